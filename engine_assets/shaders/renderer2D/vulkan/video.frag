@@ -0,0 +1,135 @@
+#version 450 core
+
+layout (location = 0) out vec4 o_Color;
+layout (location = 1) out int o_EntityID;
+
+struct VertexOutput {
+    vec4 Color;
+    vec2 TexCoord;
+};
+
+layout (location = 0) in VertexOutput i_Vertex;
+layout (location = 2) in flat float i_TexIndex;
+layout (location = 3) in flat float i_ChromaIndex;
+layout (location = 4) in flat float i_Layout;
+layout (location = 5) in flat int i_EntityID;
+
+layout (binding = 1) uniform sampler2D u_Textures[32];
+
+// convert color space to linear!
+vec4 sRGBToLinear(vec4 srgbColor) {
+    vec4 linearColor;
+    linearColor.r = (srgbColor.r <= 0.04045) ? (srgbColor.r / 12.92) : pow((srgbColor.r + 0.055) / 1.055, 2.4);
+    linearColor.g = (srgbColor.g <= 0.04045) ? (srgbColor.g / 12.92) : pow((srgbColor.g + 0.055) / 1.055, 2.4);
+    linearColor.b = (srgbColor.b <= 0.04045) ? (srgbColor.b / 12.92) : pow((srgbColor.b + 0.055) / 1.055, 2.4);
+    linearColor.a = srgbColor.a;
+    return linearColor;
+}
+
+vec4 texel(int index, ivec2 pos) {
+    vec4 tex;
+    switch (index) {
+        case 0: tex = texelFetch(u_Textures[0], pos, 0); break;
+        case 1: tex = texelFetch(u_Textures[1], pos, 0); break;
+        case 2: tex = texelFetch(u_Textures[2], pos, 0); break;
+        case 3: tex = texelFetch(u_Textures[3], pos, 0); break;
+        case 4: tex = texelFetch(u_Textures[4], pos, 0); break;
+        case 5: tex = texelFetch(u_Textures[5], pos, 0); break;
+        case 6: tex = texelFetch(u_Textures[6], pos, 0); break;
+        case 7: tex = texelFetch(u_Textures[7], pos, 0); break;
+        case 8: tex = texelFetch(u_Textures[8], pos, 0); break;
+        case 9: tex = texelFetch(u_Textures[9], pos, 0); break;
+        case 10: tex = texelFetch(u_Textures[10], pos, 0); break;
+        case 11: tex = texelFetch(u_Textures[11], pos, 0); break;
+        case 12: tex = texelFetch(u_Textures[12], pos, 0); break;
+        case 13: tex = texelFetch(u_Textures[13], pos, 0); break;
+        case 14: tex = texelFetch(u_Textures[14], pos, 0); break;
+        case 15: tex = texelFetch(u_Textures[15], pos, 0); break;
+        case 16: tex = texelFetch(u_Textures[16], pos, 0); break;
+        case 17: tex = texelFetch(u_Textures[17], pos, 0); break;
+        case 18: tex = texelFetch(u_Textures[18], pos, 0); break;
+        case 19: tex = texelFetch(u_Textures[19], pos, 0); break;
+        case 20: tex = texelFetch(u_Textures[20], pos, 0); break;
+        case 21: tex = texelFetch(u_Textures[21], pos, 0); break;
+        case 22: tex = texelFetch(u_Textures[22], pos, 0); break;
+        case 23: tex = texelFetch(u_Textures[23], pos, 0); break;
+        case 24: tex = texelFetch(u_Textures[24], pos, 0); break;
+        case 25: tex = texelFetch(u_Textures[25], pos, 0); break;
+        case 26: tex = texelFetch(u_Textures[26], pos, 0); break;
+        case 27: tex = texelFetch(u_Textures[27], pos, 0); break;
+        case 28: tex = texelFetch(u_Textures[28], pos, 0); break;
+        case 29: tex = texelFetch(u_Textures[29], pos, 0); break;
+        case 30: tex = texelFetch(u_Textures[30], pos, 0); break;
+        case 31: tex = texelFetch(u_Textures[31], pos, 0); break;
+    }
+    return tex;
+}
+
+ivec2 texSize(int index) {
+    ivec2 size;
+    switch (index) {
+        case 0: size = textureSize(u_Textures[0], 0); break;
+        case 1: size = textureSize(u_Textures[1], 0); break;
+        case 2: size = textureSize(u_Textures[2], 0); break;
+        case 3: size = textureSize(u_Textures[3], 0); break;
+        case 4: size = textureSize(u_Textures[4], 0); break;
+        case 5: size = textureSize(u_Textures[5], 0); break;
+        case 6: size = textureSize(u_Textures[6], 0); break;
+        case 7: size = textureSize(u_Textures[7], 0); break;
+        case 8: size = textureSize(u_Textures[8], 0); break;
+        case 9: size = textureSize(u_Textures[9], 0); break;
+        case 10: size = textureSize(u_Textures[10], 0); break;
+        case 11: size = textureSize(u_Textures[11], 0); break;
+        case 12: size = textureSize(u_Textures[12], 0); break;
+        case 13: size = textureSize(u_Textures[13], 0); break;
+        case 14: size = textureSize(u_Textures[14], 0); break;
+        case 15: size = textureSize(u_Textures[15], 0); break;
+        case 16: size = textureSize(u_Textures[16], 0); break;
+        case 17: size = textureSize(u_Textures[17], 0); break;
+        case 18: size = textureSize(u_Textures[18], 0); break;
+        case 19: size = textureSize(u_Textures[19], 0); break;
+        case 20: size = textureSize(u_Textures[20], 0); break;
+        case 21: size = textureSize(u_Textures[21], 0); break;
+        case 22: size = textureSize(u_Textures[22], 0); break;
+        case 23: size = textureSize(u_Textures[23], 0); break;
+        case 24: size = textureSize(u_Textures[24], 0); break;
+        case 25: size = textureSize(u_Textures[25], 0); break;
+        case 26: size = textureSize(u_Textures[26], 0); break;
+        case 27: size = textureSize(u_Textures[27], 0); break;
+        case 28: size = textureSize(u_Textures[28], 0); break;
+        case 29: size = textureSize(u_Textures[29], 0); break;
+        case 30: size = textureSize(u_Textures[30], 0); break;
+        case 31: size = textureSize(u_Textures[31], 0); break;
+    }
+    return size;
+}
+
+// BT.601 limited range, with the integer coefficients of the CPU conversion.
+vec3 yuvToRgb(vec3 yuv) {
+    vec3 cde = round(yuv * 255.0) - vec3(16.0, 128.0, 128.0);
+    vec3 rgb = vec3(298.0 * cde.x + 409.0 * cde.z,
+                    298.0 * cde.x - 100.0 * cde.y - 208.0 * cde.z,
+                    298.0 * cde.x + 516.0 * cde.y);
+    return clamp(floor((rgb + 128.0) / 256.0), 0.0, 255.0) / 255.0;
+}
+
+void main() {
+    int lumaIndex = int(i_TexIndex);
+    ivec2 size = texSize(lumaIndex);
+    ivec2 pos = clamp(ivec2(i_Vertex.TexCoord * vec2(size)), ivec2(0), size - 1);
+    vec3 yuv;
+    yuv.x = texel(lumaIndex, pos).r;
+    if (int(i_Layout) == 1) {
+        // NV12: chroma of each 2x2 block in the half size plane.
+        yuv.yz = texel(int(i_ChromaIndex), pos / 2).rg;
+    } else {
+        // YUYV: U on the even pixels and V on the odd ones, neutral V for the last pixel of odd rows.
+        int even = pos.x - pos.x % 2;
+        yuv.y = texel(lumaIndex, ivec2(even, pos.y)).g;
+        yuv.z = even + 1 < size.x ? texel(lumaIndex, ivec2(even + 1, pos.y)).g : 128.0 / 255.0;
+    }
+    o_Color = sRGBToLinear(i_Vertex.Color) * vec4(yuvToRgb(yuv), 1.0);
+    if (o_Color.a == 0)discard;
+
+    o_EntityID = i_EntityID;
+}
@@ -12,8 +12,13 @@
 
 #include "Environment.h"
 #include "core/external/yaml.h"
+#include "debug/FrameProfiler.h"
+#include "debug/HeapProfiler.h"
 #include "input/Input.h"
 #include "renderer/Renderer.h"
+#include "renderer/Renderer2D.h"
+#include "renderer/utils/ShaderCache.h"
+#include "renderer/utils/shaderFileUtils.h"
 #include "sound/SoundSystem.h"
 
 namespace owl::core {
@@ -21,7 +26,8 @@ namespace owl::core {
 
 Application* Application::s_instance = nullptr;
 
-Application::Application(AppParams iAppParams) : m_initParams{std::move(iAppParams)} {
+Application::Application(AppParams iAppParams)
+	: m_initParams{std::move(iAppParams)}, m_creationTime{std::chrono::steady_clock::now()} {
 	OWL_PROFILE_FUNCTION()
 
 	OWL_CORE_ASSERT(!s_instance, "Application already exists!")
@@ -52,6 +58,10 @@ Application::Application(AppParams iAppParams) : m_initParams{std::move(iAppPara
 		}
 
 		Log::setFrameFrequency(m_initParams.frameLogFrequency);
+		if (m_initParams.heapSamplingInterval > 0)
+			debug::HeapProfiler::start(m_initParams.heapSamplingInterval);
+		for (const auto& [scope, budget]: m_initParams.frameBudgets) debug::FrameProfiler::setBudget(scope, budget);
+		debug::FrameProfiler::setEnabled(m_initParams.frameProfiler);
 	}
 	// Looking for asset Directories
 	{
@@ -81,97 +91,140 @@ Application::Application(AppParams iAppParams) : m_initParams{std::move(iAppPara
 #endif
 	}
 
-	// Create the renderer
-	{
-		renderer::RenderCommand::create(m_initParams.renderer);
-		// check renderer creation
-		if (renderer::RenderCommand::getState() != renderer::RenderAPI::State::Created) {
-			OWL_CORE_ERROR("ERROR while Creating Renderer")
-			m_state = State::Error;
-			return;
-		}
-		// wait for all asynchron tasks
-		m_scheduler.waitEmptyQueue();
-	}
-
-	// create main window
-	{
-		mp_appWindow = input::Window::create({
-				.winType = m_initParams.isDummy ? input::Type::Null : input::Type::GLFW,
-				.title = m_initParams.name,
-				.iconPath =
-						m_initParams.icon.empty()
-								? ""
-								: renderer::Renderer::getTextureLibrary().find(m_initParams.icon).value_or("").string(),
-				.width = m_initParams.width,
-				.height = m_initParams.height,
-		});
-		input::Input::init();
-		OWL_CORE_INFO("Window Created.")
-	}
-
-	// initialize the renderer
-	{
-		renderer::Renderer::init();
-		// check renderer initialization
-		if (renderer::RenderCommand::getState() != renderer::RenderAPI::State::Ready) {
-			OWL_CORE_ERROR("ERROR while Initializing Renderer")
-			m_state = State::Error;
-			return;
-		}
-		// wait for all asynchron tasks
-		m_scheduler.waitEmptyQueue();
-		OWL_CORE_INFO("Renderer initiated.")
+	if (!initSubsystems()) {
+		m_state = State::Error;
+		return;
 	}
-
+	m_state = State::Running;
 	// set up the callbacks
 	mp_appWindow->setEventCallback([this]<typename T0>(T0&& ioPh1) { onEvent(std::forward<T0>(ioPh1)); });
+	// wait for all asynchron tasks
+	m_scheduler.waitEmptyQueue();
+
+	OWL_CORE_TRACE("Application creation done.")
+}
+
+auto Application::initSubsystems() -> bool {
+	OWL_PROFILE_FUNCTION()
 
+	// The graphic context work stays in the main thread, the rest runs in worker threads.
+	task::TaskGraph graph;
+	using enum task::TaskGraph::Affinity;
+	graph.add(
+			"renderer create",
+			[this] {
+				renderer::RenderCommand::create(m_initParams.renderer);
+				// check renderer creation
+				if (renderer::RenderCommand::getState() != renderer::RenderAPI::State::Created) {
+					OWL_CORE_ERROR("ERROR while Creating Renderer")
+					return false;
+				}
+				renderer::Renderer::initLibraries();
+				return true;
+			},
+			{}, Main);
+	graph.add("asset index", [this] {
+		std::vector<std::filesystem::path> directories;
+		for (const auto& [title, assetsPath]: m_assetDirectories) directories.push_back(assetsPath);
+		m_assetIndex.build(directories);
+		return true;
+	});
+	graph.add(
+			"shader compile",
+			[] {
+				if (renderer::RenderCommand::requireInit())
+					renderer::utils::ShaderCache::get().open(renderer::utils::getShaderCacheFile());
+				renderer::Renderer2D::precompileShaders();
+				return true;
+			},
+			{"renderer create"});
+	graph.add(
+			"window",
+			[this] {
+				mp_appWindow = input::Window::create({
+						.winType = m_initParams.isDummy ? input::Type::Null : input::Type::GLFW,
+						.title = m_initParams.name,
+						.iconPath = m_initParams.icon.empty() ? ""
+															  : renderer::Renderer::getTextureLibrary()
+																		.find(m_initParams.icon)
+																		.value_or("")
+																		.string(),
+						.width = m_initParams.width,
+						.height = m_initParams.height,
+				});
+				input::Input::init();
+				OWL_CORE_INFO("Window Created.")
+				return true;
+			},
+			{"renderer create"}, Main);
+	graph.add(
+			"renderer init",
+			[this] {
+				renderer::Renderer::init();
+				// check renderer initialization
+				if (renderer::RenderCommand::getState() != renderer::RenderAPI::State::Ready) {
+					OWL_CORE_ERROR("ERROR while Initializing Renderer")
+					return false;
+				}
+				renderer::Renderer::getTextureLibrary().setMemoryBudget(m_initParams.textureMemoryBudget);
+				OWL_CORE_INFO("Renderer initiated.")
+				return true;
+			},
+			{"window", "shader compile"}, Main);
 	// create the GUI layer
 	if (m_initParams.hasGui) {
-		mp_imGuiLayer = mkShared<gui::UiLayer>();
-		pushOverlay(mp_imGuiLayer);
-
-		// applying the theme.
-		if (const auto defaultTheme = m_workingDirectory / "theme.yml"; exists(defaultTheme)) {
-			gui::Theme theme;
-			theme.loadFromFile(defaultTheme);
-			gui::UiLayer::setTheme(theme);
-		}
-		// wait for all asynchron tasks
-		m_scheduler.waitEmptyQueue();
-
-		OWL_CORE_TRACE("GUI Layer created.")
+		graph.add(
+				"gui",
+				[this] {
+					mp_imGuiLayer = mkShared<gui::UiLayer>();
+					pushOverlay(mp_imGuiLayer);
+					// applying the theme.
+					if (const auto defaultTheme = m_workingDirectory / "theme.yml"; exists(defaultTheme)) {
+						gui::Theme theme;
+						theme.loadFromFile(defaultTheme);
+						gui::UiLayer::setTheme(theme);
+					}
+					OWL_CORE_TRACE("GUI Layer created.")
+					return true;
+				},
+				{"renderer init"}, Main);
 	}
-
-	// Create the sound system
-	{
+	graph.add("sound", [this] {
 		sound::SoundCommand::create(m_initParams.isDummy ? sound::SoundAPI::Type::Null : m_initParams.sound);
 		// check sound system creation
 		if (sound::SoundCommand::getState() != sound::SoundAPI::State::Created) {
 			OWL_CORE_ERROR("ERROR while Creating Sound system")
-			m_state = State::Error;
-			return;
+			return false;
 		}
 		sound::SoundSystem::init();
 		// check sound system initialization
 		if (sound::SoundCommand::getState() != sound::SoundAPI::State::Ready) {
 			OWL_CORE_ERROR("ERROR while Initializing Sound system")
-			m_state = State::Error;
-			return;
+			return false;
 		}
-		// wait for all asynchron tasks
-		m_scheduler.waitEmptyQueue();
 		OWL_CORE_INFO("Sound system initiated.")
+		return true;
+	});
+	graph.add("font atlas", [this] {
+		m_fontLibrary.prepare();
+		return true;
+	});
+	graph.add(
+			"font upload",
+			[this] {
+				m_fontLibrary.createTextures();
+				return true;
+			},
+			{"font atlas", "renderer init"}, Main);
+
+	const bool success = graph.run();
+	m_startupTrace = graph.getTimings();
+	for (const auto& [name, affinity, start, duration, taskSuccess]: m_startupTrace) {
+		OWL_CORE_INFO("Startup: {:<16} {:>9.2f} ms (at {:>9.2f} ms, {} thread){}", name, duration, start,
+					  affinity == Main ? "main" : "worker", taskSuccess ? "" : " FAILED")
 	}
-
-	// update the state here. (required for font initialization)
-	m_state = State::Running;
-	m_fontLibrary.init();
-	// wait for all asynchron tasks
-	m_scheduler.waitEmptyQueue();
-
-	OWL_CORE_TRACE("Application creation done.")
+	OWL_CORE_INFO("Startup: subsystems initialized in {:.2f} ms", graph.getDuration())
+	return success;
 }
 
 void Application::enableDocking() const {
@@ -190,13 +243,18 @@ Application::~Application() {
 	if (renderer::RenderCommand::getState() != renderer::RenderAPI::State::Error) {
 		m_layerStack.clear();
 		input::Input::invalidate();
-		mp_appWindow->shutdown();
+		if (mp_appWindow)
+			mp_appWindow->shutdown();
 		OWL_CORE_TRACE("Application window shut down.")
 		renderer::Renderer::shutdown();
 		renderer::RenderCommand::invalidate();
 		OWL_CORE_TRACE("Renderer shut down and invalidated.")
 		mp_appWindow.reset();
 	}
+	if (debug::HeapProfiler::isRunning()) {
+		debug::HeapProfiler::stop();
+		debug::HeapProfiler::exportFoldedStacks(m_workingDirectory / "heap_profile.folded");
+	}
 	invalidate();
 }
 
@@ -210,6 +268,7 @@ void Application::run() {
 #if OWL_TRACKER_VERBOSITY >= 3
 	uint64_t frameCount = 0;
 #endif
+	bool firstFrame = true;
 	while (m_state == State::Running) {
 		OWL_PROFILE_SCOPE("RunLoop")
 		OWL_CORE_FRAME_ADVANCE
@@ -235,6 +294,8 @@ void Application::run() {
 				mp_imGuiLayer->end();
 			}
 			renderer::RenderCommand::endFrame();
+			// release the unused textures if over budget.
+			renderer::Renderer::getTextureLibrary().trim();
 		}
 
 		// sound part
@@ -249,6 +310,16 @@ void Application::run() {
 		mp_appWindow->onUpdate();
 
 		m_scheduler.frame(m_stepper);
+		debug::HeapProfiler::frame();
+		debug::FrameProfiler::frame();
+
+		if (firstFrame) {
+			firstFrame = false;
+			const auto elapsed = std::chrono::steady_clock::now() - m_creationTime;
+			OWL_CORE_INFO("Startup: time to first frame {:.2f} ms",
+						  static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()) /
+								  1000.0)
+		}
 
 #if OWL_TRACKER_VERBOSITY >= 3
 		{
@@ -260,7 +331,7 @@ void Application::run() {
 				OWL_CORE_TRACE("")
 				OWL_CORE_TRACE(" LEAK Amount: {} in {} Unallocated chunks", memState.allocatedMemory.str(),
 							   memState.allocs.size())
-				for (const auto& chunk: memState.allocs) { OWL_CORE_TRACE(" ** {}", chunk.toStr()) }
+				for (const auto& chunk: memState.allocs.snapshot()) { OWL_CORE_TRACE(" ** {}", chunk.toStr()) }
 				OWL_CORE_TRACE("----------------------------------")
 				OWL_CORE_TRACE("")
 			}
@@ -355,6 +426,10 @@ void AppParams::loadFromFile(const std::filesystem::path& iFile) {
 		get(appConfig, "hasGui", hasGui);
 		get(appConfig, "useDebugging", useDebugging);
 		get(appConfig, "frameLogFrequency", frameLogFrequency);
+		get(appConfig, "textureMemoryBudget", textureMemoryBudget);
+		get(appConfig, "heapSamplingInterval", heapSamplingInterval);
+		get(appConfig, "frameProfiler", frameProfiler);
+		get(appConfig, "frameBudgets", frameBudgets);
 	}
 }
 
@@ -370,6 +445,12 @@ void AppParams::saveToFile(const std::filesystem::path& iFile) const {
 	out << YAML::Key << "hasGui" << YAML::Value << hasGui;
 	out << YAML::Key << "useDebugging" << YAML::Value << useDebugging;
 	out << YAML::Key << "frameLogFrequency" << YAML::Value << frameLogFrequency;
+	out << YAML::Key << "textureMemoryBudget" << YAML::Value << textureMemoryBudget;
+	out << YAML::Key << "heapSamplingInterval" << YAML::Value << heapSamplingInterval;
+	out << YAML::Key << "frameProfiler" << YAML::Value << frameProfiler;
+	out << YAML::Key << "frameBudgets" << YAML::Value << YAML::BeginMap;
+	for (const auto& [scope, budget]: frameBudgets) out << YAML::Key << scope << YAML::Value << budget;
+	out << YAML::EndMap;
 
 	out << YAML::EndMap;
 	out << YAML::EndMap;
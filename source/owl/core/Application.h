@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Timestep.h"
+#include "assets/AssetIndex.h"
 #include "event/AppEvent.h"
 #include "fonts/FontLibrary.h"
 #include "gui/UiLayer.h"
@@ -18,6 +19,7 @@
 #include "sound/SoundAPI.h"
 #include "task/Scheduler.h"
 #include "task/Task.h"
+#include "task/TaskGraph.h"
 
 #include <filesystem>
 #include <list>
@@ -40,6 +42,12 @@ struct OWL_API AppParams {
 	char** args{nullptr};
 	/// The frequency for the frame debugging
 	uint64_t frameLogFrequency{0};
+	/// Memory budget for the textures in bytes (0 means no limit).
+	uint64_t textureMemoryBudget{0};
+	/// Mean number of allocated bytes between two samples of the heap profiler (0 means disabled).
+	uint64_t heapSamplingInterval{0};
+	/// Budgets of the frame profiler in milliseconds by scope name ("Frame" for the whole frame).
+	std::map<std::string, double> frameBudgets{};
 	/// Application's title.
 	std::string name{"Owl Engine"};
 	/// Application's assets pattern.
@@ -62,6 +70,8 @@ struct OWL_API AppParams {
 	bool useDebugging{false};
 	/// Run application in Dummy mode.
 	bool isDummy{false};
+	/// If the frame profiler records from the start (it can be toggled with F3 when there is a gui).
+	bool frameProfiler{false};
 
 	/**
 	 * @brief Access to the given command line argument.
@@ -253,7 +263,33 @@ public:
 	 */
 	[[nodiscard]] auto getTaskScheduler() const -> const task::Scheduler& { return m_scheduler; }
 
+	/**
+	 * @brief Access to the index of the asset directories.
+	 * @return The asset index.
+	 */
+	[[nodiscard]] auto getAssetIndex() const -> const assets::AssetIndex& { return m_assetIndex; }
+
+	/**
+	 * @brief Access to the index of the asset directories.
+	 * @return The asset index.
+	 */
+	[[nodiscard]] auto getAssetIndex() -> assets::AssetIndex& { return m_assetIndex; }
+
+	/**
+	 * @brief Get the timings of the application's initialization phases.
+	 * @return The startup trace, in order of completion.
+	 */
+	[[nodiscard]] auto getStartupTrace() const -> const std::vector<task::TaskGraph::Timing>& {
+		return m_startupTrace;
+	}
+
 private:
+	/**
+	 * @brief Initialize the subsystems, concurrently when possible.
+	 * @return True if succeeded.
+	 */
+	auto initSubsystems() -> bool;
+
 	/**
 	 * @brief Helper function used to search for assets location.
 	 * @param[in] iPattern The pattern to search for.
@@ -304,6 +340,12 @@ private:
 	static Application* s_instance;
 	/// The task Scheduler.
 	task::Scheduler m_scheduler;
+	/// Index of the asset directories.
+	assets::AssetIndex m_assetIndex;
+	/// Timings of the initialization phases.
+	std::vector<task::TaskGraph::Timing> m_startupTrace;
+	/// Beginning of the application creation.
+	std::chrono::steady_clock::time_point m_creationTime;
 
 	/// Mark the main entrypoint function as friend.
 	friend auto ::main(int iArgc, char** iArgv) -> int;
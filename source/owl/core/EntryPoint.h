@@ -19,7 +19,7 @@
  */
 // NOLINTBEGIN(misc-definitions-in-headers)
 auto main(int iArgc, char* iArgv[]) -> int {
-	owl::core::Log::init();
+	owl::core::Log::init(spdlog::level::trace, owl::core::gDefaultFrequency, owl::core::Log::Mode::Asynchronous);
 	{
 		// Startup
 		OWL_PROFILE_BEGIN_SESSION("Startup", "OwlProfile-startup.json")
@@ -46,7 +46,7 @@ auto main(int iArgc, char* iArgv[]) -> int {
 				OWL_CORE_TRACE(" LEAK Amount: {} in {} Unallocated chunks", memState.allocatedMemory.str(),
 							   memState.allocs.size())
 #if OWL_TRACKER_VERBOSITY >= 2
-				for (const auto& chunk: memState.allocs) { OWL_CORE_TRACE(" ** {}", chunk.toStr()) }
+				for (const auto& chunk: memState.allocs.snapshot()) { OWL_CORE_TRACE(" ** {}", chunk.toStr()) }
 #endif
 				OWL_CORE_TRACE("----------------------------------")
 				OWL_CORE_TRACE("")
@@ -69,7 +69,7 @@ auto main(int iArgc, char* iArgv[]) -> int {
 #if OWL_TRACKER_VERBOSITY >= 2
 		if (memoryState.allocationCalls > memoryState.deallocationCalls) {
 			OWL_CORE_INFO("Remaining memory chunks  :", memoryState.allocationCalls)
-			for (const auto& alloc: memoryState.allocs) { OWL_CORE_INFO("* {}", alloc.toStr(false, false)) }
+			for (const auto& alloc: memoryState.allocs.snapshot()) { OWL_CORE_INFO("* {}", alloc.toStr(false, false)) }
 		}
 #endif
 	}
@@ -11,65 +11,156 @@
 OWL_DIAG_PUSH
 OWL_DIAG_DISABLE_CLANG("-Wweak-vtables")
 OWL_DIAG_DISABLE_CLANG("-Wundefined-func-template")
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 OWL_DIAG_POP
 
-
 namespace owl::core {
 
+namespace {
+
+/**
+ * @brief Logger tagging the records with the logging frame before giving them to the logger owning the sinks.
+ *
+ * The tag is added by the caller: in asynchronous mode, the backend formats the records later.
+ */
+class FrameTaggedLogger final : public spdlog::logger {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param[in] iName Name of the logger.
+	 * @param[in] iBackend The logger writing to the sinks.
+	 */
+	FrameTaggedLogger(std::string iName, shared<spdlog::logger> iBackend)
+		: logger{std::move(iName)}, m_backend{std::move(iBackend)} {}
+
+protected:
+	void sink_it_(const spdlog::details::log_msg& iMsg) override {
+		spdlog::memory_buf_t buffer;
+		fmt::format_to(std::back_inserter(buffer), "#{} ", Log::getFrame());
+		buffer.append(iMsg.payload.begin(), iMsg.payload.end());
+		m_backend->log(iMsg.time, iMsg.source, iMsg.level, {buffer.data(), buffer.size()});
+	}
+	void flush_() override { m_backend->flush(); }
+
+private:
+	/// The logger writing to the sinks.
+	shared<spdlog::logger> m_backend;
+};
+
+/**
+ * @brief Create a logger.
+ * @param[in] iName Name of the logger.
+ * @param[in] iSinks The sinks.
+ * @param[in] iThreadPool The thread writing the records, null for synchronous logging.
+ * @return The logger.
+ */
+auto makeLogger(const std::string& iName, const std::vector<spdlog::sink_ptr>& iSinks,
+				const shared<spdlog::details::thread_pool>& iThreadPool) -> shared<spdlog::logger> {
+	shared<spdlog::logger> backend;
+	if (iThreadPool)
+		backend = std::make_shared<spdlog::async_logger>(iName, iSinks.begin(), iSinks.end(), iThreadPool,
+														 spdlog::async_overflow_policy::overrun_oldest);
+	else
+		backend = std::make_shared<spdlog::logger>(iName, iSinks.begin(), iSinks.end());
+	backend->set_level(spdlog::level::trace);
+	return std::make_shared<FrameTaggedLogger>(iName, backend);
+}
+
+}// namespace
 std::shared_ptr<spdlog::logger> Log::s_coreLogger;
 std::shared_ptr<spdlog::logger> Log::s_clientLogger;
 spdlog::level::level_enum Log::s_verbosity = spdlog::level::trace;
-uint64_t Log::s_frameCounter = 0;
+std::atomic<uint64_t> Log::s_frameCounter = 0;
 uint64_t Log::s_frequency = gDefaultFrequency;
+Log::Mode Log::s_mode = Mode::Synchronous;
+shared<spdlog::details::thread_pool> Log::s_threadPool;
+std::vector<spdlog::sink_ptr> Log::s_sinks;
 
-void Log::init(const spdlog::level::level_enum& iLevel, const uint64_t iFrequency) {
+void Log::init(const spdlog::level::level_enum& iLevel, const uint64_t iFrequency, const Mode iMode,
+			   const size_t iQueueSize) {
 	OWL_SCOPE_UNTRACK
 	if (s_coreLogger != nullptr) {
 		OWL_CORE_INFO("Logger already initiated.")
 		return;
 	}
-	std::vector<spdlog::sink_ptr> logSinks;
-	logSinks.emplace_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
+	std::vector<spdlog::sink_ptr> logSinks = s_sinks;
+	if (logSinks.empty()) {
+		logSinks.emplace_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
 #ifdef WIN32
-	logSinks.emplace_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>(L"Owl.log", true));
+		logSinks.emplace_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>(L"Owl.log", true));
 #else
-	logSinks.emplace_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>("Owl.log", true));
+		logSinks.emplace_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>("Owl.log", true));
 #endif
+		logSinks[0]->set_pattern("%^[%T] %n: %v%$");
+		logSinks[1]->set_pattern("[%T] [%l] %n: %v");
+	}
 
-	logSinks[0]->set_pattern("%^[%T] %n: %v%$");
-	logSinks[1]->set_pattern("[%T] [%l] %n: %v");
+	s_mode = iMode;
+	if (s_mode == Mode::Asynchronous)
+		s_threadPool = std::make_shared<spdlog::details::thread_pool>(std::max<size_t>(iQueueSize, 1), 1);
 
-	s_coreLogger = std::make_shared<spdlog::logger>("OWL", begin(logSinks), end(logSinks));
+	s_coreLogger = makeLogger("OWL", logSinks, s_threadPool);
 	spdlog::register_logger(s_coreLogger);
 
-	s_clientLogger = std::make_shared<spdlog::logger>("APP", begin(logSinks), end(logSinks));
+	s_clientLogger = makeLogger("APP", logSinks, s_threadPool);
 	spdlog::register_logger(s_clientLogger);
 	setVerbosityLevel(iLevel);
+	if (s_mode == Mode::Asynchronous)
+		spdlog::flush_every(std::chrono::seconds(1));
 	s_frameCounter = 0;
 	s_frequency = iFrequency;
 }
 
 void Log::setVerbosityLevel(const spdlog::level::level_enum& iLevel) {
 	s_verbosity = iLevel;
+	// in asynchronous mode, the flush of the low level records is left to the periodic flusher.
+	const auto flushLevel = s_mode == Mode::Asynchronous ? std::max(s_verbosity, spdlog::level::warn) : s_verbosity;
 	if (s_coreLogger) {
 		s_coreLogger->set_level(s_verbosity);
-		s_coreLogger->flush_on(s_verbosity);
+		s_coreLogger->flush_on(flushLevel);
 	}
 	if (s_clientLogger) {
 		s_clientLogger->set_level(s_verbosity);
-		s_clientLogger->flush_on(s_verbosity);
+		s_clientLogger->flush_on(flushLevel);
 	}
 }
 
 void Log::invalidate() {
 	OWL_SCOPE_UNTRACK
+	flush();
+	// a null period stops the periodic flusher thread.
+	if (s_mode == Mode::Asynchronous)
+		spdlog::flush_every(std::chrono::seconds::zero());
 	spdlog::drop_all();
 	s_coreLogger.reset();
 	s_clientLogger.reset();
+	// the destruction of the thread pool waits for the queued records to be written.
+	s_threadPool.reset();
+	s_mode = Mode::Synchronous;
+}
+
+void Log::flush() {
+	if (s_coreLogger)
+		s_coreLogger->flush();
+	if (s_clientLogger)
+		s_clientLogger->flush();
 }
 
-void Log::newFrame() { ++s_frameCounter; }
+auto Log::getDroppedRecords() -> size_t { return s_threadPool ? s_threadPool->overrun_counter() : 0; }
+
+void Log::newFrame() { s_frameCounter.fetch_add(1, std::memory_order_relaxed); }
+
+auto LogLimiter::allow() -> bool {
+	const uint64_t frame = Log::getFrame();
+	uint64_t next = m_nextFrame.load(std::memory_order_relaxed);
+	const uint64_t allowedNext = m_interval == 0 ? std::numeric_limits<uint64_t>::max() : frame + m_interval;
+	if (frame < next || !m_nextFrame.compare_exchange_strong(next, allowedNext, std::memory_order_relaxed)) {
+		m_suppressed.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	return true;
+}
 
 }// namespace owl::core
@@ -18,19 +18,42 @@ namespace owl::core {
 
 /// Default frequency for frame output.
 constexpr uint64_t gDefaultFrequency{100};
+/// Maximal number of messages waiting in the asynchronous logging queue.
+constexpr size_t gAsyncQueueSize{8192};
 
 /**
  * @brief Logging system.
+ *
+ * Each record is tagged with the number of the frame (`#frame`) it has been emitted in. In asynchronous mode, the
+ * records are written to the sinks by a background thread: when the queue is full the oldest records are dropped
+ * rather than blocking the caller, only warnings and errors are flushed immediately, the others every second.
  */
 class OWL_API Log {
 public:
+	/// The logging modes.
+	enum struct Mode : uint8_t {
+		/// The records are written and flushed by the caller.
+		Synchronous,
+		/// The records are written by a background thread.
+		Asynchronous
+	};
+
 	/**
 	 * @brief initialize the logging system.
 	 * @param[in] iLevel Verbosity level of the logger.
 	 * @param[in] iFrequency Frequency of frame output (number of frames).
+	 * @param[in] iMode The logging mode.
+	 * @param[in] iQueueSize Maximal number of records waiting in the asynchronous queue.
 	 */
 	static void init(const spdlog::level::level_enum& iLevel = spdlog::level::trace,
-					 uint64_t iFrequency = gDefaultFrequency);
+					 uint64_t iFrequency = gDefaultFrequency, Mode iMode = Mode::Synchronous,
+					 size_t iQueueSize = gAsyncQueueSize);
+
+	/**
+	 * @brief Define the sinks used by the next initializations, instead of the console and the log file.
+	 * @param[in] iSinks The sinks, empty for the default ones.
+	 */
+	static void setSinks(const std::vector<spdlog::sink_ptr>& iSinks) { s_sinks = iSinks; }
 
 	/**
 	 * @brief Access to the logger for the core system.
@@ -61,11 +84,36 @@ public:
 	 */
 	static auto initiated() -> bool { return s_coreLogger != nullptr; }
 
+	/**
+	 * @brief Get the logging mode.
+	 * @return The logging mode.
+	 */
+	static auto getMode() -> Mode { return s_mode; }
+
+	/**
+	 * @brief Write the pending records.
+	 *
+	 * In asynchronous mode, the records are only queued for flushing.
+	 */
+	static void flush();
+
+	/**
+	 * @brief Get the number of records dropped because the asynchronous queue was full.
+	 * @return The number of dropped records.
+	 */
+	static auto getDroppedRecords() -> size_t;
+
 	/**
 	 * @brief To know if in logging frame.
 	 * @return True if in logging frame.
 	 */
-	static auto frameLog() -> bool { return s_frequency > 0 && s_frameCounter % s_frequency == 0; }
+	static auto frameLog() -> bool { return s_frequency > 0 && getFrame() % s_frequency == 0; }
+
+	/**
+	 * @brief Get the current logging frame.
+	 * @return The frame number.
+	 */
+	static auto getFrame() -> uint64_t { return s_frameCounter.load(std::memory_order_relaxed); }
 
 	/**
 	 * @brief Start a new logging frame.
@@ -86,9 +134,49 @@ private:
 	/// The level of verbosity.
 	static spdlog::level::level_enum s_verbosity;
 	/// Counter for the frames.
-	static uint64_t s_frameCounter;
+	static std::atomic<uint64_t> s_frameCounter;
 	/// Frequency of frame trace.
 	static uint64_t s_frequency;
+	/// The logging mode.
+	static Mode s_mode;
+	/// The thread writing the records in asynchronous mode.
+	static shared<spdlog::details::thread_pool> s_threadPool;
+	/// The sinks replacing the default ones.
+	static std::vector<spdlog::sink_ptr> s_sinks;
+};
+
+/**
+ * @brief Limiter of the records of a call site, based on the logging frames.
+ *
+ * Out of the frame loop (tools, tests) the frame does not advance, so a limited call site logs only once.
+ */
+class OWL_API LogLimiter final {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param[in] iFrameInterval Minimal number of frames between two records, 0 for logging only once.
+	 */
+	explicit LogLimiter(const uint64_t iFrameInterval) : m_interval{iFrameInterval} {}
+
+	/**
+	 * @brief Check if the call site can log now.
+	 * @return True if the record has to be written.
+	 */
+	auto allow() -> bool;
+
+	/**
+	 * @brief Get the number of records not written.
+	 * @return The number of records not written.
+	 */
+	[[nodiscard]] auto getSuppressed() const -> uint64_t { return m_suppressed.load(std::memory_order_relaxed); }
+
+private:
+	/// Minimal number of frames between two records.
+	uint64_t m_interval;
+	/// First frame where a record is allowed.
+	std::atomic<uint64_t> m_nextFrame{0};
+	/// Number of records not written.
+	std::atomic<uint64_t> m_suppressed{0};
 };
 }// namespace owl::core
 
@@ -105,6 +193,30 @@ private:
 #define OWL_CORE_ERROR(...) ::owl::core::Log::getCoreLogger()->error(__VA_ARGS__);
 #define OWL_CORE_CRITICAL(...) ::owl::core::Log::getCoreLogger()->critical(__VA_ARGS__);
 
+// Limited log macros
+#define OWL_LOG_LIMITED(logger, level, interval, ...)                                                                 \
+	{                                                                                                                  \
+		static ::owl::core::LogLimiter owlLogLimiter{interval};                                                        \
+		if (owlLogLimiter.allow())                                                                                     \
+			::owl::core::Log::logger()->level(__VA_ARGS__);                                                            \
+	}
+
+#define OWL_CORE_INFO_ONCE(...) OWL_LOG_LIMITED(getCoreLogger, info, 0, __VA_ARGS__)
+#define OWL_CORE_WARN_ONCE(...) OWL_LOG_LIMITED(getCoreLogger, warn, 0, __VA_ARGS__)
+#define OWL_CORE_ERROR_ONCE(...) OWL_LOG_LIMITED(getCoreLogger, error, 0, __VA_ARGS__)
+#define OWL_CORE_TRACE_THROTTLED(frames, ...) OWL_LOG_LIMITED(getCoreLogger, trace, frames, __VA_ARGS__)
+#define OWL_CORE_INFO_THROTTLED(frames, ...) OWL_LOG_LIMITED(getCoreLogger, info, frames, __VA_ARGS__)
+#define OWL_CORE_WARN_THROTTLED(frames, ...) OWL_LOG_LIMITED(getCoreLogger, warn, frames, __VA_ARGS__)
+#define OWL_CORE_ERROR_THROTTLED(frames, ...) OWL_LOG_LIMITED(getCoreLogger, error, frames, __VA_ARGS__)
+
+#define OWL_INFO_ONCE(...) OWL_LOG_LIMITED(getClientLogger, info, 0, __VA_ARGS__)
+#define OWL_WARN_ONCE(...) OWL_LOG_LIMITED(getClientLogger, warn, 0, __VA_ARGS__)
+#define OWL_ERROR_ONCE(...) OWL_LOG_LIMITED(getClientLogger, error, 0, __VA_ARGS__)
+#define OWL_TRACE_THROTTLED(frames, ...) OWL_LOG_LIMITED(getClientLogger, trace, frames, __VA_ARGS__)
+#define OWL_INFO_THROTTLED(frames, ...) OWL_LOG_LIMITED(getClientLogger, info, frames, __VA_ARGS__)
+#define OWL_WARN_THROTTLED(frames, ...) OWL_LOG_LIMITED(getClientLogger, warn, frames, __VA_ARGS__)
+#define OWL_ERROR_THROTTLED(frames, ...) OWL_LOG_LIMITED(getClientLogger, error, frames, __VA_ARGS__)
+
 // Client log macros
 #define OWL_TRACE(...) ::owl::core::Log::getClientLogger()->trace(__VA_ARGS__);
 #define OWL_INFO(...) ::owl::core::Log::getClientLogger()->info(__VA_ARGS__);
@@ -72,8 +72,10 @@ public:
 	/**
 	 * @brief Default constructor.
 	 * @param[in] iData The internal data.
+	 * @param[in] iSource The file the data has been loaded from (empty if not reloadable).
 	 */
-	explicit Asset(const shared<DataType>& iData) : m_asset{iData} {}
+	explicit Asset(const shared<DataType>& iData, std::filesystem::path iSource = {})
+		: m_asset{iData}, m_source{std::move(iSource)} {}
 
 	/**
 	 * @brief Access to the data.
@@ -81,6 +83,54 @@ public:
 	 */
 	auto get() const -> const shared<DataType>& { return m_asset; }
 
+	/**
+	 * @brief Check if the data is currently loaded.
+	 * @return True if the data is in memory.
+	 */
+	[[nodiscard]] auto isResident() const -> bool { return m_asset != nullptr; }
+
+	/**
+	 * @brief Check if the data is used outside the library.
+	 * @return True if someone else holds the data.
+	 */
+	[[nodiscard]] auto isReferenced() const -> bool { return m_asset.use_count() > 1; }
+
+	/**
+	 * @brief Check if the data can be released and loaded again later.
+	 * @return True if the asset has a source file.
+	 */
+	[[nodiscard]] auto isEvictable() const -> bool { return !m_source.empty(); }
+
+	/**
+	 * @brief Release the data, keeping the information to reload it.
+	 */
+	void evict() {
+		if (isEvictable())
+			m_asset.reset();
+	}
+
+	/**
+	 * @brief Load again the data from its source file.
+	 * @return True if the data is resident after the call.
+	 */
+	auto reload() -> bool {
+		if (!isResident() && isEvictable())
+			m_asset = DataType::create(m_source);
+		return isResident();
+	}
+
+	/**
+	 * @brief Mark the asset as used.
+	 * @param[in] iTick The current usage tick.
+	 */
+	void touch(const uint64_t iTick) { m_lastUse = iTick; }
+
+	/**
+	 * @brief Get the last usage tick.
+	 * @return The last usage tick.
+	 */
+	[[nodiscard]] auto getLastUse() const -> uint64_t { return m_lastUse; }
+
 	/**
 	 * @brief Get the list of supported file extensions for this asset type.
 	 * @return List of extensions.
@@ -90,6 +140,10 @@ public:
 private:
 	/// the real asset data;
 	shared<DataType> m_asset;
+	/// The source file of the data.
+	std::filesystem::path m_source;
+	/// The last usage tick.
+	uint64_t m_lastUse = 0;
 };
 
 }// namespace owl::core::assets
@@ -0,0 +1,109 @@
+/**
+ * @file AssetIndex.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "AssetIndex.h"
+
+namespace owl::core::assets {
+
+AssetIndex::AssetIndex() = default;
+
+AssetIndex::~AssetIndex() = default;
+
+void AssetIndex::build(const std::vector<std::filesystem::path>& iDirectories) {
+	OWL_PROFILE_FUNCTION()
+
+	m_ready.store(false, std::memory_order_release);
+	const std::lock_guard lock(m_mutex);
+	m_directories.clear();
+	size_t count = 0;
+	for (const auto& root: iDirectories) {
+		auto& directory = m_directories.emplace_back(Directory{.root = root, .files = {}, .lookup = {}});
+		if (!exists(root))
+			continue;
+		for (const auto& entry: std::filesystem::recursive_directory_iterator(root)) {
+			if (!entry.is_regular_file())
+				continue;
+			auto file = relative(entry.path(), root).generic_string();
+			directory.lookup.insert(file);
+			directory.files.push_back(std::move(file));
+			++count;
+		}
+	}
+	m_ready.store(true, std::memory_order_release);
+	OWL_CORE_TRACE("Asset index: {} files in {} directories.", count, m_directories.size())
+}
+
+void AssetIndex::insert(const std::filesystem::path& iFile) {
+	if (!isReady())
+		return;
+	const std::lock_guard lock(m_mutex);
+	for (auto& [root, files, lookup]: m_directories) {
+		const auto file = iFile.lexically_relative(root);
+		if (file.empty() || *file.begin() == "..")
+			continue;
+		if (lookup.insert(file.generic_string()).second)
+			files.push_back(file.generic_string());
+		return;
+	}
+}
+
+void AssetIndex::clear() {
+	m_ready.store(false, std::memory_order_release);
+	const std::lock_guard lock(m_mutex);
+	m_directories.clear();
+}
+
+auto AssetIndex::size() const -> size_t {
+	const std::lock_guard lock(m_mutex);
+	size_t count = 0;
+	for (const auto& directory: m_directories) count += directory.files.size();
+	return count;
+}
+
+auto AssetIndex::find(const std::filesystem::path& iName, const std::vector<std::string>& iExtensions) const
+		-> std::optional<std::filesystem::path> {
+	std::vector<std::string> candidates;
+	if (iName.has_extension()) {
+		candidates.push_back(iName.generic_string());
+	} else {
+		for (const auto& ext: iExtensions) candidates.push_back(iName.generic_string() + ext);
+	}
+	const std::lock_guard lock(m_mutex);
+	for (const auto& [root, files, lookup]: m_directories) {
+		// base folder first.
+		for (const auto& candidate: candidates) {
+			if (lookup.contains(candidate))
+				return root / candidate;
+		}
+		// then the sub-folders.
+		for (const auto& file: files) {
+			for (const auto& candidate: candidates) {
+				if (file.size() > candidate.size() && file.ends_with(candidate) &&
+					file[file.size() - candidate.size() - 1] == '/')
+					return root / file;
+			}
+		}
+	}
+	return std::nullopt;
+}
+
+auto AssetIndex::list(const std::vector<std::string>& iExtensions) const -> std::vector<std::string> {
+	std::vector<std::string> result;
+	const std::lock_guard lock(m_mutex);
+	for (const auto& directory: m_directories) {
+		for (const auto& file: directory.files) {
+			if (std::ranges::find(iExtensions, std::filesystem::path(file).extension().string()) != iExtensions.end())
+				result.push_back(std::filesystem::path(file).make_preferred().string());
+		}
+	}
+	return result;
+}
+
+}// namespace owl::core::assets
@@ -0,0 +1,106 @@
+/**
+ * @file AssetIndex.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+
+namespace owl::core::assets {
+
+/**
+ * @brief Index of the files in the asset directories, to resolve asset names without file system access.
+ *
+ * The index is built once (possibly in a worker thread), it is only read after isReady() returns true. The files
+ * created after the build are added when found by a directory scan.
+ */
+class OWL_API AssetIndex final {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	AssetIndex();
+	/**
+	 * @brief Default destructor.
+	 */
+	~AssetIndex();
+	AssetIndex(const AssetIndex&) = delete;
+	AssetIndex(AssetIndex&&) = delete;
+	auto operator=(const AssetIndex&) -> AssetIndex& = delete;
+	auto operator=(AssetIndex&&) -> AssetIndex& = delete;
+
+	/**
+	 * @brief Scan the directories and build the index.
+	 * @param[in] iDirectories The asset directories, by decreasing priority.
+	 */
+	void build(const std::vector<std::filesystem::path>& iDirectories);
+
+	/**
+	 * @brief Add a file created after the build, does nothing if the index is not ready.
+	 * @param[in] iFile The file path, outside of the indexed directories it is ignored.
+	 */
+	void insert(const std::filesystem::path& iFile);
+
+	/**
+	 * @brief Empty the index, must not be called while the index is read.
+	 */
+	void clear();
+
+	/**
+	 * @brief Check if the index can be used.
+	 * @return True if the index is built.
+	 */
+	[[nodiscard]] auto isReady() const -> bool { return m_ready.load(std::memory_order_acquire); }
+
+	/**
+	 * @brief Get the number of indexed files.
+	 * @return Number of files.
+	 */
+	[[nodiscard]] auto size() const -> size_t;
+
+	/**
+	 * @brief Find the file of an asset.
+	 * @param[in] iName Name of the asset, relative to an asset directory or to one of its sub-directories.
+	 * @param[in] iExtensions Extensions to try if the name has none.
+	 * @return The file path, or nullopt if not found.
+	 */
+	[[nodiscard]] auto find(const std::filesystem::path& iName, const std::vector<std::string>& iExtensions) const
+			-> std::optional<std::filesystem::path>;
+
+	/**
+	 * @brief List the files with the given extensions.
+	 * @param[in] iExtensions The extensions to look for.
+	 * @return Paths relative to their asset directory.
+	 */
+	[[nodiscard]] auto list(const std::vector<std::string>& iExtensions) const -> std::vector<std::string>;
+
+private:
+	/**
+	 * @brief Content of an asset directory.
+	 */
+	struct Directory {
+		/// The asset directory.
+		std::filesystem::path root;
+		/// The files relative to the root (generic format).
+		std::vector<std::string> files;
+		/// Fast lookup of the files.
+		std::unordered_set<std::string> lookup;
+	};
+	/// The indexed directories.
+	std::vector<Directory> m_directories;
+	/// Protect the directories against the insertions.
+	mutable std::mutex m_mutex;
+	/// If the index is built.
+	std::atomic<bool> m_ready{false};
+};
+
+}// namespace owl::core::assets
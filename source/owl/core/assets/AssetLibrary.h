@@ -20,6 +20,14 @@ concept HasStringSpec = requires {
 	{ T::stringToSpecification(std::declval<const std::string&>()) } -> std::same_as<typename T::Specification>;
 };
 
+/**
+ * @brief Concept that check existence of a function giving the memory footprint of the data.
+ */
+template<typename T>
+concept HasMemorySize = requires(const T& iData) {
+	{ iData.getMemorySize() } -> std::convertible_to<size_t>;
+};
+
 /**
  * @brief Namespace for asset management.
  */
@@ -68,7 +76,7 @@ public:
 	 * @param[in] iName Name of the asset.
 	 * @param[in] iAsset The asset to add.
 	 */
-	void add(const std::string& iName, shared<DataType>& iAsset) { m_assets.emplace(iName, assetType{iAsset}); }
+	void add(const std::string& iName, shared<DataType>& iAsset) { add(iName, iAsset, {}); }
 
 	/**
 	 * @brief Load an asset from a file base on name.
@@ -78,16 +86,18 @@ public:
 	auto load(const std::string& iName) -> shared<DataType> {
 		if (exists(iName)) {
 			OWL_CORE_WARN("AssetLibrary::load({}) already exists!", iName)
-			return m_assets.at(iName).get();
+			return get(iName);
 		}
 		shared<DataType> asset = nullptr;
+		std::filesystem::path source;
 		if (!DataType::extension().empty()) {
 			auto assetFile = find(iName);
 			if (!assetFile.has_value()) {
 				OWL_CORE_WARN("AssetLibrary::load({}) does not exist in asset folders!", iName)
 				return nullptr;
 			}
-			asset = DataType::create(assetFile.value());
+			source = assetFile.value();
+			asset = DataType::create(source);
 		} else if constexpr (HasStringSpec<DataType>) {
 			asset = DataType::create(DataType::stringToSpecification(iName));
 		}
@@ -96,7 +106,7 @@ public:
 			return nullptr;
 		}
 		OWL_CORE_TRACE("Asset {} Added.", iName)
-		add(iName, asset);
+		add(iName, asset, source);
 		return asset;
 	}
 
@@ -109,7 +119,7 @@ public:
 	auto load(const std::string& iName, const std::filesystem::path& iFile) -> shared<DataType> {
 		if (exists(iName)) {
 			OWL_CORE_WARN("AssetLibrary::load({}, {}) already exists!", iName, iFile.string())
-			return m_assets.at(iName).get();
+			return get(iName);
 		}
 		if (!DataType::extension().empty()) {
 			if (!std::filesystem::exists(iFile)) {
@@ -123,7 +133,7 @@ public:
 			return nullptr;
 		}
 		OWL_CORE_TRACE("Asset {} Added.", iName)
-		add(iName, asset);
+		add(iName, asset, iFile);
 		return asset;
 	}
 
@@ -136,7 +146,7 @@ public:
 	auto load(const std::string& iName, const typename DataType::Specification& iSpec) -> shared<DataType> {
 		if (exists(iName)) {
 			OWL_CORE_WARN("AssetLibrary::load({}, <Specification>) already exists!", iName)
-			return m_assets[iName].get();
+			return get(iName);
 		}
 		auto asset = DataType::create(iSpec);
 		if (asset == nullptr) {
@@ -150,15 +160,89 @@ public:
 
 	/**
 	 * @brief Access to the asset of the given name.
+	 *
+	 * Evicted assets are transparently loaded again.
 	 * @param[in] iName Name of the asset.
 	 * @return Asset's pointer or nullptr if not exists.
 	 */
 	auto get(const std::string& iName) -> shared<DataType> {
-		if (!exists(iName)) {
+		const auto it = m_assets.find(iName);
+		if (it == m_assets.end()) {
 			OWL_CORE_ERROR("Asset {} not found in library", iName)
 			return nullptr;
 		}
-		return m_assets.at(iName).get();
+		auto& asset = it->second;
+		asset.touch(++m_tick);
+		if (asset.isResident())
+			return asset.get();
+		if (!asset.reload()) {
+			OWL_CORE_WARN("Asset {} could not be reloaded", iName)
+			return nullptr;
+		}
+		OWL_CORE_TRACE("Asset {} Reloaded.", iName)
+		m_residentMemory += memorySize(asset.get());
+		// only a reload can exceed the budget, the returned asset is referenced and kept.
+		shared<DataType> result = asset.get();
+		trim();
+		return result;
+	}
+
+	/**
+	 * @brief Check if an asset is currently in memory.
+	 * @param[in] iName Name of the asset.
+	 * @return True if the asset exists and is loaded.
+	 */
+	[[nodiscard]] auto isResident(const std::string& iName) const -> bool {
+		const auto it = m_assets.find(iName);
+		return it != m_assets.end() && it->second.isResident();
+	}
+
+	/**
+	 * @brief Define the memory budget of the library.
+	 * @param[in] iBudget The budget in bytes (0 means no limit).
+	 */
+	void setMemoryBudget(const size_t iBudget) {
+		m_memoryBudget = iBudget;
+		trim();
+	}
+
+	/**
+	 * @brief Get the memory budget of the library.
+	 * @return The budget in bytes (0 means no limit).
+	 */
+	[[nodiscard]] auto getMemoryBudget() const -> size_t { return m_memoryBudget; }
+
+	/**
+	 * @brief Get the memory used by the resident assets.
+	 * @return Memory usage in bytes.
+	 */
+	[[nodiscard]] auto getMemoryUsage() const -> size_t { return m_residentMemory; }
+
+	/**
+	 * @brief Evict the least recently used assets until the memory usage fits the budget.
+	 *
+	 * Only the assets loaded from a file and not referenced outside the library can be evicted.
+	 * @return The amount of memory released in bytes.
+	 */
+	auto trim() -> size_t {
+		if (m_memoryBudget == 0 || m_residentMemory <= m_memoryBudget)
+			return 0;
+		std::vector<assetType*> candidates;
+		for (auto& [name, asset]: m_assets) {
+			if (asset.isResident() && asset.isEvictable() && !asset.isReferenced())
+				candidates.push_back(&asset);
+		}
+		std::ranges::sort(candidates, {}, &assetType::getLastUse);
+		size_t released = 0;
+		for (auto* asset: candidates) {
+			if (m_residentMemory <= m_memoryBudget)
+				break;
+			const size_t size = memorySize(asset->get());
+			asset->evict();
+			m_residentMemory -= size;
+			released += size;
+		}
+		return released;
 	}
 
 	/**
@@ -180,6 +264,8 @@ public:
 		// get a list of directory to search.
 		std::list<Application::AssetDirectory> assetDirectories;
 		if (Application::instanced()) {
+			if (const auto& index = Application::get().getAssetIndex(); index.isReady())
+				return index.list(ext);
 			assetDirectories = Application::get().getAssetDirectories();
 		} else {
 			assetDirectories.push_back({"cwd", std::filesystem::current_path()});
@@ -202,17 +288,35 @@ public:
 	[[nodiscard]] auto find(const std::string& iName) const -> std::optional<std::filesystem::path> {
 		if (assetType::extensions().empty())
 			return std::nullopt;
-		std::vector<std::string> ext = assetType::extensions();
-		// get a list of directory to search.
-		std::list<Application::AssetDirectory> assetDirectories;
-		if (Application::instanced()) {
-			assetDirectories = Application::get().getAssetDirectories();
-		} else {
-			assetDirectories.push_back({"cwd", std::filesystem::current_path()});
+		const std::vector<std::string> ext = assetType::extensions();
+		if (!Application::instanced())
+			return scan(iName, ext, {{"cwd", std::filesystem::current_path()}});
+		// use the index of the asset directories when built, the files created since are scanned.
+		auto& index = Application::get().getAssetIndex();
+		if (index.isReady()) {
+			if (auto file = index.find(iName, ext); file.has_value())
+				return file;
 		}
+		auto file = scan(iName, ext, Application::get().getAssetDirectories());
+		if (file.has_value())
+			index.insert(file.value());
+		return file;
+	}
+
+private:
+	/**
+	 * @brief Search the file of an asset in the asset directories.
+	 * @param[in] iName Name of the asset.
+	 * @param[in] iExtensions Extensions to try if the name has none.
+	 * @param[in] iDirectories The asset directories.
+	 * @return Path to the file or nullopt if not found.
+	 */
+	static auto scan(const std::string& iName, const std::vector<std::string>& iExtensions,
+					 const std::list<Application::AssetDirectory>& iDirectories)
+			-> std::optional<std::filesystem::path> {
 		const std::filesystem::path name(iName);
 		const bool hasExtension = name.has_extension();
-		for (const auto& [title, assetsPath]: assetDirectories) {
+		for (const auto& [title, assetsPath]: iDirectories) {
 			// check base folders
 			{
 				std::filesystem::path filePath = assetsPath / name;
@@ -220,7 +324,7 @@ public:
 					if (std::filesystem::exists(filePath))
 						return filePath;
 				} else {
-					for (auto& e: ext) {
+					for (const auto& e: iExtensions) {
 						std::filesystem::path filePathWithExt = filePath.string() + e;
 						if (std::filesystem::exists(filePathWithExt))
 							return filePathWithExt;
@@ -236,9 +340,9 @@ public:
 					if (std::filesystem::exists(filePath))
 						return filePath;
 				} else {
-					for (auto& e: ext) {
+					for (const auto& e: iExtensions) {
 						filePath.replace_extension(e);
-						OWL_CORE_INFO("Checking sub {}", filePath.string())
+						OWL_CORE_TRACE("Checking sub {}", filePath.string())
 						if (std::filesystem::exists(filePath))
 							return filePath;
 					}
@@ -248,9 +352,41 @@ public:
 		return std::nullopt;
 	}
 
-private:
+	/**
+	 * @brief Add the asset to the library and name it.
+	 * @param[in] iName Name of the asset.
+	 * @param[in] iAsset The asset to add.
+	 * @param[in] iSource The file to reload the asset from (empty if not reloadable).
+	 */
+	void add(const std::string& iName, const shared<DataType>& iAsset, const std::filesystem::path& iSource) {
+		if (const auto [it, inserted] = m_assets.emplace(iName, assetType{iAsset, iSource}); inserted) {
+			m_residentMemory += memorySize(iAsset);
+			it->second.touch(++m_tick);
+			trim();
+		}
+	}
+
+	/**
+	 * @brief Get the memory footprint of the given data.
+	 * @param[in] iData The data.
+	 * @return Memory size in bytes (0 if the data type does not tell its size).
+	 */
+	static auto memorySize(const shared<DataType>& iData) -> size_t {
+		if constexpr (HasMemorySize<DataType>) {
+			return iData ? static_cast<size_t>(iData->getMemorySize()) : 0;
+		} else {
+			return 0;
+		}
+	}
+
 	/// The list of assets.
 	std::unordered_map<std::string, assetType> m_assets;
+	/// Memory used by the resident assets.
+	size_t m_residentMemory = 0;
+	/// Memory budget (0 means no limit).
+	size_t m_memoryBudget = 0;
+	/// Usage counter.
+	uint64_t m_tick = 0;
 };
 
 }// namespace owl::core::assets
@@ -5,6 +5,115 @@
  * Copyright (c) 2023 All rights reserved.
  * All modification must get authorization from the author.
  */
+#include "owlpch.h"
 
+#include "stbimage.h"
+
+namespace owl::core::external {
+
+namespace {
+
+/// Maximal number of memory blocks kept by a thread.
+constexpr size_t g_maxRecycledBlocks{16};
+/// Size of the block header holding its capacity, keeping the memory aligned.
+constexpr size_t g_blockHeader{alignof(std::max_align_t)};
+
+/**
+ * @brief Memory blocks freed by stb_image, kept for reuse.
+ */
+struct RecycleBin {
+	RecycleBin() = default;
+	RecycleBin(const RecycleBin&) = delete;
+	RecycleBin(RecycleBin&&) = delete;
+	auto operator=(const RecycleBin&) -> RecycleBin& = delete;
+	auto operator=(RecycleBin&&) -> RecycleBin& = delete;
+	~RecycleBin() { release(); }
+	/// Free the kept blocks.
+	void release() {
+		for (size_t index = 0; index < count; ++index) std::free(blocks[index]);// NOLINT(*-no-malloc,*-owning-memory)
+		count = 0;
+	}
+	/// If the freed blocks are kept.
+	bool enabled = false;
+	/// The kept blocks, starting with their header.
+	std::array<void*, g_maxRecycledBlocks> blocks{};
+	/// Number of kept blocks.
+	size_t count = 0;
+};
+
+thread_local RecycleBin g_recycleBin;
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+// NOLINTBEGIN(*-no-malloc,*-owning-memory,*-reinterpret-cast)
+auto blockCapacity(const void* iBlock) -> size_t {
+	size_t capacity = 0;
+	std::memcpy(&capacity, iBlock, sizeof(size_t));
+	return capacity;
+}
+
+auto stbMalloc(const size_t iSize) -> void* {
+	auto& bin = g_recycleBin;
+	if (bin.enabled) {
+		// the smallest kept block large enough.
+		size_t best = bin.count;
+		for (size_t index = 0; index < bin.count; ++index) {
+			const size_t capacity = blockCapacity(bin.blocks[index]);
+			if (capacity >= iSize && (best == bin.count || capacity < blockCapacity(bin.blocks[best])))
+				best = index;
+		}
+		if (best < bin.count) {
+			void* block = bin.blocks[best];
+			bin.blocks[best] = bin.blocks[--bin.count];
+			return static_cast<uint8_t*>(block) + g_blockHeader;
+		}
+	}
+	void* block = std::malloc(iSize + g_blockHeader);
+	if (block == nullptr)
+		return nullptr;
+	std::memcpy(block, &iSize, sizeof(size_t));
+	return static_cast<uint8_t*>(block) + g_blockHeader;
+}
+
+void stbFree(void* iPointer) {
+	if (iPointer == nullptr)
+		return;
+	void* block = static_cast<uint8_t*>(iPointer) - g_blockHeader;
+	if (auto& bin = g_recycleBin; bin.enabled && bin.count < g_maxRecycledBlocks) {
+		bin.blocks[bin.count++] = block;
+		return;
+	}
+	std::free(block);
+}
+
+auto stbRealloc(void* iPointer, const size_t iSize) -> void* {
+	if (iPointer == nullptr)
+		return stbMalloc(iSize);
+	const size_t capacity = blockCapacity(static_cast<uint8_t*>(iPointer) - g_blockHeader);
+	if (capacity >= iSize)
+		return iPointer;
+	void* result = stbMalloc(iSize);
+	if (result == nullptr)
+		return nullptr;
+	std::memcpy(result, iPointer, capacity);
+	stbFree(iPointer);
+	return result;
+}
+// NOLINTEND(*-no-malloc,*-owning-memory,*-reinterpret-cast)
+OWL_DIAG_POP
+
+}// namespace
+
+void setStbImageRecycling(const bool iEnable) {
+	g_recycleBin.enabled = iEnable;
+	if (!iEnable)
+		g_recycleBin.release();
+}
+
+}// namespace owl::core::external
+
+#define STBI_MALLOC(iSize) owl::core::external::stbMalloc(iSize)
+#define STBI_REALLOC(iPointer, iSize) owl::core::external::stbRealloc(iPointer, iSize)
+#define STBI_FREE(iPointer) owl::core::external::stbFree(iPointer)
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -0,0 +1,25 @@
+/**
+ * @file stbimage.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "core/Core.h"
+
+#include <stb_image.h>
+
+namespace owl::core::external {
+
+/**
+ * @brief Enable the recycling of the stb_image memory in the calling thread.
+ *
+ * The memory freed by the decoder is kept for the next decodes of the thread instead of going back to the heap:
+ * repeated decodes of images of the same size do not allocate.
+ * @param[in] iEnable If the recycling is enabled, disabling it releases the kept memory.
+ */
+OWL_API void setStbImageRecycling(bool iEnable);
+
+}// namespace owl::core::external
@@ -0,0 +1,134 @@
+/**
+ * @file TaskGraph.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "TaskGraph.h"
+
+#include <future>
+
+namespace owl::core::task {
+
+namespace {
+/// @brief Execution status of a task.
+enum struct Status : uint8_t {
+	Pending,
+	Running,
+	Done,
+	Failed,
+};
+
+auto toMilliseconds(const std::chrono::steady_clock::duration& iDuration) -> double {
+	return static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(iDuration).count()) / 1000.0;
+}
+}// namespace
+
+TaskGraph::TaskGraph() = default;
+
+TaskGraph::~TaskGraph() = default;
+
+void TaskGraph::add(const std::string& iName, const std::function<bool()>& iAction,
+					const std::vector<std::string>& iDependencies, const Affinity iAffinity) {
+	if (std::ranges::find(m_nodes, iName, &Node::name) != m_nodes.end()) {
+		OWL_CORE_WARN("Task graph: task {} already exists.", iName)
+		return;
+	}
+	m_nodes.push_back({.name = iName, .action = iAction, .dependencies = iDependencies, .affinity = iAffinity});
+}
+
+auto TaskGraph::run() -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	m_timings.clear();
+	const auto start = std::chrono::steady_clock::now();
+	std::unordered_map<std::string, size_t> indices;
+	for (size_t i = 0; i < m_nodes.size(); ++i) indices.emplace(m_nodes[i].name, i);
+	for (const auto& node: m_nodes) {
+		for (const auto& dependency: node.dependencies) {
+			if (!indices.contains(dependency)) {
+				OWL_CORE_ERROR("Task graph: unknown dependency {} of task {}.", dependency, node.name)
+				return false;
+			}
+		}
+	}
+	const auto execute = [&start](const Node& iNode) -> Timing {
+		const auto taskStart = std::chrono::steady_clock::now();
+		const bool success = iNode.action();
+		return {.name = iNode.name,
+				.affinity = iNode.affinity,
+				.start = toMilliseconds(taskStart - start),
+				.duration = toMilliseconds(std::chrono::steady_clock::now() - taskStart),
+				.success = success};
+	};
+	std::vector status(m_nodes.size(), Status::Pending);
+	const auto isReady = [this, &status, &indices](const size_t iIndex) {
+		return status[iIndex] == Status::Pending &&
+			   std::ranges::all_of(m_nodes[iIndex].dependencies, [&status, &indices](const std::string& iDependency) {
+				   return status[indices.at(iDependency)] == Status::Done;
+			   });
+	};
+	bool failed = false;
+	const auto finish = [this, &status, &failed](const size_t iIndex, Timing&& iTiming) {
+		status[iIndex] = iTiming.success ? Status::Done : Status::Failed;
+		if (!iTiming.success) {
+			OWL_CORE_ERROR("Task graph: task {} failed.", iTiming.name)
+			failed = true;
+		}
+		m_timings.push_back(std::move(iTiming));
+	};
+	std::vector<std::pair<size_t, std::future<Timing>>> running;
+	while (true) {
+		bool progress = false;
+		if (!failed) {
+			for (size_t i = 0; i < m_nodes.size(); ++i) {
+				if (m_nodes[i].affinity != Affinity::Worker || !isReady(i))
+					continue;
+				status[i] = Status::Running;
+				if (!m_concurrent) {
+					finish(i, execute(m_nodes[i]));
+					progress = true;
+					break;
+				}
+				running.emplace_back(i, std::async(std::launch::async, execute, std::cref(m_nodes[i])));
+			}
+			// one main thread task at a time, so newly ready workers are launched in between.
+			for (size_t i = 0; i < m_nodes.size(); ++i) {
+				if (m_nodes[i].affinity != Affinity::Main || !isReady(i))
+					continue;
+				status[i] = Status::Running;
+				finish(i, execute(m_nodes[i]));
+				progress = true;
+				break;
+			}
+		}
+		for (auto it = running.begin(); it != running.end();) {
+			if (it->second.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready) {
+				finish(it->first, it->second.get());
+				it = running.erase(it);
+				progress = true;
+			} else {
+				++it;
+			}
+		}
+		if (progress)
+			continue;
+		if (running.empty())
+			break;
+		running.front().second.wait_for(std::chrono::milliseconds(1));
+	}
+	m_duration = toMilliseconds(std::chrono::steady_clock::now() - start);
+	if (failed)
+		return false;
+	if (const auto notRun = std::ranges::count(status, Status::Pending); notRun > 0) {
+		OWL_CORE_ERROR("Task graph: {} tasks not executed due to cyclic dependencies.", notRun)
+		return false;
+	}
+	return true;
+}
+
+}// namespace owl::core::task
@@ -0,0 +1,123 @@
+/**
+ * @file TaskGraph.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "core/Core.h"
+
+namespace owl::core::task {
+
+/**
+ * @brief Set of tasks with dependencies, executed as soon as their dependencies are done.
+ *
+ * Worker tasks run concurrently on their own thread, main thread tasks run in the thread calling run().
+ * When not concurrent, the worker tasks run one at a time in the thread calling run().
+ */
+class OWL_API TaskGraph final {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	TaskGraph();
+	/**
+	 * @brief Default destructor.
+	 */
+	~TaskGraph();
+	TaskGraph(const TaskGraph&) = delete;
+	TaskGraph(TaskGraph&&) = delete;
+	auto operator=(const TaskGraph&) -> TaskGraph& = delete;
+	auto operator=(TaskGraph&&) -> TaskGraph& = delete;
+
+	/// @brief Where a task is executed.
+	enum struct Affinity : uint8_t {
+		Main,///< In the thread calling run().
+		Worker,///< In a worker thread.
+	};
+
+	/**
+	 * @brief Execution report of a task.
+	 */
+	struct Timing {
+		/// Name of the task.
+		std::string name;
+		/// Where the task has been executed.
+		Affinity affinity = Affinity::Worker;
+		/// Start time from the beginning of run() in milliseconds.
+		double start = 0;
+		/// Duration of the task in milliseconds.
+		double duration = 0;
+		/// If the task succeeded.
+		bool success = false;
+	};
+
+	/**
+	 * @brief Add a task to the graph.
+	 * @param[in] iName Unique name of the task.
+	 * @param[in] iAction What to run, returns false in case of failure.
+	 * @param[in] iDependencies Names of the tasks that must be done before.
+	 * @param[in] iAffinity Where to run the task.
+	 */
+	void add(const std::string& iName, const std::function<bool()>& iAction,
+			 const std::vector<std::string>& iDependencies = {}, Affinity iAffinity = Affinity::Worker);
+
+	/**
+	 * @brief Execute all the tasks.
+	 * @return False if a task failed or if some dependencies cannot be satisfied.
+	 *
+	 * After a failure no other task is started, the running ones are waited for.
+	 */
+	auto run() -> bool;
+
+	/**
+	 * @brief Define if the worker tasks run concurrently.
+	 * @param[in] iConcurrent False to run the worker tasks one at a time in the thread calling run().
+	 */
+	void setConcurrent(const bool iConcurrent) { m_concurrent = iConcurrent; }
+
+	/**
+	 * @brief Check if the worker tasks run concurrently.
+	 * @return True if concurrent.
+	 */
+	[[nodiscard]] auto isConcurrent() const -> bool { return m_concurrent; }
+
+	/**
+	 * @brief Get the execution reports, in order of completion.
+	 * @return The execution reports.
+	 */
+	[[nodiscard]] auto getTimings() const -> const std::vector<Timing>& { return m_timings; }
+
+	/**
+	 * @brief Get the total duration of the last run.
+	 * @return Duration in milliseconds.
+	 */
+	[[nodiscard]] auto getDuration() const -> double { return m_duration; }
+
+private:
+	/**
+	 * @brief Internal task representation.
+	 */
+	struct Node {
+		/// Name of the task.
+		std::string name;
+		/// What to run.
+		std::function<bool()> action;
+		/// Names of the dependencies.
+		std::vector<std::string> dependencies;
+		/// Where to run.
+		Affinity affinity = Affinity::Worker;
+	};
+	/// The tasks in insertion order.
+	std::vector<Node> m_nodes;
+	/// The execution reports.
+	std::vector<Timing> m_timings;
+	/// Duration of the last run.
+	double m_duration = 0;
+	/// If the worker tasks run concurrently.
+	bool m_concurrent = true;
+};
+
+}// namespace owl::core::task
@@ -0,0 +1,52 @@
+/**
+ * @file HashUtils.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "HashUtils.h"
+
+namespace owl::core::utils {
+
+namespace {
+/// FNV-1a prime.
+constexpr uint64_t g_hashPrime{0x100000001b3ull};
+/// Size of the read buffer when hashing files.
+constexpr size_t g_hashBufferSize{65536};
+}// namespace
+
+auto hashBytes(const std::span<const uint8_t> iData, const uint64_t iSeed) -> uint64_t {
+	uint64_t hash = iSeed;
+	for (const uint8_t byte: iData) {
+		hash ^= byte;
+		hash *= g_hashPrime;
+	}
+	return hash;
+}
+
+auto hashString(const std::string_view iString, const uint64_t iSeed) -> uint64_t {
+	return hashBytes({reinterpret_cast<const uint8_t*>(iString.data()), iString.size()}, iSeed);
+}
+
+auto hashFile(const std::filesystem::path& iFile, const uint64_t iSeed) -> std::optional<uint64_t> {
+	OWL_PROFILE_FUNCTION()
+
+	std::ifstream in(iFile, std::ios::in | std::ios::binary);
+	if (!in.is_open())
+		return std::nullopt;
+	uint64_t hash = iSeed;
+	std::vector<uint8_t> buffer(g_hashBufferSize);
+	while (in) {
+		in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+		const auto count = static_cast<size_t>(in.gcount());
+		if (count == 0)
+			break;
+		hash = hashBytes({buffer.data(), count}, hash);
+	}
+	return hash;
+}
+
+}// namespace owl::core::utils
@@ -0,0 +1,55 @@
+/**
+ * @file HashUtils.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "core/Core.h"
+
+#include <filesystem>
+#include <optional>
+#include <span>
+
+namespace owl::core::utils {
+
+/// Starting value for the hash computations (FNV-1a offset basis).
+constexpr uint64_t g_hashSeed{0xcbf29ce484222325ull};
+
+/**
+ * @brief Compute a 64 bits hash of a memory block (FNV-1a).
+ * @param[in] iData The data to hash.
+ * @param[in] iSeed Hash value to continue from.
+ * @return The hash value.
+ */
+OWL_API auto hashBytes(std::span<const uint8_t> iData, uint64_t iSeed = g_hashSeed) -> uint64_t;
+
+/**
+ * @brief Compute a 64 bits hash of a string.
+ * @param[in] iString The string to hash.
+ * @param[in] iSeed Hash value to continue from.
+ * @return The hash value.
+ */
+OWL_API auto hashString(std::string_view iString, uint64_t iSeed = g_hashSeed) -> uint64_t;
+
+/**
+ * @brief Compute a 64 bits hash of a file's content.
+ * @param[in] iFile The file to hash.
+ * @param[in] iSeed Hash value to continue from.
+ * @return The hash value or nullopt if the file cannot be read.
+ */
+OWL_API auto hashFile(const std::filesystem::path& iFile, uint64_t iSeed = g_hashSeed) -> std::optional<uint64_t>;
+
+/**
+ * @brief Combine a value into an existing hash.
+ * @param[in] iSeed The current hash.
+ * @param[in] iValue The value to combine.
+ * @return The combined hash.
+ */
+constexpr auto hashCombine(const uint64_t iSeed, const uint64_t iValue) -> uint64_t {
+	return iSeed ^ (iValue + 0x9e3779b97f4a7c15ull + (iSeed << 6u) + (iSeed >> 2u));
+}
+
+}// namespace owl::core::utils
@@ -0,0 +1,89 @@
+/**
+ * @file SeqLock.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace owl::core::utils {
+
+/**
+ * @brief Sequence lock publishing a value from a single writer thread to any number of reader threads.
+ *
+ * The writer never waits, a reader retries while a write is in progress. The value is copied through relaxed
+ * atomic words, so a torn read is detected by the sequence and never a data race.
+ * @tparam T The value type, trivially copyable.
+ */
+template<typename T>
+	requires std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+class SeqLock final {
+public:
+	/**
+	 * @brief Publish a new value, from the writer thread.
+	 * @param[in] iValue The value.
+	 */
+	void store(const T& iValue) {
+		std::array<uint64_t, s_wordCount> words{};
+		std::memcpy(words.data(), &iValue, sizeof(T));
+		const uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+		// odd while writing.
+		m_sequence.store(sequence + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		for (size_t i = 0; i < s_wordCount; ++i) m_words.at(i).store(words.at(i), std::memory_order_relaxed);
+		m_sequence.store(sequence + 2, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Read the latest value.
+	 * @return The value.
+	 */
+	[[nodiscard]] auto load() const -> T {
+		T value{};
+		load(value);
+		return value;
+	}
+
+	/**
+	 * @brief Read the latest value.
+	 * @param[out] oValue The value.
+	 * @return The version of the value, incremented by each store.
+	 */
+	auto load(T& oValue) const -> uint64_t {
+		std::array<uint64_t, s_wordCount> words{};
+		uint64_t before = 0;
+		uint64_t after = 0;
+		do {
+			before = m_sequence.load(std::memory_order_acquire);
+			for (size_t i = 0; i < s_wordCount; ++i) words.at(i) = m_words.at(i).load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_acquire);
+			after = m_sequence.load(std::memory_order_relaxed);
+		} while ((before & 1u) != 0 || before != after);
+		std::memcpy(static_cast<void*>(&oValue), words.data(), sizeof(T));
+		return before / 2;
+	}
+
+	/**
+	 * @brief Get the version of the latest value.
+	 * @return The number of stores.
+	 */
+	[[nodiscard]] auto getVersion() const -> uint64_t { return m_sequence.load(std::memory_order_acquire) / 2; }
+
+private:
+	/// Number of atomic words holding the value.
+	static constexpr size_t s_wordCount{(sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t)};
+	/// The sequence, odd while writing.
+	std::atomic<uint64_t> m_sequence{0};
+	/// The value.
+	std::array<std::atomic<uint64_t>, s_wordCount> m_words{};
+};
+
+}// namespace owl::core::utils
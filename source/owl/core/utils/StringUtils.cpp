@@ -0,0 +1,54 @@
+/**
+ * @file StringUtils.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "StringUtils.h"
+
+namespace owl::core::utils {
+
+auto decodeUtf8(const std::string_view iText, size_t& ioPosition) -> uint32_t {
+	if (ioPosition >= iText.size())
+		return g_replacementCodepoint;
+	const auto lead = static_cast<uint8_t>(iText[ioPosition]);
+	ioPosition++;
+	if (lead < 0x80u)
+		return lead;
+	size_t length = 0;
+	uint32_t codepoint = 0;
+	uint32_t minimum = 0;
+	if ((lead & 0xe0u) == 0xc0u) {
+		length = 1;
+		codepoint = lead & 0x1fu;
+		minimum = 0x80;
+	} else if ((lead & 0xf0u) == 0xe0u) {
+		length = 2;
+		codepoint = lead & 0x0fu;
+		minimum = 0x800;
+	} else if ((lead & 0xf8u) == 0xf0u) {
+		length = 3;
+		codepoint = lead & 0x07u;
+		minimum = 0x10000;
+	} else {
+		return g_replacementCodepoint;
+	}
+	if (ioPosition + length > iText.size())
+		return g_replacementCodepoint;
+	for (size_t i = 0; i < length; ++i) {
+		const auto next = static_cast<uint8_t>(iText[ioPosition + i]);
+		if ((next & 0xc0u) != 0x80u)
+			return g_replacementCodepoint;
+		codepoint = (codepoint << 6u) | (next & 0x3fu);
+	}
+	// reject the overlong encodings, the surrogates and the values out of the unicode range.
+	if (codepoint < minimum || (codepoint >= 0xd800 && codepoint <= 0xdfff) || codepoint > 0x10ffff)
+		return g_replacementCodepoint;
+	ioPosition += length;
+	return codepoint;
+}
+
+}// namespace owl::core::utils
@@ -0,0 +1,29 @@
+/**
+ * @file StringUtils.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "core/Core.h"
+
+#include <string_view>
+
+namespace owl::core::utils {
+
+/// Code point replacing the invalid sequences (U+FFFD).
+constexpr uint32_t g_replacementCodepoint{0xfffd};
+
+/**
+ * @brief Decode the next code point of an UTF-8 string.
+ * @param[in] iText The text.
+ * @param[in,out] ioPosition Position of the code point in bytes, moved to the next one.
+ * @return The code point, g_replacementCodepoint for invalid or truncated sequences.
+ *
+ * An invalid sequence consumes a single byte, so that the decoding resynchronizes on the next valid one.
+ */
+OWL_API auto decodeUtf8(std::string_view iText, size_t& ioPosition) -> uint32_t;
+
+}// namespace owl::core::utils
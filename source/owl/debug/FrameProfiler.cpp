@@ -0,0 +1,415 @@
+/**
+ * @file FrameProfiler.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "FrameProfiler.h"
+#include "Profiler.h"
+
+#include <mutex>
+
+namespace owl::debug {
+
+namespace {
+
+/// Number of frames in the history.
+constexpr size_t g_historySize{600};
+
+/// If the scopes are recorded.
+std::atomic<bool> g_enabled{false};
+
+/// If the thread is the one calling frame().
+constinit thread_local bool t_recordingThread{false};
+
+/**
+ * @brief Node of the call tree.
+ */
+struct Node {
+	/// Interned name of the scope.
+	uint32_t nameId = 0;
+	/// Nesting level.
+	uint32_t depth = 0;
+	/// Parent node, -1 for the root.
+	int32_t parent = -1;
+	/// First child node, -1 if none.
+	int32_t firstChild = -1;
+	/// Last child node, -1 if none.
+	int32_t lastChild = -1;
+	/// Next node with the same parent, -1 if none.
+	int32_t nextSibling = -1;
+	/// Number of entries in the scope.
+	uint32_t calls = 0;
+	/// Time spent in the scope in ticks.
+	int64_t ticks = 0;
+};
+
+/**
+ * @brief Scope entered and not left yet.
+ */
+struct OpenScope {
+	/// Node of the scope.
+	int32_t node = 0;
+	/// Interned name of the scope.
+	uint32_t nameId = 0;
+	/// Start time in ticks.
+	int64_t start = 0;
+};
+
+/**
+ * @brief Call tree of the frame being recorded, only accessed by the recording thread.
+ */
+struct Recorder {
+	/// The nodes, the first one is the root.
+	std::vector<Node> nodes;
+	/// The open scopes, the innermost last.
+	std::vector<OpenScope> stack;
+	/// If a frame is being recorded.
+	bool started = false;
+	/// Start time of the frame.
+	std::chrono::steady_clock::time_point frameStart;
+	/// Time of the tick calibration start.
+	std::chrono::steady_clock::time_point calibrationTime;
+	/// Ticks at the tick calibration start.
+	int64_t calibrationTicks = 0;
+	/// Duration of a tick.
+	double millisecondsPerTick = 0;
+	/// Allocation calls of the tracker at the frame start.
+	size_t allocationCalls = 0;
+	/// Memory allocated by the tracker at the frame start.
+	size_t allocatedBytes = 0;
+
+	static auto get() -> Recorder& {
+		// never destroyed: scopes may end after the static destructions.
+		static auto* instance = new Recorder;
+		return *instance;
+	}
+
+	/**
+	 * @brief Get the allocations since the last call, from the tracker counters.
+	 * @return The allocations of the frame.
+	 */
+	auto sampleAllocations() -> FrameAllocations {
+		const auto& state = TrackerAPI::globals();
+		const FrameAllocations result{.allocationCalls = state.allocationCalls - allocationCalls,
+									  .allocatedMemory = {.size = state.allocatedTotal.size - allocatedBytes}};
+		allocationCalls = state.allocationCalls;
+		allocatedBytes = state.allocatedTotal.size;
+		return result;
+	}
+
+	/**
+	 * @brief Empty the tree, keeping the open scopes.
+	 */
+	void restart() {
+		nodes.clear();
+		nodes.push_back({});
+		for (auto& open: stack) {
+			const auto parent = nodes.size() - 1;
+			open.node = addChild(static_cast<int32_t>(parent), open.nameId);
+		}
+	}
+
+	/**
+	 * @brief Get or create the child of a node.
+	 * @param[in] iParent The parent node.
+	 * @param[in] iNameId The name of the child.
+	 * @return The child node.
+	 */
+	auto child(const int32_t iParent, const uint32_t iNameId) -> int32_t {
+		for (int32_t index = nodes[static_cast<size_t>(iParent)].firstChild; index >= 0;
+			 index = nodes[static_cast<size_t>(index)].nextSibling) {
+			if (nodes[static_cast<size_t>(index)].nameId == iNameId)
+				return index;
+		}
+		return addChild(iParent, iNameId);
+	}
+
+	/**
+	 * @brief Create a child node.
+	 * @param[in] iParent The parent node.
+	 * @param[in] iNameId The name of the child.
+	 * @return The new node.
+	 */
+	auto addChild(const int32_t iParent, const uint32_t iNameId) -> int32_t {
+		const auto index = static_cast<int32_t>(nodes.size());
+		nodes.push_back(
+				{.nameId = iNameId, .depth = nodes[static_cast<size_t>(iParent)].depth + 1, .parent = iParent});
+		auto& parent = nodes[static_cast<size_t>(iParent)];
+		if (parent.lastChild >= 0)
+			nodes[static_cast<size_t>(parent.lastChild)].nextSibling = index;
+		else
+			parent.firstChild = index;
+		parent.lastChild = index;
+		return index;
+	}
+};
+
+/**
+ * @brief Published results, shared between threads.
+ */
+struct FrameData {
+	/// Access protection.
+	std::mutex mutex;
+	/// Last recorded frame.
+	FrameTimings lastFrame;
+	/// Longest recorded frame.
+	FrameTimings worstFrame;
+	/// Last GPU timings read back.
+	std::vector<ScopeTiming> gpuScopes;
+	/// Circular history of the frame durations.
+	std::vector<float> history = std::vector<float>(g_historySize, 0.f);
+	/// Next write position in the history.
+	size_t historyIndex = 0;
+	/// Number of valid entries in the history.
+	size_t historyCount = 0;
+	/// Number of recorded frames.
+	uint64_t frameCount = 0;
+	/// Number of frames over budget.
+	size_t overBudgetFrames = 0;
+	/// The budget of the whole frame.
+	double frameBudget = 0;
+	/// The budgets of the scopes by name identifier.
+	std::unordered_map<uint32_t, double> budgets;
+
+	static auto get() -> FrameData& {
+		static FrameData instance;
+		return instance;
+	}
+};
+
+auto toMilliseconds(const std::chrono::steady_clock::duration& iDuration) -> double {
+	return std::chrono::duration<double, std::milli>(iDuration).count();
+}
+
+/**
+ * @brief Flatten the call tree in depth first order.
+ * @param[in] iRecorder The call tree.
+ * @param[in] iData The budgets.
+ * @param[out] oScopes The flattened scopes.
+ * @return True if a scope is over budget.
+ */
+auto flatten(const Recorder& iRecorder, const FrameData& iData, std::vector<ScopeTiming>& oScopes) -> bool {
+	oScopes.clear();
+	bool overBudget = false;
+	const auto& nodes = iRecorder.nodes;
+	int32_t index = nodes.front().firstChild;
+	while (index > 0) {
+		const auto& node = nodes[static_cast<size_t>(index)];
+		const auto budget = iData.budgets.find(node.nameId);
+		auto& scope = oScopes.emplace_back(ScopeTiming{
+				.nameId = node.nameId,
+				.depth = node.depth - 1,
+				.calls = node.calls,
+				.duration = static_cast<double>(node.ticks) * iRecorder.millisecondsPerTick,
+				.budget = budget == iData.budgets.end() ? 0.0 : budget->second});
+		overBudget |= scope.isOverBudget();
+		if (node.firstChild >= 0) {
+			index = node.firstChild;
+			continue;
+		}
+		// no child: next sibling of the node or of its closest ancestor.
+		while (index > 0 && nodes[static_cast<size_t>(index)].nextSibling < 0)
+			index = nodes[static_cast<size_t>(index)].parent;
+		if (index > 0)
+			index = nodes[static_cast<size_t>(index)].nextSibling;
+	}
+	return overBudget;
+}
+
+/**
+ * @brief Get a percentile of sorted values.
+ * @param[in] iSorted The sorted values.
+ * @param[in] iPercent The percentile.
+ * @return The value (nearest rank).
+ */
+auto percentile(const std::vector<float>& iSorted, const double iPercent) -> double {
+	if (iSorted.empty())
+		return 0;
+	const auto rank = static_cast<size_t>(std::ceil(iPercent / 100.0 * static_cast<double>(iSorted.size())));
+	return static_cast<double>(iSorted[std::clamp<size_t>(rank, 1, iSorted.size()) - 1]);
+}
+
+}// namespace
+
+void FrameProfiler::setEnabled(const bool iEnabled) { g_enabled.store(iEnabled, std::memory_order_relaxed); }
+
+auto FrameProfiler::isEnabled() -> bool { return g_enabled.load(std::memory_order_relaxed); }
+
+auto FrameProfiler::isRecordingThread() -> bool {
+	return t_recordingThread && g_enabled.load(std::memory_order_relaxed);
+}
+
+void FrameProfiler::beginScope(const uint32_t iNameId, const int64_t iStart) {
+	auto& recorder = Recorder::get();
+	if (!recorder.started)
+		return;
+	const int32_t parent = recorder.stack.empty() ? 0 : recorder.stack.back().node;
+	const int32_t node = recorder.child(parent, iNameId);
+	++recorder.nodes[static_cast<size_t>(node)].calls;
+	recorder.stack.push_back({.node = node, .nameId = iNameId, .start = iStart});
+}
+
+void FrameProfiler::endScope(const uint32_t iNameId, const int64_t iEnd) {
+	auto& recorder = Recorder::get();
+	// scope entered before the recording started.
+	if (recorder.stack.empty() || recorder.stack.back().nameId != iNameId)
+		return;
+	const auto& open = recorder.stack.back();
+	recorder.nodes[static_cast<size_t>(open.node)].ticks += iEnd - open.start;
+	recorder.stack.pop_back();
+}
+
+void FrameProfiler::setGpuScopes(const std::vector<ScopeTiming>& iScopes) {
+	if (!isEnabled())
+		return;
+	auto& data = FrameData::get();
+	const std::lock_guard lock(data.mutex);
+	data.gpuScopes = iScopes;
+	for (auto& scope: data.gpuScopes) {
+		const auto budget = data.budgets.find(scope.nameId);
+		scope.budget = budget == data.budgets.end() ? 0.0 : budget->second;
+	}
+}
+
+void FrameProfiler::frame() {
+	t_recordingThread = true;
+	auto& recorder = Recorder::get();
+	if (!isEnabled()) {
+		if (recorder.started) {
+			recorder.started = false;
+			recorder.stack.clear();
+			recorder.nodes.clear();
+		}
+		return;
+	}
+	const auto nowTicks = ProfileTimer::now();
+	const auto now = std::chrono::steady_clock::now();
+	if (!recorder.started) {
+		// the current frame is incomplete, the recording starts with the next one.
+		recorder.started = true;
+		recorder.frameStart = now;
+		recorder.calibrationTime = now;
+		recorder.calibrationTicks = nowTicks;
+		recorder.sampleAllocations();
+		recorder.restart();
+		return;
+	}
+	if (nowTicks > recorder.calibrationTicks)
+		recorder.millisecondsPerTick = toMilliseconds(now - recorder.calibrationTime) /
+									   static_cast<double>(nowTicks - recorder.calibrationTicks);
+	// the open scopes are split at the frame boundary.
+	for (auto& open: recorder.stack) {
+		recorder.nodes[static_cast<size_t>(open.node)].ticks += nowTicks - open.start;
+		open.start = nowTicks;
+	}
+	const auto allocations = recorder.sampleAllocations();
+	auto& data = FrameData::get();
+	{
+		const std::lock_guard lock(data.mutex);
+		auto& last = data.lastFrame;
+		last.frameNumber = ++data.frameCount;
+		last.duration = toMilliseconds(now - recorder.frameStart);
+		last.allocations = allocations;
+		bool overBudget = flatten(recorder, data, last.scopes);
+		last.gpuScopes = data.gpuScopes;
+		overBudget |= std::ranges::any_of(last.gpuScopes, &ScopeTiming::isOverBudget);
+		overBudget |= data.frameBudget > 0 && last.duration > data.frameBudget;
+		if (overBudget)
+			++data.overBudgetFrames;
+		data.history[data.historyIndex] = static_cast<float>(last.duration);
+		data.historyIndex = (data.historyIndex + 1) % g_historySize;
+		data.historyCount = std::min(data.historyCount + 1, g_historySize);
+		if (last.duration > data.worstFrame.duration) {
+			data.worstFrame = last;
+			if (overBudget) {
+				OWL_CORE_WARN("Frame profiler: frame {} over budget, {:.2f} ms.", last.frameNumber, last.duration)
+			}
+		}
+	}
+	recorder.restart();
+	recorder.frameStart = now;
+}
+
+void FrameProfiler::reset() {
+	auto& data = FrameData::get();
+	const std::lock_guard lock(data.mutex);
+	data.lastFrame = {};
+	data.worstFrame = {};
+	data.gpuScopes.clear();
+	data.historyIndex = 0;
+	data.historyCount = 0;
+	data.overBudgetFrames = 0;
+}
+
+auto FrameProfiler::getLastFrame() -> FrameTimings {
+	auto& data = FrameData::get();
+	const std::lock_guard lock(data.mutex);
+	return data.lastFrame;
+}
+
+auto FrameProfiler::getWorstFrame() -> FrameTimings {
+	auto& data = FrameData::get();
+	const std::lock_guard lock(data.mutex);
+	return data.worstFrame;
+}
+
+auto FrameProfiler::getHistory() -> std::vector<float> {
+	auto& data = FrameData::get();
+	const std::lock_guard lock(data.mutex);
+	std::vector<float> history;
+	history.reserve(data.historyCount);
+	const size_t first = (data.historyIndex + g_historySize - data.historyCount) % g_historySize;
+	for (size_t i = 0; i < data.historyCount; ++i) history.push_back(data.history[(first + i) % g_historySize]);
+	return history;
+}
+
+auto FrameProfiler::getStatistics() -> FrameStatistics {
+	auto sorted = getHistory();
+	FrameStatistics stats;
+	{
+		auto& data = FrameData::get();
+		const std::lock_guard lock(data.mutex);
+		stats.overBudgetFrames = data.overBudgetFrames;
+	}
+	if (sorted.empty())
+		return stats;
+	std::ranges::sort(sorted);
+	stats.frameCount = sorted.size();
+	stats.mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / static_cast<double>(sorted.size());
+	stats.p50 = percentile(sorted, 50);
+	stats.p95 = percentile(sorted, 95);
+	stats.p99 = percentile(sorted, 99);
+	stats.max = static_cast<double>(sorted.back());
+	return stats;
+}
+
+void FrameProfiler::setBudget(const std::string& iName, const double iMilliseconds) {
+	const uint32_t nameId = iName == g_frameBudgetName ? 0 : Profiler::get().internName(iName.c_str());
+	auto& data = FrameData::get();
+	const std::lock_guard lock(data.mutex);
+	if (iName == g_frameBudgetName)
+		data.frameBudget = std::max(iMilliseconds, 0.0);
+	else if (iMilliseconds > 0)
+		data.budgets[nameId] = iMilliseconds;
+	else
+		data.budgets.erase(nameId);
+}
+
+auto FrameProfiler::getBudgets() -> std::map<std::string, double> {
+	std::map<std::string, double> budgets;
+	auto& data = FrameData::get();
+	const std::lock_guard lock(data.mutex);
+	if (data.frameBudget > 0)
+		budgets.emplace(g_frameBudgetName, data.frameBudget);
+	for (const auto& [nameId, budget]: data.budgets) budgets.emplace(Profiler::get().getName(nameId), budget);
+	return budgets;
+}
+
+auto FrameProfiler::getName(const uint32_t iNameId) -> std::string { return Profiler::get().getName(iNameId); }
+
+}// namespace owl::debug
@@ -0,0 +1,181 @@
+/**
+ * @file FrameProfiler.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "HeapProfiler.h"
+
+#include <map>
+
+namespace owl::debug {
+
+/// Name of the budget applying to the whole frame.
+constexpr auto g_frameBudgetName{"Frame"};
+
+/**
+ * @brief Time spent in a profiled scope during a frame.
+ */
+struct OWL_API ScopeTiming {
+	/// Interned name of the scope.
+	uint32_t nameId{0};
+	/// Nesting level, 0 for the outermost scopes.
+	uint32_t depth{0};
+	/// Number of times the scope has been entered.
+	uint32_t calls{0};
+	/// Total time spent in the scope in milliseconds.
+	double duration{0};
+	/// Budget of the scope in milliseconds (0 means no budget).
+	double budget{0};
+
+	/**
+	 * @brief Check if the scope exceeded its budget.
+	 * @return True if over budget.
+	 */
+	[[nodiscard]] auto isOverBudget() const -> bool { return budget > 0 && duration > budget; }
+};
+
+/**
+ * @brief Timings of a frame.
+ */
+struct OWL_API FrameTimings {
+	/// Number of the frame.
+	uint64_t frameNumber{0};
+	/// Duration of the frame in milliseconds.
+	double duration{0};
+	/// Allocations done during the frame.
+	FrameAllocations allocations;
+	/// The scopes in depth first order.
+	std::vector<ScopeTiming> scopes;
+	/// The GPU scopes of the last frame read back from the GPU (a few frames older than this one).
+	std::vector<ScopeTiming> gpuScopes;
+};
+
+/**
+ * @brief Statistics over the recent frames.
+ */
+struct OWL_API FrameStatistics {
+	/// Number of frames in the statistics.
+	size_t frameCount{0};
+	/// Mean frame duration in milliseconds.
+	double mean{0};
+	/// Median frame duration in milliseconds.
+	double p50{0};
+	/// 95th percentile of the frame duration in milliseconds.
+	double p95{0};
+	/// 99th percentile of the frame duration in milliseconds.
+	double p99{0};
+	/// Longest frame duration in milliseconds.
+	double max{0};
+	/// Number of frames with at least one exceeded budget since the last reset.
+	size_t overBudgetFrames{0};
+};
+
+/**
+ * @brief Per frame aggregation of the profiled scopes.
+ *
+ * When enabled, the OWL_PROFILE_SCOPE markers hit by the thread calling frame() are gathered in a call tree,
+ * merging the scopes with the same name under the same parent. Scopes of the other threads are ignored. Budgets
+ * flag the scopes (or the whole frame with g_frameBudgetName) taking longer than expected, and the longest frame
+ * is kept to inspect hitches. Nothing is recorded when disabled.
+ */
+class OWL_API FrameProfiler final {
+public:
+	/**
+	 * @brief Enable or disable the recording.
+	 * @param[in] iEnabled The new state.
+	 */
+	static void setEnabled(bool iEnabled);
+
+	/**
+	 * @brief Check if the recording is active.
+	 * @return True if recording.
+	 */
+	static auto isEnabled() -> bool;
+
+	/**
+	 * @brief Check if the scopes of the calling thread have to be recorded.
+	 * @return True if recording this thread.
+	 */
+	static auto isRecordingThread() -> bool;
+
+	/**
+	 * @brief Function called by the profile timers when entering a scope.
+	 * @param[in] iNameId Interned name of the scope.
+	 * @param[in] iStart Start time in profiler ticks.
+	 */
+	static void beginScope(uint32_t iNameId, int64_t iStart);
+
+	/**
+	 * @brief Function called by the profile timers when leaving a scope.
+	 * @param[in] iNameId Interned name of the scope.
+	 * @param[in] iEnd End time in profiler ticks.
+	 */
+	static void endScope(uint32_t iNameId, int64_t iEnd);
+
+	/**
+	 * @brief Function called by the renderer when the GPU timings of a frame are read back.
+	 * @param[in] iScopes The GPU scopes in depth first order, the budgets are filled here.
+	 */
+	static void setGpuScopes(const std::vector<ScopeTiming>& iScopes);
+
+	/**
+	 * @brief Close the current frame, to call once per frame and always from the same thread.
+	 */
+	static void frame();
+
+	/**
+	 * @brief Remove the recorded frames and statistics.
+	 */
+	static void reset();
+
+	/**
+	 * @brief Get the timings of the last frame.
+	 * @return The frame timings.
+	 */
+	static auto getLastFrame() -> FrameTimings;
+
+	/**
+	 * @brief Get the timings of the longest frame since the last reset.
+	 * @return The frame timings.
+	 */
+	static auto getWorstFrame() -> FrameTimings;
+
+	/**
+	 * @brief Get the duration of the recent frames.
+	 * @return Frame durations in milliseconds, the oldest first.
+	 */
+	static auto getHistory() -> std::vector<float>;
+
+	/**
+	 * @brief Get the statistics over the recent frames.
+	 * @return The statistics.
+	 */
+	static auto getStatistics() -> FrameStatistics;
+
+	/**
+	 * @brief Define the budget of a scope.
+	 * @param[in] iName Name of the scope, or g_frameBudgetName for the whole frame.
+	 * @param[in] iMilliseconds The budget, 0 to remove it.
+	 */
+	static void setBudget(const std::string& iName, double iMilliseconds);
+
+	/**
+	 * @brief Get the defined budgets.
+	 * @return The budgets in milliseconds by scope name.
+	 */
+	static auto getBudgets() -> std::map<std::string, double>;
+
+	/**
+	 * @brief Get the name of a scope.
+	 * @param[in] iNameId Interned name of the scope.
+	 * @return The scope name.
+	 */
+	static auto getName(uint32_t iNameId) -> std::string;
+};
+
+}// namespace owl::debug
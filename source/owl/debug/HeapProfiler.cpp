@@ -0,0 +1,215 @@
+/**
+ * @file HeapProfiler.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "HeapProfiler.h"
+
+#include <cpptrace/cpptrace.hpp>
+#include <mutex>
+
+namespace owl::debug {
+
+namespace {
+
+/// Maximal depth of the captured call stacks.
+constexpr size_t g_maxStackDepth{48};
+
+/// Mean sampling interval, 0 when stopped.
+std::atomic<size_t> g_samplingInterval{0};
+
+/**
+ * @brief Sampling state of a thread.
+ */
+struct ThreadSampler {
+	/// Bytes to allocate before the next sample.
+	int64_t bytesUntilSample = 0;
+	/// Random generator state.
+	uint64_t randomState = 0;
+	/// Sampling interval used to draw the current distance.
+	size_t interval = 0;
+
+	/**
+	 * @brief Draw the distance to the next sample from an exponential distribution.
+	 * @return The distance in bytes.
+	 */
+	auto nextDistance() -> int64_t {
+		if (randomState == 0)
+			randomState = reinterpret_cast<uintptr_t>(this) ^
+						  static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) ^
+						  0x9E3779B97F4A7C15ull;
+		// xorshift64*
+		randomState ^= randomState >> 12;
+		randomState ^= randomState << 25;
+		randomState ^= randomState >> 27;
+		const uint64_t random = randomState * 0x2545F4914F6CDD1Dull;
+		// uniform in (0, 1]
+		const double uniform = (static_cast<double>(random >> 11) + 1.0) / 9007199254740992.0;
+		return static_cast<int64_t>(-std::log(uniform) * static_cast<double>(interval)) + 1;
+	}
+};
+
+constinit thread_local ThreadSampler t_sampler;
+
+/**
+ * @brief Aggregated data of the profiler.
+ */
+struct ProfileData {
+	/// Access protection.
+	std::mutex mutex;
+	/// The call sites by hash of their stack.
+	std::unordered_map<uint64_t, CallSite> callSites;
+	/// Allocations of the last frame.
+	FrameAllocations lastFrame;
+	/// Allocation calls at the previous frame.
+	size_t previousCalls{0};
+	/// Allocated bytes at the previous frame.
+	size_t previousBytes{0};
+
+	static auto get() -> ProfileData& {
+		// never destroyed: allocations may happen after the static destructions.
+		static auto* instance = new ProfileData;
+		return *instance;
+	}
+};
+
+auto hashFrames(const std::vector<cpptrace::frame_ptr>& iFrames) -> uint64_t {
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ull;
+	for (const auto frame: iFrames) {
+		hash ^= static_cast<uint64_t>(frame);
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+void recordSample(const size_t iSize, const size_t iInterval) {
+	auto trace = cpptrace::generate_raw_trace(2, g_maxStackDepth);
+	// probability for this allocation to contain at least one sample point.
+	const double probability =
+			1.0 - std::exp(-static_cast<double>(iSize) / static_cast<double>(std::max<size_t>(iInterval, 1)));
+	const double weight = probability > 0 ? 1.0 / probability : 1.0;
+	const uint64_t key = hashFrames(trace.frames);
+	auto& data = ProfileData::get();
+	const std::lock_guard lock(data.mutex);
+	auto& site = data.callSites[key];
+	if (site.frames.empty())
+		site.frames.assign(trace.frames.begin(), trace.frames.end());
+	++site.sampleCount;
+	site.estimatedCalls += weight;
+	site.estimatedBytes += weight * static_cast<double>(iSize);
+}
+
+auto isInternalFrame(const std::string& iSymbol) -> bool {
+	return iSymbol.starts_with("operator new") || iSymbol.contains("owl::debug::TrackerAPI") ||
+		   iSymbol.contains("owl::debug::HeapProfiler") || iSymbol.contains("owl::debug::(anonymous namespace)");
+}
+
+}// namespace
+
+void HeapProfiler::start(const size_t iSamplingInterval) {
+	OWL_CORE_INFO("Heap profiler: sampling every {} on average.", MemorySize{iSamplingInterval}.str())
+	g_samplingInterval.store(std::max<size_t>(iSamplingInterval, 1), std::memory_order_relaxed);
+}
+
+void HeapProfiler::stop() { g_samplingInterval.store(0, std::memory_order_relaxed); }
+
+auto HeapProfiler::isRunning() -> bool { return g_samplingInterval.load(std::memory_order_relaxed) > 0; }
+
+void HeapProfiler::reset() {
+	OWL_SCOPE_UNTRACK
+	auto& data = ProfileData::get();
+	const std::lock_guard lock(data.mutex);
+	data.callSites.clear();
+	data.lastFrame = {};
+}
+
+void HeapProfiler::onAllocation(const size_t iSize) {
+	const size_t interval = g_samplingInterval.load(std::memory_order_relaxed);
+	if (interval == 0)
+		return;
+	if (t_sampler.interval != interval) {
+		t_sampler.interval = interval;
+		t_sampler.bytesUntilSample = t_sampler.nextDistance();
+	}
+	t_sampler.bytesUntilSample -= static_cast<int64_t>(iSize);
+	if (t_sampler.bytesUntilSample > 0)
+		return;
+	t_sampler.bytesUntilSample = t_sampler.nextDistance();
+	recordSample(iSize, interval);
+}
+
+void HeapProfiler::frame() {
+	if (!isRunning())
+		return;
+	const auto& state = TrackerAPI::globals();
+	auto& data = ProfileData::get();
+	OWL_SCOPE_UNTRACK
+	const std::lock_guard lock(data.mutex);
+	data.lastFrame.allocationCalls = state.allocationCalls - data.previousCalls;
+	data.lastFrame.allocatedMemory.size = state.allocatedTotal.size - data.previousBytes;
+	data.previousCalls = state.allocationCalls;
+	data.previousBytes = state.allocatedTotal.size;
+}
+
+auto HeapProfiler::getLastFrame() -> FrameAllocations {
+	OWL_SCOPE_UNTRACK
+	auto& data = ProfileData::get();
+	const std::lock_guard lock(data.mutex);
+	return data.lastFrame;
+}
+
+auto HeapProfiler::getCallSites() -> std::vector<CallSite> {
+	std::vector<CallSite> result;
+	{
+		OWL_SCOPE_UNTRACK
+		auto& data = ProfileData::get();
+		const std::lock_guard lock(data.mutex);
+		result.reserve(data.callSites.size());
+		for (const auto& site: data.callSites | std::views::values) result.push_back(site);
+	}
+	std::ranges::sort(result, std::greater{}, &CallSite::estimatedBytes);
+	return result;
+}
+
+auto HeapProfiler::exportFoldedStacks(const std::filesystem::path& iFile) -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	const auto callSites = getCallSites();
+	std::ofstream out(iFile, std::ios::out);
+	if (!out.is_open()) {
+		OWL_CORE_WARN("Heap profiler: cannot open file {} for writing.", iFile.string())
+		return false;
+	}
+	for (const auto& site: callSites) {
+		const auto trace = cpptrace::raw_trace{site.frames}.resolve();
+		std::vector<std::string> names;
+		bool inAllocator = true;
+		for (const auto& frame: trace.frames) {
+			// the first frames are the allocator and the profiler.
+			if (inAllocator && isInternalFrame(frame.symbol))
+				continue;
+			inAllocator = false;
+			names.push_back(frame.symbol.empty() ? fmt::format("{:#x}", frame.raw_address) : frame.symbol);
+		}
+		if (names.empty())
+			names.emplace_back("[unknown]");
+		std::string line;
+		for (const auto& name: std::views::reverse(names)) {
+			if (!line.empty())
+				line += ';';
+			line += name;
+		}
+		std::ranges::replace(line, '\n', ' ');
+		out << line << ' ' << static_cast<uint64_t>(site.estimatedBytes) << '\n';
+	}
+	OWL_CORE_INFO("Heap profiler: {} call sites written in {}", callSites.size(), iFile.string())
+	return out.good();
+}
+
+}// namespace owl::debug
@@ -0,0 +1,108 @@
+/**
+ * @file HeapProfiler.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "Tracker.h"
+
+#include <filesystem>
+
+namespace owl::debug {
+
+/// Default mean number of bytes between two samples.
+constexpr size_t g_defaultSamplingInterval{512ull * 1024ull};
+
+/**
+ * @brief Allocations done during a frame.
+ */
+struct OWL_API FrameAllocations {
+	/// Number of allocations.
+	size_t allocationCalls{0};
+	/// Amount of allocated memory.
+	MemorySize allocatedMemory{0};
+};
+
+/**
+ * @brief Samples aggregated by allocation call stack.
+ */
+struct OWL_API CallSite {
+	/// Return addresses of the call stack, most recent call first.
+	std::vector<uintptr_t> frames;
+	/// Number of samples taken at this call site.
+	size_t sampleCount{0};
+	/// Estimated number of allocations.
+	double estimatedCalls{0};
+	/// Estimated amount of allocated memory in bytes.
+	double estimatedBytes{0};
+};
+
+/**
+ * @brief Sampling allocation profiler.
+ *
+ * A call stack is captured every N allocated bytes on average, N following an exponential distribution (Poisson
+ * process over the allocated bytes, as tcmalloc or heapprofd). Each sample is weighted by the inverse of its
+ * sampling probability so the call site aggregates are unbiased estimations of the real allocations.
+ */
+class OWL_API HeapProfiler final {
+public:
+	/**
+	 * @brief Start the sampling.
+	 * @param[in] iSamplingInterval Mean number of bytes between two samples.
+	 */
+	static void start(size_t iSamplingInterval = g_defaultSamplingInterval);
+
+	/**
+	 * @brief Stop the sampling, the aggregated samples are kept.
+	 */
+	static void stop();
+
+	/**
+	 * @brief Check if the sampling is active.
+	 * @return True if sampling.
+	 */
+	static auto isRunning() -> bool;
+
+	/**
+	 * @brief Remove all the aggregated samples.
+	 */
+	static void reset();
+
+	/**
+	 * @brief Function called by the memory tracker at each allocation.
+	 * @param[in] iSize The allocated size.
+	 */
+	static void onAllocation(size_t iSize);
+
+	/**
+	 * @brief Update the frame counters, to call once per frame.
+	 */
+	static void frame();
+
+	/**
+	 * @brief Get the allocations of the last frame.
+	 * @return The frame allocations.
+	 */
+	static auto getLastFrame() -> FrameAllocations;
+
+	/**
+	 * @brief Get the aggregated samples.
+	 * @return The call sites by decreasing estimated memory.
+	 */
+	static auto getCallSites() -> std::vector<CallSite>;
+
+	/**
+	 * @brief Write the profile as folded stacks (one line per call stack, root first, with its estimated bytes).
+	 * @param[in] iFile The file to write.
+	 * @return True if succeeded.
+	 *
+	 * The format is read by flamegraph.pl, speedscope or inferno. The symbols are resolved here.
+	 */
+	static auto exportFoldedStacks(const std::filesystem::path& iFile) -> bool;
+};
+
+}// namespace owl::debug
@@ -9,13 +9,134 @@
 
 #include "Profiler.h"
 
+#include "FrameProfiler.h"
+
 namespace owl::debug {
 
+namespace {
+
+/// Magic number at the beginning of the binary profile.
+constexpr std::array<char, 4> g_profileMagic{'O', 'P', 'R', 'F'};
+/// Version of the binary profile layout.
+constexpr uint32_t g_profileVersion{1};
+/// Number of events in a thread buffer (power of two).
+constexpr uint64_t g_ringSize{8192};
+/// Period of the buffer draining.
+constexpr std::chrono::milliseconds g_drainPeriod{10};
+
+/**
+ * @brief Header of the binary profile.
+ */
+struct ProfileHeader {
+	/// Magic number.
+	std::array<char, 4> magic = g_profileMagic;
+	/// File layout version.
+	uint32_t version = g_profileVersion;
+	/// Session start time in ticks.
+	int64_t start = 0;
+	/// Duration of a tick.
+	double nanosecondsPerTick = 1.0;
+	/// Number of events following the header.
+	uint64_t eventCount = 0;
+	/// Number of names following the events.
+	uint64_t nameCount = 0;
+};
+
+/// Counter for the thread indices.
+std::atomic<uint32_t> g_threadCount{0};
+
+/**
+ * @brief Calibration of the ticks over a session, from its start to now.
+ * @param[in] iSession The session.
+ * @return Duration of a tick in nanoseconds.
+ */
+auto calibrate(const ProfileSession& iSession) -> double {
+	const int64_t ticks = ProfileTimer::now() - iSession.start;
+	const auto duration =
+			std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - iSession.startTime);
+	return ticks > 0 ? static_cast<double>(duration.count()) / static_cast<double>(ticks) : 1.0;
+}
+
+}// namespace
+
+/**
+ * @brief Single producer, single consumer ring of events.
+ */
+class ThreadBuffer {
+public:
+	/**
+	 * @brief Add an event, it is dropped if the ring is full.
+	 * @param[in] iEvent The event.
+	 */
+	void push(const ProfileEvent& iEvent) {
+		const uint64_t head = m_head.load(std::memory_order_relaxed);
+		if (head - m_tail.load(std::memory_order_acquire) >= g_ringSize) {
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		m_events[head & (g_ringSize - 1)] = iEvent;
+		m_head.store(head + 1, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Write the pending events.
+	 * @param[in,out] ioStream Where to write.
+	 * @return Number of written events.
+	 */
+	auto drain(std::ostream& ioStream) -> uint64_t {
+		const uint64_t tail = m_tail.load(std::memory_order_relaxed);
+		const uint64_t head = m_head.load(std::memory_order_acquire);
+		for (uint64_t i = tail; i < head;) {
+			// contiguous part of the ring.
+			const uint64_t index = i & (g_ringSize - 1);
+			const uint64_t count = std::min(head - i, g_ringSize - index);
+			ioStream.write(reinterpret_cast<const char*>(m_events.data() + index),
+						   static_cast<std::streamsize>(count * sizeof(ProfileEvent)));
+			i += count;
+		}
+		m_tail.store(head, std::memory_order_release);
+		return head - tail;
+	}
+
+	/**
+	 * @brief Forget the pending events.
+	 */
+	void discard() { m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_release); }
+
+	/**
+	 * @brief Check if all events have been drained.
+	 * @return True if no pending event.
+	 */
+	[[nodiscard]] auto isEmpty() const -> bool {
+		return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief Get and reset the number of dropped events.
+	 * @return Number of dropped events.
+	 */
+	auto takeDropped() -> uint64_t { return m_dropped.exchange(0, std::memory_order_relaxed); }
+
+	/// Index of the owning thread.
+	uint32_t threadId = 0;
+
+private:
+	/// The events.
+	std::array<ProfileEvent, g_ringSize> m_events{};
+	/// Write position.
+	alignas(64) std::atomic<uint64_t> m_head{0};
+	/// Read position.
+	alignas(64) std::atomic<uint64_t> m_tail{0};
+	/// Number of events dropped because the ring was full.
+	std::atomic<uint64_t> m_dropped{0};
+};
+
 Profiler::Profiler() = default;
 
 Profiler::~Profiler() { endSession(); }
 
 void Profiler::beginSession(const std::string& iName, const std::string& iFilepath) {
+	stopDraining();
 	const std::lock_guard<std::mutex> lock(m_profilerMutex);
 	if (m_currentSession) {
 		// If there is already a current session, then close it before beginning
@@ -31,11 +152,34 @@ void Profiler::beginSession(const std::string& iName, const std::string& iFilepa
 		}
 		internalEndSession();
 	}
-	m_outputStream.open(iFilepath);
+	auto session = mkUniq<ProfileSession>(iName);
+	session->binaryFile = iFilepath;
+	if (session->binaryFile.extension() == ".json") {
+		session->jsonFile = session->binaryFile;
+		session->binaryFile.replace_extension(".owlprof");
+	}
+	if (!iFilepath.empty())
+		m_outputStream.open(session->binaryFile, std::ios::out | std::ios::binary);
 
 	if (m_outputStream.is_open()) {
-		m_currentSession = mkUniq<ProfileSession>(iName);
+		session->startTime = std::chrono::steady_clock::now();
+		session->start = ProfileTimer::now();
+		m_currentSession = std::move(session);
 		writeHeader();
+		// events of a previous session not yet drained are discarded.
+		{
+			const std::lock_guard registryLock(m_registryMutex);
+			for (const auto& buffer: m_buffers) buffer->discard();
+		}
+		m_active.store(true, std::memory_order_release);
+		m_drainThread = std::jthread([this](const std::stop_token& iStop) {
+			while (!iStop.stop_requested()) {
+				std::this_thread::sleep_for(g_drainPeriod);
+				const std::lock_guard<std::mutex> drainLock(m_profilerMutex);
+				if (m_currentSession)
+					drain();
+			}
+		});
 	} else {
 		if (core::Log::getCoreLogger()) {// Edge case: BeginSession() might be  before Log::Init()
 			OWL_CORE_ERROR("Instrumentor could not open results file '{}'.", iFilepath)
@@ -44,51 +188,161 @@ void Profiler::beginSession(const std::string& iName, const std::string& iFilepa
 }
 
 void Profiler::endSession() {
+	stopDraining();
 	const std::lock_guard<std::mutex> lock(m_profilerMutex);
 	internalEndSession();
 }
 
-void Profiler::writeProfile(const ProfileResult& iResult) {
-	std::stringstream json;
+void Profiler::stopDraining() {
+	m_active.store(false, std::memory_order_release);
+	if (m_drainThread.joinable()) {
+		m_drainThread.request_stop();
+		m_drainThread.join();
+	}
+}
+
+auto Profiler::internName(const char* iName) -> uint32_t {
+	const std::lock_guard lock(m_registryMutex);
+	if (const auto it = m_nameIds.find(iName); it != m_nameIds.end())
+		return it->second;
+	const auto id = static_cast<uint32_t>(m_names.size());
+	m_names.emplace_back(iName);
+	m_nameIds.emplace(iName, id);
+	return id;
+}
 
-	json << std::setprecision(3) << std::fixed;
-	json << ",{";
-	json << R"("cat":"function",)";
-	json << "\"dur\":" << (iResult.elapsedTime.count()) << ',';
-	json << R"("name":")" << iResult.name << "\",";
-	json << R"("ph":"X",)";
-	json << "\"pid\":0,";
-	json << "\"tid\":" << iResult.threadId << ",";
-	json << "\"ts\":" << iResult.start.count();
-	json << "}";
+auto Profiler::getName(const uint32_t iNameId) -> std::string {
+	const std::lock_guard lock(m_registryMutex);
+	return iNameId < m_names.size() ? m_names[iNameId] : std::string{};
+}
+
+void Profiler::record(const uint32_t iNameId, const int64_t iStart, const int64_t iEnd) {
+	auto& buffer = threadBuffer();
+	buffer.push({.nameId = iNameId, .threadId = buffer.threadId, .start = iStart, .end = iEnd});
+}
 
+auto Profiler::getNanosecondsPerTick() -> double {
 	const std::lock_guard<std::mutex> lock(m_profilerMutex);
-	if (m_currentSession) {
-		m_outputStream << json.str();
-		m_outputStream.flush();
+	return m_currentSession ? calibrate(*m_currentSession) : 1.0;
+}
+
+void Profiler::recordGpu(const uint32_t iNameId, const int64_t iStart, const int64_t iEnd) {
+	threadBuffer().push({.nameId = iNameId, .threadId = g_gpuThreadId, .start = iStart, .end = iEnd});
+}
+
+auto Profiler::threadBuffer() -> ThreadBuffer& {
+	thread_local shared<ThreadBuffer> buffer;
+	if (!buffer) {
+		buffer = mkShared<ThreadBuffer>();
+		buffer->threadId = g_threadCount.fetch_add(1, std::memory_order_relaxed);
+		const std::lock_guard lock(m_registryMutex);
+		// the buffers of the terminated threads are released once drained.
+		std::erase_if(m_buffers, [](const shared<ThreadBuffer>& iBuffer) {
+			return iBuffer.use_count() == 1 && iBuffer->isEmpty();
+		});
+		m_buffers.push_back(buffer);
 	}
+	return *buffer;
 }
 
 void Profiler::writeHeader() {
-	m_outputStream << R"({"otherData": {},"traceEvents":[{})";
-	m_outputStream.flush();
+	const ProfileHeader header{.start = m_currentSession->start};
+	m_outputStream.write(reinterpret_cast<const char*>(&header), sizeof(ProfileHeader));
+}
+
+void Profiler::drain() {
+	uint64_t dropped = 0;
+	const std::lock_guard lock(m_registryMutex);
+	for (const auto& buffer: m_buffers) {
+		m_currentSession->eventCount += buffer->drain(m_outputStream);
+		dropped += buffer->takeDropped();
+	}
+	if (dropped > 0 && core::Log::getCoreLogger())
+		OWL_CORE_WARN("Profiler: {} events dropped, buffers full.", dropped)
 }
 
 void Profiler::writeFooter() {
-	m_outputStream << "]}";
-	m_outputStream.flush();
+	std::vector<std::string> names;
+	{
+		const std::lock_guard lock(m_registryMutex);
+		names = m_names;
+	}
+	for (const auto& name: names) {
+		const auto size = static_cast<uint32_t>(name.size());
+		m_outputStream.write(reinterpret_cast<const char*>(&size), sizeof(uint32_t));
+		m_outputStream.write(name.data(), static_cast<std::streamsize>(size));
+	}
+	const ProfileHeader header{.start = m_currentSession->start,
+							   .nanosecondsPerTick = calibrate(*m_currentSession),
+							   .eventCount = m_currentSession->eventCount,
+							   .nameCount = names.size()};
+	m_outputStream.seekp(0);
+	m_outputStream.write(reinterpret_cast<const char*>(&header), sizeof(ProfileHeader));
 }
 
 void Profiler::internalEndSession() {
 	if (m_currentSession) {
+		drain();
 		writeFooter();
 		m_outputStream.close();
+		if (!m_currentSession->jsonFile.empty()) {
+			if (convertToChromeTrace(m_currentSession->binaryFile, m_currentSession->jsonFile))
+				std::filesystem::remove(m_currentSession->binaryFile);
+		}
 		m_currentSession.reset();
 		m_currentSession = nullptr;
 	}
 }
 
-ProfileTimer::ProfileTimer(const char* iName) : m_name(iName), m_startTimePoint{std::chrono::steady_clock::now()} {}
+auto Profiler::convertToChromeTrace(const std::filesystem::path& iBinaryFile, const std::filesystem::path& iJsonFile)
+		-> bool {
+	std::ifstream in(iBinaryFile, std::ios::in | std::ios::binary);
+	if (!in.is_open())
+		return false;
+	ProfileHeader header;
+	in.read(reinterpret_cast<char*>(&header), sizeof(ProfileHeader));
+	if (!in || header.magic != g_profileMagic || header.version != g_profileVersion)
+		return false;
+	std::vector<ProfileEvent> events(header.eventCount);
+	in.read(reinterpret_cast<char*>(events.data()), static_cast<std::streamsize>(events.size() * sizeof(ProfileEvent)));
+	std::vector<std::string> names(header.nameCount);
+	for (auto& name: names) {
+		uint32_t size = 0;
+		in.read(reinterpret_cast<char*>(&size), sizeof(uint32_t));
+		name.resize(size);
+		in.read(name.data(), static_cast<std::streamsize>(size));
+	}
+	if (!in)
+		return false;
+	std::ofstream out(iJsonFile, std::ios::out);
+	if (!out.is_open())
+		return false;
+	out << R"({"otherData": {},"traceEvents":[{})";
+	if (std::ranges::any_of(events, [](const ProfileEvent& iEvent) { return iEvent.threadId == g_gpuThreadId; }))
+		out << fmt::format(R"(,{{"name":"thread_name","ph":"M","pid":0,"tid":{},"args":{{"name":"GPU"}}}})",
+						   g_gpuThreadId);
+	for (const auto& [nameId, threadId, start, end]: events) {
+		out << fmt::format(R"(,{{"cat":"function","dur":{:.3f},"name":"{}","ph":"X","pid":0,"tid":{},"ts":{:.3f}}})",
+						   static_cast<double>(end - start) * header.nanosecondsPerTick / 1000.0,
+						   nameId < names.size() ? names[nameId] : std::string{"unknown"}, threadId,
+						   static_cast<double>(start - header.start) * header.nanosecondsPerTick / 1000.0);
+	}
+	out << "]}";
+	return out.good();
+}
+
+ProfileTimer::ProfileTimer(const char* iName) : ProfileTimer(Profiler::get().internName(iName)) {}
+
+ProfileTimer::ProfileTimer(const uint32_t iNameId)
+	: m_nameId{iNameId}, m_session{Profiler::get().isSessionActive()}, m_frame{FrameProfiler::isRecordingThread()} {
+	if (!m_session && !m_frame) {
+		m_stopped = true;
+		return;
+	}
+	m_start = now();
+	if (m_frame)
+		FrameProfiler::beginScope(m_nameId, m_start);
+}
 
 ProfileTimer::~ProfileTimer() {
 	if (!m_stopped)
@@ -96,14 +350,13 @@ ProfileTimer::~ProfileTimer() {
 }
 
 void ProfileTimer::stop() {
-	const auto endTimePoint = std::chrono::steady_clock::now();
-	const auto highResStart = floatingPointMicroseconds{m_startTimePoint.time_since_epoch()};
-	const auto elapsedTime =
-			std::chrono::time_point_cast<std::chrono::microseconds>(endTimePoint).time_since_epoch() -
-			std::chrono::time_point_cast<std::chrono::microseconds>(m_startTimePoint).time_since_epoch();
-
-	Profiler::get().writeProfile({m_name, highResStart, elapsedTime, std::this_thread::get_id()});
-
+	if (m_stopped)
+		return;
+	const auto end = now();
+	if (m_session)
+		Profiler::get().record(m_nameId, m_start, end);
+	if (m_frame)
+		FrameProfiler::endScope(m_nameId, end);
 	m_stopped = true;
 }
 
@@ -9,20 +9,33 @@
 
 #include "core/Log.h"
 #include <fstream>
+#include <mutex>
+#include <thread>
+#if defined(__x86_64__) || defined(_M_X64)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
 
 namespace owl::debug {
 
-/// The type for microseconds.
-using floatingPointMicroseconds = std::chrono::duration<double, std::micro>;
+/// Thread identifier of the events measured on the GPU.
+constexpr uint32_t g_gpuThreadId{std::numeric_limits<uint32_t>::max()};
 
 /**
- * @brief Data for profiling result.
+ * @brief Event recorded by a profiled scope.
  */
-struct ProfileResult {
-	std::string name;///< Result's name.
-	floatingPointMicroseconds start;///< Data's starting time point.
-	std::chrono::microseconds elapsedTime;///< Data's elapsed time.
-	std::thread::id threadId;///< Data's thread ID.
+struct ProfileEvent {
+	/// Interned name of the scope.
+	uint32_t nameId = 0;
+	/// Index of the thread.
+	uint32_t threadId = 0;
+	/// Start time in ticks.
+	int64_t start = 0;
+	/// End time in ticks.
+	int64_t end = 0;
 };
 
 /**
@@ -31,10 +44,21 @@ struct ProfileResult {
 struct ProfileSession {
 	explicit ProfileSession(std::string iName) : name{std::move(iName)} {}
 	std::string name;/// Session's name.
+	std::filesystem::path binaryFile;/// File receiving the events.
+	std::filesystem::path jsonFile;/// Chrome trace file to generate at the end, if any.
+	int64_t start = 0;/// Session's start time in ticks.
+	std::chrono::steady_clock::time_point startTime;/// Session's start time.
+	uint64_t eventCount = 0;/// Number of written events.
 };
 
+class ThreadBuffer;
+
 /**
  * @brief class for accessing to the internal profiler.
+ *
+ * Each thread writes fixed-size binary events in its own lock-free ring buffer. A background thread drains the
+ * buffers into the session file. Sessions opened with a `.json` file are converted to Chrome trace format at their
+ * end, other extensions keep the compact binary file.
  */
 class OWL_API Profiler {
 public:
@@ -56,10 +80,55 @@ public:
 	void endSession();
 
 	/**
-	 * @brief Write profiling result into json file.
-	 * @param[in] iResult The Result to write.
+	 * @brief Check if a session is running.
+	 * @return True if events are recorded.
+	 */
+	[[nodiscard]] auto isSessionActive() const -> bool { return m_active.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Get the unique identifier of a scope name.
+	 * @param[in] iName The scope name.
+	 * @return The name identifier.
+	 */
+	auto internName(const char* iName) -> uint32_t;
+
+	/**
+	 * @brief Get a scope name from its identifier.
+	 * @param[in] iNameId The name identifier.
+	 * @return The scope name, empty if unknown.
+	 */
+	auto getName(uint32_t iNameId) -> std::string;
+
+	/**
+	 * @brief Record an event in the calling thread's buffer.
+	 * @param[in] iNameId The scope name identifier.
+	 * @param[in] iStart Start time in ticks.
+	 * @param[in] iEnd End time in ticks.
 	 */
-	void writeProfile(const ProfileResult& iResult);
+	void record(uint32_t iNameId, int64_t iStart, int64_t iEnd);
+
+	/**
+	 * @brief Record an event measured on the GPU, displayed in its own track.
+	 * @param[in] iNameId The scope name identifier.
+	 * @param[in] iStart Start time in ticks.
+	 * @param[in] iEnd End time in ticks.
+	 */
+	void recordGpu(uint32_t iNameId, int64_t iStart, int64_t iEnd);
+
+	/**
+	 * @brief Get the duration of a tick, with the calibration of the current session written in its header.
+	 * @return Nanoseconds per tick, 1 without session.
+	 */
+	auto getNanosecondsPerTick() -> double;
+
+	/**
+	 * @brief Convert a binary profile file to a Chrome trace file.
+	 * @param[in] iBinaryFile The binary profile.
+	 * @param[in] iJsonFile The Chrome trace file to write.
+	 * @return True if succeeded.
+	 */
+	static auto convertToChromeTrace(const std::filesystem::path& iBinaryFile, const std::filesystem::path& iJsonFile)
+			-> bool;
 
 	/**
 	 * @brief Singleton accessor.
@@ -82,27 +151,58 @@ private:
 	~Profiler();
 
 	/**
-	 * @brief write json header.
+	 * @brief write the file header.
 	 */
 	void writeHeader();
 
 	/**
-	 * @brief write json footer.
+	 * @brief write the names and complete the header.
 	 */
 	void writeFooter();
 
+	/**
+	 * @brief Write the pending events into the session file.
+	 *
+	 * @note: you must already own lock on m_profilerMutex.
+	 */
+	void drain();
+
+	/**
+	 * @brief Stop the recording and the background draining, must be called without owning m_profilerMutex.
+	 */
+	void stopDraining();
+
 	/**
 	 * @brief Terminate the session.
 	 *
-	 * @note: you must already own lock on m_Mutex before calling InternalEndSession().
+	 * @note: you must already own lock on m_profilerMutex before calling InternalEndSession().
 	 */
 	void internalEndSession();
+
+	/**
+	 * @brief Get the buffer of the calling thread.
+	 * @return The thread buffer.
+	 */
+	auto threadBuffer() -> ThreadBuffer&;
+
 	/// Mutex.
 	std::mutex m_profilerMutex;
 	/// Actual running session.
 	uniq<ProfileSession> m_currentSession{nullptr};
 	/// Output file stream.
 	std::ofstream m_outputStream;
+	/// If a session is running.
+	std::atomic<bool> m_active{false};
+	/// Background thread draining the buffers.
+	std::jthread m_drainThread;
+	/// Mutex for the buffers list and the names.
+	std::mutex m_registryMutex;
+	/// The thread buffers.
+	std::vector<shared<ThreadBuffer>> m_buffers;
+	/// The interned names.
+	std::vector<std::string> m_names;
+	/// Identifier of the interned names.
+	std::unordered_map<std::string, uint32_t> m_nameIds;
 };
 
 /**
@@ -116,6 +216,12 @@ public:
 	 */
 	explicit ProfileTimer(const char* iName);
 
+	/**
+	 * @brief Constructor.
+	 * @param[in] iNameId Scope's interned name.
+	 */
+	explicit ProfileTimer(uint32_t iNameId);
+
 	ProfileTimer(const ProfileTimer&) = delete;
 	ProfileTimer(ProfileTimer&&) = delete;
 	auto operator=(const ProfileTimer&) -> ProfileTimer& = delete;
@@ -130,11 +236,29 @@ public:
 	 */
 	void stop();
 
+	/**
+	 * @brief Get the current time in the profiler time base.
+	 * @return Time in ticks (time stamp counter when available, else nanoseconds).
+	 */
+	static auto now() -> int64_t {
+#if defined(__x86_64__) || defined(_M_X64)
+		return static_cast<int64_t>(__rdtsc());
+#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+					   std::chrono::steady_clock::now().time_since_epoch())
+				.count();
+#endif
+	}
+
 private:
-	/// Scope's name.
-	const char* m_name;
-	/// Timer starting point.
-	std::chrono::time_point<std::chrono::steady_clock> m_startTimePoint;
+	/// Scope's interned name.
+	uint32_t m_nameId;
+	/// Timer starting point in ticks.
+	int64_t m_start{0};
+	/// If the scope is recorded in the profiling session.
+	bool m_session{false};
+	/// If the scope is recorded by the frame profiler.
+	bool m_frame{false};
 	/// Timer state, true if not running.
 	bool m_stopped{false};
 };
@@ -192,7 +316,6 @@ OWL_DIAG_POP
 #undef OWL_PROFILE
 #define OWL_PROFILE 1
 #endif
-#if OWL_PROFILE
 // Resolve which function signature macro will be used. Note that this only
 // is resolved when the (pre)compiler starts, so the syntax highlighting
 // could mark the wrong one in your editor!
@@ -215,17 +338,20 @@ OWL_DIAG_POP
 #define OWL_FUNC_SIG "OWL_FUNC_SIG unknown!"
 #endif
 
-#define OWL_PROFILE_BEGIN_SESSION(name, filepath) ::owl::debug::Profiler::get().beginSession(name, filepath);
-#define OWL_PROFILE_END_SESSION() ::owl::debug::Profiler::get().endSession();
+// The scopes are always instrumented so the frame profiler can be enabled at runtime, they only check two flags
+// when nothing is recording.
 #define OWL_PROFILE_SCOPE_LINE2(name, line)                                                                            \
-	constexpr auto fixedName##line = ::owl::debug::utils::cleanupOutputString(name, "__cdecl ");                       \
-	::owl::debug::ProfileTimer timer##line(fixedName##line.data);
+	static constexpr auto fixedName##line = ::owl::debug::utils::cleanupOutputString(name, "__cdecl ");                \
+	static const uint32_t nameId##line = ::owl::debug::Profiler::get().internName(fixedName##line.data);               \
+	::owl::debug::ProfileTimer timer##line(nameId##line);
 #define OWL_PROFILE_SCOPE_LINE(name, line) OWL_PROFILE_SCOPE_LINE2(name, line)
 #define OWL_PROFILE_SCOPE(name) OWL_PROFILE_SCOPE_LINE(name, __LINE__)
 #define OWL_PROFILE_FUNCTION() OWL_PROFILE_SCOPE(OWL_FUNC_SIG)
+
+#if OWL_PROFILE
+#define OWL_PROFILE_BEGIN_SESSION(name, filepath) ::owl::debug::Profiler::get().beginSession(name, filepath);
+#define OWL_PROFILE_END_SESSION() ::owl::debug::Profiler::get().endSession();
 #else
 #define OWL_PROFILE_BEGIN_SESSION(name, filepath)
 #define OWL_PROFILE_END_SESSION()
-#define OWL_PROFILE_SCOPE(name)
-#define OWL_PROFILE_FUNCTION()
 #endif
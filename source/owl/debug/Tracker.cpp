@@ -7,47 +7,65 @@
  */
 
 #include "owlpch.h"
-#include <stack>
 
 #include "Tracker.h"
 
+#include "HeapProfiler.h"
+
+#include <mutex>
+
 // NOLINTBEGIN(misc-no-recursion)
 
 #define OWL_DEALLOC_EXCEPT noexcept
 namespace {
 
-bool s_antiLoop = false;
-
-class TrackerState {
-public:
-	/// Destructor.
-	~TrackerState() = default;
-
-	TrackerState(const TrackerState&) = delete;
-	TrackerState(TrackerState&&) = delete;
-	auto operator=(const TrackerState&) -> TrackerState& = delete;
-	auto operator=(TrackerState&&) -> TrackerState& = delete;
+/// Maximal depth of tracking scopes.
+constexpr size_t g_maxTrackDepth = 32;
 
-	static auto get() -> TrackerState& {
-		static TrackerState instance;
-		return instance;
+/**
+ * @brief Tracking state of a thread, trivially destructible to stay usable until the thread end.
+ */
+struct ThreadContext {
+	/// Re-entrancy guard: true while the thread is inside the tracker.
+	bool inTracker = false;
+	/// Number of tracking scopes.
+	size_t depth = 0;
+	/// Tracking scopes.
+	std::array<bool, g_maxTrackDepth> doTrack{};
+	/// Last chunk allocated by the thread.
+	void* lastAllocation = nullptr;
+
+	/// Scopes nested deeper than the limit are counted but keep the state of the deepest stored one.
+	[[nodiscard]] auto canTrack() const -> bool {
+		return depth == 0 || doTrack[std::min(depth, g_maxTrackDepth) - 1];
 	}
-
-	void pushTrack(const bool iState) { m_doTrack.push(iState); }
-	void popTrack() {
-		if (m_doTrack.size() > 1)
-			m_doTrack.pop();
+	void pushTrack(const bool iState) {
+		if (depth < g_maxTrackDepth)
+			doTrack[depth] = iState;
+		++depth;
 	}
-	[[nodiscard]] auto canTrack() const -> bool {
-		if (m_doTrack.empty())
-			return true;
-		return m_doTrack.top();
+	void popTrack() {
+		if (depth > 0)
+			--depth;
 	}
+};
+
+constinit thread_local ThreadContext t_context;
+
+/**
+ * @brief Set the re-entrancy guard of the thread during its lifetime.
+ */
+class Guard {
+public:
+	Guard() : m_previous{t_context.inTracker} { t_context.inTracker = true; }
+	~Guard() { t_context.inTracker = m_previous; }
+	Guard(const Guard&) = delete;
+	Guard(Guard&&) = delete;
+	auto operator=(const Guard&) -> Guard& = delete;
+	auto operator=(Guard&&) -> Guard& = delete;
 
 private:
-	/// states of tracking
-	std::stack<bool> m_doTrack;
-	TrackerState() { m_doTrack.push(true); }
+	bool m_previous;
 };
 
 }// namespace
@@ -78,93 +96,404 @@ namespace owl::debug {
 
 namespace {
 
-class StateManager {
+/// Current tracking period, incremented at each state check.
+std::atomic<uint32_t> g_generation{0};
+
+/**
+ * @brief Allocation counters of a thread, only written by its thread.
+ */
+struct alignas(64) ThreadCounters {
+	/// Number of tracked allocations.
+	std::atomic<size_t> allocationCalls{0};
+	/// Amount of tracked allocated memory.
+	std::atomic<size_t> allocatedBytes{0};
+	/// Number of tracked de-allocations.
+	std::atomic<size_t> deallocationCalls{0};
+	/// Amount of tracked de-allocated memory.
+	std::atomic<size_t> deallocatedBytes{0};
+	/// Number of de-allocations of chunks allocated in the same tracking period.
+	std::atomic<size_t> periodDeallocationCalls{0};
+	/// If a thread owns these counters.
+	std::atomic<bool> inUse{true};
+	/// Next counters in the pool.
+	ThreadCounters* next = nullptr;
+};
+
+/**
+ * @brief Sum of the counters of all threads.
+ */
+struct CounterTotals {
+	size_t allocationCalls = 0;
+	size_t allocatedBytes = 0;
+	size_t deallocationCalls = 0;
+	size_t deallocatedBytes = 0;
+	size_t periodDeallocationCalls = 0;
+};
+
+/**
+ * @brief Pool of the thread counters, the counters are recycled when threads end and never freed.
+ */
+class CounterPool {
+public:
+	static auto get() -> CounterPool& {
+		// never destroyed: allocations may happen after the static destructions.
+		static auto* instance = new CounterPool;
+		return *instance;
+	}
+
+	auto acquire() -> ThreadCounters* {
+		for (auto* counters = m_head.load(std::memory_order_acquire); counters != nullptr;
+			 counters = counters->next) {
+			if (bool expected = false; counters->inUse.compare_exchange_strong(expected, true))
+				return counters;
+		}
+		auto* counters = new ThreadCounters;
+		counters->next = m_head.load(std::memory_order_relaxed);
+		while (!m_head.compare_exchange_weak(counters->next, counters, std::memory_order_release,
+											 std::memory_order_relaxed)) {}
+		return counters;
+	}
+
+	[[nodiscard]] auto sum() const -> CounterTotals {
+		CounterTotals totals;
+		for (const auto* counters = m_head.load(std::memory_order_acquire); counters != nullptr;
+			 counters = counters->next) {
+			totals.allocationCalls += counters->allocationCalls.load(std::memory_order_relaxed);
+			totals.allocatedBytes += counters->allocatedBytes.load(std::memory_order_relaxed);
+			totals.deallocationCalls += counters->deallocationCalls.load(std::memory_order_relaxed);
+			totals.deallocatedBytes += counters->deallocatedBytes.load(std::memory_order_relaxed);
+			totals.periodDeallocationCalls += counters->periodDeallocationCalls.load(std::memory_order_relaxed);
+		}
+		return totals;
+	}
+
+private:
+	CounterPool() = default;
+	/// Head of the counters list.
+	std::atomic<ThreadCounters*> m_head{nullptr};
+};
+
+/**
+ * @brief Give back the thread counters to the pool at thread end.
+ */
+struct CounterRelease {
+	ThreadCounters* counters = nullptr;
+	CounterRelease() = default;
+	~CounterRelease() {
+		if (counters != nullptr)
+			counters->inUse.store(false, std::memory_order_release);
+	}
+	CounterRelease(const CounterRelease&) = delete;
+	CounterRelease(CounterRelease&&) = delete;
+	auto operator=(const CounterRelease&) -> CounterRelease& = delete;
+	auto operator=(CounterRelease&&) -> CounterRelease& = delete;
+};
+
+/**
+ * @brief Get the counters of the calling thread, must be called inside the guard.
+ * @return The thread counters.
+ */
+auto threadCounters() -> ThreadCounters& {
+	// plain pointer: still valid in the thread after the release of its counters.
+	constinit thread_local ThreadCounters* counters = nullptr;
+	if (counters == nullptr) {
+		counters = CounterPool::get().acquire();
+		thread_local CounterRelease release;
+		release.counters = counters;
+	}
+	return *counters;
+}
+
+/**
+ * @brief Live chunks of memory, in an open addressing hash table split in independently locked shards.
+ */
+class ChunkTable {
 public:
-	static void allocate() {
-		s_globalAllocationState = std::make_shared<AllocationState>();
-		s_currentAllocationState = std::make_shared<AllocationState>();
-		s_lastAllocationState = std::make_shared<AllocationState>();
+	static auto get() -> ChunkTable& {
+		// never destroyed: allocations may happen after the static destructions.
+		static auto* instance = new ChunkTable;
+		return *instance;
+	}
+
+	/**
+	 * @brief A chunk of memory.
+	 */
+	struct Chunk {
+		void* location = nullptr;
+		size_t size = 0;
+		uint32_t generation = 0;
+#ifdef OWL_STACKTRACE
+		cpptrace::stacktrace* trace = nullptr;
+#endif
+	};
+
+	/**
+	 * @brief Add a chunk, replacing any chunk at the same location.
+	 * @param[in] iChunk The chunk to add.
+	 * @return The replaced chunk if any.
+	 */
+	auto insert(const Chunk& iChunk) -> std::optional<Chunk> {
+		const uint64_t hash = hashOf(iChunk.location);
+		auto& shard = m_shards[hash >> (64 - g_shardBits)];
+		const std::lock_guard lock(shard.mutex);
+		if ((shard.count + 1) * 2 > shard.slots.size())
+			shard.grow();
+		const size_t mask = shard.slots.size() - 1;
+		for (size_t i = hash & mask;; i = (i + 1) & mask) {
+			auto& slot = shard.slots[i];
+			if (slot.location == nullptr) {
+				slot = iChunk;
+				++shard.count;
+				return std::nullopt;
+			}
+			if (slot.location == iChunk.location)
+				return std::exchange(slot, iChunk);
+		}
+	}
+
+	/**
+	 * @brief Remove a chunk.
+	 * @param[in] iLocation Location of the chunk.
+	 * @return The removed chunk, or nullopt if not found.
+	 */
+	auto erase(void* iLocation) -> std::optional<Chunk> {
+		const uint64_t hash = hashOf(iLocation);
+		auto& shard = m_shards[hash >> (64 - g_shardBits)];
+		const std::lock_guard lock(shard.mutex);
+		if (shard.count == 0)
+			return std::nullopt;
+		const size_t mask = shard.slots.size() - 1;
+		size_t hole = hash & mask;
+		while (shard.slots[hole].location != iLocation) {
+			if (shard.slots[hole].location == nullptr)
+				return std::nullopt;
+			hole = (hole + 1) & mask;
+		}
+		const Chunk removed = shard.slots[hole];
+		// backward shift deletion: move back the following chunks that are out of their home slot.
+		for (size_t next = (hole + 1) & mask; shard.slots[next].location != nullptr; next = (next + 1) & mask) {
+			const size_t home = hashOf(shard.slots[next].location) & mask;
+			if (((next - home) & mask) >= ((next - hole) & mask)) {
+				shard.slots[hole] = shard.slots[next];
+				hole = next;
+			}
+		}
+		shard.slots[hole] = {};
+		--shard.count;
+		return removed;
 	}
-	static void pushMemory(void* iLocation, const size_t iSize) {
-		if (!s_globalAllocationState)
-			allocate();
-		s_currentAllocationState->pushMemory(iLocation, iSize);
-		s_globalAllocationState->pushMemory(iLocation, iSize);
+
+	/**
+	 * @brief Find a chunk.
+	 * @param[in] iLocation Location of the chunk.
+	 * @param[in] iGeneration If set, the chunk must belong to this tracking period.
+	 * @return The chunk information, or nullopt if not found.
+	 */
+	[[nodiscard]] auto find(void* iLocation, const std::optional<uint32_t>& iGeneration) const
+			-> std::optional<AllocationInfo> {
+		const uint64_t hash = hashOf(iLocation);
+		const auto& shard = m_shards[hash >> (64 - g_shardBits)];
+		const std::lock_guard lock(shard.mutex);
+		if (shard.count == 0)
+			return std::nullopt;
+		const size_t mask = shard.slots.size() - 1;
+		for (size_t i = hash & mask; shard.slots[i].location != nullptr; i = (i + 1) & mask) {
+			if (shard.slots[i].location != iLocation)
+				continue;
+			if (iGeneration.has_value() && shard.slots[i].generation != iGeneration.value())
+				return std::nullopt;
+			return toInfo(shard.slots[i]);
+		}
+		return std::nullopt;
+	}
+
+	/**
+	 * @brief Call a function on each chunk.
+	 * @param[in] iGeneration If set, only the chunks of this tracking period are visited.
+	 * @param[in] iFunction The function to call, returns false to stop.
+	 */
+	void forEach(const std::optional<uint32_t>& iGeneration,
+				 const std::function<bool(const Chunk&)>& iFunction) const {
+		for (const auto& shard: m_shards) {
+			const std::lock_guard lock(shard.mutex);
+			for (const auto& slot: shard.slots) {
+				if (slot.location == nullptr || (iGeneration.has_value() && slot.generation != iGeneration.value()))
+					continue;
+				if (!iFunction(slot))
+					return;
+			}
+		}
+	}
+
+	static auto toInfo(const Chunk& iChunk) -> AllocationInfo {
+		AllocationInfo info(iChunk.location, iChunk.size);
+#ifdef OWL_STACKTRACE
+		if (iChunk.trace != nullptr)
+			info.fullTrace = *iChunk.trace;
+#endif
+		return info;
 	}
-	static void freeMemory(void* iLocation, const size_t iSize) {
-		s_currentAllocationState->freeMemory(iLocation, iSize);
-		s_globalAllocationState->freeMemory(iLocation, iSize);
+
+private:
+	ChunkTable() = default;
+	/// Number of bits used for the shard selection.
+	static constexpr uint64_t g_shardBits = 6;
+	/// Initial number of slots of a shard.
+	static constexpr size_t g_initialSlots = 256;
+
+	static auto hashOf(const void* iLocation) -> uint64_t {
+		// murmur3 finalizer: both the high bits (shard) and the low bits (slot) must be well distributed.
+		auto hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(iLocation));
+		hash ^= hash >> 33;
+		hash *= 0xff51afd7ed558ccdull;
+		hash ^= hash >> 33;
+		hash *= 0xc4ceb9fe1a85ec53ull;
+		hash ^= hash >> 33;
+		return hash;
 	}
-	static void swapCurrent() {
-		if (!s_lastAllocationState)
-			allocate();
-		s_lastAllocationState->reset();
-		std::swap(s_currentAllocationState, s_lastAllocationState);
+
+	/**
+	 * @brief A part of the table.
+	 */
+	struct alignas(64) Shard {
+		mutable std::mutex mutex;
+		std::vector<Chunk> slots;
+		size_t count = 0;
+
+		void grow() {
+			std::vector<Chunk> old(std::max(g_initialSlots, slots.size() * 2));
+			std::swap(old, slots);
+			const size_t mask = slots.size() - 1;
+			for (const auto& chunk: old) {
+				if (chunk.location == nullptr)
+					continue;
+				size_t i = hashOf(chunk.location) & mask;
+				while (slots[i].location != nullptr) i = (i + 1) & mask;
+				slots[i] = chunk;
+			}
+		}
+	};
+	/// The shards.
+	std::array<Shard, size_t{1} << g_shardBits> m_shards;
+};
+
+/**
+ * @brief Reported states.
+ */
+class StateManager {
+public:
+	static auto get() -> StateManager& {
+		// never destroyed: allocations may happen after the static destructions.
+		static auto* instance = new StateManager;
+		return *instance;
 	}
-	[[nodiscard]] static auto getLastAllocationState() -> const AllocationState& {
-		if (!s_lastAllocationState)
-			allocate();
-		return *s_lastAllocationState;
+
+	auto checkState() -> const AllocationState& {
+		const std::lock_guard lock(m_mutex);
+		const auto totals = CounterPool::get().sum();
+		const uint32_t generation = g_generation.fetch_add(1, std::memory_order_relaxed);
+		size_t periodBytes = 0;
+		ChunkTable::get().forEach(generation, [&periodBytes](const ChunkTable::Chunk& iChunk) {
+			periodBytes += iChunk.size;
+			return true;
+		});
+		m_last.allocationCalls = totals.allocationCalls - m_lastTotals.allocationCalls;
+		m_last.deallocationCalls = totals.periodDeallocationCalls - m_lastTotals.periodDeallocationCalls;
+		m_last.allocatedMemory.size = periodBytes;
+		m_last.allocatedTotal.size = totals.allocatedBytes - m_lastTotals.allocatedBytes;
+		m_last.memoryPeek.size = periodBytes;
+		m_last.allocs = AllocationList{generation};
+		m_lastTotals = totals;
+		updateGlobals(totals);
+		return m_last;
 	}
-	[[nodiscard]] static auto getGlobalAllocationState() -> const AllocationState& {
-		if (!s_globalAllocationState)
-			allocate();
-		return *s_globalAllocationState;
+
+	auto globals() -> const AllocationState& {
+		const std::lock_guard lock(m_mutex);
+		updateGlobals(CounterPool::get().sum());
+		return m_globals;
 	}
 
 private:
+	StateManager() = default;
+
+	void updateGlobals(const CounterTotals& iTotals) {
+		m_globals.allocationCalls = iTotals.allocationCalls;
+		m_globals.deallocationCalls = iTotals.deallocationCalls;
+		m_globals.allocatedMemory.size = iTotals.allocatedBytes - iTotals.deallocatedBytes;
+		m_globals.allocatedTotal.size = iTotals.allocatedBytes;
+		m_globals.memoryPeek.size = std::max(m_globals.memoryPeek.size, m_globals.allocatedMemory.size);
+	}
+
+	/// Access protection.
+	std::mutex m_mutex;
 	/// Global Memory allocation state's info.
-	static shared<AllocationState> s_globalAllocationState;
-	/// Current Memory allocation state's info.
-	static shared<AllocationState> s_currentAllocationState;
+	AllocationState m_globals;
 	/// Last Memory allocation state's info.
-	static shared<AllocationState> s_lastAllocationState;
+	AllocationState m_last;
+	/// Counters at the last check.
+	CounterTotals m_lastTotals;
 };
-shared<AllocationState> StateManager::s_globalAllocationState;
-shared<AllocationState> StateManager::s_currentAllocationState;
-shared<AllocationState> StateManager::s_lastAllocationState;
+
 }// namespace
 
 // =========================== TrackerAPI =================================
 
 void TrackerAPI::allocate(void* iMemoryPtr, const size_t iSize) {
-	if (s_antiLoop)
-		return;
-	s_antiLoop = true;
-	if (!TrackerState::get().canTrack()) {
-		s_antiLoop = false;
+	if (t_context.inTracker || iMemoryPtr == nullptr || !t_context.canTrack())
 		return;
+	const Guard guard;
+	ChunkTable::Chunk chunk{
+			.location = iMemoryPtr, .size = iSize, .generation = g_generation.load(std::memory_order_relaxed)};
+#ifdef OWL_STACKTRACE
+	chunk.trace = new cpptrace::stacktrace(cpptrace::generate_trace());
+#endif
+	auto& counters = threadCounters();
+	if (const auto replaced = ChunkTable::get().insert(chunk); replaced.has_value()) {
+		// the previous chunk at this location has been freed outside of the tracker.
+		counters.deallocationCalls.fetch_add(1, std::memory_order_relaxed);
+		counters.deallocatedBytes.fetch_add(replaced->size, std::memory_order_relaxed);
+#ifdef OWL_STACKTRACE
+		delete replaced->trace;
+#endif
 	}
-	StateManager::pushMemory(iMemoryPtr, iSize);
-	s_antiLoop = false;
+	counters.allocationCalls.fetch_add(1, std::memory_order_relaxed);
+	counters.allocatedBytes.fetch_add(iSize, std::memory_order_relaxed);
+	t_context.lastAllocation = iMemoryPtr;
+	HeapProfiler::onAllocation(iSize);
 }
 
-void TrackerAPI::deallocate(void* iMemoryPtr, const size_t iSize) {
-	if (s_antiLoop)
+void TrackerAPI::deallocate(void* iMemoryPtr, [[maybe_unused]] const size_t iSize) {
+	// untracked scopes do not skip the removal: the chunk must not stay alive in the table.
+	if (t_context.inTracker || iMemoryPtr == nullptr)
 		return;
-	s_antiLoop = true;
-	if (!TrackerState::get().canTrack()) {
-		s_antiLoop = false;
+	const Guard guard;
+	const auto chunk = ChunkTable::get().erase(iMemoryPtr);
+	if (!chunk.has_value())
 		return;
-	}
-	StateManager::freeMemory(iMemoryPtr, iSize);
-	s_antiLoop = false;
+	auto& counters = threadCounters();
+	counters.deallocationCalls.fetch_add(1, std::memory_order_relaxed);
+	counters.deallocatedBytes.fetch_add(chunk->size, std::memory_order_relaxed);
+	if (chunk->generation == g_generation.load(std::memory_order_relaxed))
+		counters.periodDeallocationCalls.fetch_add(1, std::memory_order_relaxed);
+#ifdef OWL_STACKTRACE
+	delete chunk->trace;
+#endif
 }
 
 auto TrackerAPI::checkState() -> const AllocationState& {
-	StateManager::swapCurrent();
-	return StateManager::getLastAllocationState();
+	const Guard guard;
+	return StateManager::get().checkState();
 }
 
-auto TrackerAPI::globals() -> const AllocationState& { return StateManager::getGlobalAllocationState(); }
+auto TrackerAPI::globals() -> const AllocationState& {
+	const Guard guard;
+	return StateManager::get().globals();
+}
 
 // =========================== Allocation Info =================================
 
-AllocationInfo::AllocationInfo(void* iLocation, const size_t iSize) : location{iLocation}, size{iSize} {
-#ifdef OWL_STACKTRACE
-	fullTrace = cpptrace::generate_trace();
-#endif
-}
+AllocationInfo::AllocationInfo(void* iLocation, const size_t iSize) : location{iLocation}, size{iSize} {}
 
 auto AllocationInfo::toStr([[maybe_unused]] const bool iTracePrint, [[maybe_unused]] const bool iFullTrace) const
 		-> std::string {
@@ -208,36 +537,50 @@ auto AllocationInfo::getCallerInfo() const -> const cpptrace::stacktrace_frame&
 }
 #endif
 
-// =========================== Allocation state =================================
-
-AllocationState::~AllocationState() { s_antiLoop = true; }
+// =========================== Allocation list =================================
 
-void AllocationState::pushMemory(void* iLocation, size_t iSize) {
-	allocationCalls++;
-	allocatedMemory.size += iSize;
-	memoryPeek.size = std::max(memoryPeek.size, allocatedMemory.size);
-	if (!s_antiLoop)
-		fmt::println("Problème d'antiloop!!!");
-	allocs.emplace_back(iLocation, iSize);
+auto AllocationList::size() const -> size_t {
+	const Guard guard;
+	size_t count = 0;
+	ChunkTable::get().forEach(m_generation, [&count](const ChunkTable::Chunk&) {
+		++count;
+		return true;
+	});
+	return count;
 }
 
-void AllocationState::freeMemory(void* iLocation, size_t iSize) {
-	if (const auto chunk = std::ranges::find_if(
-				allocs.begin(), allocs.end(),
-				[&iLocation](const AllocationInfo& iAllocInfo) { return iAllocInfo.location == iLocation; });
-		chunk != allocs.end()) {
-		if (iSize == 0) {
-			iSize = chunk->size.size;
-		}
-		allocs.erase(chunk);
-		deallocationCalls++;
-		allocatedMemory.size -= iSize;
+auto AllocationList::back() const -> AllocationInfo {
+	const Guard guard;
+	if (t_context.lastAllocation != nullptr) {
+		if (auto info = ChunkTable::get().find(t_context.lastAllocation, m_generation); info.has_value())
+			return std::move(info.value());
 	}
+	std::optional<AllocationInfo> result;
+	ChunkTable::get().forEach(m_generation, [&result](const ChunkTable::Chunk& iChunk) {
+		result = ChunkTable::toInfo(iChunk);
+		return false;
+	});
+	return result.value_or(AllocationInfo{nullptr, 0});
+}
+
+auto AllocationList::snapshot() const -> std::vector<AllocationInfo> {
+	std::vector<AllocationInfo> result;
+	const Guard guard;
+	ChunkTable::get().forEach(m_generation, [&result](const ChunkTable::Chunk& iChunk) {
+		result.push_back(ChunkTable::toInfo(iChunk));
+		return true;
+	});
+	return result;
 }
 
+// =========================== Allocation state =================================
+
+AllocationState::~AllocationState() = default;
+
 void AllocationState::reset() {
-	allocs.clear();
+	allocs = AllocationList{};
 	allocatedMemory.size = 0;
+	allocatedTotal.size = 0;
 	allocationCalls = 0;
 	deallocationCalls = 0;
 	memoryPeek.size = 0;
@@ -245,26 +588,10 @@ void AllocationState::reset() {
 
 // =========================== scopes ==============================
 
-ScopeUntrack::ScopeUntrack() {
-	s_antiLoop = true;
-	TrackerState::get().pushTrack(false);
-	s_antiLoop = false;
-}
-ScopeUntrack::~ScopeUntrack() {
-	s_antiLoop = true;
-	TrackerState::get().popTrack();
-	s_antiLoop = false;
-}
-ScopeTrack::ScopeTrack() {
-	s_antiLoop = true;
-	TrackerState::get().pushTrack(true);
-	s_antiLoop = false;
-}
-ScopeTrack::~ScopeTrack() {
-	s_antiLoop = true;
-	TrackerState::get().popTrack();
-	s_antiLoop = false;
-}
+ScopeUntrack::ScopeUntrack() { t_context.pushTrack(false); }
+ScopeUntrack::~ScopeUntrack() { t_context.popTrack(); }
+ScopeTrack::ScopeTrack() { t_context.pushTrack(true); }
+ScopeTrack::~ScopeTrack() { t_context.popTrack(); }
 
 }// namespace owl::debug
 
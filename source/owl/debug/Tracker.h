@@ -96,6 +96,48 @@ struct OWL_API AllocationInfo {
 	[[nodiscard]] OWL_API auto toStr(bool iTracePrint = true, bool iFullTrace = false) const -> std::string;
 };
 
+/**
+ * @brief View on the live chunks of memory held by the tracker.
+ *
+ * The chunks are stored in a sharded hash table, the view only reads it when queried.
+ */
+class OWL_API AllocationList {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param[in] iGeneration If set, only the chunks allocated during this tracking period are viewed.
+	 */
+	explicit AllocationList(std::optional<uint32_t> iGeneration = std::nullopt) : m_generation{iGeneration} {}
+
+	/**
+	 * @brief Get the number of live chunks.
+	 * @return Number of chunks.
+	 */
+	[[nodiscard]] auto size() const -> size_t;
+
+	/**
+	 * @brief Check if there is no live chunk.
+	 * @return True if empty.
+	 */
+	[[nodiscard]] auto empty() const -> bool { return size() == 0; }
+
+	/**
+	 * @brief Get the last chunk allocated by the calling thread, or any chunk if already freed.
+	 * @return The chunk information.
+	 */
+	[[nodiscard]] auto back() const -> AllocationInfo;
+
+	/**
+	 * @brief Copy the information of all the live chunks.
+	 * @return The chunks.
+	 */
+	[[nodiscard]] auto snapshot() const -> std::vector<AllocationInfo>;
+
+private:
+	/// The viewed tracking period.
+	std::optional<uint32_t> m_generation;
+};
+
 /**
  * @brief Result structure of allocation state.
  */
@@ -112,30 +154,23 @@ struct OWL_API AllocationState {
 	size_t allocationCalls{0};
 	/// Amount of de-allocation calls.
 	size_t deallocationCalls{0};
-	/// Max seen amount of memory.
+	/// Amount of allocated memory, without the de-allocations.
+	MemorySize allocatedTotal{0};
+	/// Max seen amount of memory (sampled at each state query).
 	MemorySize memoryPeek{0};
 	/// list of allocated chunks of memory.
-	std::list<AllocationInfo> allocs{};
+	AllocationList allocs{};
 	/**
-	 * @brief Reset the database.
+	 * @brief Reset the counters.
 	 */
 	void reset();
-	/**
-	 * @brief Add a chunk of memory to the database.
-	 * @param[in] iLocation Pointer to the allocated memory
-	 * @param[in] iSize Amount of allocated memory.
-	 */
-	void pushMemory(void* iLocation, size_t iSize);
-	/**
-	 * @brief Free the chunk of memory at the given location.
-	 * @param[in] iLocation Memory location.
-	 * @param[in] iSize Amount of memory.
-	 */
-	void freeMemory(void* iLocation, size_t iSize);
 };
 
 /**
  * @brief Simple API to manipulate the memory tracker.
+ *
+ * Counters are kept per thread and summed when queried, the re-entrancy guard and the tracking scopes are per
+ * thread too: the tracker can be called concurrently.
  */
 class OWL_API TrackerAPI {
 public:
@@ -154,14 +189,14 @@ public:
 	static void deallocate(void* iMemoryPtr, size_t iSize = 0);
 
 	/**
-	 * @brief Reset current memory state monitor and give the previous status.
+	 * @brief Start a new tracking period and give the status of the previous one.
 	 * @return Status since last call to check.
 	 */
 	static auto checkState() -> const AllocationState&;
 
 	/**
 	 * @brief Get the memory state since the start of the program.
-	 * @return Memory state.
+	 * @return Memory state, updated at each call.
 	 */
 	static auto globals() -> const AllocationState&;
 };
@@ -0,0 +1,107 @@
+/**
+ * @file AtlasGenerator.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "AtlasGenerator.h"
+
+#undef INFINITE
+#include <msdf-atlas-gen/msdf-atlas-gen.h>
+
+namespace owl::fonts {
+
+auto generateAtlas(const std::filesystem::path& iPath, const std::span<const CharsetRange> iCharset,
+				   const double iEmSize, const uint32_t iThreadCount) -> std::optional<FontAtlasData> {
+	OWL_PROFILE_FUNCTION()
+
+	msdfgen::FreetypeHandle* ft = msdfgen::initializeFreetype();
+	if (ft == nullptr) {
+		OWL_CORE_ERROR("Font: Failed to initialize Freetype library.")
+		return std::nullopt;
+	}
+	msdfgen::FontHandle* font = loadFont(ft, iPath.string().c_str());
+	if (font == nullptr) {
+		OWL_CORE_ERROR("Font: Failed to load font: {}", iPath.string())
+		deinitializeFreetype(ft);
+		return std::nullopt;
+	}
+	msdf_atlas::Charset charset;
+	for (const auto& [begin, end]: iCharset) {
+		for (uint32_t c = begin; c <= end; c++) charset.add(c);
+	}
+	std::vector<msdf_atlas::GlyphGeometry> glyphs;
+	msdf_atlas::FontGeometry fontGeometry(&glyphs);
+	constexpr double fontScale = 1.0;
+	const int glyphsLoaded = fontGeometry.loadCharset(font, fontScale, charset);
+	OWL_CORE_TRACE("Font {}: Loaded {} glyphs from font (out of {})", iPath.filename().stem().string(), glyphsLoaded,
+				   charset.size())
+	destroyFont(font);
+	deinitializeFreetype(ft);
+	if (glyphs.empty())
+		return FontAtlasData{};
+
+	msdf_atlas::TightAtlasPacker atlasPacker;
+	atlasPacker.setPixelRange(2.0);
+	atlasPacker.setMiterLimit(1.0);
+	atlasPacker.setScale(iEmSize);
+	if (const int remaining = atlasPacker.pack(glyphs.data(), static_cast<int>(glyphs.size())); remaining != 0) {
+		OWL_CORE_ERROR("Font loading: Failed Packing.")
+		return std::nullopt;
+	}
+	math::vec2i size;
+	atlasPacker.getDimensions(size.x(), size.y());
+
+	constexpr double angleThreshold = 3.0;
+	constexpr uint64_t lcgMultiplier = 6364136223846793005;
+	uint64_t glyphSeed = 0;
+	for (msdf_atlas::GlyphGeometry& glyph: glyphs) {
+		glyphSeed *= lcgMultiplier;
+		glyph.edgeColoring(msdfgen::edgeColoringInkTrap, angleThreshold, glyphSeed);
+	}
+
+	msdf_atlas::GeneratorAttributes attributes;
+	attributes.config.overlapSupport = true;
+	attributes.scanlinePass = true;
+	msdf_atlas::ImmediateAtlasGenerator<float, 3, msdf_atlas::msdfGenerator, msdf_atlas::BitmapAtlasStorage<uint8_t, 3>>
+			generator(size.x(), size.y());
+	generator.setAttributes(attributes);
+	generator.setThreadCount(static_cast<int>(std::max(1u, iThreadCount)));
+	generator.generate(glyphs.data(), static_cast<int>(glyphs.size()));
+	const auto bitmap = static_cast<msdfgen::BitmapConstRef<uint8_t, 3>>(generator.atlasStorage());
+
+	const auto& metrics = fontGeometry.getMetrics();
+	FontAtlasData data{.ascenderY = metrics.ascenderY,
+					   .descenderY = metrics.descenderY,
+					   .lineHeight = metrics.lineHeight,
+					   .atlasSize = {static_cast<uint32_t>(size.x()), static_cast<uint32_t>(size.y())},
+					   .glyphs = {},
+					   .kerning = {},
+					   .pixels = std::vector<uint8_t>(bitmap.pixels,
+													  bitmap.pixels + static_cast<size_t>(bitmap.width) *
+																			  static_cast<size_t>(bitmap.height) * 3)};
+	std::unordered_map<int, uint32_t> codepoints;
+	data.glyphs.reserve(glyphs.size());
+	for (const auto& glyph: glyphs) {
+		auto& [codepoint, advance, plane, atlas] = data.glyphs.emplace_back();
+		codepoint = glyph.getCodepoint();
+		advance = glyph.getAdvance();
+		glyph.getQuadPlaneBounds(plane[0], plane[1], plane[2], plane[3]);
+		glyph.getQuadAtlasBounds(atlas[0], atlas[1], atlas[2], atlas[3]);
+		codepoints.emplace(glyph.getIndex(), codepoint);
+	}
+	// the generator's kerning is indexed by glyph, the atlas one by code point.
+	for (const auto& [indices, advance]: fontGeometry.getKerning()) {
+		const auto first = codepoints.find(indices.first);
+		const auto second = codepoints.find(indices.second);
+		if (first != codepoints.end() && second != codepoints.end())
+			data.kerning.push_back({.first = first->second, .second = second->second, .advance = advance});
+	}
+	data.sort();
+	return data;
+}
+
+}// namespace owl::fonts
@@ -0,0 +1,28 @@
+/**
+ * @file AtlasGenerator.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "FontAtlasCache.h"
+
+namespace owl::fonts {
+
+/**
+ * @brief Run the MSDF generation of a set of glyphs.
+ * @param[in] iPath The font file.
+ * @param[in] iCharset The code points to generate, the ones missing in the font are skipped.
+ * @param[in] iEmSize The size of an em in the atlas in pixels.
+ * @param[in] iThreadCount Number of generation threads.
+ * @return The atlas, nullopt in case of failure.
+ *
+ * The generation does not depend on the application state: it can run in any thread.
+ */
+OWL_API auto generateAtlas(const std::filesystem::path& iPath, std::span<const CharsetRange> iCharset,
+						   double iEmSize, uint32_t iThreadCount) -> std::optional<FontAtlasData>;
+
+}// namespace owl::fonts
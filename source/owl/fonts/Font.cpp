@@ -8,188 +8,191 @@
 #include "owlpch.h"
 
 #include "Font.h"
-
+#include "AtlasGenerator.h"
+#include "GlyphAtlas.h"
 #include "core/Application.h"
 
-#undef INFINITE
-#include <msdf-atlas-gen/msdf-atlas-gen.h>
-
 namespace owl::fonts {
 
-struct MsdfData {
-	std::vector<msdf_atlas::GlyphGeometry> glyphs;
-	msdf_atlas::FontGeometry fontGeometry;
-};
-
 namespace {
-template<typename T, typename S, int N, msdf_atlas::GeneratorFunction<S, N> GenFunc>
-auto createAndCacheAtlas([[maybe_unused]] const std::string& iFontName, [[maybe_unused]] float iFontSize,
-						 const std::vector<msdf_atlas::GlyphGeometry>& iGlyphs,
-						 [[maybe_unused]] const msdf_atlas::FontGeometry& iFontGeometry, math::vec2i iSize)
-		-> shared<renderer::Texture2D> {
-	msdf_atlas::GeneratorAttributes attributes;
-	attributes.config.overlapSupport = true;
-	attributes.scanlinePass = true;
-	msdf_atlas::ImmediateAtlasGenerator<S, N, GenFunc, msdf_atlas::BitmapAtlasStorage<T, N>> generator(iSize.x(),
-																									   iSize.y());
-	generator.setAttributes(attributes);
-	generator.setThreadCount(8);
-	generator.generate(iGlyphs.data(), static_cast<int>(iGlyphs.size()));
-	auto bitmap = static_cast<msdfgen::BitmapConstRef<T, N>>(generator.atlasStorage());
-	const renderer::Texture::Specification spec{
-			.size = {static_cast<uint32_t>(bitmap.width), static_cast<uint32_t>(bitmap.height)},
-			.format = renderer::ImageFormat::RGB8,
-			.generateMips = false};
-	shared<renderer::Texture2D> texture = renderer::Texture2D::create(spec);
-	texture->setData(const_cast<uint8_t*>(bitmap.pixels), static_cast<uint32_t>(bitmap.width * bitmap.height * 3));
-	return texture;
+
+/// The preloaded code points (from imgui_draw.cpp), the other ones use the dynamic atlas.
+constexpr std::array<CharsetRange, 1> g_charsetRanges{{{.begin = 0x0020, .end = 0x00FF}}};
+/// Size of an em in the atlas in pixels.
+constexpr double g_emSize{40.0};
+
+/// First code point of the glyph table.
+constexpr uint32_t g_tableBegin{std::ranges::min(g_charsetRanges, {}, &CharsetRange::begin).begin};
+/// Number of code points in the glyph table.
+constexpr uint32_t g_tableSize{std::ranges::max(g_charsetRanges, {}, &CharsetRange::end).end - g_tableBegin + 1};
+
+/**
+ * @brief Check if a code point is preloaded.
+ * @param[in] iCodepoint The code point.
+ * @return True if in the preloaded ranges.
+ */
+auto isPreloaded(const uint32_t iCodepoint) -> bool {
+	return std::ranges::any_of(g_charsetRanges, [iCodepoint](const CharsetRange& iRange) {
+		return iCodepoint >= iRange.begin && iCodepoint <= iRange.end;
+	});
 }
+
+/**
+ * @brief Key of a kerning pair.
+ * @param[in] iFirst The first code point.
+ * @param[in] iSecond The second code point.
+ * @return The key.
+ */
+constexpr auto kerningKey(const uint32_t iFirst, const uint32_t iSecond) -> uint64_t {
+	return (static_cast<uint64_t>(iFirst) << 32u) | iSecond;
+}
+
 }// namespace
 
-Font::Font(const std::filesystem::path& iPath, const bool iIsDefault) : m_default{iIsDefault} {
+Font::Font(const std::filesystem::path& iPath, const bool iIsDefault, const bool iCreateTexture)
+	: m_default{iIsDefault} {
 	OWL_SCOPE_UNTRACK
 
 	if (!exists(iPath)) {
 		OWL_CORE_ERROR("Font: Font file {} does not exists.", iPath.string())
 		return;
 	}
-	msdfgen::FreetypeHandle* ft = msdfgen::initializeFreetype();
-	if (ft == nullptr) {
-		OWL_CORE_ERROR("Font: Failed to initialize Freetype library.")
-		return;
-	}
-	msdfgen::FontHandle* font = loadFont(ft, iPath.string().c_str());
-	if (font == nullptr) {
-		OWL_CORE_ERROR("Font: Failed to load font: {}", iPath.string())
-		return;
-	}
-	struct CharsetRange {
-		uint32_t begin = 0, end = 0;
-	};
-
-	// from imgui_draw.cpp
-	static constexpr CharsetRange charsetRanges[] = {{.begin = 0x0020, .end = 0x00FF}};
-	msdf_atlas::Charset charset;
-	for (auto [begin, end]: charsetRanges) {
-		for (uint32_t c = begin; c <= end; c++) charset.add(c);
-	}
-	m_data = std::make_shared<MsdfData>();
-	constexpr double fontScale = 1.0;
-	m_data->fontGeometry = msdf_atlas::FontGeometry(&m_data->glyphs);
-	int glyphsLoaded = m_data->fontGeometry.loadCharset(font, fontScale, charset);
-	OWL_CORE_INFO("Font {}: Loaded {} glyphs from font (out of {})", iPath.filename().stem().string(), glyphsLoaded,
-				  charset.size())
-	double emSize = 40.0;
-	msdf_atlas::TightAtlasPacker atlasPacker;
-	// atlasPacker.setDimensionsConstraint()
-	atlasPacker.setPixelRange(2.0);
-	atlasPacker.setMiterLimit(1.0);
-	atlasPacker.setScale(emSize);
-	if (const int remaining = atlasPacker.pack(m_data->glyphs.data(), static_cast<int>(m_data->glyphs.size()));
-		remaining != 0) {
-		OWL_CORE_ERROR("Font loading: Failed Packing.")
-	}
-	math::vec2i size;
-	atlasPacker.getDimensions(size.x(), size.y());
-	emSize = atlasPacker.getScale();
-
-#define DEFAULT_ANGLE_THRESHOLD 3.0
-	constexpr uint64_t LCG_MULTIPLIER = 6364136223846793005;
-	constexpr uint64_t LCG_INCREMENT = 1442695040888963407;
-#define THREAD_COUNT 8
-	// if MSDF || MTSDF
-	uint64_t coloringSeed = 0;
-	if constexpr ((false)) {
-		msdf_atlas::Workload(
-				[&glyphs = m_data->glyphs, &coloringSeed](int i, [[maybe_unused]] int threadNo) -> bool {
-					const uint64_t glyphSeed =
-							(LCG_MULTIPLIER * (coloringSeed ^ static_cast<uint64_t>(i)) + LCG_INCREMENT) *
-							!!coloringSeed;
-					glyphs[static_cast<size_t>(i)].edgeColoring(msdfgen::edgeColoringInkTrap, DEFAULT_ANGLE_THRESHOLD,
-																glyphSeed);
-					return true;
-				},
-				static_cast<int>(m_data->glyphs.size()))
-				.finish(THREAD_COUNT);
-	} else {
-		uint64_t glyphSeed = coloringSeed;
-		for (msdf_atlas::GlyphGeometry& glyph: m_data->glyphs) {
-			glyphSeed *= LCG_MULTIPLIER;
-			glyph.edgeColoring(msdfgen::edgeColoringInkTrap, DEFAULT_ANGLE_THRESHOLD, glyphSeed);
+	const std::string name = iPath.stem().string();
+	const auto key = computeAtlasKey(iPath, g_charsetRanges, g_emSize);
+	const auto cacheFile = key.has_value() ? getAtlasCacheFile(name, key.value()) : std::filesystem::path{};
+	if (!cacheFile.empty()) {
+		if (auto data = readAtlasCache(cacheFile, key.value()); data.has_value()) {
+			m_data = mkShared<FontAtlasData>(std::move(data.value()));
+			OWL_CORE_TRACE("Font {}: atlas loaded from {}", name, cacheFile.string())
 		}
 	}
-	m_atlasTexture = createAndCacheAtlas<uint8_t, float, 3, msdf_atlas::msdfGenerator>(
-			"Test", static_cast<float>(emSize), m_data->glyphs, m_data->fontGeometry, size);
-#if 0
-	msdfgen::Shape shape;
-	if (msdfgen::loadGlyph(shape, font, 'C'))
-	{
-		shape.normalize();
-		//                      max. angle
-		msdfgen::edgeColoringSimple(shape, 3.0);
-		//           image width, height
-		msdfgen::Bitmap<float, 3> msdf(32, 32);
-		//                     range, scale, translation
-		msdfgen::generateMSDF(msdf, shape, 4.0, 1.0, msdfgen::Vector2(4.0, 4.0));
-		msdfgen::savePng(msdf, "output.png");
+	if (!m_data) {
+		auto data = generateAtlas(iPath, g_charsetRanges, g_emSize, std::max(1u, std::thread::hardware_concurrency()));
+		if (!data.has_value())
+			return;
+		m_data = mkShared<FontAtlasData>(std::move(data.value()));
+		if (!cacheFile.empty() && !writeAtlasCache(cacheFile, key.value(), *m_data))
+			OWL_CORE_WARN("Font {}: unable to write the atlas cache {}", name, cacheFile.string())
 	}
-#endif
-	destroyFont(font);
-	deinitializeFreetype(ft);
-	m_name = iPath.stem().string();
+	m_name = name;
+	buildMetrics();
+	m_dynamicAtlas = mkShared<GlyphAtlas>(iPath, g_emSize);
+	if (iCreateTexture)
+		createAtlasTexture();
 }
 
 Font::~Font() = default;
 
-auto Font::getGlyphBox(const char& iChar) const -> GlyphMetrics {
-	GlyphMetrics result{.quad = {{0, 0}, {0, 0}}, .uv = {{0, 0}, {0, 0}}};
-	const auto& metrics = m_data->fontGeometry.getMetrics();
-	const float fsScale = 1.0f / static_cast<float>(metrics.ascenderY - metrics.descenderY);
+void Font::createAtlasTexture() {
+	if (m_atlasTexture || !m_data || m_data->pixels.empty())
+		return;
+	const renderer::Texture::Specification spec{
+			.size = m_data->atlasSize, .format = renderer::ImageFormat::RGB8, .generateMips = false};
+	m_atlasTexture = renderer::Texture2D::create(spec);
+	m_atlasTexture->setData(m_data->pixels.data(), static_cast<uint32_t>(m_data->pixels.size()));
+	// the pixels are now owned by the texture.
+	m_data->pixels.clear();
+	m_data->pixels.shrink_to_fit();
+}
+
+void Font::update() {
+	if (!m_dynamicAtlas)
+		return;
+	const uint64_t frame =
+			core::Application::instanced() ? core::Application::get().getTimeStep().getFrameNumber() : 0;
+	m_dynamicAtlas->update(frame);
+}
+
+auto Font::getAtlasVersion() const -> uint64_t { return m_dynamicAtlas ? m_dynamicAtlas->getVersion() : 0; }
 
-	if (iChar == '\n') {
-		return result;
+void Font::touchAtlasPage(const uint32_t iPage) const {
+	// page 0 is the preloaded atlas.
+	if (iPage > 0 && m_dynamicAtlas)
+		m_dynamicAtlas->touch(iPage - 1);
+}
+
+auto Font::getAtlasTexture(const uint32_t iPage) const -> shared<renderer::Texture2D> {
+	if (iPage == 0)
+		return m_atlasTexture;
+	if (!m_dynamicAtlas)
+		return nullptr;
+	return m_dynamicAtlas->getPageTexture(iPage - 1);
+}
+
+void Font::buildMetrics() {
+	m_scale = 1.0f / static_cast<float>(m_data->ascenderY - m_data->descenderY);
+	m_lineHeight = m_scale * static_cast<float>(m_data->lineHeight);
+	m_glyphTable.assign(g_tableSize, GlyphEntry{});
+	const math::vec2 atlasSize{static_cast<float>(m_data->atlasSize.x()), static_cast<float>(m_data->atlasSize.y())};
+	for (const auto& glyph: m_data->glyphs) {
+		if (glyph.codepoint < g_tableBegin || glyph.codepoint - g_tableBegin >= g_tableSize)
+			continue;
+		const auto& [pl, pb, pr, pt] = glyph.planeBounds;
+		const auto& [al, ab, ar, at] = glyph.atlasBounds;
+		m_glyphTable[glyph.codepoint - g_tableBegin] = {
+				.quad = {{static_cast<float>(pl) * m_scale, static_cast<float>(pb) * m_scale},
+						 {static_cast<float>(pr) * m_scale, static_cast<float>(pt) * m_scale}},
+				.uv = {{static_cast<float>(al) / atlasSize.x(), static_cast<float>(ab) / atlasSize.y()},
+					   {static_cast<float>(ar) / atlasSize.x(), static_cast<float>(at) / atlasSize.y()}},
+				.advance = static_cast<float>(glyph.advance) * m_scale,
+				.page = 0,
+				.valid = true};
 	}
-	const auto* glyph = m_data->fontGeometry.getGlyph(static_cast<msdfgen::unicode_t>(iChar));
-	if (glyph == nullptr)
-		glyph = m_data->fontGeometry.getGlyph('?');
+	m_kerning.clear();
+	m_kerning.reserve(m_data->kerning.size());
+	for (const auto& [first, second, advance]: m_data->kerning)
+		m_kerning.emplace(kerningKey(first, second), static_cast<float>(advance) * m_scale);
+	// the lookups now use the tables.
+	m_data->glyphs.clear();
+	m_data->glyphs.shrink_to_fit();
+	m_data->kerning.clear();
+	m_data->kerning.shrink_to_fit();
+}
+
+auto Font::findGlyph(const uint32_t iCodepoint) const -> std::optional<GlyphEntry> {
+	if (iCodepoint >= g_tableBegin && iCodepoint - g_tableBegin < m_glyphTable.size()) {
+		if (const auto& entry = m_glyphTable[iCodepoint - g_tableBegin]; entry.valid)
+			return entry;
+	}
+	// the preloaded glyphs missing in the preloaded atlas are missing in the font.
+	if (iCodepoint < ' ' || isPreloaded(iCodepoint) || !m_dynamicAtlas)
+		return std::nullopt;
+	const auto* glyph = m_dynamicAtlas->find(iCodepoint);
 	if (glyph == nullptr)
-		return result;
-	if (iChar == '\t')
-		glyph = m_data->fontGeometry.getGlyph(' ');
-	double pl = 0;
-	double pb = 0;
-	double pr = 0;
-	double pt = 0;
-	glyph->getQuadPlaneBounds(pl, pb, pr, pt);
-	result.quad.min() = math::vec2{static_cast<float>(pl) * fsScale, static_cast<float>(pb) * fsScale};
-	result.quad.max() = math::vec2{static_cast<float>(pr) * fsScale, static_cast<float>(pt) * fsScale};
-	double al = 0;
-	double ab = 0;
-	double ar = 0;
-	double at = 0;
-	glyph->getQuadAtlasBounds(al, ab, ar, at);
-	result.uv.min() = math::vec2{static_cast<float>(al / m_atlasTexture->getSize().x()),
-								 static_cast<float>(ab / m_atlasTexture->getSize().y())};
-	result.uv.max() = math::vec2{static_cast<float>(ar / m_atlasTexture->getSize().x()),
-								 static_cast<float>(at / m_atlasTexture->getSize().y())};
-	return result;
+		return std::nullopt;
+	const auto& [pl, pb, pr, pt] = glyph->planeBounds;
+	return GlyphEntry{.quad = {{static_cast<float>(pl) * m_scale, static_cast<float>(pb) * m_scale},
+							   {static_cast<float>(pr) * m_scale, static_cast<float>(pt) * m_scale}},
+					  .uv = glyph->uv,
+					  .advance = static_cast<float>(glyph->advance) * m_scale,
+					  .page = glyph->page + 1,
+					  .valid = true};
 }
 
-auto Font::getScaledLineHeight() const -> float {
-	const auto& metrics = m_data->fontGeometry.getMetrics();
-	const float fsScale = 1.0f / static_cast<float>(metrics.ascenderY - metrics.descenderY);
-	return fsScale * static_cast<float>(metrics.lineHeight);
+auto Font::getGlyphBox(const uint32_t iCodepoint) const -> GlyphMetrics {
+	if (iCodepoint == '\n')
+		return {.quad = {{0, 0}, {0, 0}}, .uv = {{0, 0}, {0, 0}}, .page = 0};
+	auto glyph = findGlyph(iCodepoint == '\t' ? static_cast<uint32_t>(' ') : iCodepoint);
+	if (!glyph.has_value())
+		glyph = findGlyph('?');
+	if (!glyph.has_value())
+		return {.quad = {{0, 0}, {0, 0}}, .uv = {{0, 0}, {0, 0}}, .page = 0};
+	return {.quad = glyph->quad, .uv = glyph->uv, .page = glyph->page};
 }
 
-auto Font::getAdvance(const char& iChar, const char& iNextChar) const -> float {
-	const auto ucode = static_cast<msdf_atlas::unicode_t>(iChar);
-	const auto* glyph = m_data->fontGeometry.getGlyph(ucode);
-	double advance = glyph->getAdvance();
-	const auto nextCharacter = static_cast<msdfgen::unicode_t>(iNextChar);
-	m_data->fontGeometry.getAdvance(advance, ucode, nextCharacter);
-	const auto& metrics = m_data->fontGeometry.getMetrics();
-	const float fsScale = 1.0f / static_cast<float>(metrics.ascenderY - metrics.descenderY);
-	return fsScale * static_cast<float>(advance);
+auto Font::getScaledLineHeight() const -> float { return m_lineHeight; }
+
+auto Font::getAdvance(const uint32_t iCodepoint, const uint32_t iNextCodepoint) const -> float {
+	auto glyph = findGlyph(iCodepoint == '\t' ? static_cast<uint32_t>(' ') : iCodepoint);
+	if (!glyph.has_value() && iCodepoint >= ' ')
+		glyph = findGlyph('?');
+	if (!glyph.has_value())
+		return 0;
+	// the kerning is only known between preloaded glyphs.
+	if (m_kerning.empty())
+		return glyph->advance;
+	const auto kerning = m_kerning.find(kerningKey(iCodepoint, iNextCodepoint));
+	return kerning == m_kerning.end() ? glyph->advance : glyph->advance + kerning->second;
 }
 
 }// namespace owl::fonts
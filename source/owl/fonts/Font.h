@@ -15,17 +15,26 @@
 
 namespace owl::fonts {
 
-struct MsdfData;
+struct FontAtlasData;
+class GlyphAtlas;
 
 /**
  * @brief Class describing a font.
+ *
+ * The MSDF atlas of the latin glyphs is generated once per font file: it is then loaded from the `cache/fonts` folder
+ * of the working directory. The other glyphs are rasterized on first use in a dynamic atlas.
  */
 class OWL_API Font final {
 public:
 	/**
 	 * @brief Default constructor.
+	 * @param[in] iPath The font file.
+	 * @param[in] iIsDefault If this is the default font.
+	 * @param[in] iCreateTexture If the atlas texture is created, else createAtlasTexture() must be called later.
+	 *
+	 * Without the texture creation, the font can be loaded outside the rendering thread.
 	 */
-	explicit Font(const std::filesystem::path& iPath, bool iIsDefault = false);
+	explicit Font(const std::filesystem::path& iPath, bool iIsDefault = false, bool iCreateTexture = true);
 	/**
 	 * @brief Default destructor.
 	 */
@@ -48,10 +57,42 @@ public:
 	auto operator=(Font&&) -> Font& = default;
 
 	/**
-	 * @brief Get the atlas texture corresponding to the Font.
-	 * @return The atlas texture.
+	 * @brief Get an atlas texture of the Font.
+	 * @param[in] iPage The atlas page: 0 for the preloaded glyphs, the next ones for the dynamic atlas.
+	 * @return The atlas texture, nullptr if the page does not exist.
 	 */
-	[[nodiscard]] auto getAtlasTexture() const -> shared<renderer::Texture2D> { return m_atlasTexture; }
+	[[nodiscard]] auto getAtlasTexture(uint32_t iPage = 0) const -> shared<renderer::Texture2D>;
+
+	/**
+	 * @brief Upload the generated atlas into a texture, does nothing if already done.
+	 *
+	 * Must be called in the rendering thread.
+	 */
+	void createAtlasTexture();
+
+	/**
+	 * @brief Insert the glyphs rasterized since the last call in the dynamic atlas, and launch the next
+	 * rasterizations.
+	 *
+	 * Must be called in the rendering thread. The glyphs requested before are available after this call, their
+	 * metrics are invalidated by the next one.
+	 */
+	void update();
+
+	/**
+	 * @brief Get the version of the glyph metrics.
+	 * @return A counter that changes when glyph metrics returned before may have changed.
+	 */
+	[[nodiscard]] auto getAtlasVersion() const -> uint64_t;
+
+	/**
+	 * @brief Mark an atlas page as used in the current frame.
+	 *
+	 * To call for each page sampled by glyphs rendered from metrics got in a previous frame, so that the dynamic
+	 * atlas does not reuse the page during the frame.
+	 * @param[in] iPage The atlas page, as given in the glyph metrics.
+	 */
+	void touchAtlasPage(uint32_t iPage) const;
 
 	/**
 	 * @brief Metrics of the glyphs.
@@ -61,8 +102,15 @@ public:
 		math::box2f quad;
 		/// The quad for texture space.
 		math::box2f uv;
+		/// The atlas page holding the glyph.
+		uint32_t page = 0;
 	};
-	[[nodiscard]] auto getGlyphBox(const char& iChar) const -> GlyphMetrics;
+	/**
+	 * @brief Get the metrics of a glyph.
+	 * @param[in] iCodepoint The unicode code point.
+	 * @return The glyph metrics, the ones of '?' if the glyph is missing or not rasterized yet.
+	 */
+	[[nodiscard]] auto getGlyphBox(uint32_t iCodepoint) const -> GlyphMetrics;
 	/**
 	 * @brief Get the line width.
 	 * @return The line width.
@@ -70,11 +118,11 @@ public:
 	[[nodiscard]] auto getScaledLineHeight() const -> float;
 	/**
 	 * @brief Compute the position of the next character.
-	 * @param iChar The current char.
-	 * @param iNextChar The next char.
+	 * @param[in] iCodepoint The current code point.
+	 * @param[in] iNextCodepoint The next code point.
 	 * @return ne position.
 	 */
-	[[nodiscard]] auto getAdvance(const char& iChar, const char& iNextChar) const -> float;
+	[[nodiscard]] auto getAdvance(uint32_t iCodepoint, uint32_t iNextCodepoint) const -> float;
 
 	/**
 	 * @brief get the font's name.
@@ -89,10 +137,46 @@ public:
 	auto isDefault() const -> bool { return m_default; }
 
 private:
+	/**
+	 * @brief Metrics of a glyph scaled to the font size.
+	 */
+	struct GlyphEntry {
+		/// The quad for 3D space.
+		math::box2f quad;
+		/// The quad for texture space.
+		math::box2f uv;
+		/// The horizontal advance.
+		float advance = 0;
+		/// The atlas page holding the glyph.
+		uint32_t page = 0;
+		/// If the font has the glyph.
+		bool valid = false;
+	};
+	/**
+	 * @brief Precompute the metrics of the preloaded glyphs from the atlas data.
+	 */
+	void buildMetrics();
+	/**
+	 * @brief Search a glyph in the atlases.
+	 * @param[in] iCodepoint The code point.
+	 * @return The glyph, nullopt if missing or not rasterized yet.
+	 */
+	[[nodiscard]] auto findGlyph(uint32_t iCodepoint) const -> std::optional<GlyphEntry>;
+
 	/// pointer to the texture.
 	shared<renderer::Texture2D> m_atlasTexture;
-	/// The internal atlas data.
-	shared<MsdfData> m_data;
+	/// The atlas data.
+	shared<FontAtlasData> m_data;
+	/// The glyphs rasterized on demand.
+	shared<GlyphAtlas> m_dynamicAtlas;
+	/// The preloaded glyphs, indexed by code point from the first preloaded one.
+	std::vector<GlyphEntry> m_glyphTable;
+	/// The kerning between preloaded glyphs, indexed by the pair of code points.
+	std::unordered_map<uint64_t, float> m_kerning;
+	/// Scale from em to the font size.
+	float m_scale = 0;
+	/// The scaled line height.
+	float m_lineHeight = 0;
 	/// The name of the font.
 	std::string m_name;
 	/// If this font is the default one.
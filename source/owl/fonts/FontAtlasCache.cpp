@@ -0,0 +1,190 @@
+/**
+ * @file FontAtlasCache.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "FontAtlasCache.h"
+
+#include "core/Application.h"
+#include "core/utils/HashUtils.h"
+
+namespace owl::fonts {
+
+namespace {
+
+/// Magic number at the beginning of atlas cache files.
+constexpr std::array<char, 4> g_atlasMagic{'O', 'F', 'N', 'T'};
+/// Version of the atlas generation and file layout, to increment when one of them changes.
+constexpr uint32_t g_atlasVersion{1};
+
+/**
+ * @brief Header of an atlas cache file.
+ */
+struct AtlasHeader {
+	/// Magic number.
+	std::array<char, 4> magic = g_atlasMagic;
+	/// Generation and layout version.
+	uint32_t version = g_atlasVersion;
+	/// Atlas key.
+	uint64_t key = 0;
+	/// Vertical position of the ascender.
+	double ascenderY = 0;
+	/// Vertical position of the descender.
+	double descenderY = 0;
+	/// Distance between two lines.
+	double lineHeight = 0;
+	/// Width of the atlas.
+	uint32_t width = 0;
+	/// Height of the atlas.
+	uint32_t height = 0;
+	/// Number of glyphs.
+	uint32_t glyphCount = 0;
+	/// Number of kerning pairs.
+	uint32_t kerningCount = 0;
+};
+
+/**
+ * @brief Glyph in an atlas cache file, with its padding made explicit to write reproducible files.
+ */
+struct GlyphRecord {
+	/// Unicode code point.
+	uint32_t codepoint = 0;
+	/// Reserved.
+	uint32_t reserved = 0;
+	/// Horizontal advance.
+	double advance = 0;
+	/// Quad bounds in em (left, bottom, right, top).
+	std::array<double, 4> planeBounds{};
+	/// Quad bounds in the atlas in pixels (left, bottom, right, top).
+	std::array<double, 4> atlasBounds{};
+};
+static_assert(sizeof(GlyphRecord) == 80);
+
+/// Number of bytes per atlas pixel (RGB8).
+constexpr size_t g_atlasPixelSize{3};
+/// Maximal number of glyphs or kerning pairs in a cache file, to reject corrupted headers.
+constexpr uint32_t g_maxAtlasRecords{1u << 24u};
+/// Maximal atlas width or height in a cache file, to reject corrupted headers.
+constexpr uint32_t g_maxAtlasDimension{16384};
+
+}// namespace
+
+void FontAtlasData::sort() {
+	std::ranges::sort(glyphs, {}, &Glyph::codepoint);
+	std::ranges::sort(kerning, [](const Kerning& iA, const Kerning& iB) {
+		return std::tie(iA.first, iA.second) < std::tie(iB.first, iB.second);
+	});
+}
+
+auto FontAtlasData::findGlyph(const uint32_t iCodepoint) const -> const Glyph* {
+	const auto it = std::ranges::lower_bound(glyphs, iCodepoint, {}, &Glyph::codepoint);
+	if (it == glyphs.end() || it->codepoint != iCodepoint)
+		return nullptr;
+	return &*it;
+}
+
+auto FontAtlasData::getKerning(const uint32_t iFirst, const uint32_t iSecond) const -> double {
+	const auto it = std::ranges::lower_bound(kerning, std::tie(iFirst, iSecond), {},
+											 [](const Kerning& iK) { return std::tie(iK.first, iK.second); });
+	if (it == kerning.end() || it->first != iFirst || it->second != iSecond)
+		return 0;
+	return it->advance;
+}
+
+auto computeAtlasKey(const std::filesystem::path& iFontFile, const std::span<const CharsetRange> iCharset,
+					 const double iEmSize) -> std::optional<uint64_t> {
+	const auto fontHash = core::utils::hashFile(iFontFile);
+	if (!fontHash.has_value())
+		return std::nullopt;
+	uint64_t key = core::utils::hashCombine(fontHash.value(), g_atlasVersion);
+	for (const auto& [begin, end]: iCharset) {
+		key = core::utils::hashCombine(key, begin);
+		key = core::utils::hashCombine(key, end);
+	}
+	return core::utils::hashCombine(key, std::bit_cast<uint64_t>(iEmSize));
+}
+
+auto getAtlasCacheFile(const std::string& iFontName, const uint64_t iKey) -> std::filesystem::path {
+	if (!core::Application::instanced())
+		return {};
+	return core::Application::get().getWorkingDirectory() / "cache" / "fonts" /
+		   fmt::format("{}-{:016x}.ofnt", iFontName, iKey);
+}
+
+auto writeAtlasCache(const std::filesystem::path& iFile, const uint64_t iKey, const FontAtlasData& iData) -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	if (iData.pixels.size() != static_cast<size_t>(iData.atlasSize.surface()) * g_atlasPixelSize)
+		return false;
+	if (iFile.has_parent_path() && !exists(iFile.parent_path()))
+		create_directories(iFile.parent_path());
+	std::ofstream out(iFile, std::ios::out | std::ios::binary);
+	if (!out.is_open()) {
+		OWL_CORE_WARN("Cannot open file {} for writting.", iFile.string())
+		return false;
+	}
+	const AtlasHeader header{.key = iKey,
+							 .ascenderY = iData.ascenderY,
+							 .descenderY = iData.descenderY,
+							 .lineHeight = iData.lineHeight,
+							 .width = iData.atlasSize.x(),
+							 .height = iData.atlasSize.y(),
+							 .glyphCount = static_cast<uint32_t>(iData.glyphs.size()),
+							 .kerningCount = static_cast<uint32_t>(iData.kerning.size())};
+	std::vector<GlyphRecord> glyphs;
+	glyphs.reserve(iData.glyphs.size());
+	for (const auto& [codepoint, advance, planeBounds, atlasBounds]: iData.glyphs)
+		glyphs.push_back(
+				{.codepoint = codepoint, .advance = advance, .planeBounds = planeBounds, .atlasBounds = atlasBounds});
+	out.write(reinterpret_cast<const char*>(&header), sizeof(AtlasHeader));
+	out.write(reinterpret_cast<const char*>(glyphs.data()),
+			  static_cast<std::streamsize>(glyphs.size() * sizeof(GlyphRecord)));
+	out.write(reinterpret_cast<const char*>(iData.kerning.data()),
+			  static_cast<std::streamsize>(iData.kerning.size() * sizeof(FontAtlasData::Kerning)));
+	out.write(reinterpret_cast<const char*>(iData.pixels.data()), static_cast<std::streamsize>(iData.pixels.size()));
+	out.close();
+	return !out.fail();
+}
+
+auto readAtlasCache(const std::filesystem::path& iFile, const uint64_t iKey) -> std::optional<FontAtlasData> {
+	OWL_PROFILE_FUNCTION()
+
+	std::ifstream in(iFile, std::ios::in | std::ios::binary);
+	if (!in.is_open())
+		return std::nullopt;
+	AtlasHeader header;
+	in.read(reinterpret_cast<char*>(&header), sizeof(AtlasHeader));
+	if (!in || header.magic != g_atlasMagic || header.version != g_atlasVersion || header.key != iKey ||
+		header.glyphCount > g_maxAtlasRecords || header.kerningCount > g_maxAtlasRecords ||
+		header.width > g_maxAtlasDimension || header.height > g_maxAtlasDimension)
+		return std::nullopt;
+	FontAtlasData data{.ascenderY = header.ascenderY,
+					   .descenderY = header.descenderY,
+					   .lineHeight = header.lineHeight,
+					   .atlasSize = {header.width, header.height},
+					   .glyphs = {},
+					   .kerning = std::vector<FontAtlasData::Kerning>(header.kerningCount),
+					   .pixels = std::vector<uint8_t>(static_cast<size_t>(header.width) * header.height *
+													  g_atlasPixelSize)};
+	std::vector<GlyphRecord> glyphs(header.glyphCount);
+	in.read(reinterpret_cast<char*>(glyphs.data()), static_cast<std::streamsize>(glyphs.size() * sizeof(GlyphRecord)));
+	in.read(reinterpret_cast<char*>(data.kerning.data()),
+			static_cast<std::streamsize>(data.kerning.size() * sizeof(FontAtlasData::Kerning)));
+	in.read(reinterpret_cast<char*>(data.pixels.data()), static_cast<std::streamsize>(data.pixels.size()));
+	if (!in)
+		return std::nullopt;
+	data.glyphs.reserve(glyphs.size());
+	for (const auto& glyph: glyphs)
+		data.glyphs.push_back({.codepoint = glyph.codepoint,
+							   .advance = glyph.advance,
+							   .planeBounds = glyph.planeBounds,
+							   .atlasBounds = glyph.atlasBounds});
+	return data;
+}
+
+}// namespace owl::fonts
@@ -0,0 +1,128 @@
+/**
+ * @file FontAtlasCache.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+#include "math/vectors.h"
+
+namespace owl::fonts {
+
+/**
+ * @brief Range of unicode code points.
+ */
+struct OWL_API CharsetRange {
+	/// First code point.
+	uint32_t begin = 0;
+	/// Last code point (included).
+	uint32_t end = 0;
+};
+
+/**
+ * @brief Generated font atlas, independent of the generator: everything needed to render text with the font.
+ *
+ * The bounds are stored as given by the generator: plane bounds in em, atlas bounds in pixels.
+ */
+struct OWL_API FontAtlasData {
+	/**
+	 * @brief Metrics of a glyph.
+	 */
+	struct Glyph {
+		/// Unicode code point.
+		uint32_t codepoint = 0;
+		/// Horizontal advance.
+		double advance = 0;
+		/// Quad bounds in em (left, bottom, right, top).
+		std::array<double, 4> planeBounds{};
+		/// Quad bounds in the atlas in pixels (left, bottom, right, top).
+		std::array<double, 4> atlasBounds{};
+	};
+	/**
+	 * @brief Advance correction between two glyphs.
+	 */
+	struct Kerning {
+		/// Code point of the first glyph.
+		uint32_t first = 0;
+		/// Code point of the second glyph.
+		uint32_t second = 0;
+		/// Correction to add to the first glyph's advance.
+		double advance = 0;
+	};
+
+	/// Vertical position of the ascender.
+	double ascenderY = 0;
+	/// Vertical position of the descender.
+	double descenderY = 0;
+	/// Distance between two lines.
+	double lineHeight = 0;
+	/// Size of the atlas in pixels.
+	math::vec2ui atlasSize;
+	/// The glyphs, sorted by code point.
+	std::vector<Glyph> glyphs;
+	/// The kerning pairs, sorted by code points.
+	std::vector<Kerning> kerning;
+	/// The atlas pixels (RGB8), empty once uploaded to a texture.
+	std::vector<uint8_t> pixels;
+
+	/**
+	 * @brief Sort the glyphs and kerning pairs for the lookups.
+	 */
+	void sort();
+
+	/**
+	 * @brief Search a glyph.
+	 * @param[in] iCodepoint The code point.
+	 * @return The glyph or nullptr if not in the atlas.
+	 */
+	[[nodiscard]] auto findGlyph(uint32_t iCodepoint) const -> const Glyph*;
+
+	/**
+	 * @brief Get the advance correction between two glyphs.
+	 * @param[in] iFirst The code point of the first glyph.
+	 * @param[in] iSecond The code point of the second glyph.
+	 * @return The correction, 0 if none.
+	 */
+	[[nodiscard]] auto getKerning(uint32_t iFirst, uint32_t iSecond) const -> double;
+};
+
+/**
+ * @brief Compute the key identifying an atlas generated from a font file.
+ * @param[in] iFontFile The font file.
+ * @param[in] iCharset The loaded code points.
+ * @param[in] iEmSize The size of an em in the atlas in pixels.
+ * @return The key, or nullopt if the font file cannot be read.
+ */
+OWL_API auto computeAtlasKey(const std::filesystem::path& iFontFile, std::span<const CharsetRange> iCharset,
+							 double iEmSize) -> std::optional<uint64_t>;
+
+/**
+ * @brief Get the cache file of an atlas.
+ * @param[in] iFontName The name of the font.
+ * @param[in] iKey The key of the atlas.
+ * @return The cache file, empty if there is no application to give the cache directory.
+ */
+OWL_API auto getAtlasCacheFile(const std::string& iFontName, uint64_t iKey) -> std::filesystem::path;
+
+/**
+ * @brief Write an atlas to a cache file.
+ * @param[in] iFile The destination file.
+ * @param[in] iKey The key of the atlas.
+ * @param[in] iData The atlas.
+ * @return True if succeeded.
+ */
+OWL_API auto writeAtlasCache(const std::filesystem::path& iFile, uint64_t iKey, const FontAtlasData& iData) -> bool;
+
+/**
+ * @brief Read an atlas from a cache file.
+ * @param[in] iFile The file to read.
+ * @param[in] iKey The expected key.
+ * @return The atlas, or nullopt if the file is missing, invalid or generated with another key.
+ */
+OWL_API auto readAtlasCache(const std::filesystem::path& iFile, uint64_t iKey) -> std::optional<FontAtlasData>;
+
+}// namespace owl::fonts
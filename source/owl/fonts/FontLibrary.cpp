@@ -19,7 +19,7 @@ auto getFontPath() -> std::list<std::filesystem::path> {
 	if (!core::Application::instanced())
 		return {};
 	const auto& app = core::Application::get();
-	if (app.getState() != core::Application::State::Running)
+	if (app.getState() == core::Application::State::Error)
 		return {};
 	std::list<std::filesystem::path> paths;
 	for (const auto& [title, assetsPath]: app.getAssetDirectories()) {
@@ -38,20 +38,36 @@ FontLibrary::FontLibrary() : m_defaultFontName("OpenSans-Regular") {
 }
 
 void FontLibrary::init() {
+	prepare();
+	createTextures();
+}
+
+void FontLibrary::prepare() {
+	OWL_PROFILE_FUNCTION()
+
 	m_fonts.clear();
-	loadFont(m_defaultFontName);
+	loadFont(m_defaultFontName, false);
 	m_fonts["null"] = nullptr;
 }
 
+void FontLibrary::createTextures() const {
+	OWL_PROFILE_FUNCTION()
+
+	for (const auto& font: m_fonts | std::views::values) {
+		if (font)
+			font->createAtlasTexture();
+	}
+}
+
 FontLibrary::~FontLibrary() = default;
 
-void FontLibrary::loadFont(const std::string& iName) {
+void FontLibrary::loadFont(const std::string& iName, const bool iCreateTexture) {
 	for (const auto& path: getFontPath()) {
 		for (const auto& item: std::filesystem::recursive_directory_iterator(path)) {
 			if (!item.is_regular_file() || item.path().extension() != ".ttf")
 				continue;
 			if (item.path().stem() == iName) {
-				m_fonts.emplace(iName, mkShared<Font>(item.path(), iName == m_defaultFontName));
+				m_fonts.emplace(iName, mkShared<Font>(item.path(), iName == m_defaultFontName, iCreateTexture));
 			}
 		}
 	}
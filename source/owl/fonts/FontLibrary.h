@@ -37,6 +37,18 @@ public:
 	 * @brief Initialize the library.
 	 */
 	void init();
+	/**
+	 * @brief First part of the initialization: load the default font without its texture.
+	 *
+	 * Does not need the rendering thread.
+	 */
+	void prepare();
+	/**
+	 * @brief Second part of the initialization: create the textures of the loaded fonts.
+	 *
+	 * Must be called in the rendering thread.
+	 */
+	void createTextures() const;
 	/**
 	 * @brief Get the default font.
 	 * @return The default font.
@@ -68,9 +80,10 @@ private:
 	std::unordered_map<std::string, shared<Font>> m_fonts;
 	/**
 	 * @brief Load a font.
-	 * @param iName The font's name.
+	 * @param[in] iName The font's name.
+	 * @param[in] iCreateTexture If the atlas texture is created.
 	 */
-	void loadFont(const std::string& iName);
+	void loadFont(const std::string& iName, bool iCreateTexture = true);
 };
 
 }// namespace owl::fonts
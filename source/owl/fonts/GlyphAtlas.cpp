@@ -0,0 +1,244 @@
+/**
+ * @file GlyphAtlas.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "GlyphAtlas.h"
+
+#include "AtlasGenerator.h"
+#include "core/Application.h"
+
+namespace owl::fonts {
+
+namespace {
+
+/// Number of bytes per page pixel (RGB8).
+constexpr size_t g_pagePixelSize{3};
+/// Empty pixels between the glyphs, to avoid sampling the neighbours.
+constexpr uint32_t g_glyphPadding{1};
+
+}// namespace
+
+ShelfPacker::ShelfPacker(const math::vec2ui& iSize) : m_size{iSize} {}
+
+auto ShelfPacker::insert(const math::vec2ui& iSize) -> std::optional<math::vec2ui> {
+	if (iSize.x() > m_size.x() || iSize.y() > m_size.y())
+		return std::nullopt;
+	// best fit: the lowest shelf high enough with room left.
+	Shelf* best = nullptr;
+	for (auto& shelf: m_shelves) {
+		if (shelf.height < iSize.y() || shelf.width + iSize.x() > m_size.x())
+			continue;
+		if (best == nullptr || shelf.height < best->height)
+			best = &shelf;
+	}
+	// do not waste a high shelf for a small rectangle if a new shelf can be opened.
+	if (best != nullptr && (best->height <= 2 * iSize.y() || m_top + iSize.y() > m_size.y())) {
+		const math::vec2ui position{best->width, best->y};
+		best->width += iSize.x();
+		return position;
+	}
+	if (m_top + iSize.y() > m_size.y())
+		return std::nullopt;
+	m_shelves.push_back({.y = m_top, .height = iSize.y(), .width = iSize.x()});
+	const math::vec2ui position{0, m_top};
+	m_top += iSize.y();
+	return position;
+}
+
+void ShelfPacker::clear() {
+	m_shelves.clear();
+	m_top = 0;
+}
+
+GlyphAtlas::GlyphAtlas(std::filesystem::path iFontFile, const double iEmSize, const bool iCreateTextures,
+					   const uint32_t iMaxPages)
+	: m_fontFile{std::move(iFontFile)}, m_emSize{iEmSize}, m_createTextures{iCreateTextures},
+	  m_maxPages{std::max(iMaxPages, 1u)} {}
+
+GlyphAtlas::~GlyphAtlas() = default;
+
+auto GlyphAtlas::find(const uint32_t iCodepoint) -> const Glyph* {
+	if (const auto it = m_glyphs.find(iCodepoint); it != m_glyphs.end()) {
+		touch(it->second.page);
+		return &it->second;
+	}
+	if (!m_missing.contains(iCodepoint) && m_requested.insert(iCodepoint).second)
+		m_queue.push_back(iCodepoint);
+	return nullptr;
+}
+
+void GlyphAtlas::touch(const uint32_t iPage) {
+	if (iPage >= m_pages.size())
+		return;
+	m_pages[iPage].lastUse = ++m_useCounter;
+	m_pages[iPage].lastFrame = m_frame;
+}
+
+void GlyphAtlas::update(const uint64_t iFrame) {
+	m_frame = iFrame;
+	bool complete = true;
+	if (m_batch && m_batch->done.load(std::memory_order_acquire)) {
+		complete = insertBatch(*m_batch);
+		m_batch.reset();
+	}
+	// the glyphs queued again wait for another frame.
+	if (m_batch || m_queue.empty() || !complete)
+		return;
+	launchBatch();
+	// synchronous rasterization.
+	if (m_batch->done.load(std::memory_order_acquire)) {
+		insertBatch(*m_batch);
+		m_batch.reset();
+	}
+}
+
+auto GlyphAtlas::getPageTexture(const uint32_t iPage) const -> shared<renderer::Texture2D> {
+	if (iPage >= m_pages.size())
+		return nullptr;
+	return m_pages[iPage].texture;
+}
+
+void GlyphAtlas::launchBatch() {
+	OWL_PROFILE_FUNCTION()
+
+	const auto count = std::min(m_queue.size(), static_cast<size_t>(g_glyphBatchSize));
+	std::vector<uint32_t> codepoints(m_queue.begin(), m_queue.begin() + static_cast<std::ptrdiff_t>(count));
+	m_queue.erase(m_queue.begin(), m_queue.begin() + static_cast<std::ptrdiff_t>(count));
+	std::ranges::sort(codepoints);
+	m_batch = mkShared<Batch>();
+	for (const auto codepoint: codepoints) {
+		if (!m_batch->charset.empty() && m_batch->charset.back().end + 1 == codepoint)
+			m_batch->charset.back().end = codepoint;
+		else
+			m_batch->charset.push_back({.begin = codepoint, .end = codepoint});
+	}
+	auto rasterize = [batch = m_batch, file = m_fontFile, emSize = m_emSize] {
+		batch->data = generateAtlas(file, batch->charset, emSize, 1);
+		batch->done.store(true, std::memory_order_release);
+	};
+	if (core::Application::instanced())
+		core::Application::get().getTaskScheduler().pushTask(core::task::Task{rasterize});
+	else
+		rasterize();
+}
+
+auto GlyphAtlas::insertBatch(const Batch& iBatch) -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	std::unordered_set<uint32_t> inserted;
+	std::unordered_set<uint32_t> deferred;
+	if (iBatch.data.has_value()) {
+		const auto& data = iBatch.data.value();
+		std::vector<uint8_t> pixels;
+		for (const auto& glyph: data.glyphs) {
+			Glyph entry{.advance = glyph.advance,
+						.planeBounds = glyph.planeBounds,
+						.uv = {{0, 0}, {0, 0}},
+						.page = 0};
+			const auto& [al, ab, ar, at] = glyph.atlasBounds;
+			if (ar > al && at > ab) {
+				// the quad bounds are half a pixel inside the generated box.
+				const math::vec2ui origin{static_cast<uint32_t>(std::lround(al - 0.5)),
+										  static_cast<uint32_t>(std::lround(ab - 0.5))};
+				const math::vec2ui size{static_cast<uint32_t>(std::lround(ar - al + 1.0)),
+										static_cast<uint32_t>(std::lround(at - ab + 1.0))};
+				if (origin.x() + size.x() > data.atlasSize.x() || origin.y() + size.y() > data.atlasSize.y())
+					continue;
+				const math::vec2ui paddedSize{size.x() + g_glyphPadding, size.y() + g_glyphPadding};
+				if (paddedSize.x() > g_glyphPageSize || paddedSize.y() > g_glyphPageSize)
+					continue;
+				const auto place = reserve(paddedSize);
+				if (!place.has_value()) {
+					deferred.insert(glyph.codepoint);
+					continue;
+				}
+				const auto& [page, position] = place.value();
+				if (const auto& texture = m_pages[page].texture; texture) {
+					const size_t rowSize = size.x() * g_pagePixelSize;
+					pixels.resize(rowSize * size.y());
+					for (uint32_t row = 0; row < size.y(); ++row) {
+						const size_t source = ((origin.y() + row) * data.atlasSize.x() + origin.x()) * g_pagePixelSize;
+						std::copy_n(data.pixels.begin() + static_cast<std::ptrdiff_t>(source), rowSize,
+									pixels.begin() + static_cast<std::ptrdiff_t>(row * rowSize));
+					}
+					texture->setSubData(pixels.data(), position, size);
+				}
+				constexpr auto pageSize = static_cast<float>(g_glyphPageSize);
+				entry.uv = {{(static_cast<float>(position.x()) + 0.5f) / pageSize,
+							 (static_cast<float>(position.y()) + 0.5f) / pageSize},
+							{(static_cast<float>(position.x() + size.x()) - 0.5f) / pageSize,
+							 (static_cast<float>(position.y() + size.y()) - 0.5f) / pageSize}};
+				entry.page = page;
+			}
+			m_glyphs[glyph.codepoint] = entry;
+			inserted.insert(glyph.codepoint);
+		}
+	}
+	for (const auto& [begin, end]: iBatch.charset) {
+		for (uint32_t codepoint = begin; codepoint <= end; ++codepoint) {
+			if (deferred.contains(codepoint)) {
+				m_queue.push_back(codepoint);
+				continue;
+			}
+			m_requested.erase(codepoint);
+			if (!inserted.contains(codepoint))
+				m_missing.insert(codepoint);
+		}
+	}
+	++m_version;
+	return deferred.empty();
+}
+
+auto GlyphAtlas::reserve(const math::vec2ui& iSize) -> std::optional<std::pair<uint32_t, math::vec2ui>> {
+	for (uint32_t index = 0; index < m_pages.size(); ++index) {
+		if (const auto position = m_pages[index].packer.insert(iSize); position.has_value()) {
+			m_pages[index].lastUse = ++m_useCounter;
+			m_pages[index].lastFrame = m_frame;
+			return std::make_pair(index, position.value());
+		}
+	}
+	if (iSize.x() > g_glyphPageSize || iSize.y() > g_glyphPageSize)
+		return std::nullopt;
+	uint32_t index = 0;
+	if (m_pages.size() < m_maxPages) {
+		index = static_cast<uint32_t>(m_pages.size());
+		auto& page = m_pages.emplace_back();
+		if (m_createTextures) {
+			page.texture = renderer::Texture2D::create(renderer::Texture::Specification{
+					.size = {g_glyphPageSize, g_glyphPageSize},
+					.format = renderer::ImageFormat::RGB8,
+					.generateMips = false});
+			if (page.texture) {
+				std::vector<uint8_t> blank(g_glyphPageSize * g_glyphPageSize * g_pagePixelSize, 0);
+				page.texture->setData(blank.data(), static_cast<uint32_t>(blank.size()));
+			}
+		}
+	} else {
+		// the pages used in the frame are still sampled by the batched quads.
+		auto lru = m_pages.end();
+		for (auto it = m_pages.begin(); it != m_pages.end(); ++it) {
+			if (it->lastFrame != m_frame && (lru == m_pages.end() || it->lastUse < lru->lastUse))
+				lru = it;
+		}
+		if (lru == m_pages.end())
+			return std::nullopt;
+		index = static_cast<uint32_t>(std::distance(m_pages.begin(), lru));
+		OWL_CORE_TRACE("GlyphAtlas: evict page {} of {}", index, m_fontFile.stem().string())
+		std::erase_if(m_glyphs, [index](const auto& iGlyph) {
+			const auto& [pl, pb, pr, pt] = iGlyph.second.planeBounds;
+			return iGlyph.second.page == index && pr > pl && pt > pb;
+		});
+		lru->packer.clear();
+	}
+	m_pages[index].lastUse = ++m_useCounter;
+	m_pages[index].lastFrame = m_frame;
+	return std::make_pair(index, m_pages[index].packer.insert(iSize).value());
+}
+
+}// namespace owl::fonts
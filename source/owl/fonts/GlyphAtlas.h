@@ -0,0 +1,251 @@
+/**
+ * @file GlyphAtlas.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "FontAtlasCache.h"
+#include "math/box.h"
+#include "renderer/Texture.h"
+
+#include <unordered_set>
+
+namespace owl::fonts {
+
+/// Size of the dynamic atlas pages in pixels.
+constexpr uint32_t g_glyphPageSize{512};
+/// Maximal number of pages of a dynamic atlas.
+constexpr uint32_t g_maxGlyphPages{4};
+/// Maximal number of glyphs rasterized in a single task.
+constexpr uint32_t g_glyphBatchSize{64};
+
+/**
+ * @brief Shelf packing of rectangles in a fixed size area.
+ *
+ * The rectangles are put on horizontal shelves, a new shelf being opened on top of the previous ones when no
+ * existing shelf fits.
+ */
+class OWL_API ShelfPacker final {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param[in] iSize The size of the area.
+	 */
+	explicit ShelfPacker(const math::vec2ui& iSize);
+
+	/**
+	 * @brief Reserve a rectangle.
+	 * @param[in] iSize The size of the rectangle.
+	 * @return The position of the rectangle, nullopt if the area is full.
+	 */
+	auto insert(const math::vec2ui& iSize) -> std::optional<math::vec2ui>;
+
+	/**
+	 * @brief Free all the rectangles.
+	 */
+	void clear();
+
+	/**
+	 * @brief Get the height used by the shelves.
+	 * @return The used height.
+	 */
+	[[nodiscard]] auto getUsedHeight() const -> uint32_t { return m_top; }
+
+private:
+	/**
+	 * @brief A shelf.
+	 */
+	struct Shelf {
+		/// Vertical position.
+		uint32_t y = 0;
+		/// Height.
+		uint32_t height = 0;
+		/// Used width.
+		uint32_t width = 0;
+	};
+	/// The size of the area.
+	math::vec2ui m_size;
+	/// The shelves.
+	std::vector<Shelf> m_shelves;
+	/// Top of the last shelf.
+	uint32_t m_top = 0;
+};
+
+/**
+ * @brief Atlas of the glyphs rasterized on demand.
+ *
+ * A glyph unknown at lookup is queued, the queued glyphs are rasterized by batch in a task and inserted in the pages
+ * during the next update(). When all the pages are full, the least recently used one is cleared. A page holding
+ * glyphs looked up or touched in the current frame is never cleared: the quads already batched still sample it, the
+ * glyphs that do not fit are queued again.
+ *
+ * The lookups and update are done in the rendering thread.
+ */
+class OWL_API GlyphAtlas final {
+public:
+	/**
+	 * @brief A glyph in the atlas.
+	 */
+	struct Glyph {
+		/// Horizontal advance in em.
+		double advance = 0;
+		/// Quad bounds in em (left, bottom, right, top).
+		std::array<double, 4> planeBounds{};
+		/// Quad in texture space.
+		math::box2f uv;
+		/// Index of the page holding the glyph.
+		uint32_t page = 0;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iFontFile The font file.
+	 * @param[in] iEmSize The size of an em in the pages in pixels.
+	 * @param[in] iCreateTextures If the page textures are created.
+	 * @param[in] iMaxPages Maximal number of pages.
+	 */
+	GlyphAtlas(std::filesystem::path iFontFile, double iEmSize, bool iCreateTextures = true,
+			   uint32_t iMaxPages = g_maxGlyphPages);
+	/**
+	 * @brief Destructor.
+	 */
+	~GlyphAtlas();
+	GlyphAtlas(const GlyphAtlas&) = delete;
+	GlyphAtlas(GlyphAtlas&&) = delete;
+	auto operator=(const GlyphAtlas&) -> GlyphAtlas& = delete;
+	auto operator=(GlyphAtlas&&) -> GlyphAtlas& = delete;
+
+	/**
+	 * @brief Search a glyph, queue its rasterization if unknown.
+	 * @param[in] iCodepoint The code point.
+	 * @return The glyph, nullptr if not rasterized yet or missing in the font.
+	 */
+	auto find(uint32_t iCodepoint) -> const Glyph*;
+
+	/**
+	 * @brief Mark a page as used in the current frame, as a lookup of one of its glyphs does.
+	 *
+	 * For the glyphs placed before and rendered without new lookup.
+	 * @param[in] iPage The page index.
+	 */
+	void touch(uint32_t iPage);
+
+	/**
+	 * @brief Insert the rasterized glyphs in the pages and launch the rasterization of the queued ones.
+	 *
+	 * Without application, the rasterization is done synchronously.
+	 * @param[in] iFrame The number of the current frame.
+	 */
+	void update(uint64_t iFrame);
+
+	/**
+	 * @brief Check if a code point is not in the font.
+	 * @param[in] iCodepoint The code point.
+	 * @return True if the rasterization failed to find the glyph.
+	 */
+	[[nodiscard]] auto isMissing(const uint32_t iCodepoint) const -> bool { return m_missing.contains(iCodepoint); }
+
+	/**
+	 * @brief Check if some glyphs are queued or being rasterized.
+	 * @return True if glyphs are pending.
+	 */
+	[[nodiscard]] auto hasPendingGlyphs() const -> bool { return !m_requested.empty(); }
+
+	/**
+	 * @brief Get the version of the atlas content.
+	 * @return A counter incremented each time glyphs are inserted or evicted.
+	 */
+	[[nodiscard]] auto getVersion() const -> uint64_t { return m_version; }
+
+	/**
+	 * @brief Get the number of pages.
+	 * @return The number of pages.
+	 */
+	[[nodiscard]] auto getPageCount() const -> uint32_t { return static_cast<uint32_t>(m_pages.size()); }
+
+	/**
+	 * @brief Get the texture of a page.
+	 * @param[in] iPage The page index.
+	 * @return The texture, nullptr if not created.
+	 */
+	[[nodiscard]] auto getPageTexture(uint32_t iPage) const -> shared<renderer::Texture2D>;
+
+private:
+	/**
+	 * @brief Glyphs being rasterized, shared with the task.
+	 */
+	struct Batch {
+		/// The requested code points.
+		std::vector<CharsetRange> charset;
+		/// The rasterization result.
+		std::optional<FontAtlasData> data;
+		/// If the rasterization is finished.
+		std::atomic<bool> done = false;
+	};
+	/**
+	 * @brief A page of the atlas.
+	 */
+	struct Page {
+		/// The packing of the page.
+		ShelfPacker packer{{g_glyphPageSize, g_glyphPageSize}};
+		/// The texture.
+		shared<renderer::Texture2D> texture;
+		/// Value of the use counter at the last lookup of a glyph of the page.
+		uint64_t lastUse = 0;
+		/// Frame of the last lookup of a glyph of the page.
+		uint64_t lastFrame = 0;
+	};
+
+	/**
+	 * @brief Launch the rasterization of the queued glyphs.
+	 */
+	void launchBatch();
+
+	/**
+	 * @brief Insert the glyphs of a finished batch in the pages.
+	 * @param[in] iBatch The batch.
+	 * @return False if some glyphs are queued again, the pages being used in the frame.
+	 */
+	auto insertBatch(const Batch& iBatch) -> bool;
+
+	/**
+	 * @brief Reserve place in the pages, evicting the least recently used one if needed.
+	 * @param[in] iSize The size to reserve.
+	 * @return The page index and position, nullopt if the size does not fit in a page or if all the pages are full
+	 * and used in the current frame.
+	 */
+	auto reserve(const math::vec2ui& iSize) -> std::optional<std::pair<uint32_t, math::vec2ui>>;
+
+	/// The font file.
+	std::filesystem::path m_fontFile;
+	/// The size of an em in pixels.
+	double m_emSize;
+	/// If the page textures are created.
+	bool m_createTextures;
+	/// Maximal number of pages.
+	uint32_t m_maxPages;
+	/// The glyphs in the pages.
+	std::unordered_map<uint32_t, Glyph> m_glyphs;
+	/// The code points queued or being rasterized.
+	std::unordered_set<uint32_t> m_requested;
+	/// The code points queued.
+	std::vector<uint32_t> m_queue;
+	/// The code points not in the font.
+	std::unordered_set<uint32_t> m_missing;
+	/// The batch being rasterized.
+	shared<Batch> m_batch;
+	/// The pages.
+	std::vector<Page> m_pages;
+	/// Counter of the lookups for the page eviction.
+	uint64_t m_useCounter = 0;
+	/// The current frame.
+	uint64_t m_frame = 0;
+	/// Version of the atlas content.
+	uint64_t m_version = 0;
+};
+
+}// namespace owl::fonts
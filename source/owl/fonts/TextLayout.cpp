@@ -0,0 +1,84 @@
+/**
+ * @file TextLayout.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "TextLayout.h"
+
+#include "core/utils/StringUtils.h"
+
+namespace owl::fonts {
+
+auto TextLayout::update(const shared<Font>& iFont, const std::string_view iText, const float iKerning,
+						const float iLineSpacing) -> bool {
+	if (iFont == nullptr) {
+		m_glyphs.clear();
+		m_pages.clear();
+		m_valid = false;
+		return false;
+	}
+	iFont->update();
+	const bool sameFont = !m_font.owner_before(iFont) && !iFont.owner_before(m_font) && !m_font.expired();
+	if (m_valid && sameFont && m_atlasVersion == iFont->getAtlasVersion() && m_kerning == iKerning &&
+		m_lineSpacing == iLineSpacing && m_text == iText) {
+		// the glyphs are not looked up again: their pages must still be kept during the frame.
+		for (const auto page: m_pages)
+			iFont->touchAtlasPage(page);
+		return false;
+	}
+	OWL_PROFILE_FUNCTION()
+
+	m_glyphs.clear();
+	m_pages.clear();
+	m_text = iText;
+	m_font = iFont;
+	m_kerning = iKerning;
+	m_lineSpacing = iLineSpacing;
+	m_atlasVersion = iFont->getAtlasVersion();
+	m_valid = true;
+
+	// place the glyphs and compute the extents in a single pass.
+	const float lineHeight = iFont->getScaledLineHeight() + iLineSpacing;
+	math::box2f extents;
+	math::vec2 cursor{0.f, 0.f};
+	size_t position = 0;
+	std::optional<uint32_t> next;
+	while (next.has_value() || position < iText.size()) {
+		const uint32_t codepoint = next.has_value() ? next.value() : core::utils::decodeUtf8(iText, position);
+		next.reset();
+		if (codepoint == '\r')
+			continue;
+		if (codepoint == '\n') {
+			cursor.x() = 0;
+			cursor.y() -= lineHeight;
+			continue;
+		}
+		auto [quad, uv, page] = iFont->getGlyphBox(codepoint);
+		quad.translate(cursor);
+		extents.update(quad);
+		m_glyphs.push_back({.quad = quad, .uv = uv, .page = page});
+		if (std::ranges::find(m_pages, page) == m_pages.end())
+			m_pages.push_back(page);
+		if (position < iText.size()) {
+			next = core::utils::decodeUtf8(iText, position);
+			cursor.x() += iFont->getAdvance(codepoint, next.value()) + iKerning;
+		}
+	}
+	// fit the glyphs in the [-0.5, 0.5] square.
+	math::vec2 scale = extents.diagonal();
+	scale.x() = 1.f / scale.x();
+	scale.y() = 1.f / scale.y();
+	const math::vec2 offset = -extents.min() - 0.5f * extents.diagonal();
+	for (auto& glyph: m_glyphs) {
+		glyph.quad.translate(offset);
+		glyph.quad.scale(scale);
+	}
+	return true;
+}
+
+}// namespace owl::fonts
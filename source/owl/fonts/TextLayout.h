@@ -0,0 +1,77 @@
+/**
+ * @file TextLayout.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "Font.h"
+
+namespace owl::fonts {
+
+/**
+ * @brief Glyph quads of a string, fitted in the [-0.5, 0.5] square.
+ *
+ * The layout is kept between the renderings and only computed again when the text, the font, the spacing or the
+ * font's glyph metrics change.
+ */
+class OWL_API TextLayout final {
+public:
+	/**
+	 * @brief A placed glyph.
+	 */
+	struct Glyph {
+		/// The quad in local space.
+		math::box2f quad;
+		/// The quad in texture space.
+		math::box2f uv;
+		/// The atlas page holding the glyph.
+		uint32_t page = 0;
+	};
+
+	/**
+	 * @brief Compute the layout if outdated.
+	 * @param[in] iFont The font.
+	 * @param[in] iText The text in UTF-8.
+	 * @param[in] iKerning Additional space between the glyphs.
+	 * @param[in] iLineSpacing Additional space between the lines.
+	 * @return True if the layout has been computed.
+	 *
+	 * Must be called in the rendering thread, as it updates the font's dynamic atlas.
+	 */
+	auto update(const shared<Font>& iFont, std::string_view iText, float iKerning, float iLineSpacing) -> bool;
+
+	/**
+	 * @brief Force the next update to compute the layout.
+	 */
+	void invalidate() { m_valid = false; }
+
+	/**
+	 * @brief Access to the placed glyphs.
+	 * @return The glyphs.
+	 */
+	[[nodiscard]] auto getGlyphs() const -> const std::vector<Glyph>& { return m_glyphs; }
+
+private:
+	/// The placed glyphs.
+	std::vector<Glyph> m_glyphs;
+	/// The distinct atlas pages of the glyphs.
+	std::vector<uint32_t> m_pages;
+	/// The text of the layout.
+	std::string m_text;
+	/// The font of the layout.
+	weak<Font> m_font;
+	/// The kerning of the layout.
+	float m_kerning = 0.f;
+	/// The line spacing of the layout.
+	float m_lineSpacing = 0.f;
+	/// The font's atlas version of the layout.
+	uint64_t m_atlasVersion = 0;
+	/// If the layout has been computed.
+	bool m_valid = false;
+};
+
+}// namespace owl::fonts
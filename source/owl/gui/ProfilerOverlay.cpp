@@ -0,0 +1,136 @@
+/**
+ * @file ProfilerOverlay.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "ProfilerOverlay.h"
+
+#include "core/external/imgui.h"
+#include "debug/FrameProfiler.h"
+
+namespace owl::gui {
+
+namespace {
+
+/// Number of bars in the frame time histogram.
+constexpr size_t g_histogramBins{32};
+/// Color of the values over budget.
+constexpr ImVec4 g_overBudgetColor{1.0f, 0.35f, 0.3f, 1.0f};
+
+/**
+ * @brief Display a duration, highlighted if over budget.
+ * @param[in] iLabel The label.
+ * @param[in] iValue The duration in milliseconds.
+ * @param[in] iBudget The budget in milliseconds (0 means no budget).
+ */
+void durationText(const char* iLabel, const double iValue, const double iBudget) {
+	if (iBudget > 0 && iValue > iBudget)
+		ImGui::TextColored(g_overBudgetColor, "%s%.2f ms", iLabel, iValue);
+	else
+		ImGui::Text("%s%.2f ms", iLabel, iValue);
+}
+
+}// namespace
+
+ProfilerOverlay::ProfilerOverlay() = default;
+
+ProfilerOverlay::~ProfilerOverlay() = default;
+
+void ProfilerOverlay::onRender() {
+	const auto budgets = debug::FrameProfiler::getBudgets();
+	const auto frameBudget = budgets.contains(debug::g_frameBudgetName) ? budgets.at(debug::g_frameBudgetName) : 0.0;
+	const auto stats = debug::FrameProfiler::getStatistics();
+	const auto history = debug::FrameProfiler::getHistory();
+	const auto frame = m_showWorst ? debug::FrameProfiler::getWorstFrame() : debug::FrameProfiler::getLastFrame();
+
+	ImGui::SetNextWindowBgAlpha(0.85f);
+	ImGui::SetNextWindowSize({420, 0}, ImGuiCond_FirstUseEver);
+	if (!ImGui::Begin("Frame profiler (F3)", nullptr, ImGuiWindowFlags_NoFocusOnAppearing)) {
+		ImGui::End();
+		return;
+	}
+	ImGui::Text("Frames: %zu, over budget: %zu", stats.frameCount, stats.overBudgetFrames);
+	durationText("Mean: ", stats.mean, frameBudget);
+	ImGui::SameLine();
+	durationText("Max: ", stats.max, frameBudget);
+	durationText("p50: ", stats.p50, frameBudget);
+	ImGui::SameLine();
+	durationText("p95: ", stats.p95, frameBudget);
+	ImGui::SameLine();
+	durationText("p99: ", stats.p99, frameBudget);
+	if (!history.empty()) {
+		const auto scale = static_cast<float>(std::max(stats.max, frameBudget));
+		ImGui::PlotLines("##history", history.data(), static_cast<int>(history.size()), 0, "frame time", 0.f, scale,
+						 {-1, 60});
+		std::array<float, g_histogramBins> bins{};
+		for (const auto duration: history) {
+			const auto bin =
+					scale > 0 ? static_cast<size_t>(duration / scale * static_cast<float>(g_histogramBins)) : 0;
+			bins[std::min(bin, g_histogramBins - 1)] += 1.f;
+		}
+		const auto overlay = fmt::format("0 - {:.1f} ms", static_cast<double>(scale));
+		ImGui::PlotHistogram("##histogram", bins.data(), static_cast<int>(bins.size()), 0, overlay.c_str(), 0.f,
+							 FLT_MAX, {-1, 60});
+	}
+	ImGui::Separator();
+	if (ImGui::Button("Reset"))
+		debug::FrameProfiler::reset();
+	ImGui::SameLine();
+	ImGui::Checkbox("Longest frame", &m_showWorst);
+	ImGui::Text("Frame %llu:", static_cast<unsigned long long>(frame.frameNumber));
+	ImGui::SameLine();
+	durationText("", frame.duration, frameBudget);
+	ImGui::Text("Allocations: %zu (%s)", frame.allocations.allocationCalls,
+				frame.allocations.allocatedMemory.str().c_str());
+	scopeTable("##scopes", frame.scopes);
+	if (!frame.gpuScopes.empty()) {
+		ImGui::TextUnformatted("GPU:");
+		scopeTable("##gpuScopes", frame.gpuScopes);
+	}
+	ImGui::End();
+}
+
+void ProfilerOverlay::scopeTable(const char* iId, const std::vector<debug::ScopeTiming>& iScopes) {
+	if (!ImGui::BeginTable(iId, 4,
+						   ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp |
+								   ImGuiTableFlags_ScrollY,
+						   {0, iScopes.size() > 12 ? 300.f : 0.f}))
+		return;
+	ImGui::TableSetupScrollFreeze(0, 1);
+	ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+	ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_WidthFixed);
+	ImGui::TableSetupColumn("ms", ImGuiTableColumnFlags_WidthFixed);
+	ImGui::TableSetupColumn("Budget", ImGuiTableColumnFlags_WidthFixed);
+	ImGui::TableHeadersRow();
+	for (const auto& scope: iScopes) {
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		if (scope.depth > 0)
+			ImGui::Indent(static_cast<float>(scope.depth) * 10.f);
+		ImGui::TextUnformatted(getName(scope.nameId).c_str());
+		if (scope.depth > 0)
+			ImGui::Unindent(static_cast<float>(scope.depth) * 10.f);
+		ImGui::TableNextColumn();
+		ImGui::Text("%u", scope.calls);
+		ImGui::TableNextColumn();
+		durationText("", scope.duration, scope.budget);
+		ImGui::TableNextColumn();
+		if (scope.budget > 0)
+			ImGui::Text("%.2f", scope.budget);
+	}
+	ImGui::EndTable();
+}
+
+auto ProfilerOverlay::getName(const uint32_t iNameId) -> const std::string& {
+	auto it = m_names.find(iNameId);
+	if (it == m_names.end())
+		it = m_names.emplace(iNameId, debug::FrameProfiler::getName(iNameId)).first;
+	return it->second;
+}
+
+}// namespace owl::gui
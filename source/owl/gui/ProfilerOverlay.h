@@ -0,0 +1,66 @@
+/**
+ * @file ProfilerOverlay.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+
+namespace owl::debug {
+struct ScopeTiming;
+}// namespace owl::debug
+
+namespace owl::gui {
+
+/**
+ * @brief Window displaying the frame profiler results.
+ *
+ * It shows the frame time distribution, the allocations and the scope tree of the last frame (or of the longest
+ * one), the scopes over budget being highlighted. The GPU scopes are shown when the render API can time them.
+ */
+class OWL_API ProfilerOverlay final {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	ProfilerOverlay();
+	/**
+	 * @brief Default destructor.
+	 */
+	~ProfilerOverlay();
+	ProfilerOverlay(const ProfilerOverlay&) = delete;
+	ProfilerOverlay(ProfilerOverlay&&) = delete;
+	auto operator=(const ProfilerOverlay&) -> ProfilerOverlay& = delete;
+	auto operator=(ProfilerOverlay&&) -> ProfilerOverlay& = delete;
+
+	/**
+	 * @brief Render the overlay.
+	 */
+	void onRender();
+
+private:
+	/**
+	 * @brief Display a table of scopes.
+	 * @param[in] iId ImGui identifier of the table.
+	 * @param[in] iScopes The scopes in tree order.
+	 */
+	void scopeTable(const char* iId, const std::vector<debug::ScopeTiming>& iScopes);
+
+	/**
+	 * @brief Get the display name of a scope.
+	 * @param[in] iNameId The scope's interned name.
+	 * @return The name.
+	 */
+	auto getName(uint32_t iNameId) -> const std::string&;
+
+	/// If the longest frame is displayed instead of the last one.
+	bool m_showWorst = false;
+	/// Cache of the scope names.
+	std::unordered_map<uint32_t, std::string> m_names;
+};
+
+}// namespace owl::gui
@@ -10,9 +10,12 @@
 
 #include "UiLayer.h"
 
+#include "ProfilerOverlay.h"
 #include "core/Application.h"
 #include "core/external/glfw3.h"
 #include "core/external/imgui.h"
+#include "debug/FrameProfiler.h"
+#include "event/KeyEvent.h"
 #include "renderer/RenderCommand.h"
 #include "renderer/vulkan/internal/VulkanHandler.h"
 #include "utils.h"
@@ -31,7 +34,7 @@ namespace owl::gui {
 #include "Roboto-Italic.embed"
 #include "Roboto-Regular.embed"
 
-UiLayer::UiLayer() : Layer("ImGuiLayer") {}
+UiLayer::UiLayer() : Layer("ImGuiLayer"), m_profilerOverlay{mkUniq<ProfilerOverlay>()} {}
 UiLayer::~UiLayer() = default;
 
 void UiLayer::onAttach() {
@@ -103,6 +106,13 @@ void UiLayer::onDetach() {
 }
 
 void UiLayer::onEvent(event::Event& ioEvent) {
+	event::EventDispatcher dispatcher(ioEvent);
+	dispatcher.dispatch<event::KeyPressedEvent>([](const event::KeyPressedEvent& iEvent) {
+		if (iEvent.getKeyCode() != input::key::F3 || iEvent.getRepeatCount() > 0)
+			return false;
+		debug::FrameProfiler::setEnabled(!debug::FrameProfiler::isEnabled());
+		return true;
+	});
 	if (m_blockEvent) {
 		const ImGuiIO& io = ImGui::GetIO();
 		ioEvent.handled |= ioEvent.isInCategory(event::Category::Mouse) && io.WantCaptureMouse;
@@ -143,6 +153,8 @@ void UiLayer::end() const {
 	if (m_dockingEnable) {
 		ImGui::End();
 	}
+	if (debug::FrameProfiler::isEnabled())
+		m_profilerOverlay->onRender();
 	ImGuiIO& io = ImGui::GetIO();
 	if (m_withApp) {
 		const core::Application& app = core::Application::get();
@@ -154,12 +166,16 @@ void UiLayer::end() const {
 		renderer::RenderCommand::getApi() != renderer::RenderAPI::Type::Vulkan)
 		return;
 	ImGui::Render();
-	if (renderer::RenderCommand::getApi() == renderer::RenderAPI::Type::OpenGL)
+	if (renderer::RenderCommand::getApi() == renderer::RenderAPI::Type::OpenGL) {
+		OWL_GPU_SCOPE("UiLayer::render")
 		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-	else if (renderer::RenderCommand::getApi() == renderer::RenderAPI::Type::Vulkan) {
+	} else if (renderer::RenderCommand::getApi() == renderer::RenderAPI::Type::Vulkan) {
 		const auto& vkh = renderer::vulkan::internal::VulkanHandler::get();
 		renderer::RenderCommand::beginBatch();
-		ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), vkh.getCurrentCommandBuffer());
+		{
+			OWL_GPU_SCOPE("UiLayer::render")
+			ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), vkh.getCurrentCommandBuffer());
+		}
 		renderer::RenderCommand::endBatch();
 	}
 
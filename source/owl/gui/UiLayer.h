@@ -14,6 +14,7 @@
  * @brief Namespace for gui
  */
 namespace owl::gui {
+class ProfilerOverlay;
 /**
  * @brief Class ImGuiLayer
  */
@@ -100,6 +101,8 @@ private:
 	bool m_dockingEnable = false;
 	/// If is attached.
 	bool m_withApp = true;
+	/// Display of the frame profiler, toggled with F3.
+	uniq<ProfilerOverlay> m_profilerOverlay;
 
 	/// Function that initialize the docking port.
 	static void initializeDocking();
@@ -0,0 +1,99 @@
+/**
+ * @file MspLink.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "MspLink.h"
+
+namespace owl::input::serial {
+
+namespace {
+/// Longest wait for bytes, bounding the reaction to a stop request.
+constexpr std::chrono::milliseconds g_linkPollTimeout{50};
+}// namespace
+
+MspLink::MspLink(MspParser::Handler iHandler) : m_ring{0}, m_parser{std::move(iHandler)} {}
+
+MspLink::~MspLink() { close(); }
+
+auto MspLink::open(const Specification& iSpecification) -> bool {
+	close();
+	m_specification = iSpecification;
+	if (!m_port.open(m_specification.port, m_specification.baudRate))
+		return false;
+	OWL_CORE_INFO("Serial ({}): Telemetry link opened at {} bauds.", m_specification.port, m_specification.baudRate)
+	if (m_ring.getCapacity() < m_specification.bufferSize)
+		m_ring.resize(m_specification.bufferSize);
+	else
+		m_ring.clear();
+	m_parser.reset();
+	m_requests.clear();
+	for (const uint16_t command: m_specification.requests)
+		MspParser::encode(command, {}, MspDirection::Request, m_requests);
+	m_bytes.store(0, std::memory_order_relaxed);
+	m_frames.store(0, std::memory_order_relaxed);
+	m_errors.store(0, std::memory_order_relaxed);
+	m_polls.store(0, std::memory_order_relaxed);
+	m_lost.store(false, std::memory_order_relaxed);
+	m_linkThread = std::jthread([this](const std::stop_token& iStop) { linkLoop(iStop); });
+	return true;
+}
+
+void MspLink::close() {
+	if (m_linkThread.joinable()) {
+		m_linkThread.request_stop();
+		m_linkThread.join();
+	}
+	m_port.close();
+}
+
+auto MspLink::getStatistics() const -> Statistics {
+	return {.bytes = m_bytes.load(std::memory_order_relaxed),
+			.frames = m_frames.load(std::memory_order_relaxed),
+			.errors = m_errors.load(std::memory_order_relaxed),
+			.requests = m_polls.load(std::memory_order_relaxed)};
+}
+
+void MspLink::linkLoop(const std::stop_token& iStop) {
+	const bool polling = !m_requests.empty() && m_specification.requestRate > 0;
+	const auto interval = polling ? std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+											std::chrono::duration<double>(1.0 / m_specification.requestRate))
+								  : std::chrono::steady_clock::duration::zero();
+	auto nextPoll = std::chrono::steady_clock::now();
+	while (!iStop.stop_requested()) {
+		auto timeout = g_linkPollTimeout;
+		if (polling) {
+			const auto now = std::chrono::steady_clock::now();
+			if (now >= nextPoll) {
+				if (m_port.write(m_requests))
+					m_polls.fetch_add(1, std::memory_order_relaxed);
+				// a late poll does not burst to catch up.
+				nextPoll = std::max(nextPoll + interval, now);
+			}
+			timeout = std::min(timeout, std::chrono::ceil<std::chrono::milliseconds>(nextPoll - now));
+		}
+		const int64_t count = m_port.read(m_ring.getWritable(), timeout);
+		if (count < 0) {
+			OWL_CORE_WARN("Serial ({}): Telemetry link lost.", m_specification.port)
+			m_lost.store(true, std::memory_order_release);
+			return;
+		}
+		if (count == 0)
+			continue;
+		m_ring.commit(static_cast<size_t>(count));
+		m_bytes.fetch_add(static_cast<uint64_t>(count), std::memory_order_relaxed);
+		OWL_PROFILE_SCOPE("telemetry parsing")
+		const auto regions = m_ring.getReadable();
+		m_parser.parse(regions[0]);
+		m_parser.parse(regions[1]);
+		m_ring.consume(regions[0].size() + regions[1].size());
+		m_frames.store(m_parser.getFrameCount(), std::memory_order_relaxed);
+		m_errors.store(m_parser.getErrorCount(), std::memory_order_relaxed);
+	}
+}
+
+}// namespace owl::input::serial
@@ -0,0 +1,139 @@
+/**
+ * @file MspLink.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "MspParser.h"
+#include "Port.h"
+
+#include <thread>
+
+namespace owl::input::serial {
+
+/**
+ * @brief Telemetry link to a flight controller talking MSP.
+ *
+ * A dedicated thread waits for the bytes of the port, reads them in a ring buffer and parses them in place.
+ * The decoded messages are given to the handler on this thread. The link may also poll the flight controller,
+ * sending a list of requests at a fixed rate.
+ */
+class OWL_API MspLink final {
+public:
+	/**
+	 * @brief Link parameters.
+	 */
+	struct OWL_API Specification {
+		/// The port (device file or COM port).
+		std::string port;
+		/// The baud rate.
+		uint32_t baudRate = 115200;
+		/// Commands requested at each poll.
+		std::vector<uint16_t> requests;
+		/// Number of polls per second, zero to only listen.
+		float requestRate = 0.f;
+		/// Size of the ring buffer.
+		size_t bufferSize = 4096;
+	};
+
+	/**
+	 * @brief Link statistics.
+	 */
+	struct OWL_API Statistics {
+		/// Number of received bytes.
+		uint64_t bytes = 0;
+		/// Number of decoded messages.
+		uint64_t frames = 0;
+		/// Number of invalid messages.
+		uint64_t errors = 0;
+		/// Number of polls sent.
+		uint64_t requests = 0;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iHandler The function receiving the messages, called by the link thread.
+	 */
+	explicit MspLink(MspParser::Handler iHandler);
+	MspLink(const MspLink&) = delete;
+	MspLink(MspLink&&) = delete;
+	auto operator=(const MspLink&) -> MspLink& = delete;
+	auto operator=(MspLink&&) -> MspLink& = delete;
+
+	/**
+	 * @brief Destructor.
+	 */
+	~MspLink();
+
+	/**
+	 * @brief Open the port and start the link thread.
+	 * @param[in] iSpecification The link parameters.
+	 * @return True if the link started.
+	 */
+	auto open(const Specification& iSpecification) -> bool;
+
+	/**
+	 * @brief Stop the link thread and close the port.
+	 */
+	void close();
+
+	/**
+	 * @brief Check if the link thread runs.
+	 * @return True if running.
+	 */
+	[[nodiscard]] auto isOpened() const -> bool { return m_linkThread.joinable(); }
+
+	/**
+	 * @brief Check if the port was lost, the link thread being stopped.
+	 * @return True if the port was lost.
+	 */
+	[[nodiscard]] auto isLost() const -> bool { return m_lost.load(std::memory_order_acquire); }
+
+	/**
+	 * @brief Get the port of the link.
+	 * @return The port.
+	 */
+	[[nodiscard]] auto getPort() const -> const std::string& { return m_specification.port; }
+
+	/**
+	 * @brief Get the statistics of the link.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStatistics() const -> Statistics;
+
+private:
+	/// The link parameters.
+	Specification m_specification;
+	/// The serial port.
+	Port m_port;
+	/// The received bytes.
+	RingBuffer m_ring;
+	/// The parser.
+	MspParser m_parser;
+	/// The encoded requests.
+	std::vector<uint8_t> m_requests;
+	/// Number of received bytes.
+	std::atomic<uint64_t> m_bytes{0};
+	/// Number of decoded messages.
+	std::atomic<uint64_t> m_frames{0};
+	/// Number of invalid messages.
+	std::atomic<uint64_t> m_errors{0};
+	/// Number of polls sent.
+	std::atomic<uint64_t> m_polls{0};
+	/// If the port was lost.
+	std::atomic<bool> m_lost{false};
+	/// The link thread.
+	std::jthread m_linkThread;
+
+	/**
+	 * @brief Read and parse the bytes until stopped.
+	 * @param[in] iStop The stop token of the thread.
+	 */
+	void linkLoop(const std::stop_token& iStop);
+};
+
+}// namespace owl::input::serial
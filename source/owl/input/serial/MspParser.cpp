@@ -0,0 +1,189 @@
+/**
+ * @file MspParser.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "MspParser.h"
+
+namespace owl::input::serial {
+
+namespace {
+
+// NOLINTBEGIN(*-magic-numbers)
+/// Largest command of a version 1 message.
+constexpr uint16_t g_maxV1Command{254};
+
+/**
+ * @brief Update a DVB-S2 CRC8, the checksum of the version 2.
+ * @param[in] iCrc The current CRC.
+ * @param[in] iByte The byte.
+ * @return The updated CRC.
+ */
+constexpr auto crc8DvbS2(uint8_t iCrc, const uint8_t iByte) -> uint8_t {
+	iCrc ^= iByte;
+	for (uint8_t bit = 0; bit < 8; ++bit)
+		iCrc = (iCrc & 0x80u) != 0 ? static_cast<uint8_t>((iCrc << 1u) ^ 0xD5u) : static_cast<uint8_t>(iCrc << 1u);
+	return iCrc;
+}
+
+constexpr auto directionChar(const MspDirection iDirection) -> uint8_t {
+	switch (iDirection) {
+		case MspDirection::Request:
+			return '<';
+		case MspDirection::Response:
+			return '>';
+		case MspDirection::Error:
+			return '!';
+	}
+	return '>';
+}
+// NOLINTEND(*-magic-numbers)
+
+}// namespace
+
+MspParser::MspParser(Handler iHandler) : m_handler{std::move(iHandler)} { m_payload.reserve(s_maxPayload); }
+
+void MspParser::reset() {
+	m_state = State::Idle;
+	m_payload.clear();
+}
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+// NOLINTBEGIN(*-magic-numbers)
+void MspParser::parse(const std::span<const uint8_t> iData) {
+	size_t pos = 0;
+	while (pos < iData.size()) {
+		if (m_state == State::Payload) {
+			// the payload bytes are taken in a single run.
+			const auto chunk = iData.subspan(pos, std::min(m_size - m_payload.size(), iData.size() - pos));
+			m_payload.insert(m_payload.end(), chunk.begin(), chunk.end());
+			updateChecksum(chunk);
+			pos += chunk.size();
+			if (m_payload.size() == m_size)
+				m_state = State::Checksum;
+			continue;
+		}
+		const uint8_t byte = iData[pos++];
+		const std::span<const uint8_t> single{&byte, 1};
+		switch (m_state) {
+			case State::Idle:
+				if (byte == '$')
+					m_state = State::Header;
+				break;
+			case State::Header:
+				if (byte == 'M' || byte == 'X') {
+					m_frame.version = byte == 'M' ? 1 : 2;
+					m_state = State::Direction;
+				} else {
+					m_state = byte == '$' ? State::Header : State::Idle;
+				}
+				break;
+			case State::Direction:
+				if (byte == '<')
+					m_frame.direction = MspDirection::Request;
+				else if (byte == '>')
+					m_frame.direction = MspDirection::Response;
+				else if (byte == '!')
+					m_frame.direction = MspDirection::Error;
+				else {
+					m_state = byte == '$' ? State::Header : State::Idle;
+					break;
+				}
+				m_checksum = 0;
+				m_state = m_frame.version == 1 ? State::V1Size : State::V2Flag;
+				break;
+			case State::V1Size:
+				m_size = byte;
+				updateChecksum(single);
+				m_state = State::V1Command;
+				break;
+			case State::V2Flag:
+				updateChecksum(single);
+				m_state = State::V2CommandLow;
+				break;
+			case State::V1Command:
+			case State::V2CommandLow:
+				m_frame.command = byte;
+				updateChecksum(single);
+				m_state = m_state == State::V1Command ? State::Payload : State::V2CommandHigh;
+				break;
+			case State::V2CommandHigh:
+				m_frame.command |= static_cast<uint16_t>(byte << 8u);
+				updateChecksum(single);
+				m_state = State::V2SizeLow;
+				break;
+			case State::V2SizeLow:
+				m_size = byte;
+				updateChecksum(single);
+				m_state = State::V2SizeHigh;
+				break;
+			case State::V2SizeHigh:
+				m_size |= static_cast<size_t>(byte) << 8u;
+				updateChecksum(single);
+				m_state = State::Payload;
+				break;
+			case State::Checksum:
+				if (byte == m_checksum) {
+					m_frame.payload = m_payload;
+					++m_frameCount;
+					m_handler(m_frame);
+				} else {
+					++m_errorCount;
+				}
+				reset();
+				break;
+			case State::Payload:
+				break;
+		}
+		if (m_state == State::Payload) {
+			// start of the payload.
+			m_payload.clear();
+			if (m_size > s_maxPayload) {
+				++m_errorCount;
+				reset();
+			} else if (m_size == 0) {
+				m_state = State::Checksum;
+			}
+		}
+	}
+}
+
+void MspParser::updateChecksum(const std::span<const uint8_t> iData) {
+	if (m_frame.version == 1) {
+		for (const uint8_t byte: iData) m_checksum ^= byte;
+	} else {
+		for (const uint8_t byte: iData) m_checksum = crc8DvbS2(m_checksum, byte);
+	}
+}
+
+void MspParser::encode(const uint16_t iCommand, const std::span<const uint8_t> iPayload, const MspDirection iDirection,
+					   std::vector<uint8_t>& ioBuffer) {
+	if (iCommand <= g_maxV1Command && iPayload.size() < 255) {
+		const auto size = static_cast<uint8_t>(iPayload.size());
+		const auto command = static_cast<uint8_t>(iCommand);
+		ioBuffer.insert(ioBuffer.end(), {'$', 'M', directionChar(iDirection), size, command});
+		uint8_t checksum = size ^ command;
+		for (const uint8_t byte: iPayload) checksum ^= byte;
+		ioBuffer.insert(ioBuffer.end(), iPayload.begin(), iPayload.end());
+		ioBuffer.push_back(checksum);
+		return;
+	}
+	const size_t header = ioBuffer.size() + 3;
+	ioBuffer.insert(ioBuffer.end(), {'$', 'X', directionChar(iDirection), 0, static_cast<uint8_t>(iCommand & 0xFFu),
+									 static_cast<uint8_t>(iCommand >> 8u),
+									 static_cast<uint8_t>(iPayload.size() & 0xFFu),
+									 static_cast<uint8_t>(iPayload.size() >> 8u)});
+	ioBuffer.insert(ioBuffer.end(), iPayload.begin(), iPayload.end());
+	uint8_t crc = 0;
+	for (size_t i = header; i < ioBuffer.size(); ++i) crc = crc8DvbS2(crc, ioBuffer[i]);
+	ioBuffer.push_back(crc);
+}
+// NOLINTEND(*-magic-numbers)
+OWL_DIAG_POP
+
+}// namespace owl::input::serial
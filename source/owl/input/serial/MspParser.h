@@ -0,0 +1,137 @@
+/**
+ * @file MspParser.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+
+#include <functional>
+#include <span>
+
+namespace owl::input::serial {
+
+/**
+ * @brief Direction of a MSP message.
+ */
+enum struct MspDirection : uint8_t {
+	Request,///< To the flight controller.
+	Response,///< From the flight controller.
+	Error,///< Error response of the flight controller.
+};
+
+/**
+ * @brief A decoded MSP message.
+ */
+struct OWL_API MspFrame {
+	/// The command.
+	uint16_t command = 0;
+	/// The direction.
+	MspDirection direction = MspDirection::Response;
+	/// The protocol version, 1 or 2.
+	uint8_t version = 1;
+	/// The payload, valid during the call of the handler.
+	std::span<const uint8_t> payload;
+};
+
+/**
+ * @brief Streaming parser of the MultiWii Serial Protocol, versions 1 and 2.
+ *
+ * The bytes are given as they arrive, a message may be split across any number of calls. The invalid messages
+ * are skipped up to the next start marker.
+ */
+class OWL_API MspParser final {
+public:
+	/// Function receiving the decoded messages.
+	using Handler = std::function<void(const MspFrame&)>;
+
+	/// Largest accepted payload.
+	static constexpr size_t s_maxPayload{1024};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iHandler The function receiving the messages.
+	 */
+	explicit MspParser(Handler iHandler);
+
+	/**
+	 * @brief Parse the next bytes of the stream.
+	 * @param[in] iData The bytes.
+	 */
+	void parse(std::span<const uint8_t> iData);
+
+	/**
+	 * @brief Discard a partial message.
+	 */
+	void reset();
+
+	/**
+	 * @brief Get the number of decoded messages.
+	 * @return The number of messages.
+	 */
+	[[nodiscard]] auto getFrameCount() const -> uint64_t { return m_frameCount; }
+
+	/**
+	 * @brief Get the number of invalid messages.
+	 * @return The number of messages with a bad checksum or size.
+	 */
+	[[nodiscard]] auto getErrorCount() const -> uint64_t { return m_errorCount; }
+
+	/**
+	 * @brief Encode a message, in version 1 when the command and the payload fit.
+	 * @param[in] iCommand The command.
+	 * @param[in] iPayload The payload.
+	 * @param[in] iDirection The direction.
+	 * @param[in,out] ioBuffer The buffer receiving the message.
+	 */
+	static void encode(uint16_t iCommand, std::span<const uint8_t> iPayload, MspDirection iDirection,
+					   std::vector<uint8_t>& ioBuffer);
+
+private:
+	/**
+	 * @brief Parser states.
+	 */
+	enum struct State : uint8_t {
+		Idle,
+		Header,
+		Direction,
+		V1Size,
+		V1Command,
+		V2Flag,
+		V2CommandLow,
+		V2CommandHigh,
+		V2SizeLow,
+		V2SizeHigh,
+		Payload,
+		Checksum,
+	};
+
+	/// The message handler.
+	Handler m_handler;
+	/// The current state.
+	State m_state = State::Idle;
+	/// The message in progress.
+	MspFrame m_frame;
+	/// Size of the payload in progress.
+	size_t m_size = 0;
+	/// Checksum of the message in progress.
+	uint8_t m_checksum = 0;
+	/// The payload in progress.
+	std::vector<uint8_t> m_payload;
+	/// Number of decoded messages.
+	uint64_t m_frameCount = 0;
+	/// Number of invalid messages.
+	uint64_t m_errorCount = 0;
+
+	/**
+	 * @brief Update the checksum of the message in progress.
+	 * @param[in] iData The bytes.
+	 */
+	void updateChecksum(std::span<const uint8_t> iData);
+};
+
+}// namespace owl::input::serial
@@ -0,0 +1,214 @@
+/**
+ * @file Port.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "Port.h"
+
+#ifdef OWL_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/uio.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+namespace owl::input::serial {
+
+#ifdef OWL_PLATFORM_WINDOWS
+
+Port::Port() = default;
+
+Port::~Port() { close(); }
+
+auto Port::open(const std::string& iPort, const uint32_t iBaudRate) -> bool {
+	close();
+	const std::string path = fmt::format("\\\\.\\{}", iPort);
+	HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, 0, nullptr);
+	if (handle == INVALID_HANDLE_VALUE) {
+		OWL_CORE_WARN("Serial ({}): Unable to open the port.", iPort)
+		return false;
+	}
+	DCB dcb{};
+	dcb.DCBlength = sizeof(DCB);
+	if (GetCommState(handle, &dcb) == 0) {
+		OWL_CORE_WARN("Serial ({}): Unable to get the port state.", iPort)
+		CloseHandle(handle);
+		return false;
+	}
+	dcb.BaudRate = iBaudRate;
+	dcb.ByteSize = 8;
+	dcb.Parity = NOPARITY;
+	dcb.StopBits = ONESTOPBIT;
+	dcb.fBinary = TRUE;
+	dcb.fOutxCtsFlow = FALSE;
+	dcb.fRtsControl = RTS_CONTROL_DISABLE;
+	dcb.fOutX = FALSE;
+	dcb.fInX = FALSE;
+	if (SetCommState(handle, &dcb) == 0) {
+		OWL_CORE_WARN("Serial ({}): Unable to set the port state.", iPort)
+		CloseHandle(handle);
+		return false;
+	}
+	PurgeComm(handle, PURGE_RXCLEAR | PURGE_TXCLEAR);
+	m_handle = handle;
+	m_timeout = {};
+	return true;
+}
+
+void Port::close() {
+	if (m_handle == nullptr)
+		return;
+	CloseHandle(m_handle);
+	m_handle = nullptr;
+}
+
+auto Port::isOpened() const -> bool { return m_handle != nullptr; }
+
+auto Port::read(const RingBuffer::Regions<uint8_t>& iRegions, const std::chrono::milliseconds iTimeout) -> int64_t {
+	if (m_handle == nullptr)
+		return -1;
+	if (iRegions[0].empty())
+		return 0;
+	if (iTimeout != m_timeout) {
+		// returns as soon as a byte is received, or after the timeout.
+		COMMTIMEOUTS timeouts{.ReadIntervalTimeout = MAXDWORD,
+							  .ReadTotalTimeoutMultiplier = MAXDWORD,
+							  .ReadTotalTimeoutConstant = static_cast<DWORD>(std::max<int64_t>(iTimeout.count(), 1)),
+							  .WriteTotalTimeoutMultiplier = 0,
+							  .WriteTotalTimeoutConstant = 0};
+		if (SetCommTimeouts(m_handle, &timeouts) == 0)
+			return -1;
+		m_timeout = iTimeout;
+	}
+	DWORD count = 0;
+	if (ReadFile(m_handle, iRegions[0].data(), static_cast<DWORD>(iRegions[0].size()), &count, nullptr) == 0)
+		return -1;
+	return static_cast<int64_t>(count);
+}
+
+auto Port::write(const std::span<const uint8_t> iData) -> bool {
+	if (m_handle == nullptr)
+		return false;
+	DWORD count = 0;
+	return WriteFile(m_handle, iData.data(), static_cast<DWORD>(iData.size()), &count, nullptr) != 0 &&
+		   count == iData.size();
+}
+
+#else
+
+namespace {
+
+auto toSpeed(const uint32_t iBaudRate) -> speed_t {
+	// NOLINTBEGIN(*-magic-numbers)
+	switch (iBaudRate) {
+		case 9600:
+			return B9600;
+		case 19200:
+			return B19200;
+		case 38400:
+			return B38400;
+		case 57600:
+			return B57600;
+		case 115200:
+			return B115200;
+		case 230400:
+			return B230400;
+		case 460800:
+			return B460800;
+		case 921600:
+			return B921600;
+		default:
+			break;
+	}
+	// NOLINTEND(*-magic-numbers)
+	OWL_CORE_WARN("Serial: Unsupported baud rate {}, using 115200.", iBaudRate)
+	return B115200;
+}
+
+}// namespace
+
+Port::Port() = default;
+
+Port::~Port() { close(); }
+
+auto Port::open(const std::string& iPort, const uint32_t iBaudRate) -> bool {
+	close();
+	const int handle = ::open(iPort.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+	if (handle < 0) {
+		OWL_CORE_WARN("Serial ({}): Unable to open the port.", iPort)
+		return false;
+	}
+	termios options{};
+	if (tcgetattr(handle, &options) < 0) {
+		OWL_CORE_WARN("Serial ({}): Unable to get the port attributes.", iPort)
+		::close(handle);
+		return false;
+	}
+	cfmakeraw(&options);
+	options.c_cflag |= CLOCAL | CREAD;
+	options.c_cflag &= ~static_cast<tcflag_t>(CSTOPB | CRTSCTS);
+	// the reads never block, the waits are done by poll.
+	options.c_cc[VMIN] = 0;
+	options.c_cc[VTIME] = 0;
+	const speed_t speed = toSpeed(iBaudRate);
+	if (cfsetispeed(&options, speed) < 0 || cfsetospeed(&options, speed) < 0 ||
+		tcsetattr(handle, TCSANOW, &options) < 0) {
+		OWL_CORE_WARN("Serial ({}): Unable to set the port attributes.", iPort)
+		::close(handle);
+		return false;
+	}
+	tcflush(handle, TCIOFLUSH);
+	m_handle = handle;
+	return true;
+}
+
+void Port::close() {
+	if (m_handle < 0)
+		return;
+	::close(m_handle);
+	m_handle = -1;
+}
+
+auto Port::isOpened() const -> bool { return m_handle >= 0; }
+
+auto Port::read(const RingBuffer::Regions<uint8_t>& iRegions, const std::chrono::milliseconds iTimeout) -> int64_t {
+	if (m_handle < 0)
+		return -1;
+	if (iRegions[0].empty())
+		return 0;
+	pollfd descriptor{.fd = m_handle, .events = POLLIN, .revents = 0};
+	const int ready = poll(&descriptor, 1, static_cast<int>(iTimeout.count()));
+	if (ready < 0)
+		return errno == EINTR ? 0 : -1;
+	if (ready == 0)
+		return 0;
+	if ((descriptor.revents & POLLIN) == 0)
+		return -1;// hang up or error.
+	// both regions in one call, straight into the ring buffer.
+	std::array<iovec, 2> vectors{iovec{.iov_base = iRegions[0].data(), .iov_len = iRegions[0].size()},
+								 iovec{.iov_base = iRegions[1].data(), .iov_len = iRegions[1].size()}};
+	const ssize_t count = readv(m_handle, vectors.data(), iRegions[1].empty() ? 1 : 2);
+	if (count < 0)
+		return errno == EAGAIN || errno == EINTR ? 0 : -1;
+	// readable without any byte: end of file, the other side hung up.
+	return count == 0 ? -1 : count;
+}
+
+auto Port::write(const std::span<const uint8_t> iData) -> bool {
+	if (m_handle < 0)
+		return false;
+	const ssize_t count = ::write(m_handle, iData.data(), iData.size());
+	return count == static_cast<ssize_t>(iData.size());
+}
+
+#endif
+
+}// namespace owl::input::serial
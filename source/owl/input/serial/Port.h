@@ -0,0 +1,83 @@
+/**
+ * @file Port.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "RingBuffer.h"
+
+/**
+ * @brief namespace for serial links.
+ */
+namespace owl::input::serial {
+
+/**
+ * @brief Serial port in raw mode, 8 data bits, no parity and one stop bit.
+ */
+class OWL_API Port final {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	Port();
+	Port(const Port&) = delete;
+	Port(Port&&) = delete;
+	auto operator=(const Port&) -> Port& = delete;
+	auto operator=(Port&&) -> Port& = delete;
+
+	/**
+	 * @brief Destructor.
+	 */
+	~Port();
+
+	/**
+	 * @brief Open a port.
+	 * @param[in] iPort The port (device file or COM port).
+	 * @param[in] iBaudRate The baud rate.
+	 * @return True if the port is open.
+	 */
+	auto open(const std::string& iPort, uint32_t iBaudRate) -> bool;
+
+	/**
+	 * @brief Close the port.
+	 */
+	void close();
+
+	/**
+	 * @brief Check if the port is open.
+	 * @return True if open.
+	 */
+	[[nodiscard]] auto isOpened() const -> bool;
+
+	/**
+	 * @brief Wait for bytes and read them in place in the regions of a ring buffer.
+	 * @param[in] iRegions The free regions.
+	 * @param[in] iTimeout The longest wait.
+	 * @return The number of bytes read, 0 on timeout, negative if the port is lost.
+	 */
+	auto read(const RingBuffer::Regions<uint8_t>& iRegions, std::chrono::milliseconds iTimeout) -> int64_t;
+
+	/**
+	 * @brief Write bytes, without waiting for a full output queue.
+	 * @param[in] iData The bytes.
+	 * @return True if all the bytes are written.
+	 */
+	auto write(std::span<const uint8_t> iData) -> bool;
+
+private:
+#ifdef OWL_PLATFORM_WINDOWS
+	/// The port handle.
+	void* m_handle = nullptr;
+	/// The read timeout of the port.
+	std::chrono::milliseconds m_timeout{0};
+#else
+	/// The port file descriptor.
+	int m_handle = -1;
+#endif
+};
+
+}// namespace owl::input::serial
@@ -0,0 +1,56 @@
+/**
+ * @file RingBuffer.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "RingBuffer.h"
+
+namespace owl::input::serial {
+
+RingBuffer::RingBuffer(const size_t iCapacity) { resize(iCapacity); }
+
+auto RingBuffer::getWritable() -> Regions<uint8_t> {
+	const size_t head = m_head.load(std::memory_order_relaxed);
+	return split(head, m_data.size() - (head - m_tail.load(std::memory_order_acquire)));
+}
+
+void RingBuffer::commit(const size_t iSize) {
+	m_head.store(m_head.load(std::memory_order_relaxed) + iSize, std::memory_order_release);
+}
+
+auto RingBuffer::getReadable() -> Regions<const uint8_t> {
+	const size_t tail = m_tail.load(std::memory_order_relaxed);
+	const auto regions = split(tail, m_head.load(std::memory_order_acquire) - tail);
+	return {regions[0], regions[1]};
+}
+
+void RingBuffer::consume(const size_t iSize) {
+	m_tail.store(m_tail.load(std::memory_order_relaxed) + iSize, std::memory_order_release);
+}
+
+void RingBuffer::clear() {
+	m_head.store(0, std::memory_order_relaxed);
+	m_tail.store(0, std::memory_order_relaxed);
+}
+
+void RingBuffer::resize(const size_t iCapacity) {
+	m_data.assign(std::bit_ceil(std::max<size_t>(iCapacity, 2)), 0);
+	m_mask = m_data.size() - 1;
+	clear();
+}
+
+auto RingBuffer::split(const size_t iStart, const size_t iSize) -> Regions<uint8_t> {
+	const size_t start = iStart & m_mask;
+	const size_t first = std::min(iSize, m_data.size() - start);
+	uint8_t* data = m_data.data();
+	OWL_DIAG_PUSH
+	OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+	return {std::span<uint8_t>{data + start, first}, std::span<uint8_t>{data, iSize - first}};
+	OWL_DIAG_POP
+}
+
+}// namespace owl::input::serial
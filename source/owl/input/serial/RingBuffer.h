@@ -0,0 +1,103 @@
+/**
+ * @file RingBuffer.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+
+#include <span>
+
+namespace owl::input::serial {
+
+/**
+ * @brief Byte ring buffer between a single producer and a single consumer.
+ *
+ * The producer writes in place in the free regions then commits them, the consumer reads the filled regions in
+ * place then consumes them: the bytes are never copied in between.
+ */
+class OWL_API RingBuffer final {
+public:
+	/// Two regions of the buffer, the second one is empty unless the region wraps.
+	template<typename T>
+	using Regions = std::array<std::span<T>, 2>;
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iCapacity The capacity, rounded up to a power of two.
+	 */
+	explicit RingBuffer(size_t iCapacity);
+
+	/**
+	 * @brief Get the capacity.
+	 * @return The capacity in bytes.
+	 */
+	[[nodiscard]] auto getCapacity() const -> size_t { return m_data.size(); }
+
+	/**
+	 * @brief Get the number of bytes to read.
+	 * @return The number of bytes.
+	 */
+	[[nodiscard]] auto getSize() const -> size_t {
+		return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief Get the free regions, for the producer.
+	 * @return The free regions.
+	 */
+	[[nodiscard]] auto getWritable() -> Regions<uint8_t>;
+
+	/**
+	 * @brief Make the first bytes of the free regions readable.
+	 * @param[in] iSize The number of bytes written.
+	 */
+	void commit(size_t iSize);
+
+	/**
+	 * @brief Get the filled regions, for the consumer.
+	 * @return The filled regions.
+	 */
+	[[nodiscard]] auto getReadable() -> Regions<const uint8_t>;
+
+	/**
+	 * @brief Release the first bytes of the filled regions.
+	 * @param[in] iSize The number of bytes read.
+	 */
+	void consume(size_t iSize);
+
+	/**
+	 * @brief Discard the content, neither the producer nor the consumer must be working.
+	 */
+	void clear();
+
+	/**
+	 * @brief Discard the content and change the capacity, neither the producer nor the consumer must be working.
+	 * @param[in] iCapacity The new capacity, rounded up to a power of two.
+	 */
+	void resize(size_t iCapacity);
+
+private:
+	/// The bytes.
+	std::vector<uint8_t> m_data;
+	/// Mask of the positions.
+	size_t m_mask = 0;
+	/// Number of bytes committed.
+	std::atomic<size_t> m_head{0};
+	/// Number of bytes consumed.
+	std::atomic<size_t> m_tail{0};
+
+	/**
+	 * @brief Split a range of the buffer into its regions.
+	 * @param[in] iStart Position of the range.
+	 * @param[in] iSize Size of the range.
+	 * @return The regions.
+	 */
+	[[nodiscard]] auto split(size_t iStart, size_t iSize) -> Regions<uint8_t>;
+};
+
+}// namespace owl::input::serial
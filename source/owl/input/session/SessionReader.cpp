@@ -0,0 +1,107 @@
+/**
+ * @file SessionReader.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "SessionReader.h"
+
+#include "event/KeyEvent.h"
+#include "event/MouseEvent.h"
+
+namespace owl::input::session {
+
+auto SessionReader::open(const std::filesystem::path& iFile) -> bool {
+	close();
+	{
+		std::ifstream in(iFile, std::ios::in | std::ios::binary);
+		if (!in.is_open()) {
+			OWL_CORE_WARN("SessionReader: unable to open {}.", iFile.string())
+			return false;
+		}
+		m_data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	}
+	SessionHeader header;
+	if (m_data.size() < sizeof(header)) {
+		OWL_CORE_WARN("SessionReader: {} is not a session log.", iFile.string())
+		close();
+		return false;
+	}
+	std::memcpy(&header, m_data.data(), sizeof(header));
+	if (header.magic != g_sessionMagic || header.version != g_sessionVersion) {
+		OWL_CORE_WARN("SessionReader: {} is not a session log of version {}.", iFile.string(), g_sessionVersion)
+		close();
+		return false;
+	}
+	m_startTime = std::chrono::system_clock::time_point{
+			std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds{header.start})};
+	const std::span<const uint8_t> data{m_data};
+	size_t offset = sizeof(header);
+	while (data.size() - offset >= sizeof(RecordHeader)) {
+		RecordHeader record;
+		std::memcpy(&record, data.subspan(offset, sizeof(record)).data(), sizeof(record));
+		offset += sizeof(record);
+		if (data.size() - offset < record.size)
+			break;
+		m_records.push_back({.type = record.type,
+							 .timestamp = std::chrono::nanoseconds{record.timestamp},
+							 .payload = data.subspan(offset, record.size)});
+		offset += record.size;
+	}
+	if (offset != data.size())
+		OWL_CORE_WARN("SessionReader: {} is truncated.", iFile.string())
+	// the records pushed by several threads may be slightly out of order.
+	std::ranges::stable_sort(m_records, {}, &Record::timestamp);
+	return true;
+}
+
+void SessionReader::close() {
+	m_records.clear();
+	m_data.clear();
+	m_startTime = {};
+	m_position = 0;
+}
+
+auto SessionReader::getDuration() const -> std::chrono::nanoseconds {
+	return m_records.empty() ? std::chrono::nanoseconds{0} : m_records.back().timestamp;
+}
+
+auto SessionReader::getNextTime() const -> std::chrono::nanoseconds {
+	return isFinished() ? getDuration() : m_records[m_position].timestamp;
+}
+
+auto SessionReader::advanceTo(const std::chrono::nanoseconds iTime) -> std::span<const Record> {
+	const size_t first = m_position;
+	while (m_position < m_records.size() && m_records[m_position].timestamp <= iTime) ++m_position;
+	return std::span{m_records}.subspan(first, m_position - first);
+}
+
+auto SessionReader::decodeEvent(const Record& iRecord) -> uniq<event::Event> {
+	EventPayload payload;
+	if (!readValue(iRecord, payload))
+		return nullptr;
+	switch (static_cast<event::Type>(payload.type)) {
+		case event::Type::KeyPressed:
+			return mkUniq<event::KeyPressedEvent>(payload.key, payload.repeat);
+		case event::Type::KeyReleased:
+			return mkUniq<event::KeyReleasedEvent>(payload.key);
+		case event::Type::KeyTyped:
+			return mkUniq<event::KeyTypedEvent>(payload.key);
+		case event::Type::MouseButtonPressed:
+			return mkUniq<event::MouseButtonPressedEvent>(payload.button);
+		case event::Type::MouseButtonReleased:
+			return mkUniq<event::MouseButtonReleasedEvent>(payload.button);
+		case event::Type::MouseMoved:
+			return mkUniq<event::MouseMovedEvent>(payload.position[0], payload.position[1]);
+		case event::Type::MouseScrolled:
+			return mkUniq<event::MouseScrolledEvent>(payload.position[0], payload.position[1]);
+		default:
+			break;
+	}
+	return nullptr;
+}
+
+}// namespace owl::input::session
@@ -0,0 +1,131 @@
+/**
+ * @file SessionReader.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "SessionWriter.h"
+
+namespace owl::input::session {
+
+/**
+ * @brief Reader of a session log, replaying its records in time order.
+ *
+ * The log is loaded in memory when opening, the records point into it. The replay is driven by the caller: either
+ * with a clock, getting the records up to a time, or as fast as possible, getting one time step after the other.
+ */
+class OWL_API SessionReader final {
+public:
+	/**
+	 * @brief A record of the log.
+	 */
+	struct OWL_API Record {
+		/// Type of the record.
+		uint16_t type = 0;
+		/// Time of the record from the start.
+		std::chrono::nanoseconds timestamp{0};
+		/// The payload.
+		std::span<const uint8_t> payload;
+	};
+
+	/**
+	 * @brief Read a session log.
+	 *
+	 * A log from an interrupted session is read up to its last complete record.
+	 * @param[in] iFile The log file.
+	 * @return True if the log is valid.
+	 */
+	auto open(const std::filesystem::path& iFile) -> bool;
+
+	/**
+	 * @brief Release the log.
+	 */
+	void close();
+
+	/**
+	 * @brief Get all the records.
+	 * @return The records.
+	 */
+	[[nodiscard]] auto getRecords() const -> const std::vector<Record>& { return m_records; }
+
+	/**
+	 * @brief Get the system time of the start of the session.
+	 * @return The start time.
+	 */
+	[[nodiscard]] auto getStartTime() const -> std::chrono::system_clock::time_point { return m_startTime; }
+
+	/**
+	 * @brief Get the duration of the session.
+	 * @return Time of the last record.
+	 */
+	[[nodiscard]] auto getDuration() const -> std::chrono::nanoseconds;
+
+	/**
+	 * @brief Restart the replay.
+	 */
+	void rewind() { m_position = 0; }
+
+	/**
+	 * @brief Check if all the records are replayed.
+	 * @return True if finished.
+	 */
+	[[nodiscard]] auto isFinished() const -> bool { return m_position >= m_records.size(); }
+
+	/**
+	 * @brief Get the time of the next record to replay.
+	 * @return The time of the next record, the duration if finished.
+	 */
+	[[nodiscard]] auto getNextTime() const -> std::chrono::nanoseconds;
+
+	/**
+	 * @brief Replay the records up to a time.
+	 * @param[in] iTime The time from the start.
+	 * @return The records replayed.
+	 */
+	auto advanceTo(std::chrono::nanoseconds iTime) -> std::span<const Record>;
+
+	/**
+	 * @brief Replay the records of the next time.
+	 * @return The records replayed, sharing the same time.
+	 */
+	auto advance() -> std::span<const Record> { return advanceTo(getNextTime()); }
+
+	/**
+	 * @brief Read the value of a record.
+	 * @tparam T The value type, trivially copyable.
+	 * @param[in] iRecord The record.
+	 * @param[out] oValue The value.
+	 * @return True if the payload holds the value.
+	 */
+	template<typename T>
+		requires std::is_trivially_copyable_v<T>
+	static auto readValue(const Record& iRecord, T& oValue) -> bool {
+		if (iRecord.payload.size() != sizeof(T))
+			return false;
+		std::memcpy(static_cast<void*>(&oValue), iRecord.payload.data(), sizeof(T));
+		return true;
+	}
+
+	/**
+	 * @brief Rebuild an input event from its record.
+	 * @param[in] iRecord The record, written with SessionWriter::encodeEvent.
+	 * @return The event, nullptr if the record is not an event.
+	 */
+	static auto decodeEvent(const Record& iRecord) -> uniq<event::Event>;
+
+private:
+	/// The log content.
+	std::vector<uint8_t> m_data;
+	/// The records.
+	std::vector<Record> m_records;
+	/// System time of the start.
+	std::chrono::system_clock::time_point m_startTime;
+	/// Position of the next record to replay.
+	size_t m_position = 0;
+};
+
+}// namespace owl::input::session
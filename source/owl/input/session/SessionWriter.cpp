@@ -0,0 +1,185 @@
+/**
+ * @file SessionWriter.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "SessionWriter.h"
+
+#include "event/KeyEvent.h"
+#include "event/MouseEvent.h"
+
+namespace owl::input::session {
+
+SessionWriter::SessionWriter() : SessionWriter(Specification{}) {}
+
+SessionWriter::SessionWriter(const Specification& iSpecification) : m_specification{iSpecification} {
+	m_specification.maxPending = std::max(m_specification.maxPending, m_specification.chunkSize);
+}
+
+SessionWriter::~SessionWriter() { stop(); }
+
+auto SessionWriter::start(const std::filesystem::path& iFile) -> bool {
+	stop();
+	m_file = iFile;
+	m_file.replace_extension(g_sessionExtension);
+	if (m_file.has_parent_path())
+		create_directories(m_file.parent_path());
+	m_stream = {};
+	// the buffers are written whole: no stream buffering.
+	m_stream.rdbuf()->pubsetbuf(nullptr, 0);
+	m_stream.open(m_file, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!m_stream.is_open()) {
+		OWL_CORE_WARN("SessionWriter: unable to create {}.", m_file.string())
+		return false;
+	}
+	m_start = std::chrono::steady_clock::now();
+	const SessionHeader header{.start = std::chrono::duration_cast<std::chrono::nanoseconds>(
+											   std::chrono::system_clock::now().time_since_epoch())
+											   .count()};
+	m_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	m_pending.clear();
+	m_pending.reserve(m_specification.chunkSize);
+	m_writing.clear();
+	m_writing.reserve(m_specification.chunkSize);
+	m_records.store(0, std::memory_order_relaxed);
+	m_dropped.store(0, std::memory_order_relaxed);
+	m_bytes.store(sizeof(header), std::memory_order_relaxed);
+	{
+		std::lock_guard lock(m_mutex);
+		m_failed = false;
+		m_open = true;
+	}
+	m_writerThread = std::jthread([this](const std::stop_token& iStop) { writerLoop(iStop); });
+	OWL_CORE_INFO("SessionWriter: recording to {}.", m_file.string())
+	return true;
+}
+
+void SessionWriter::stop() {
+	if (!m_writerThread.joinable())
+		return;
+	{
+		std::lock_guard lock(m_mutex);
+		m_open = false;
+	}
+	m_writerThread.request_stop();
+	m_writerThread.join();
+	m_stream.close();
+	const auto statistics = getStatistics();
+	OWL_CORE_INFO("SessionWriter: {} records to {} ({} dropped).", statistics.records, m_file.string(),
+				  statistics.dropped)
+}
+
+auto SessionWriter::push(const uint16_t iType, const std::chrono::steady_clock::time_point iTime,
+						 const std::span<const uint8_t> iPayload) -> bool {
+	bool wakeUp = false;
+	{
+		std::lock_guard lock(m_mutex);
+		if (!m_open)
+			return false;
+		if (m_failed || m_pending.size() + sizeof(RecordHeader) + iPayload.size() > m_specification.maxPending) {
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		const RecordHeader header{
+				.type = iType,
+				.size = static_cast<uint32_t>(iPayload.size()),
+				.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(iTime - m_start).count()};
+		const auto* bytes = reinterpret_cast<const uint8_t*>(&header);
+		OWL_DIAG_PUSH
+		OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+		m_pending.insert(m_pending.end(), bytes, bytes + sizeof(header));
+		OWL_DIAG_POP
+		m_pending.insert(m_pending.end(), iPayload.begin(), iPayload.end());
+		wakeUp = m_pending.size() >= m_specification.chunkSize;
+	}
+	m_records.fetch_add(1, std::memory_order_relaxed);
+	if (wakeUp)
+		m_wakeUp.notify_one();
+	return true;
+}
+
+auto SessionWriter::getStatistics() const -> Statistics {
+	return {.records = m_records.load(std::memory_order_relaxed),
+			.dropped = m_dropped.load(std::memory_order_relaxed),
+			.bytes = m_bytes.load(std::memory_order_relaxed)};
+}
+
+void SessionWriter::writerLoop(const std::stop_token& iStop) {
+	while (!iStop.stop_requested()) {
+		{
+			std::unique_lock lock(m_mutex);
+			m_wakeUp.wait_for(lock, iStop, m_specification.flushPeriod,
+							  [this] { return m_pending.size() >= m_specification.chunkSize; });
+			std::swap(m_pending, m_writing);
+		}
+		writeRecords();
+	}
+	// the last records.
+	{
+		std::lock_guard lock(m_mutex);
+		std::swap(m_pending, m_writing);
+	}
+	writeRecords();
+}
+
+void SessionWriter::writeRecords() {
+	if (m_writing.empty())
+		return;
+	OWL_PROFILE_SCOPE("session writing")
+	m_stream.write(reinterpret_cast<const char*>(m_writing.data()), static_cast<std::streamsize>(m_writing.size()));
+	if (m_stream.good()) {
+		m_bytes.fetch_add(m_writing.size(), std::memory_order_relaxed);
+	} else {
+		// the records of the buffer are lost, and the following ones are dropped.
+		uint64_t lost = 0;
+		for (size_t offset = 0; offset + sizeof(RecordHeader) <= m_writing.size(); ++lost) {
+			RecordHeader header;
+			OWL_DIAG_PUSH
+			OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+			std::memcpy(&header, m_writing.data() + offset, sizeof(header));
+			OWL_DIAG_POP
+			offset += sizeof(header) + header.size;
+		}
+		m_dropped.fetch_add(lost, std::memory_order_relaxed);
+		std::lock_guard lock(m_mutex);
+		if (!m_failed)
+			OWL_CORE_WARN("SessionWriter: unable to write to {}.", m_file.string())
+		m_failed = true;
+	}
+	m_writing.clear();
+}
+
+auto SessionWriter::encodeEvent(const event::Event& iEvent, EventPayload& oPayload) -> bool {
+	oPayload = {.type = static_cast<uint8_t>(iEvent.getType())};
+	switch (iEvent.getType()) {
+		case event::Type::KeyPressed:
+			oPayload.key = static_cast<const event::KeyPressedEvent&>(iEvent).getKeyCode();
+			oPayload.repeat = static_cast<const event::KeyPressedEvent&>(iEvent).getRepeatCount();
+			return true;
+		case event::Type::KeyReleased:
+		case event::Type::KeyTyped:
+			oPayload.key = static_cast<const event::KeyEvent&>(iEvent).getKeyCode();
+			return true;
+		case event::Type::MouseButtonPressed:
+		case event::Type::MouseButtonReleased:
+			oPayload.button = static_cast<const event::MouseButtonEvent&>(iEvent).getMouseButton();
+			return true;
+		case event::Type::MouseMoved:
+			oPayload.position = {static_cast<const event::MouseMovedEvent&>(iEvent).getX(),
+								 static_cast<const event::MouseMovedEvent&>(iEvent).getY()};
+			return true;
+		case event::Type::MouseScrolled:
+			oPayload.position = {static_cast<const event::MouseScrolledEvent&>(iEvent).getXOff(),
+								 static_cast<const event::MouseScrolledEvent&>(iEvent).getYOff()};
+			return true;
+		default:
+			break;
+	}
+	return false;
+}
+
+}// namespace owl::input::session
@@ -0,0 +1,237 @@
+/**
+ * @file SessionWriter.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+#include "event/Event.h"
+
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <thread>
+
+/**
+ * @brief namespace for the recording of sessions.
+ */
+namespace owl::input::session {
+
+/// Extension of the session logs.
+constexpr std::string_view g_sessionExtension{".owls"};
+/// Version of the session log layout.
+constexpr uint32_t g_sessionVersion{1};
+/// Magic of the session log header.
+constexpr std::array<char, 4> g_sessionMagic{'O', 'W', 'L', 'S'};
+
+/**
+ * @brief Header of a session log.
+ */
+struct OWL_API SessionHeader {
+	/// The log magic.
+	std::array<char, 4> magic = g_sessionMagic;
+	/// Version of the layout.
+	uint32_t version = g_sessionVersion;
+	/// System time of the start, in nanoseconds since the epoch.
+	int64_t start = 0;
+};
+
+/**
+ * @brief Header of a record, followed by its payload.
+ */
+struct OWL_API RecordHeader {
+	/// Type of the record, defined by the application.
+	uint16_t type = 0;
+	/// Reserved.
+	uint16_t reserved = 0;
+	/// Size of the payload.
+	uint32_t size = 0;
+	/// Time of the record from the start, in nanoseconds.
+	int64_t timestamp = 0;
+};
+
+/**
+ * @brief Payload of an input event record.
+ */
+struct OWL_API EventPayload {
+	/// Type of the event.
+	uint8_t type = 0;
+	/// Mouse button.
+	uint8_t button = 0;
+	/// Key code.
+	uint16_t key = 0;
+	/// Key repeat count.
+	uint16_t repeat = 0;
+	/// Reserved.
+	uint16_t reserved = 0;
+	/// Mouse position or scroll offset.
+	std::array<float, 2> position{};
+};
+
+/**
+ * @brief Asynchronous writer of a session log: a sequence of timestamped and typed records.
+ *
+ * The records are appended to a pending buffer, a full buffer drops the record instead of waiting. A dedicated
+ * writer thread swaps the buffers and writes them whole, when enough bytes are pending or periodically.
+ */
+class OWL_API SessionWriter final {
+public:
+	/**
+	 * @brief Writing parameters.
+	 */
+	struct OWL_API Specification {
+		/// Number of pending bytes waking the writer.
+		size_t chunkSize = 64ull << 10u;
+		/// Number of pending bytes before dropping.
+		size_t maxPending = 4ull << 20u;
+		/// Longest time between two writes.
+		std::chrono::milliseconds flushPeriod{100};
+	};
+
+	/**
+	 * @brief Writing statistics.
+	 */
+	struct OWL_API Statistics {
+		/// Number of records accepted.
+		uint64_t records = 0;
+		/// Number of records dropped because the buffer was full or the writing failed.
+		uint64_t dropped = 0;
+		/// Number of bytes written to the file.
+		uint64_t bytes = 0;
+	};
+
+	/**
+	 * @brief Default constructor.
+	 */
+	SessionWriter();
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iSpecification The writing parameters.
+	 */
+	explicit SessionWriter(const Specification& iSpecification);
+	SessionWriter(const SessionWriter&) = delete;
+	SessionWriter(SessionWriter&&) = delete;
+	auto operator=(const SessionWriter&) -> SessionWriter& = delete;
+	auto operator=(SessionWriter&&) -> SessionWriter& = delete;
+
+	/**
+	 * @brief Destructor, stops the writing.
+	 */
+	~SessionWriter();
+
+	/**
+	 * @brief Create the file and start the writer thread.
+	 * @param[in] iFile The file, its extension is replaced by the session log one.
+	 * @return True if the writing started.
+	 */
+	auto start(const std::filesystem::path& iFile) -> bool;
+
+	/**
+	 * @brief Write the pending records and stop the writer thread.
+	 */
+	void stop();
+
+	/**
+	 * @brief Check if a writing is running.
+	 * @return True if writing.
+	 */
+	[[nodiscard]] auto isRecording() const -> bool { return m_writerThread.joinable(); }
+
+	/**
+	 * @brief Get the file of the session log.
+	 * @return The file path.
+	 */
+	[[nodiscard]] auto getFile() const -> const std::filesystem::path& { return m_file; }
+
+	/**
+	 * @brief Get the start of the session, the origin of the record times.
+	 * @return The start time.
+	 */
+	[[nodiscard]] auto getStart() const -> std::chrono::steady_clock::time_point { return m_start; }
+
+	/**
+	 * @brief Append a record, from any thread, never waits for the writer.
+	 * @param[in] iType The record type.
+	 * @param[in] iTime The record time.
+	 * @param[in] iPayload The record payload.
+	 * @return True if the record is accepted, false if dropped.
+	 */
+	auto push(uint16_t iType, std::chrono::steady_clock::time_point iTime, std::span<const uint8_t> iPayload) -> bool;
+
+	/**
+	 * @brief Append a record holding a value.
+	 * @tparam T The value type, trivially copyable.
+	 * @param[in] iType The record type.
+	 * @param[in] iTime The record time.
+	 * @param[in] iValue The value.
+	 * @return True if the record is accepted, false if dropped.
+	 */
+	template<typename T>
+		requires std::is_trivially_copyable_v<T>
+	auto pushValue(const uint16_t iType, const std::chrono::steady_clock::time_point iTime, const T& iValue) -> bool {
+		return push(iType, iTime, {reinterpret_cast<const uint8_t*>(&iValue), sizeof(T)});
+	}
+
+	/**
+	 * @brief Get the statistics of the writing.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStatistics() const -> Statistics;
+
+	/**
+	 * @brief Encode an input event as a record payload.
+	 * @param[in] iEvent The event.
+	 * @param[out] oPayload The payload.
+	 * @return False if the event is not a keyboard or mouse event.
+	 */
+	static auto encodeEvent(const event::Event& iEvent, EventPayload& oPayload) -> bool;
+
+private:
+	/// The writing parameters.
+	Specification m_specification;
+	/// The log file.
+	std::filesystem::path m_file;
+	/// The output stream.
+	std::ofstream m_stream;
+	/// Start of the session.
+	std::chrono::steady_clock::time_point m_start;
+	/// Lock of the pending buffer.
+	std::mutex m_mutex;
+	/// Wakes the writer thread.
+	std::condition_variable_any m_wakeUp;
+	/// The records waiting for the writer.
+	std::vector<uint8_t> m_pending;
+	/// The records being written.
+	std::vector<uint8_t> m_writing;
+	/// If the records are accepted.
+	bool m_open = false;
+	/// If the writing failed.
+	bool m_failed = false;
+	/// Number of records accepted.
+	std::atomic<uint64_t> m_records{0};
+	/// Number of records dropped.
+	std::atomic<uint64_t> m_dropped{0};
+	/// Number of bytes written.
+	std::atomic<uint64_t> m_bytes{0};
+	/// The writer thread.
+	std::jthread m_writerThread;
+
+	/**
+	 * @brief Write the pending records until stopped.
+	 * @param[in] iStop The stop token of the thread.
+	 */
+	void writerLoop(const std::stop_token& iStop);
+
+	/**
+	 * @brief Write the records swapped from the pending buffer.
+	 */
+	void writeRecords();
+};
+
+}// namespace owl::input::session
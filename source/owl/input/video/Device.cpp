@@ -8,129 +8,164 @@
 #include "owlpch.h"
 
 #include "Device.h"
-#include <stb_image.h>
+#include "FrameRecorder.h"
+#include "PixelConversion.h"
 
 namespace owl::input::video {
 
-namespace {
-
-OWL_DIAG_PUSH
-OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
-// NOLINTBEGIN(*-magic-numbers)
-void convertNv12ToRgb24(const uint8_t* iNv12Buffer, const math::vec2ui& iSize, uint8_t* oRgb24Buffer) {
-	// Each component Y occupy width * height bytes.
-	const uint32_t ySize = iSize.surface();
-
-	// Pointers to component Y, U and V in buffer NV12
-	const uint8_t* yComponent = iNv12Buffer;
-	const uint8_t* uvComponent = iNv12Buffer + ySize;
-
-	for (uint32_t i = 0; i < iSize.y(); i++) {
-		for (uint32_t j = 0; j < iSize.x(); j++) {
-			// index in buffer NV12
-			const uint32_t yIndex = i * iSize.x() + j;
-			const uint32_t uvIndex = (i / 2ul * iSize.x()) + (j & ~1ul);
-			// index in buffer RGB24
-			const uint32_t rgbIndex = ((i + 1) * iSize.x() - j - 1) * 3;
-			// Convert YUV to RGB
-			const int32_t c = yComponent[yIndex] - 16;
-			const int32_t d = uvComponent[uvIndex] - 128;
-			const int32_t e = uvComponent[uvIndex + 1] - 128;
-			// Compute RGB component, limit values in range [0, 255]
-			oRgb24Buffer[rgbIndex] = static_cast<uint8_t>(math::clamp((298 * c + 409 * e + 128) >> 8, 0, 255));
-			oRgb24Buffer[rgbIndex + 1] =
-					static_cast<uint8_t>(math::clamp((298 * c - 100 * d - 208 * e + 128) >> 8, 0, 255));
-			oRgb24Buffer[rgbIndex + 2] = static_cast<uint8_t>(math::clamp((298 * c + 516 * d + 128) >> 8, 0, 255));
-		}
+Device::Device(std::string iName) : m_name(std::move(iName)) {}
+
+Device::~Device() = default;
+
+auto Device::convertToRgb(const uint8_t* iInputBuffer, const int32_t iBufferSize, std::vector<uint8_t>& ioRgbBuffer,
+						  math::vec2ui& oSize) -> bool {
+	if (m_pixFormat == PixelFormat::MJpeg) {
+		if (iBufferSize <= 0)
+			return false;
+		return m_jpegDecoder.decode(iInputBuffer, static_cast<size_t>(iBufferSize), getDecodeScale(), true,
+									ioRgbBuffer, oSize);
 	}
+	oSize = m_size;
+	ioRgbBuffer.resize(3ull * m_size.surface());
+	switch (m_pixFormat) {
+		case PixelFormat::Nv12:
+			convertNv12ToRgb24(iInputBuffer, m_size, ioRgbBuffer.data(), {.mirror = true});
+			return true;
+		case PixelFormat::Rgb24:
+			copyRgb24(iInputBuffer, m_size, ioRgbBuffer.data());
+			return true;
+		case PixelFormat::YuYv:
+			convertYuYvToRgb24(iInputBuffer, m_size, ioRgbBuffer.data());
+			return true;
+		case PixelFormat::MJpeg:
+		case PixelFormat::Unknwon:
+			break;
+	}
+	OWL_CORE_WARN("Unknown or unsupported pixel format.")
+	return false;
 }
 
-void convertYuYvToRgb24(const uint8_t* iYuYvBuffer, const math::vec2ui& iSize, uint8_t* oRgb24Buffer) {
-	// Each component YUV takes 2 bytes in YUYV format.
-	const uint32_t yuyvSize = iSize.surface() * 2;
-
-	for (uint32_t i = 0; i < yuyvSize; i += 4) {
-		// Convert YUV to RGB for first pixel
-		const int32_t c0 = iYuYvBuffer[i] - 16;
-		const int32_t d0 = iYuYvBuffer[i + 1] - 128;
-		const int32_t e0 = iYuYvBuffer[i + 3] - 128;
-		// Convert YUV to RGB for second pixel
-		const int32_t c1 = iYuYvBuffer[i + 2] - 16;
-		// Indices dans le tampon RGB24
-		const uint32_t rgbIndex = i * 3 / 2;
-
-		// Store RGB component in RGB24 buffer for the 2 pixels.
-		oRgb24Buffer[rgbIndex] = static_cast<uint8_t>(math::clamp((298 * c0 + 409 * e0 + 128) >> 8, 0, 255));
-		oRgb24Buffer[rgbIndex + 1] =
-				static_cast<uint8_t>(math::clamp((298 * c0 - 100 * d0 - 208 * e0 + 128) >> 8, 0, 255));
-		oRgb24Buffer[rgbIndex + 2] = static_cast<uint8_t>(math::clamp((298 * c0 + 516 * d0 + 128) >> 8, 0, 255));
-
-		oRgb24Buffer[rgbIndex + 3] = static_cast<uint8_t>(math::clamp((298 * c1 + 409 * e0 + 128) >> 8, 0, 255));
-		oRgb24Buffer[rgbIndex + 4] =
-				static_cast<uint8_t>(math::clamp((298 * c1 - 100 * d0 - 208 * e0 + 128) >> 8, 0, 255));
-		oRgb24Buffer[rgbIndex + 5] = static_cast<uint8_t>(math::clamp((298 * c1 + 516 * d0 + 128) >> 8, 0, 255));
+auto Device::captureFrame(const uint8_t* iInputBuffer, const int32_t iBufferSize, Frame& ioFrame) -> bool {
+	size_t rawSize = 0;
+	if (hasGpuConversion() && (m_pixFormat == PixelFormat::Nv12 || m_pixFormat == PixelFormat::YuYv)) {
+		ioFrame.layout = m_pixFormat == PixelFormat::Nv12 ? renderer::YuvLayout::Nv12 : renderer::YuvLayout::YuYv;
+		rawSize = getRawFrameSize(m_pixFormat, m_size);
+	}
+	if (rawSize == 0) {
+		ioFrame.layout = renderer::YuvLayout::None;
+		return convertToRgb(iInputBuffer, iBufferSize, ioFrame.pixels, ioFrame.size);
 	}
+	if (iBufferSize < 0 || static_cast<size_t>(iBufferSize) < rawSize)
+		return false;
+	ioFrame.size = m_size;
+	OWL_DIAG_PUSH
+	OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+	ioFrame.pixels.assign(iInputBuffer, iInputBuffer + rawSize);
+	OWL_DIAG_POP
+	return true;
 }
 
-void convertMJpegToRgb24(const uint8_t* iJpegBuffer, const int32_t iJpegSize, const math::vec2ui& iSize,
-						 uint8_t* oRgb24Buffer) {
-	int comp = 0;
-	int width = 0;
-	int height = 0;
-	stbi_set_flip_vertically_on_load(0);
-	uint8_t* buffer = stbi_load_from_memory(iJpegBuffer, iJpegSize, &width, &height, &comp, 3);
-	if (buffer == nullptr) {
-		OWL_CORE_WARN("Jpeg decoding: nullptr result.")
-		return;
-	}
-	if (iSize != math::vec2ui{static_cast<uint32_t>(width), static_cast<uint32_t>(height)}) {
-		OWL_CORE_WARN("Jpeg decoding: size missmatch ({} {}) expecting {} {}.", width, height, iSize.x(), iSize.y())
-		stbi_image_free(buffer);
-		return;
+void Device::setRecorder(const shared<FrameRecorder>& iRecorder) {
+	const std::lock_guard lock(m_recorderMutex);
+	m_recorder = iRecorder;
+}
+
+void Device::recordFrame(const uint8_t* iInputBuffer, const int32_t iBufferSize, const uint64_t iSequence) {
+	shared<FrameRecorder> recorder;
+	{
+		const std::lock_guard lock(m_recorderMutex);
+		recorder = m_recorder;
 	}
-	if (comp != 3) {
-		OWL_CORE_WARN("Jpeg decoding: wrong number of channels: {} expecting 3.", comp)
-		stbi_image_free(buffer);
+	if (!recorder || iBufferSize <= 0)
 		return;
-	}
-	//int rowSize = width * 3;
-	for (int i = 0; i < height; ++i) {
-		for (int j = 0; j < width; ++j) {
-			const int sourceIndex = (i * width + j) * 3;
-			const int destinationIndex = ((i + 1) * width - j - 1) * 3;// Inversion horizontale
-			std::memcpy(oRgb24Buffer + destinationIndex, buffer + sourceIndex, 3);
-		}
-	}
-	//std::memcpy(rgb24Buffer, buffer, frameSize.surface() * 3);
-	stbi_image_free(buffer);
+	// a raw frame is recorded without the driver padding.
+	size_t size = getRawFrameSize(m_pixFormat, m_size);
+	if (size == 0 || size > static_cast<size_t>(iBufferSize))
+		size = static_cast<size_t>(iBufferSize);
+	recorder->push(iInputBuffer, size, iSequence, std::chrono::steady_clock::now());
 }
-// NOLINTEND(*-magic-numbers)
-OWL_DIAG_POP
 
-}// namespace
+auto Device::getStatistics() const -> Statistics {
+	Statistics statistics{.captured = m_captured.load(std::memory_order_relaxed),
+						  .uploaded = m_uploaded,
+						  .dropped = m_mailbox.getDroppedCount(),
+						  .lastLatency = m_lastLatency};
+	if (m_uploaded > 0)
+		statistics.meanLatency = m_latencySum / static_cast<double>(m_uploaded);
+	return statistics;
+}
 
-Device::Device(std::string iName) : m_name(std::move(iName)) {}
+void Device::resetCapture() {
+	m_mailbox.reset();
+	m_captured.store(0, std::memory_order_relaxed);
+	m_uploaded = 0;
+	m_latencySum = {};
+	m_lastLatency = {};
+}
 
-Device::~Device() = default;
+void Device::publishFrame() {
+	m_mailbox.publish();
+	m_captured.fetch_add(1, std::memory_order_relaxed);
+}
+
+auto Device::consumeFrame(FrameTextures& ioFrame) -> bool {
+	Frame* frame = m_mailbox.consume();
+	if (frame == nullptr)
+		return false;// no new frame since the last call.
+	uploadFrame(*frame, ioFrame);
+	accountUpload(frame->timestamp);
+	return true;
+}
+
+void Device::accountUpload(const std::chrono::steady_clock::time_point iCaptureTime) {
+	m_lastLatency = std::chrono::steady_clock::now() - iCaptureTime;
+	m_latencySum += m_lastLatency;
+	++m_uploaded;
+}
 
-auto Device::getRgbBuffer(const uint8_t* iInputBuffer, const int32_t iBufferSize) const -> std::vector<uint8_t> {
-	std::vector<uint8_t> output;
-	if (m_pixFormat == PixelFormat::Nv12) {
-		output.resize(3ull * m_size.surface());
-		convertNv12ToRgb24(iInputBuffer, m_size, output.data());
-	} else if (m_pixFormat == PixelFormat::Rgb24) {
-		output.resize(3ull * m_size.surface());
-		memcpy(output.data(), iInputBuffer, output.size());
-	} else if (m_pixFormat == PixelFormat::YuYv) {
-		output.resize(3ull * m_size.surface());
-		convertYuYvToRgb24(iInputBuffer, m_size, output.data());
-	} else if (m_pixFormat == PixelFormat::MJpeg) {
-		output.resize(3ull * m_size.surface());
-		convertMJpegToRgb24(iInputBuffer, iBufferSize, m_size, output.data());
-	} else {
-		OWL_CORE_WARN("Unknown or unsupported pixel format, empty output buffer.")
+void Device::uploadFrame(Frame& iFrame, FrameTextures& ioTextures) {
+	const auto& size = iFrame.size;
+	auto format = renderer::ImageFormat::RGB8;
+	if (iFrame.layout == renderer::YuvLayout::Nv12)
+		format = renderer::ImageFormat::R8;
+	else if (iFrame.layout == renderer::YuvLayout::YuYv)
+		format = renderer::ImageFormat::RG8;
+	if (!ioTextures.texture || ioTextures.texture->getSize() != size ||
+		ioTextures.texture->getSpecification().format != format)
+		ioTextures.texture = renderer::Texture2D::create({size, format, false});
+	ioTextures.layout = iFrame.layout;
+	ioTextures.sequence = iFrame.sequence;
+	ioTextures.timestamp = iFrame.timestamp;
+	// the NV12 frames are mirrored like by the CPU conversion.
+	ioTextures.mirror = iFrame.layout == renderer::YuvLayout::Nv12;
+	if (iFrame.layout != renderer::YuvLayout::Nv12) {
+		ioTextures.chroma.reset();
+		ioTextures.texture->setData(iFrame.pixels.data(), static_cast<uint32_t>(iFrame.pixels.size()));
+		return;
+	}
+	const math::vec2ui chromaSize{(size.x() + 1) / 2, (size.y() + 1) / 2};
+	if (!ioTextures.chroma || ioTextures.chroma->getSize() != chromaSize)
+		ioTextures.chroma = renderer::Texture2D::create({chromaSize, renderer::ImageFormat::RG8, false});
+	OWL_DIAG_PUSH
+	OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+	ioTextures.texture->setData(iFrame.pixels.data(), size.surface());
+	ioTextures.chroma->setData(iFrame.pixels.data() + size.surface(), 2 * chromaSize.surface());
+	OWL_DIAG_POP
+}
+
+auto Device::getRawFrameSize(const PixelFormat& iPixFormat, const math::vec2ui& iSize) -> size_t {
+	switch (iPixFormat) {
+		case PixelFormat::Rgb24:
+			return 3ull * iSize.surface();
+		case PixelFormat::Nv12:
+			return iSize.surface() + 2ull * ((iSize.x() + 1) / 2) * ((iSize.y() + 1) / 2);
+		case PixelFormat::YuYv:
+			return 2ull * iSize.surface();
+		case PixelFormat::MJpeg:
+		case PixelFormat::Unknwon:
+			return 0;
 	}
-	return output;
+	return 0;
 }
 
 auto Device::isPixelFormatSupported(const PixelFormat& iPixFormat) -> bool {
@@ -7,11 +7,35 @@
  */
 
 #pragma once
+#include "FrameMailbox.h"
+#include "MJpegDecoder.h"
 #include "core/Core.h"
 #include "renderer/Texture.h"
 
+#include <mutex>
+
 namespace owl::input::video {
 
+class FrameRecorder;
+
+/**
+ * @brief Textures of a video frame, ready to draw.
+ */
+struct OWL_API FrameTextures {
+	/// The RGB frame, or the luma (NV12) or packed (YUYV) plane of a raw frame.
+	shared<renderer::Texture> texture;
+	/// The chroma plane of a NV12 frame.
+	shared<renderer::Texture> chroma;
+	/// Layout of a raw frame, None for an RGB frame.
+	renderer::YuvLayout layout = renderer::YuvLayout::None;
+	/// If the frame must be drawn mirrored horizontally.
+	bool mirror = false;
+	/// The capture sequence number of the frame.
+	uint64_t sequence = 0;
+	/// The capture time of the frame.
+	std::chrono::steady_clock::time_point timestamp;
+};
+
 /**
  * @brief Class describing the video input device.
  */
@@ -61,9 +85,37 @@ public:
 
 	/**
 	 * @brief Retrieve a frame.
-	 * @param[in] iFrame The frame to update.
+	 * @param[in,out] ioFrame The frame to update.
 	 */
-	virtual void fillFrame(shared<renderer::Texture>& iFrame) = 0;
+	virtual void fillFrame(FrameTextures& ioFrame) = 0;
+
+	/**
+	 * @brief Capture statistics.
+	 */
+	struct OWL_API Statistics {
+		/// Number of frames published by the capture.
+		uint64_t captured = 0;
+		/// Number of frames uploaded.
+		uint64_t uploaded = 0;
+		/// Number of frames replaced before being uploaded.
+		uint64_t dropped = 0;
+		/// Mean time between the capture and the upload of the frames.
+		std::chrono::duration<double, std::milli> meanLatency{0};
+		/// Time between the capture and the upload of the latest frame.
+		std::chrono::duration<double, std::milli> lastLatency{0};
+	};
+
+	/**
+	 * @brief Get the capture statistics since the opening.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStatistics() const -> Statistics;
+
+	/**
+	 * @brief Get the time between two frames of the device.
+	 * @return The frame interval, zero if unknown.
+	 */
+	[[nodiscard]] auto getFrameInterval() const -> const std::chrono::duration<double>& { return m_frameInterval; }
 
 	/**
 	 * @brief Get the unique bus information.
@@ -90,6 +142,56 @@ public:
 	 */
 	[[nodiscard]] auto getPixelFormat() const -> const PixelFormat& { return m_pixFormat; }
 
+	/**
+	 * @brief Get the native size of the frames.
+	 * @return The frame size.
+	 */
+	[[nodiscard]] auto getSize() const -> const math::vec2ui& { return m_size; }
+
+	/**
+	 * @brief Define the downscaling of the compressed frames.
+	 *
+	 * Only the MJPEG frames are downscaled, while decoding.
+	 * @param[in] iScale The decoding scale.
+	 */
+	void setDecodeScale(const DecodeScale iScale) { m_decodeScale.store(iScale, std::memory_order_relaxed); }
+
+	/**
+	 * @brief Get the downscaling of the compressed frames.
+	 * @return The decoding scale.
+	 */
+	[[nodiscard]] auto getDecodeScale() const -> DecodeScale { return m_decodeScale.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Define if the NV12 and YUYV frames are uploaded raw, to be converted while drawing.
+	 *
+	 * The raw planes are half the size of the RGB24 frames and skip the CPU conversion.
+	 * @param[in] iEnable True to upload the raw frames.
+	 */
+	void setGpuConversion(const bool iEnable) { m_gpuConversion.store(iEnable, std::memory_order_relaxed); }
+
+	/**
+	 * @brief Check if the NV12 and YUYV frames are uploaded raw.
+	 * @return True if the frames are converted while drawing.
+	 */
+	[[nodiscard]] auto hasGpuConversion() const -> bool { return m_gpuConversion.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Define the recorder of the captured frames.
+	 *
+	 * The frames are pushed by the capture thread, as captured: compressed or raw.
+	 * @param[in] iRecorder The recorder, nullptr to stop feeding it.
+	 */
+	void setRecorder(const shared<FrameRecorder>& iRecorder);
+
+	/**
+	 * @brief Compute the size of an uncompressed frame.
+	 * @param[in] iPixFormat The pixel format.
+	 * @param[in] iSize The frame size.
+	 * @return The size in bytes, 0 for the compressed or unknown formats.
+	 */
+	[[nodiscard]] static auto getRawFrameSize(const PixelFormat& iPixFormat, const math::vec2ui& iSize) -> size_t;
+
 	/**
 	 * @brief Check the support for the pixel format.
 	 * @param[in] iPixFormat The pixel format to test.
@@ -107,15 +209,89 @@ protected:
 	PixelFormat m_pixFormat = PixelFormat::Unknwon;
 	/// The size of the frame.
 	math::vec2ui m_size;
+	/// Time between two frames, zero if unknown.
+	std::chrono::duration<double> m_frameInterval{};
 	// NOLINTEND(readability-redundant-member-init)
+	/// The downscaling of the compressed frames.
+	std::atomic<DecodeScale> m_decodeScale{DecodeScale::Full};
+	/// If the raw frames are converted while drawing.
+	std::atomic<bool> m_gpuConversion{false};
+	/// The MJPEG decoder.
+	MJpegDecoder m_jpegDecoder;
+	/// Mutex of the recorder.
+	std::mutex m_recorderMutex;
+	/// The recorder of the captured frames.
+	shared<FrameRecorder> m_recorder;
+	/// The latest captured frame, for the devices capturing on their own thread.
+	FrameMailbox m_mailbox;
+	/// Number of published frames.
+	std::atomic<uint64_t> m_captured{0};
+	/// Number of uploaded frames.
+	uint64_t m_uploaded = 0;
+	/// Sum of the upload latencies.
+	std::chrono::steady_clock::duration m_latencySum{0};
+	/// Upload latency of the latest frame.
+	std::chrono::steady_clock::duration m_lastLatency{0};
+
+	/**
+	 * @brief Discard the published frame and reset the statistics, when opening.
+	 */
+	void resetCapture();
+
+	/**
+	 * @brief Publish the frame filled in the mailbox, on the capture thread.
+	 */
+	void publishFrame();
+
+	/**
+	 * @brief Upload the latest published frame, if any.
+	 * @param[in,out] ioFrame The frame textures.
+	 * @return True if a new frame is uploaded.
+	 */
+	auto consumeFrame(FrameTextures& ioFrame) -> bool;
+
+	/**
+	 * @brief Account the upload of a frame in the statistics.
+	 * @param[in] iCaptureTime The capture time of the frame.
+	 */
+	void accountUpload(std::chrono::steady_clock::time_point iCaptureTime);
+
+	/**
+	 * @brief Push a captured frame to the recorder, if any.
+	 * @param[in] iInputBuffer The input buffer.
+	 * @param[in] iBufferSize The size of the buffer
+	 * @param[in] iSequence The capture sequence number.
+	 */
+	void recordFrame(const uint8_t* iInputBuffer, int32_t iBufferSize, uint64_t iSequence);
 
 	/**
 	 * @brief Convert a raw buffer of pixel to RGB24 format.
+	 *
+	 * The output buffer is only resized: reusing it from a frame to the next avoids any allocation.
 	 * @param[in] iInputBuffer The input buffer.
 	 * @param[in] iBufferSize The size of the buffer
-	 * @return A converted RGB24 buffer.
+	 * @param[in,out] ioRgbBuffer The RGB24 buffer to fill.
+	 * @param[out] oSize The size of the converted frame.
+	 * @return True if the buffer is filled.
+	 */
+	[[nodiscard]] auto convertToRgb(const uint8_t* iInputBuffer, int32_t iBufferSize, std::vector<uint8_t>& ioRgbBuffer,
+									math::vec2ui& oSize) -> bool;
+
+	/**
+	 * @brief Fill a frame from a raw buffer: a copy of the planes with the GPU conversion, RGB24 pixels otherwise.
+	 * @param[in] iInputBuffer The input buffer.
+	 * @param[in] iBufferSize The size of the buffer
+	 * @param[in,out] ioFrame The frame to fill, its pixel buffer is reused.
+	 * @return True if the frame is filled.
+	 */
+	[[nodiscard]] auto captureFrame(const uint8_t* iInputBuffer, int32_t iBufferSize, Frame& ioFrame) -> bool;
+
+	/**
+	 * @brief Upload a frame to its textures, recreated if their size or format changed.
+	 * @param[in] iFrame The frame.
+	 * @param[in,out] ioTextures The textures.
 	 */
-	[[nodiscard]] auto getRgbBuffer(const uint8_t* iInputBuffer, int32_t iBufferSize) const -> std::vector<uint8_t>;
+	static void uploadFrame(Frame& iFrame, FrameTextures& ioTextures);
 };
 
 }// namespace owl::input::video
@@ -0,0 +1,247 @@
+/**
+ * @file FileDevice.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "FileDevice.h"
+#include "FrameRecorder.h"
+
+namespace owl::input::video {
+
+namespace {
+
+auto readFile(const std::filesystem::path& iFile) -> std::vector<uint8_t> {
+	std::ifstream in(iFile, std::ios::in | std::ios::binary | std::ios::ate);
+	if (!in.is_open())
+		return {};
+	std::vector<uint8_t> data(static_cast<size_t>(in.tellg()));
+	in.seekg(0);
+	in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+	if (!in)
+		return {};
+	return data;
+}
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+// NOLINTBEGIN(*-magic-numbers)
+/**
+ * @brief Split a stream of concatenated JPEG images.
+ * @param[in] iData The stream.
+ * @param[out] oFrames The images.
+ */
+void splitJpegStream(const std::vector<uint8_t>& iData, std::vector<std::vector<uint8_t>>& oFrames) {
+	const size_t size = iData.size();
+	size_t pos = 0;
+	while (pos + 1 < size) {
+		// start of image.
+		if (iData[pos] != 0xFF || iData[pos + 1] != 0xD8) {
+			++pos;
+			continue;
+		}
+		const size_t begin = pos;
+		pos += 2;
+		// skip the header segments: an embedded thumbnail holds its own start and end markers.
+		while (pos + 3 < size && iData[pos] == 0xFF) {
+			const uint8_t marker = iData[pos + 1];
+			if (marker == 0xFF) {
+				++pos;
+				continue;
+			}
+			if (marker == 0xD9)
+				break;
+			pos += 2 + (static_cast<size_t>(iData[pos + 2]) << 8u | iData[pos + 3]);
+			// start of scan: the entropy coded data never holds an end marker.
+			if (marker == 0xDA)
+				break;
+		}
+		while (pos + 1 < size && (iData[pos] != 0xFF || iData[pos + 1] != 0xD9)) ++pos;
+		if (pos + 1 >= size)
+			break;// truncated image.
+		pos += 2;
+		oFrames.emplace_back(iData.begin() + static_cast<std::ptrdiff_t>(begin),
+							 iData.begin() + static_cast<std::ptrdiff_t>(pos));
+	}
+}
+// NOLINTEND(*-magic-numbers)
+OWL_DIAG_POP
+
+}// namespace
+
+FileDevice::FileDevice(std::filesystem::path iPath, const Specification& iSpecification)
+	: Device{fmt::format("Replay {}", iPath.filename().string())}, m_path{std::move(iPath)},
+	  m_specification{iSpecification} {
+	m_busInfo = fmt::format("file:{}", m_path.string());
+	m_pixFormat = m_specification.format;
+	m_size = m_specification.size;
+}
+
+FileDevice::~FileDevice() { close(); }
+
+void FileDevice::open() {
+	close();
+	OWL_CORE_INFO("Opening replay device ({}): {}", m_path.string(), m_name)
+	if (!isPixelFormatSupported(m_specification.format) || !loadFrames()) {
+		OWL_CORE_WARN("({}) No frame to replay.", m_path.string())
+		m_frames.clear();
+		m_sequences.clear();
+		return;
+	}
+	if (m_sequences.empty()) {
+		// the frames of the other sources are numbered by their rank.
+		m_sequences.resize(m_frames.size());
+		std::iota(m_sequences.begin(), m_sequences.end(), uint64_t{1});
+	}
+	m_pixFormat = m_specification.format;
+	if (m_pixFormat == PixelFormat::MJpeg) {
+		// the size is read from the first image.
+		std::vector<uint8_t> rgb;
+		if (!m_jpegDecoder.decode(m_frames.front().data(), m_frames.front().size(), DecodeScale::Full, false, rgb,
+								  m_size)) {
+			OWL_CORE_WARN("({}) Unable to decode the first frame.", m_path.string())
+			m_frames.clear();
+			m_sequences.clear();
+			return;
+		}
+	} else {
+		m_size = m_specification.size;
+	}
+	OWL_CORE_INFO("({}) Replaying {} frames of {} x {}.", m_path.string(), m_frames.size(), m_size.x(), m_size.y())
+	m_frameInterval = m_specification.frameRate > 0
+							  ? std::chrono::duration<double>(1.0 / static_cast<double>(m_specification.frameRate))
+							  : std::chrono::duration<double>::zero();
+	resetCapture();
+	m_finished.store(false, std::memory_order_relaxed);
+	if (m_specification.stepped) {
+		m_frameInterval = std::chrono::duration<double>::zero();
+		m_stepping = true;
+		return;
+	}
+	m_replayThread = std::jthread([this](const std::stop_token& iStop) { replayLoop(iStop); });
+}
+
+void FileDevice::close() {
+	if (!isOpened())
+		return;
+	if (m_replayThread.joinable()) {
+		m_replayThread.request_stop();
+		m_replayThread.join();
+	}
+	m_stepping = false;
+	m_frames.clear();
+	m_sequences.clear();
+}
+
+auto FileDevice::isValid() const -> bool { return !m_name.empty() && exists(m_path); }
+
+void FileDevice::fillFrame(FrameTextures& ioFrame) {
+	if (!isOpened())
+		return;
+	consumeFrame(ioFrame);
+}
+
+auto FileDevice::showFrame(const uint64_t iSequence) -> bool {
+	if (!m_stepping)
+		return false;
+	const auto it = std::ranges::lower_bound(m_sequences, iSequence);
+	if (it == m_sequences.end() || *it != iSequence)
+		return false;
+	OWL_PROFILE_SCOPE("video replay conversion")
+	const auto& data = m_frames[static_cast<size_t>(std::distance(m_sequences.begin(), it))];
+	Frame& frame = m_mailbox.acquireWrite();
+	if (!captureFrame(data.data(), static_cast<int32_t>(data.size()), frame))
+		return false;
+	frame.sequence = iSequence;
+	frame.timestamp = std::chrono::steady_clock::now();
+	publishFrame();
+	return true;
+}
+
+auto FileDevice::loadFrames() -> bool {
+	m_frames.clear();
+	m_sequences.clear();
+	if (m_path.extension() == FrameRecorder::s_containerExtension) {
+		// a recording holds its format, size and capture sequence numbers.
+		FrameRecorder::ContainerInfo info;
+		if (!FrameRecorder::readContainer(m_path, info, m_frames))
+			return false;
+		m_specification.format = info.format;
+		m_specification.size = info.size;
+		const size_t rawSize = getRawFrameSize(info.format, info.size);
+		for (size_t index = 0; index < m_frames.size(); ++index) {
+			if (m_frames[index].size() < rawSize)
+				continue;
+			m_sequences.push_back(info.sequences[index]);
+			if (m_sequences.size() - 1 != index)
+				m_frames[m_sequences.size() - 1] = std::move(m_frames[index]);
+		}
+		m_frames.resize(m_sequences.size());
+		return !m_frames.empty();
+	}
+	const size_t rawSize = getRawFrameSize(m_specification.format, m_specification.size);
+	if (m_specification.format != PixelFormat::MJpeg && rawSize == 0)
+		return false;
+	if (is_directory(m_path)) {
+		std::vector<std::filesystem::path> files;
+		for (const auto& entry: std::filesystem::directory_iterator(m_path))
+			if (entry.is_regular_file())
+				files.push_back(entry.path());
+		std::ranges::sort(files);
+		for (const auto& file: files) {
+			auto data = readFile(file);
+			if (data.empty() || data.size() < rawSize) {
+				OWL_CORE_WARN("({}) Skipping the invalid frame {}.", m_path.string(), file.filename().string())
+				continue;
+			}
+			m_frames.push_back(std::move(data));
+		}
+		return !m_frames.empty();
+	}
+	const auto data = readFile(m_path);
+	if (m_specification.format == PixelFormat::MJpeg) {
+		splitJpegStream(data, m_frames);
+		return !m_frames.empty();
+	}
+	for (size_t offset = 0; offset + rawSize <= data.size(); offset += rawSize)
+		m_frames.emplace_back(data.begin() + static_cast<std::ptrdiff_t>(offset),
+							  data.begin() + static_cast<std::ptrdiff_t>(offset + rawSize));
+	return !m_frames.empty();
+}
+
+void FileDevice::replayLoop(const std::stop_token& iStop) {
+	const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(m_frameInterval);
+	auto next = std::chrono::steady_clock::now();
+	uint64_t sequence = 0;
+	size_t index = 0;
+	while (!iStop.stop_requested()) {
+		if (index == m_frames.size()) {
+			if (!m_specification.loop) {
+				m_finished.store(true, std::memory_order_release);
+				return;
+			}
+			index = 0;
+		}
+		{
+			OWL_PROFILE_SCOPE("video replay conversion")
+			const auto& data = m_frames[index++];
+			Frame& frame = m_mailbox.acquireWrite();
+			if (captureFrame(data.data(), static_cast<int32_t>(data.size()), frame)) {
+				frame.sequence = ++sequence;
+				frame.timestamp = std::chrono::steady_clock::now();
+				publishFrame();
+			}
+		}
+		if (interval == std::chrono::steady_clock::duration::zero())
+			continue;
+		// a late replay does not burst to catch up.
+		next = std::max(next + interval, std::chrono::steady_clock::now());
+		std::unique_lock lock(m_pacingMutex);
+		m_pacing.wait_until(lock, iStop, next, [] { return false; });
+	}
+}
+
+}// namespace owl::input::video
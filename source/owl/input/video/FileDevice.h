@@ -0,0 +1,147 @@
+/**
+ * @file FileDevice.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "Device.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace owl::input::video {
+
+/**
+ * @brief Virtual video device replaying recorded frames.
+ *
+ * The source is either a file of concatenated frames (raw frames of fixed size, or JPEG images for MJPEG),
+ * or a directory holding one frame per file, replayed in the order of the file names. The raw recordings of a
+ * FrameRecorder (`.owlv`) define their own format and size.
+ * The frames are loaded in memory when opening, so the replay does not depend on the disk.
+ *
+ * A stepped device has no replay thread: the frames are published on request, by their capture sequence number,
+ * to follow the recorded frame references of a session.
+ */
+class OWL_API FileDevice final : public Device {
+public:
+	/**
+	 * @brief Replay parameters.
+	 */
+	struct OWL_API Specification {
+		/// Pixel format of the frames.
+		PixelFormat format = PixelFormat::Nv12;
+		/// Size of the raw frames, read from the first image for MJPEG.
+		math::vec2ui size;
+		/// Number of frames per second, zero to replay as fast as possible.
+		float frameRate = 30.f;
+		/// If the replay restarts after the last frame.
+		bool loop = true;
+		/// If the frames are only published by showFrame.
+		bool stepped = false;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iPath The frame file or directory.
+	 * @param[in] iSpecification The replay parameters.
+	 */
+	FileDevice(std::filesystem::path iPath, const Specification& iSpecification);
+	FileDevice(const FileDevice&) = delete;
+	FileDevice(FileDevice&&) = delete;
+	auto operator=(const FileDevice&) -> FileDevice& = delete;
+	auto operator=(FileDevice&&) -> FileDevice& = delete;
+
+	/**
+	 * @brief Destructor.
+	 */
+	~FileDevice() override;
+
+	/**
+	 * @brief Load the frames and start the replay.
+	 */
+	void open() override;
+
+	/**
+	 * @brief Stop the replay and release the frames.
+	 */
+	void close() override;
+
+	/**
+	 * @brief Check if the device is open.
+	 * @return True if open.
+	 */
+	[[nodiscard]] auto isOpened() const -> bool override { return m_replayThread.joinable() || m_stepping; }
+
+	/**
+	 * @brief Check the validity of the device.
+	 * @return True if the source still exists.
+	 */
+	[[nodiscard]] auto isValid() const -> bool override;
+
+	/**
+	 * @brief Upload the latest replayed frame, if any.
+	 * @param[in,out] ioFrame The frame to update.
+	 */
+	void fillFrame(FrameTextures& ioFrame) override;
+
+	/**
+	 * @brief Get the number of loaded frames.
+	 * @return The number of frames, zero if not opened.
+	 */
+	[[nodiscard]] auto getFrameCount() const -> size_t { return m_frames.size(); }
+
+	/**
+	 * @brief Check if a non-looping replay reached its last frame.
+	 * @return True if all the frames are published.
+	 */
+	[[nodiscard]] auto isFinished() const -> bool { return m_finished.load(std::memory_order_acquire); }
+
+	/**
+	 * @brief Convert and publish a frame of a stepped device.
+	 *
+	 * The capture sequence numbers are the recorded ones for the FrameRecorder containers, the frame rank from 1
+	 * for the other sources.
+	 * @param[in] iSequence The capture sequence number of the frame.
+	 * @return True if the frame is published, false if not stepped or not in the source.
+	 */
+	auto showFrame(uint64_t iSequence) -> bool;
+
+private:
+	/// The frame file or directory.
+	std::filesystem::path m_path;
+	/// The replay parameters.
+	Specification m_specification;
+	/// The encoded frames.
+	std::vector<std::vector<uint8_t>> m_frames;
+	/// Capture sequence number of the frames, increasing.
+	std::vector<uint64_t> m_sequences;
+	/// If the device is opened in stepped mode.
+	bool m_stepping = false;
+	/// If a non-looping replay is over.
+	std::atomic<bool> m_finished{false};
+	/// Mutex of the pacing wait.
+	std::mutex m_pacingMutex;
+	/// Wakes the pacing wait on stop requests.
+	std::condition_variable_any m_pacing;
+	/// Thread converting and publishing the frames at the frame rate.
+	std::jthread m_replayThread;
+
+	/**
+	 * @brief Load the frames of the source.
+	 * @return True if at least a frame is loaded.
+	 */
+	auto loadFrames() -> bool;
+
+	/**
+	 * @brief Publish the frames at the frame rate.
+	 * @param[in] iStop The stop token of the thread.
+	 */
+	void replayLoop(const std::stop_token& iStop);
+};
+
+}// namespace owl::input::video
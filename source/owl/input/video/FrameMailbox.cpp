@@ -0,0 +1,30 @@
+/**
+ * @file FrameMailbox.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "FrameMailbox.h"
+
+namespace owl::input::video {
+
+void FrameMailbox::publish() {
+	const uint8_t previous = m_latest.exchange(m_back | s_fresh, std::memory_order_acq_rel);
+	if ((previous & s_fresh) != 0)
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+	m_back = previous & s_indexMask;
+}
+
+auto FrameMailbox::consume() -> Frame* {
+	if ((m_latest.load(std::memory_order_acquire) & s_fresh) == 0)
+		return nullptr;
+	m_front = m_latest.exchange(m_front, std::memory_order_acq_rel) & s_indexMask;
+	return &m_frames[m_front];
+}
+
+void FrameMailbox::reset() { m_latest.fetch_and(s_indexMask, std::memory_order_acq_rel); }
+
+}// namespace owl::input::video
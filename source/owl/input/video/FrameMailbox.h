@@ -0,0 +1,88 @@
+/**
+ * @file FrameMailbox.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+#include "math/vectors.h"
+#include "renderer/Texture.h"
+
+namespace owl::input::video {
+
+/**
+ * @brief A captured frame, converted to RGB24 or kept raw for a conversion while drawing.
+ */
+struct OWL_API Frame {
+	/// The RGB24 pixels, or the raw planes.
+	std::vector<uint8_t> pixels;
+	/// Layout of the raw planes, None for RGB24.
+	renderer::YuvLayout layout = renderer::YuvLayout::None;
+	/// The frame size.
+	math::vec2ui size;
+	/// The capture sequence number.
+	uint64_t sequence = 0;
+	/// The capture time.
+	std::chrono::steady_clock::time_point timestamp;
+};
+
+/**
+ * @brief Lock-free exchange of the latest frame between a producer and a consumer thread.
+ *
+ * Triple buffering: the producer fills its back frame then publishes it, the consumer takes the latest published
+ * frame. A frame published while the previous one is not consumed replaces it, the producer never waits.
+ */
+class OWL_API FrameMailbox final {
+public:
+	/**
+	 * @brief Get the frame to fill, owned by the producer until publish().
+	 * @return The back frame.
+	 */
+	auto acquireWrite() -> Frame& { return m_frames[m_back]; }
+
+	/**
+	 * @brief Make the back frame the latest one.
+	 */
+	void publish();
+
+	/**
+	 * @brief Take the latest frame, owned by the consumer until the next consume().
+	 * @return The frame, nullptr if nothing new was published.
+	 */
+	auto consume() -> Frame*;
+
+	/**
+	 * @brief Discard the published frame.
+	 *
+	 * Neither the producer nor the consumer must be working.
+	 */
+	void reset();
+
+	/**
+	 * @brief Get the number of frames replaced before being consumed.
+	 * @return The number of dropped frames.
+	 */
+	[[nodiscard]] auto getDroppedCount() const -> uint64_t { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+	/// Flag of the latest index marking a frame not yet consumed.
+	static constexpr uint8_t s_fresh{0x4};
+	/// Mask of the frame index.
+	static constexpr uint8_t s_indexMask{0x3};
+	/// The frames.
+	std::array<Frame, 3> m_frames;
+	/// Index of the frame owned by the producer.
+	uint8_t m_back = 0;
+	/// Index of the frame owned by the consumer.
+	uint8_t m_front = 1;
+	/// Index of the latest published frame, with the fresh flag.
+	std::atomic<uint8_t> m_latest{2};
+	/// Number of frames dropped.
+	std::atomic<uint64_t> m_dropped{0};
+};
+
+}// namespace owl::input::video
@@ -0,0 +1,339 @@
+/**
+ * @file FrameRecorder.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "FrameRecorder.h"
+
+namespace owl::input::video {
+
+namespace {
+
+/// Alignment of the written chunks.
+constexpr size_t g_chunkAlignment{4096};
+/// Version of the container layout.
+constexpr uint32_t g_containerVersion{1};
+/// Magic of the container header.
+constexpr std::array<char, 4> g_containerMagic{'O', 'W', 'L', 'V'};
+/// Magic of the frame records.
+constexpr std::array<char, 4> g_recordMagic{'F', 'R', 'M', 'E'};
+/// Magic of the container footer.
+constexpr std::array<char, 8> g_indexMagic{'O', 'W', 'L', 'V', 'I', 'D', 'X', '1'};
+
+/**
+ * @brief Header of the container.
+ */
+struct ContainerHeader {
+	/// The container magic.
+	std::array<char, 4> magic = g_containerMagic;
+	/// Version of the layout.
+	uint32_t version = g_containerVersion;
+	/// Pixel format of the frames.
+	uint32_t format = 0;
+	/// Width of the frames.
+	uint32_t width = 0;
+	/// Height of the frames.
+	uint32_t height = 0;
+	/// Reserved.
+	std::array<uint32_t, 3> reserved{};
+};
+
+/**
+ * @brief Header of a frame record, followed by the frame.
+ */
+struct RecordHeader {
+	/// The record magic.
+	std::array<char, 4> magic = g_recordMagic;
+	/// Reserved.
+	uint32_t reserved = 0;
+	/// Size of the frame.
+	uint64_t size = 0;
+	/// The capture sequence number.
+	uint64_t sequence = 0;
+	/// The capture time from the start, in nanoseconds.
+	int64_t timestamp = 0;
+};
+
+/**
+ * @brief Footer of the container, after the index.
+ */
+struct ContainerFooter {
+	/// Position of the index in the file.
+	uint64_t indexOffset = 0;
+	/// Number of index entries.
+	uint64_t count = 0;
+	/// The footer magic.
+	std::array<char, 8> magic = g_indexMagic;
+};
+
+template<typename T>
+auto readStruct(const std::vector<uint8_t>& iData, const uint64_t iOffset, T& oValue) -> bool {
+	if (iOffset > iData.size() || iData.size() - iOffset < sizeof(T))
+		return false;
+	OWL_DIAG_PUSH
+	OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+	std::memcpy(&oValue, iData.data() + iOffset, sizeof(T));
+	OWL_DIAG_POP
+	return true;
+}
+
+}// namespace
+
+FrameRecorder::FrameRecorder() : FrameRecorder(Specification{}) {}
+
+FrameRecorder::FrameRecorder(const Specification& iSpecification) : m_specification{iSpecification} {
+	// whole aligned chunks.
+	m_specification.chunkSize =
+			std::max(g_chunkAlignment, (m_specification.chunkSize + g_chunkAlignment - 1) & ~(g_chunkAlignment - 1));
+	m_specification.queueSize = std::max(m_specification.queueSize, 1u);
+}
+
+FrameRecorder::~FrameRecorder() { stop(); }
+
+auto FrameRecorder::start(const std::filesystem::path& iFile, const Device::PixelFormat iFormat,
+						  const math::vec2ui& iSize) -> bool {
+	stop();
+	const size_t rawSize = Device::getRawFrameSize(iFormat, iSize);
+	if (iFormat != Device::PixelFormat::MJpeg && rawSize == 0) {
+		OWL_CORE_WARN("FrameRecorder: unsupported pixel format.")
+		return false;
+	}
+	m_file = iFile;
+	m_file.replace_extension(getExtension(iFormat));
+	if (m_file.has_parent_path())
+		create_directories(m_file.parent_path());
+	m_stream = {};
+	// the chunks are written whole: no stream buffering.
+	m_stream.rdbuf()->pubsetbuf(nullptr, 0);
+	m_stream.open(m_file, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!m_stream.is_open()) {
+		OWL_CORE_WARN("FrameRecorder: unable to create {}.", m_file.string())
+		return false;
+	}
+	m_container = iFormat != Device::PixelFormat::MJpeg;
+	// the slots are sized once, for the compressed frames they grow to the largest one.
+	m_slots.resize(m_specification.queueSize);
+	for (auto& slot: m_slots) slot.data.reserve(rawSize);
+	m_chunkStorage.resize(m_specification.chunkSize + g_chunkAlignment);
+	void* chunk = m_chunkStorage.data();
+	size_t space = m_chunkStorage.size();
+	m_chunk = static_cast<uint8_t*>(std::align(g_chunkAlignment, m_specification.chunkSize, chunk, space));
+	m_chunkFill = 0;
+	m_chunkOffset = 0;
+	m_failed = false;
+	m_index.clear();
+	m_head.store(0, std::memory_order_relaxed);
+	m_tail.store(0, std::memory_order_relaxed);
+	m_written.store(0, std::memory_order_relaxed);
+	m_dropped.store(0, std::memory_order_relaxed);
+	m_bytes.store(0, std::memory_order_relaxed);
+	m_maxQueued.store(0, std::memory_order_relaxed);
+	m_start = std::chrono::steady_clock::now();
+	if (m_container) {
+		const ContainerHeader header{.format = static_cast<uint32_t>(iFormat), .width = iSize.x(), .height = iSize.y()};
+		append(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+	}
+	OWL_CORE_INFO("FrameRecorder: recording to {}.", m_file.string())
+	m_accepting.store(true, std::memory_order_release);
+	m_writerThread = std::jthread([this](const std::stop_token& iStop) { writeLoop(iStop); });
+	return true;
+}
+
+void FrameRecorder::stop() {
+	if (!isRecording())
+		return;
+	// a push that saw the recording accepted fills its slot before the writer leaves.
+	m_accepting.store(false);
+	while (m_pushing.load() != 0) std::this_thread::yield();
+	m_writerThread.request_stop();
+	m_writerThread.join();
+	if (m_container && !m_failed) {
+		const ContainerFooter footer{.indexOffset = m_chunkOffset + m_chunkFill, .count = m_index.size()};
+		append(reinterpret_cast<const uint8_t*>(m_index.data()), m_index.size() * sizeof(IndexEntry));
+		append(reinterpret_cast<const uint8_t*>(&footer), sizeof(footer));
+	}
+	if (!m_failed)
+		flushChunk();
+	m_stream.close();
+	const auto statistics = getStatistics();
+	OWL_CORE_INFO("FrameRecorder: {} frames written in {}, {} dropped.", statistics.written, m_file.string(),
+				  statistics.dropped)
+}
+
+auto FrameRecorder::push(const uint8_t* iData, const size_t iSize, const uint64_t iSequence,
+						 const std::chrono::steady_clock::time_point iTimestamp) -> bool {
+	// sequentially consistent with stop: either the stop sees this push, or this push sees the stop.
+	m_pushing.fetch_add(1);
+	const bool queued = m_accepting.load() && enqueue(iData, iSize, iSequence, iTimestamp);
+	m_pushing.fetch_sub(1, std::memory_order_release);
+	return queued;
+}
+
+auto FrameRecorder::enqueue(const uint8_t* iData, const size_t iSize, const uint64_t iSequence,
+							const std::chrono::steady_clock::time_point iTimestamp) -> bool {
+	const uint64_t head = m_head.load(std::memory_order_relaxed);
+	const uint64_t queued = head - m_tail.load(std::memory_order_acquire);
+	if (queued >= m_slots.size()) {
+		// the writer is late: the frame is lost, the capture never waits.
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	auto& slot = m_slots[head % m_slots.size()];
+	OWL_DIAG_PUSH
+	OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+	slot.data.assign(iData, iData + iSize);
+	OWL_DIAG_POP
+	slot.sequence = iSequence;
+	slot.timestamp = iTimestamp;
+	m_head.store(head + 1, std::memory_order_release);
+	if (queued + 1 > m_maxQueued.load(std::memory_order_relaxed))
+		m_maxQueued.store(static_cast<uint32_t>(queued + 1), std::memory_order_relaxed);
+	// taking the mutex orders the notification after the check of a writer about to wait.
+	{ const std::lock_guard lock(m_wakeMutex); }
+	m_wake.notify_one();
+	return true;
+}
+
+auto FrameRecorder::getStatistics() const -> Statistics {
+	return {.pushed = m_head.load(std::memory_order_relaxed),
+			.written = m_written.load(std::memory_order_relaxed),
+			.dropped = m_dropped.load(std::memory_order_relaxed),
+			.bytes = m_bytes.load(std::memory_order_relaxed),
+			.maxQueued = m_maxQueued.load(std::memory_order_relaxed)};
+}
+
+auto FrameRecorder::getExtension(const Device::PixelFormat iFormat) -> std::string {
+	return iFormat == Device::PixelFormat::MJpeg ? ".mjpeg" : std::string{s_containerExtension};
+}
+
+void FrameRecorder::writeLoop(const std::stop_token& iStop) {
+	const auto pending = [this] {
+		return m_head.load(std::memory_order_acquire) != m_tail.load(std::memory_order_relaxed);
+	};
+	while (true) {
+		{
+			std::unique_lock lock(m_wakeMutex);
+			// after a stop request, the queued frames are written before leaving.
+			if (!m_wake.wait(lock, iStop, pending))
+				return;
+		}
+		const uint64_t head = m_head.load(std::memory_order_acquire);
+		for (uint64_t tail = m_tail.load(std::memory_order_relaxed); tail != head; ++tail) {
+			OWL_PROFILE_SCOPE("video recording")
+			const auto& slot = m_slots[tail % m_slots.size()];
+			bool success = !m_failed;
+			if (success && m_container) {
+				const RecordHeader record{
+						.size = slot.data.size(),
+						.sequence = slot.sequence,
+						.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(slot.timestamp - m_start)
+											 .count()};
+				m_index.push_back({.offset = m_chunkOffset + m_chunkFill,
+								   .size = record.size,
+								   .sequence = record.sequence,
+								   .timestamp = record.timestamp});
+				success = append(reinterpret_cast<const uint8_t*>(&record), sizeof(record));
+			}
+			success = success && append(slot.data.data(), slot.data.size());
+			if (success) {
+				m_written.fetch_add(1, std::memory_order_relaxed);
+			} else {
+				if (!m_failed)
+					OWL_CORE_WARN("FrameRecorder: unable to write in {}.", m_file.string())
+				m_failed = true;
+				m_dropped.fetch_add(1, std::memory_order_relaxed);
+			}
+			// releases the slot to the capture thread.
+			m_tail.store(tail + 1, std::memory_order_release);
+		}
+	}
+}
+
+auto FrameRecorder::append(const uint8_t* iData, size_t iSize) -> bool {
+	OWL_DIAG_PUSH
+	OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+	while (iSize > 0) {
+		const size_t count = std::min(iSize, m_specification.chunkSize - m_chunkFill);
+		std::memcpy(m_chunk + m_chunkFill, iData, count);
+		m_chunkFill += count;
+		iData += count;
+		iSize -= count;
+		if (m_chunkFill == m_specification.chunkSize && !flushChunk())
+			return false;
+	}
+	OWL_DIAG_POP
+	return true;
+}
+
+auto FrameRecorder::flushChunk() -> bool {
+	if (m_chunkFill == 0)
+		return true;
+	m_stream.write(reinterpret_cast<const char*>(m_chunk), static_cast<std::streamsize>(m_chunkFill));
+	if (!m_stream.good())
+		return false;
+	m_bytes.fetch_add(m_chunkFill, std::memory_order_relaxed);
+	m_chunkOffset += m_chunkFill;
+	m_chunkFill = 0;
+	return true;
+}
+
+auto FrameRecorder::readContainer(const std::filesystem::path& iFile, ContainerInfo& oInfo,
+								  std::vector<std::vector<uint8_t>>& oFrames) -> bool {
+	oInfo = {};
+	oFrames.clear();
+	std::ifstream in(iFile, std::ios::in | std::ios::binary | std::ios::ate);
+	if (!in.is_open())
+		return false;
+	std::vector<uint8_t> data(static_cast<size_t>(in.tellg()));
+	in.seekg(0);
+	in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+	ContainerHeader header;
+	if (!in || !readStruct(data, 0, header) || header.magic != g_containerMagic ||
+		header.version != g_containerVersion ||
+		header.format >= static_cast<uint32_t>(Device::PixelFormat::Unknwon))
+		return false;
+	oInfo.format = static_cast<Device::PixelFormat>(header.format);
+	oInfo.size = {header.width, header.height};
+	if (Device::getRawFrameSize(oInfo.format, oInfo.size) == 0)
+		return false;
+	const auto readRecord = [&data, &oInfo, &oFrames](uint64_t& ioOffset, const uint64_t iEnd) -> bool {
+		RecordHeader record;
+		if (ioOffset > iEnd || iEnd - ioOffset < sizeof(record) || !readStruct(data, ioOffset, record) ||
+			record.magic != g_recordMagic || iEnd - ioOffset - sizeof(record) < record.size)
+			return false;// truncated record.
+		ioOffset += sizeof(record);
+		OWL_DIAG_PUSH
+		OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+		oFrames.emplace_back(data.begin() + static_cast<std::ptrdiff_t>(ioOffset),
+							 data.begin() + static_cast<std::ptrdiff_t>(ioOffset + record.size));
+		OWL_DIAG_POP
+		oInfo.sequences.push_back(record.sequence);
+		oInfo.timestamps.emplace_back(record.timestamp);
+		ioOffset += record.size;
+		return true;
+	};
+	// the index ends at the footer.
+	const uint64_t indexEnd = data.size() - std::min(data.size(), sizeof(ContainerFooter));
+	if (ContainerFooter footer; indexEnd >= sizeof(header) && readStruct(data, indexEnd, footer) &&
+								footer.magic == g_indexMagic && footer.indexOffset <= indexEnd &&
+								footer.count * sizeof(IndexEntry) == indexEnd - footer.indexOffset) {
+		for (uint64_t i = 0; i < footer.count; ++i) {
+			IndexEntry entry;
+			readStruct(data, footer.indexOffset + i * sizeof(IndexEntry), entry);
+			if (!readRecord(entry.offset, footer.indexOffset))
+				break;
+		}
+		return true;
+	}
+	// no index: an interrupted recording is read up to its last whole record.
+	for (uint64_t offset = sizeof(header); offset < data.size();)
+		if (!readRecord(offset, data.size()))
+			break;
+	return true;
+}
+
+}// namespace owl::input::video
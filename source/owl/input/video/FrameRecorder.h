@@ -0,0 +1,264 @@
+/**
+ * @file FrameRecorder.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "Device.h"
+
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace owl::input::video {
+
+/**
+ * @brief Asynchronous recorder of the frames of a capture device.
+ *
+ * The capture thread pushes its frames in a bounded queue of preallocated slots, a full queue drops the frame
+ * instead of waiting. A dedicated writer thread packs the frames in aligned chunks and writes them whole.
+ *
+ * The MJPEG frames are written as they are, one image after the other (a `.mjpeg` stream). The raw frames are
+ * written in a `.owlv` container: a header, the frame records, then an index of the records and a footer.
+ * @note There must be a single thread pushing frames.
+ */
+class OWL_API FrameRecorder final {
+public:
+	/// Extension of the raw video containers.
+	static constexpr std::string_view s_containerExtension{".owlv"};
+
+	/**
+	 * @brief Recording parameters.
+	 */
+	struct OWL_API Specification {
+		/// Number of frames waiting for the writer before dropping.
+		uint32_t queueSize = 8;
+		/// Size of the written chunks, a multiple of 4096.
+		size_t chunkSize = 4ull << 20u;
+	};
+
+	/**
+	 * @brief Recording statistics.
+	 */
+	struct OWL_API Statistics {
+		/// Number of frames accepted in the queue.
+		uint64_t pushed = 0;
+		/// Number of frames written.
+		uint64_t written = 0;
+		/// Number of frames dropped because the queue was full or the writing failed.
+		uint64_t dropped = 0;
+		/// Number of bytes written to the file.
+		uint64_t bytes = 0;
+		/// Highest number of frames waiting in the queue.
+		uint32_t maxQueued = 0;
+	};
+
+	/**
+	 * @brief Description of a recorded raw video.
+	 */
+	struct OWL_API ContainerInfo {
+		/// Pixel format of the frames.
+		Device::PixelFormat format = Device::PixelFormat::Unknwon;
+		/// Size of the frames.
+		math::vec2ui size;
+		/// Capture sequence number of the frames.
+		std::vector<uint64_t> sequences;
+		/// Capture time of the frames, from the start of the recording.
+		std::vector<std::chrono::nanoseconds> timestamps;
+	};
+
+	/**
+	 * @brief Default constructor.
+	 */
+	FrameRecorder();
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iSpecification The recording parameters.
+	 */
+	explicit FrameRecorder(const Specification& iSpecification);
+	FrameRecorder(const FrameRecorder&) = delete;
+	FrameRecorder(FrameRecorder&&) = delete;
+	auto operator=(const FrameRecorder&) -> FrameRecorder& = delete;
+	auto operator=(FrameRecorder&&) -> FrameRecorder& = delete;
+
+	/**
+	 * @brief Destructor, stops the recording.
+	 */
+	~FrameRecorder();
+
+	/**
+	 * @brief Create the file and start the writer thread.
+	 * @param[in] iFile The file, its extension is replaced according to the pixel format.
+	 * @param[in] iFormat Pixel format of the frames.
+	 * @param[in] iSize Size of the frames.
+	 * @return True if the recording started.
+	 */
+	auto start(const std::filesystem::path& iFile, Device::PixelFormat iFormat, const math::vec2ui& iSize) -> bool;
+
+	/**
+	 * @brief Write the queued frames, complete the file and stop the writer thread.
+	 *
+	 * Can be called from another thread than the pushing one: a frame being pushed is waited for.
+	 */
+	void stop();
+
+	/**
+	 * @brief Check if a recording is running.
+	 * @return True if recording.
+	 */
+	[[nodiscard]] auto isRecording() const -> bool { return m_writerThread.joinable(); }
+
+	/**
+	 * @brief Get the file of the recording.
+	 * @return The file path.
+	 */
+	[[nodiscard]] auto getFile() const -> const std::filesystem::path& { return m_file; }
+
+	/**
+	 * @brief Queue a frame, never waits for the writer.
+	 * @param[in] iData The frame, as captured.
+	 * @param[in] iSize The size of the frame in bytes.
+	 * @param[in] iSequence The capture sequence number.
+	 * @param[in] iTimestamp The capture time.
+	 * @return True if the frame is queued, false if dropped.
+	 */
+	auto push(const uint8_t* iData, size_t iSize, uint64_t iSequence,
+			  std::chrono::steady_clock::time_point iTimestamp) -> bool;
+
+	/**
+	 * @brief Get the statistics of the recording.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStatistics() const -> Statistics;
+
+	/**
+	 * @brief Get the file extension of a recording.
+	 * @param[in] iFormat Pixel format of the frames.
+	 * @return The extension.
+	 */
+	[[nodiscard]] static auto getExtension(Device::PixelFormat iFormat) -> std::string;
+
+	/**
+	 * @brief Read a raw video container.
+	 *
+	 * A container without index, from an interrupted recording, is read record after record.
+	 * @param[in] iFile The container file.
+	 * @param[out] oInfo The description of the video.
+	 * @param[out] oFrames The frames.
+	 * @return True if the container is valid.
+	 */
+	static auto readContainer(const std::filesystem::path& iFile, ContainerInfo& oInfo,
+							  std::vector<std::vector<uint8_t>>& oFrames) -> bool;
+
+private:
+	/**
+	 * @brief A queued frame.
+	 */
+	struct Slot {
+		/// The frame data, keeps its capacity.
+		std::vector<uint8_t> data;
+		/// The capture sequence number.
+		uint64_t sequence = 0;
+		/// The capture time.
+		std::chrono::steady_clock::time_point timestamp;
+	};
+	/**
+	 * @brief Index entry of a written frame.
+	 */
+	struct IndexEntry {
+		/// Position of the record in the file.
+		uint64_t offset = 0;
+		/// Size of the frame.
+		uint64_t size = 0;
+		/// The capture sequence number.
+		uint64_t sequence = 0;
+		/// The capture time from the start, in nanoseconds.
+		int64_t timestamp = 0;
+	};
+
+	/// The recording parameters.
+	Specification m_specification;
+	/// The recording file.
+	std::filesystem::path m_file;
+	/// The output stream.
+	std::ofstream m_stream;
+	/// If the frames are written in a container.
+	bool m_container = false;
+	/// Start of the recording.
+	std::chrono::steady_clock::time_point m_start;
+	/// The queue slots.
+	std::vector<Slot> m_slots;
+	/// Number of frames pushed, the next slot to fill.
+	std::atomic<uint64_t> m_head{0};
+	/// Number of frames taken by the writer, the next slot to write.
+	std::atomic<uint64_t> m_tail{0};
+	/// Storage of the chunk.
+	std::vector<uint8_t> m_chunkStorage;
+	/// The aligned chunk, inside the storage.
+	uint8_t* m_chunk = nullptr;
+	/// Number of bytes in the chunk.
+	size_t m_chunkFill = 0;
+	/// Position in the file of the chunk start.
+	uint64_t m_chunkOffset = 0;
+	/// Index of the written frames.
+	std::vector<IndexEntry> m_index;
+	/// If the writing failed, the next frames are dropped.
+	bool m_failed = false;
+	/// If the frames are accepted in the queue.
+	std::atomic<bool> m_accepting{false};
+	/// Number of push calls in progress, waited for by stop.
+	std::atomic<uint32_t> m_pushing{0};
+	/// Number of frames written.
+	std::atomic<uint64_t> m_written{0};
+	/// Number of frames dropped.
+	std::atomic<uint64_t> m_dropped{0};
+	/// Number of bytes written.
+	std::atomic<uint64_t> m_bytes{0};
+	/// Highest queue depth.
+	std::atomic<uint32_t> m_maxQueued{0};
+	/// Mutex of the writer wait.
+	std::mutex m_wakeMutex;
+	/// Wakes the writer on new frames and stop requests.
+	std::condition_variable_any m_wake;
+	/// The writer thread.
+	std::jthread m_writerThread;
+
+	/**
+	 * @brief Queue a frame in a free slot.
+	 * @param[in] iData The frame, as captured.
+	 * @param[in] iSize The size of the frame in bytes.
+	 * @param[in] iSequence The capture sequence number.
+	 * @param[in] iTimestamp The capture time.
+	 * @return True if the frame is queued, false if the queue is full.
+	 */
+	auto enqueue(const uint8_t* iData, size_t iSize, uint64_t iSequence,
+				 std::chrono::steady_clock::time_point iTimestamp) -> bool;
+
+	/**
+	 * @brief Write the queued frames until stopped.
+	 * @param[in] iStop The stop token of the thread.
+	 */
+	void writeLoop(const std::stop_token& iStop);
+
+	/**
+	 * @brief Append data to the chunk, writing the full chunks.
+	 * @param[in] iData The data.
+	 * @param[in] iSize The size of the data.
+	 * @return False if the writing failed.
+	 */
+	auto append(const uint8_t* iData, size_t iSize) -> bool;
+
+	/**
+	 * @brief Write the chunk content.
+	 * @return False if the writing failed.
+	 */
+	auto flushChunk() -> bool;
+};
+
+}// namespace owl::input::video
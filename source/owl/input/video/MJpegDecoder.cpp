@@ -0,0 +1,213 @@
+/**
+ * @file MJpegDecoder.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "MJpegDecoder.h"
+
+#include "PixelConversion.h"
+#include "core/external/stbimage.h"
+
+#ifdef OWL_HAS_LIBJPEG
+#include <csetjmp>
+#include <cstdio>
+#include <jpeglib.h>
+#endif
+
+namespace owl::input::video {
+
+namespace {
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+// NOLINTBEGIN(*-magic-numbers)
+
+/**
+ * @brief Mirror the pixels of a RGB24 row in place.
+ * @param[in,out] ioRow The row.
+ * @param[in] iWidth The row width.
+ */
+void mirrorRow(uint8_t* ioRow, const uint32_t iWidth) {
+	uint8_t* left = ioRow;
+	uint8_t* right = ioRow + static_cast<size_t>(iWidth - 1) * 3;
+	for (; left < right; left += 3, right -= 3) {
+		std::swap(left[0], right[0]);
+		std::swap(left[1], right[1]);
+		std::swap(left[2], right[2]);
+	}
+}
+
+/**
+ * @brief Downscale a RGB24 frame by averaging blocks of pixels.
+ * @param[in] iSource The source frame.
+ * @param[in] iSourceSize The source size.
+ * @param[in] iScale The downscaling factor.
+ * @param[in] iMirror If the rows are mirrored horizontally.
+ * @param[out] oDestination The destination frame.
+ * @param[in] iSize The destination size.
+ */
+void downscale(const uint8_t* iSource, const math::vec2ui& iSourceSize, const uint32_t iScale, const bool iMirror,
+			   uint8_t* oDestination, const math::vec2ui& iSize) {
+	for (uint32_t row = 0; row < iSize.y(); ++row) {
+		const uint32_t rowBegin = row * iScale;
+		const uint32_t rowEnd = std::min(rowBegin + iScale, iSourceSize.y());
+		uint8_t* destination = oDestination + static_cast<size_t>(row) * iSize.x() * 3;
+		for (uint32_t column = 0; column < iSize.x(); ++column) {
+			const uint32_t columnBegin = column * iScale;
+			const uint32_t columnEnd = std::min(columnBegin + iScale, iSourceSize.x());
+			std::array<uint32_t, 3> sum{0, 0, 0};
+			for (uint32_t y = rowBegin; y < rowEnd; ++y) {
+				const uint8_t* pixel = iSource + (static_cast<size_t>(y) * iSourceSize.x() + columnBegin) * 3;
+				for (uint32_t x = columnBegin; x < columnEnd; ++x, pixel += 3) {
+					sum[0] += pixel[0];
+					sum[1] += pixel[1];
+					sum[2] += pixel[2];
+				}
+			}
+			const uint32_t count = (rowEnd - rowBegin) * (columnEnd - columnBegin);
+			uint8_t* pixel = destination + static_cast<size_t>(iMirror ? iSize.x() - 1 - column : column) * 3;
+			for (size_t channel = 0; channel < 3; ++channel)
+				pixel[channel] = static_cast<uint8_t>((sum[channel] + count / 2) / count);
+		}
+	}
+}
+
+#ifdef OWL_HAS_LIBJPEG
+/**
+ * @brief Error manager jumping back to the decoding instead of exiting.
+ */
+struct ErrorManager {
+	/// The libjpeg error manager.
+	jpeg_error_mgr base;
+	/// The jump point.
+	std::jmp_buf jump;
+};
+
+void errorExit(const j_common_ptr iInfo) {
+	auto* manager = reinterpret_cast<ErrorManager*>(iInfo->err);
+	std::array<char, JMSG_LENGTH_MAX> message{};
+	manager->base.format_message(iInfo, message.data());
+	OWL_CORE_WARN("Jpeg decoding: {}", message.data())
+	std::longjmp(manager->jump, 1);
+}
+
+void outputMessage(const j_common_ptr) {}
+#endif
+
+// NOLINTEND(*-magic-numbers)
+OWL_DIAG_POP
+
+}// namespace
+
+#ifdef OWL_HAS_LIBJPEG
+struct MJpegDecoder::Impl {
+	/// The decompression state.
+	jpeg_decompress_struct info{};
+	/// The error manager.
+	ErrorManager error{};
+};
+#else
+struct MJpegDecoder::Impl {};
+#endif
+
+auto getScaledSize(const math::vec2ui& iSize, const DecodeScale iScale) -> math::vec2ui {
+	const auto scale = static_cast<uint32_t>(iScale);
+	return {(iSize.x() + scale - 1) / scale, (iSize.y() + scale - 1) / scale};
+}
+
+auto chooseDecodeScale(const math::vec2ui& iSize, const math::vec2ui& iDisplaySize) -> DecodeScale {
+	if (iDisplaySize.x() == 0 || iDisplaySize.y() == 0)
+		return DecodeScale::Full;
+	for (const auto scale: {DecodeScale::Eighth, DecodeScale::Quarter, DecodeScale::Half}) {
+		if (const auto size = getScaledSize(iSize, scale); size.x() >= iDisplaySize.x() && size.y() >= iDisplaySize.y())
+			return scale;
+	}
+	return DecodeScale::Full;
+}
+
+MJpegDecoder::MJpegDecoder() : m_impl{mkUniq<Impl>()} {
+#ifdef OWL_HAS_LIBJPEG
+	m_impl->info.err = jpeg_std_error(&m_impl->error.base);
+	m_impl->error.base.error_exit = errorExit;
+	m_impl->error.base.output_message = outputMessage;
+	jpeg_create_decompress(&m_impl->info);
+#endif
+}
+
+MJpegDecoder::~MJpegDecoder() {
+#ifdef OWL_HAS_LIBJPEG
+	jpeg_destroy_decompress(&m_impl->info);
+#endif
+}
+
+auto MJpegDecoder::hasScaledDecoding() -> bool {
+#ifdef OWL_HAS_LIBJPEG
+	return true;
+#else
+	return false;
+#endif
+}
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+auto MJpegDecoder::decode(const uint8_t* iJpegBuffer, const size_t iJpegSize, const DecodeScale iScale,
+						  const bool iMirror, std::vector<uint8_t>& ioRgb24Buffer, math::vec2ui& oSize) -> bool {
+	OWL_PROFILE_FUNCTION()
+
+#ifdef OWL_HAS_LIBJPEG
+	// only trivial objects in this scope: the errors jump back here.
+	jpeg_decompress_struct& info = m_impl->info;
+	if (setjmp(m_impl->error.jump) != 0) {// NOLINT(cert-err52-cpp)
+		jpeg_abort_decompress(&info);
+		return false;
+	}
+	jpeg_mem_src(&info, iJpegBuffer, static_cast<unsigned long>(iJpegSize));
+	if (jpeg_read_header(&info, TRUE) != JPEG_HEADER_OK) {
+		jpeg_abort_decompress(&info);
+		return false;
+	}
+	info.out_color_space = JCS_RGB;
+	info.scale_num = 1;
+	info.scale_denom = static_cast<uint32_t>(iScale);
+	info.dct_method = JDCT_IFAST;
+	jpeg_start_decompress(&info);
+	oSize = {info.output_width, info.output_height};
+	ioRgb24Buffer.resize(static_cast<size_t>(oSize.surface()) * 3);
+	while (info.output_scanline < info.output_height) {
+		uint8_t* row = ioRgb24Buffer.data() + static_cast<size_t>(info.output_scanline) * oSize.x() * 3;
+		jpeg_read_scanlines(&info, &row, 1);
+		if (iMirror)
+			mirrorRow(row, oSize.x());
+	}
+	jpeg_finish_decompress(&info);
+	// the corrupted frames (truncated data...) are decoded with warnings: drop them.
+	return m_impl->error.base.num_warnings == 0;
+#else
+	int width = 0;
+	int height = 0;
+	int comp = 0;
+	stbi_set_flip_vertically_on_load_thread(0);
+	uint8_t* buffer =
+			stbi_load_from_memory(iJpegBuffer, static_cast<int>(iJpegSize), &width, &height, &comp, 3);
+	if (buffer == nullptr) {
+		OWL_CORE_WARN("Jpeg decoding: {}", stbi_failure_reason())
+		return false;
+	}
+	const math::vec2ui size{static_cast<uint32_t>(width), static_cast<uint32_t>(height)};
+	oSize = getScaledSize(size, iScale);
+	ioRgb24Buffer.resize(static_cast<size_t>(oSize.surface()) * 3);
+	if (iScale == DecodeScale::Full)
+		copyRgb24(buffer, size, ioRgb24Buffer.data(), {.mirror = iMirror});
+	else
+		downscale(buffer, size, static_cast<uint32_t>(iScale), iMirror, ioRgb24Buffer.data(), oSize);
+	stbi_image_free(buffer);
+	return true;
+#endif
+}
+OWL_DIAG_POP
+
+}// namespace owl::input::video
@@ -0,0 +1,89 @@
+/**
+ * @file MJpegDecoder.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+#include "math/vectors.h"
+
+namespace owl::input::video {
+
+/**
+ * @brief Downscaling factor of the decoded frames.
+ */
+enum struct DecodeScale : uint8_t {
+	Full = 1,///< Native size.
+	Half = 2,///< Half width and height.
+	Quarter = 4,///< Quarter width and height.
+	Eighth = 8,///< Eighth of width and height.
+};
+
+/**
+ * @brief Compute the size of a frame decoded at a scale.
+ * @param[in] iSize The native size.
+ * @param[in] iScale The decoding scale.
+ * @return The decoded size, rounded up.
+ */
+OWL_API auto getScaledSize(const math::vec2ui& iSize, DecodeScale iScale) -> math::vec2ui;
+
+/**
+ * @brief Choose the smallest decoding scale still covering a display area.
+ * @param[in] iSize The native size.
+ * @param[in] iDisplaySize The size at which the frame is displayed, zero for the native size.
+ * @return The decoding scale.
+ */
+OWL_API auto chooseDecodeScale(const math::vec2ui& iSize, const math::vec2ui& iDisplaySize) -> DecodeScale;
+
+/**
+ * @brief Decoder of Motion-JPEG frames to RGB24.
+ *
+ * With libjpeg(-turbo), the downscaling is done in the DCT domain and the rows are decoded straight in the output.
+ * Without it, stb_image decodes the full frame, then a box filter downscales it.
+ */
+class OWL_API MJpegDecoder final {
+public:
+	/**
+	 * @brief Constructor.
+	 */
+	MJpegDecoder();
+	/**
+	 * @brief Destructor.
+	 */
+	~MJpegDecoder();
+	MJpegDecoder(const MJpegDecoder&) = delete;
+	MJpegDecoder(MJpegDecoder&&) = delete;
+	auto operator=(const MJpegDecoder&) -> MJpegDecoder& = delete;
+	auto operator=(MJpegDecoder&&) -> MJpegDecoder& = delete;
+
+	/**
+	 * @brief Decode a frame.
+	 * @param[in] iJpegBuffer The JPEG data.
+	 * @param[in] iJpegSize The size of the JPEG data.
+	 * @param[in] iScale The decoding scale.
+	 * @param[in] iMirror If the rows are mirrored horizontally.
+	 * @param[in,out] ioRgb24Buffer The RGB24 frame, resized to the decoded size.
+	 * @param[out] oSize The decoded size.
+	 * @return True if the frame is decoded without error.
+	 */
+	auto decode(const uint8_t* iJpegBuffer, size_t iJpegSize, DecodeScale iScale, bool iMirror,
+				std::vector<uint8_t>& ioRgb24Buffer, math::vec2ui& oSize) -> bool;
+
+	/**
+	 * @brief Check if the decoding uses libjpeg(-turbo).
+	 * @return True if libjpeg is used, false for stb_image.
+	 */
+	[[nodiscard]] static auto hasScaledDecoding() -> bool;
+
+private:
+	/// The libjpeg state, reused from a frame to the next.
+	struct Impl;
+	/// Pointer to the libjpeg state.
+	uniq<Impl> m_impl;
+};
+
+}// namespace owl::input::video
@@ -22,8 +22,13 @@ Manager::Manager() { updateDeviceList(); }
 Manager::~Manager() { close(); }
 
 void Manager::updateDeviceList(const bool iReset) {
-	if (iReset)
+	if (iReset) {
+		close();
+		m_currentDevice = g_maxDevices;
 		m_devices.clear();
+	}
+	// the invalid devices are removed from the list: the current one is searched again.
+	const auto current = getCurrentDevice();
 #if defined(OWL_PLATFORM_WINDOWS)
 	windows::updateList(m_devices);
 #elif defined(OWL_PLATFORM_LINUX)
@@ -31,6 +36,33 @@ void Manager::updateDeviceList(const bool iReset) {
 #else
 #error "Unsupported platform"
 #endif
+	if (!current)
+		return;
+	if (const auto listed = std::ranges::find(m_devices, current); listed != m_devices.end()) {
+		m_currentDevice = static_cast<size_t>(std::distance(m_devices.begin(), listed));
+	} else {
+		current->close();
+		m_currentDevice = g_maxDevices;
+	}
+}
+
+auto Manager::addDevice(const shared<Device>& iDevice) -> int8_t {
+	if (!iDevice || !iDevice->isValid())
+		return -1;
+	if (const auto listed = std::ranges::find_if(m_devices,
+												 [&iDevice](const shared<Device>& iDev) {
+													 return iDev->getBusInfo() == iDevice->getBusInfo();
+												 });
+		listed != m_devices.end()) {
+		const auto id = static_cast<size_t>(std::distance(m_devices.begin(), listed));
+		if (id != m_currentDevice)
+			*listed = iDevice;
+		return static_cast<int8_t>(id);
+	}
+	if (m_devices.size() >= g_maxDevices)
+		return -1;
+	m_devices.push_back(iDevice);
+	return static_cast<int8_t>(m_devices.size() - 1);
 }
 
 auto Manager::getDevicesNames() const -> std::vector<std::string> {
@@ -41,7 +73,7 @@ auto Manager::getDevicesNames() const -> std::vector<std::string> {
 }
 
 auto Manager::getCurrentDevice() const -> shared<Device> {
-	if (m_currentDevice >= g_maxDevices)
+	if (m_currentDevice >= m_devices.size())
 		return nullptr;
 	return m_devices[m_currentDevice];
 }
@@ -60,10 +92,10 @@ void Manager::close() const {
 	getCurrentDevice()->close();
 }
 
-void Manager::fillFrame(shared<renderer::Texture>& iFrame) const {
+void Manager::fillFrame(FrameTextures& ioFrame) const {
 	if (!isOpened())
 		return;
-	getCurrentDevice()->fillFrame(iFrame);
+	getCurrentDevice()->fillFrame(ioFrame);
 }
 
 auto Manager::getCurrentDeviceId() const -> int8_t {
@@ -49,10 +49,22 @@ public:
 
 	/**
 	 * @brief Request a refresh of the devices list.
+	 *
+	 * The invalid devices are removed, the current device is closed if removed.
 	 * @param[in] iReset the list will be reset before search, closing all the devices.
 	 */
 	void updateDeviceList(bool iReset = false);
 
+	/**
+	 * @brief Add a device to the list, like a virtual device replaying files.
+	 *
+	 * The device stays listed while valid, until a reset of the list. It replaces a listed device with the same bus
+	 * info, unless that one is open.
+	 * @param[in] iDevice The device to add.
+	 * @return Id of the device, -1 if not added.
+	 */
+	auto addDevice(const shared<Device>& iDevice) -> int8_t;
+
 	/**
 	 * @brief Get an ordered list of device names.
 	 * @return List of device name.
@@ -94,10 +106,10 @@ public:
 	void close() const;
 
 	/**
-	 * @brief Grab a frame and put it into the Texture.
-	 * @param[in] iFrame The texture to update.
+	 * @brief Grab a frame and put it into the textures.
+	 * @param[in,out] ioFrame The textures to update.
 	 */
-	void fillFrame(shared<renderer::Texture>& iFrame) const;
+	void fillFrame(FrameTextures& ioFrame) const;
 
 private:
 	/**
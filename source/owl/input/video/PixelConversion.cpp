@@ -0,0 +1,575 @@
+/**
+ * @file PixelConversion.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "PixelConversion.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(__AVX2__)
+#define OWL_CONVERSION_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OWL_CONVERSION_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define OWL_CONVERSION_NEON
+#include <arm_neon.h>
+#endif
+
+namespace owl::input::video {
+
+namespace {
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+// NOLINTBEGIN(*-magic-numbers)
+
+/**
+ * @brief Compute a color channel from its fixed point value.
+ * @param[in] iValue The channel value with 8 bits of fractional part.
+ * @return The channel limited to [0, 255].
+ */
+constexpr auto channel(const int32_t iValue) -> uint8_t {
+	return static_cast<uint8_t>(math::clamp(iValue >> 8, 0, 255));
+}
+
+/**
+ * @brief Convert a pixel from YUV to RGB (ITU-R BT.601, video range).
+ * @param[in] iY The luma.
+ * @param[in] iU The blue chroma.
+ * @param[in] iV The red chroma.
+ * @param[out] oPixel The RGB pixel.
+ */
+inline void yuvToRgb(const uint8_t iY, const uint8_t iU, const uint8_t iV, uint8_t* oPixel) {
+	const int32_t c = iY - 16;
+	const int32_t d = iU - 128;
+	const int32_t e = iV - 128;
+	oPixel[0] = channel(298 * c + 409 * e + 128);
+	oPixel[1] = channel(298 * c - 100 * d - 208 * e + 128);
+	oPixel[2] = channel(298 * c + 516 * d + 128);
+}
+
+#if defined(OWL_CONVERSION_AVX2)
+/// Number of pixels converted at once.
+constexpr uint32_t g_blockSize{16};
+#elif defined(OWL_CONVERSION_SSE2) || defined(OWL_CONVERSION_NEON)
+/// Number of pixels converted at once.
+constexpr uint32_t g_blockSize{8};
+#else
+/// No vectorized implementation.
+constexpr uint32_t g_blockSize{0};
+#endif
+
+/**
+ * @brief Planar RGB values of a block of pixels.
+ */
+struct Block {
+	/// Red values.
+	std::array<uint8_t, std::max(g_blockSize, 1u)> r;
+	/// Green values.
+	std::array<uint8_t, std::max(g_blockSize, 1u)> g;
+	/// Blue values.
+	std::array<uint8_t, std::max(g_blockSize, 1u)> b;
+};
+
+#if defined(OWL_CONVERSION_AVX2)
+/**
+ * @brief Compute a color channel of a block.
+ * @param[in] iLumaLo Luma term (298 * c + 128) of the pixels 0-3 and 8-11.
+ * @param[in] iLumaHi Luma term of the pixels 4-7 and 12-15.
+ * @param[in] iChromaLo Interleaved (d, e) of the pixels 0-3 and 8-11.
+ * @param[in] iChromaHi Interleaved (d, e) of the pixels 4-7 and 12-15.
+ * @param[in] iCoefficients Interleaved coefficients of d and e.
+ * @return The channel values in the low 128 bits.
+ */
+inline auto channelBlock(const __m256i iLumaLo, const __m256i iLumaHi, const __m256i iChromaLo,
+						 const __m256i iChromaHi, const __m256i iCoefficients) -> __m128i {
+	const __m256i lo = _mm256_srai_epi32(_mm256_add_epi32(iLumaLo, _mm256_madd_epi16(iChromaLo, iCoefficients)), 8);
+	const __m256i hi = _mm256_srai_epi32(_mm256_add_epi32(iLumaHi, _mm256_madd_epi16(iChromaHi, iCoefficients)), 8);
+	// the packing works by 128 bits lanes: gather the two lanes' results.
+	const __m256i words = _mm256_packs_epi32(lo, hi);
+	const __m256i bytes = _mm256_packus_epi16(words, words);
+	return _mm256_castsi256_si128(_mm256_permute4x64_epi64(bytes, _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+/**
+ * @brief Convert a block of pixels.
+ * @param[in] iY The 16 luma values as 16 bits integers.
+ * @param[in] iUv The 8 chroma pairs (U, V) as 16 bits integers.
+ * @param[out] oBlock The RGB values.
+ */
+inline void convertBlock(const __m256i iY, const __m256i iUv, Block& oBlock) {
+	const __m256i c = _mm256_sub_epi16(iY, _mm256_set1_epi16(16));
+	const __m256i uv = _mm256_sub_epi16(iUv, _mm256_set1_epi16(128));
+	const __m256i d =
+			_mm256_shufflehi_epi16(_mm256_shufflelo_epi16(uv, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 2, 0, 0));
+	const __m256i e =
+			_mm256_shufflehi_epi16(_mm256_shufflelo_epi16(uv, _MM_SHUFFLE(3, 3, 1, 1)), _MM_SHUFFLE(3, 3, 1, 1));
+	const __m256i one = _mm256_set1_epi16(1);
+	const __m256i lumaCoefficients = _mm256_set1_epi32((128 << 16) | 298);
+	const __m256i lumaLo = _mm256_madd_epi16(_mm256_unpacklo_epi16(c, one), lumaCoefficients);
+	const __m256i lumaHi = _mm256_madd_epi16(_mm256_unpackhi_epi16(c, one), lumaCoefficients);
+	const __m256i chromaLo = _mm256_unpacklo_epi16(d, e);
+	const __m256i chromaHi = _mm256_unpackhi_epi16(d, e);
+	const auto coefficients = [](const int16_t iD, const int16_t iE) {
+		return _mm256_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(static_cast<uint16_t>(iE)) << 16u |
+													  static_cast<uint16_t>(iD)));
+	};
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(oBlock.r.data()),
+					 channelBlock(lumaLo, lumaHi, chromaLo, chromaHi, coefficients(0, 409)));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(oBlock.g.data()),
+					 channelBlock(lumaLo, lumaHi, chromaLo, chromaHi, coefficients(-100, -208)));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(oBlock.b.data()),
+					 channelBlock(lumaLo, lumaHi, chromaLo, chromaHi, coefficients(516, 0)));
+}
+
+inline void convertNv12Block(const uint8_t* iY, const uint8_t* iUv, Block& oBlock) {
+	convertBlock(_mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(iY))),
+				 _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(iUv))), oBlock);
+}
+
+inline void convertYuYvBlock(const uint8_t* iYuYv, Block& oBlock) {
+	const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(iYuYv));
+	convertBlock(_mm256_and_si256(pixels, _mm256_set1_epi16(0x00ff)), _mm256_srli_epi16(pixels, 8), oBlock);
+}
+#elif defined(OWL_CONVERSION_SSE2)
+/**
+ * @brief Compute a color channel of a block.
+ * @param[in] iLumaLo Luma term (298 * c + 128) of the pixels 0-3.
+ * @param[in] iLumaHi Luma term of the pixels 4-7.
+ * @param[in] iChromaLo Interleaved (d, e) of the pixels 0-3.
+ * @param[in] iChromaHi Interleaved (d, e) of the pixels 4-7.
+ * @param[in] iCoefficients Interleaved coefficients of d and e.
+ * @return The channel values in the low 64 bits.
+ */
+inline auto channelBlock(const __m128i iLumaLo, const __m128i iLumaHi, const __m128i iChromaLo,
+						 const __m128i iChromaHi, const __m128i iCoefficients) -> __m128i {
+	const __m128i lo = _mm_srai_epi32(_mm_add_epi32(iLumaLo, _mm_madd_epi16(iChromaLo, iCoefficients)), 8);
+	const __m128i hi = _mm_srai_epi32(_mm_add_epi32(iLumaHi, _mm_madd_epi16(iChromaHi, iCoefficients)), 8);
+	const __m128i words = _mm_packs_epi32(lo, hi);
+	return _mm_packus_epi16(words, words);
+}
+
+/**
+ * @brief Convert a block of pixels.
+ * @param[in] iY The 8 luma values as 16 bits integers.
+ * @param[in] iUv The 4 chroma pairs (U, V) as 16 bits integers.
+ * @param[out] oBlock The RGB values.
+ */
+inline void convertBlock(const __m128i iY, const __m128i iUv, Block& oBlock) {
+	const __m128i c = _mm_sub_epi16(iY, _mm_set1_epi16(16));
+	const __m128i uv = _mm_sub_epi16(iUv, _mm_set1_epi16(128));
+	const __m128i d = _mm_shufflehi_epi16(_mm_shufflelo_epi16(uv, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 2, 0, 0));
+	const __m128i e = _mm_shufflehi_epi16(_mm_shufflelo_epi16(uv, _MM_SHUFFLE(3, 3, 1, 1)), _MM_SHUFFLE(3, 3, 1, 1));
+	const __m128i one = _mm_set1_epi16(1);
+	const __m128i lumaCoefficients = _mm_set1_epi32((128 << 16) | 298);
+	const __m128i lumaLo = _mm_madd_epi16(_mm_unpacklo_epi16(c, one), lumaCoefficients);
+	const __m128i lumaHi = _mm_madd_epi16(_mm_unpackhi_epi16(c, one), lumaCoefficients);
+	const __m128i chromaLo = _mm_unpacklo_epi16(d, e);
+	const __m128i chromaHi = _mm_unpackhi_epi16(d, e);
+	const auto coefficients = [](const int16_t iD, const int16_t iE) {
+		return _mm_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(static_cast<uint16_t>(iE)) << 16u |
+												   static_cast<uint16_t>(iD)));
+	};
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(oBlock.r.data()),
+					 channelBlock(lumaLo, lumaHi, chromaLo, chromaHi, coefficients(0, 409)));
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(oBlock.g.data()),
+					 channelBlock(lumaLo, lumaHi, chromaLo, chromaHi, coefficients(-100, -208)));
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(oBlock.b.data()),
+					 channelBlock(lumaLo, lumaHi, chromaLo, chromaHi, coefficients(516, 0)));
+}
+
+inline void convertNv12Block(const uint8_t* iY, const uint8_t* iUv, Block& oBlock) {
+	const __m128i zero = _mm_setzero_si128();
+	convertBlock(_mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(iY)), zero),
+				 _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(iUv)), zero), oBlock);
+}
+
+inline void convertYuYvBlock(const uint8_t* iYuYv, Block& oBlock) {
+	const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iYuYv));
+	convertBlock(_mm_and_si128(pixels, _mm_set1_epi16(0x00ff)), _mm_srli_epi16(pixels, 8), oBlock);
+}
+#elif defined(OWL_CONVERSION_NEON)
+/**
+ * @brief Compute a color channel of a block.
+ * @param[in] iC The luma terms.
+ * @param[in] iD The blue chroma terms.
+ * @param[in] iE The red chroma terms.
+ * @param[in] iCoefD The coefficient of the blue chroma.
+ * @param[in] iCoefE The coefficient of the red chroma.
+ * @return The channel values.
+ */
+inline auto channelBlock(const int16x8_t iC, const int16x8_t iD, const int16x8_t iE, const int16_t iCoefD,
+						 const int16_t iCoefE) -> uint8x8_t {
+	int32x4_t lo = vmlal_n_s16(vdupq_n_s32(128), vget_low_s16(iC), 298);
+	lo = vmlal_n_s16(lo, vget_low_s16(iD), iCoefD);
+	lo = vmlal_n_s16(lo, vget_low_s16(iE), iCoefE);
+	int32x4_t hi = vmlal_n_s16(vdupq_n_s32(128), vget_high_s16(iC), 298);
+	hi = vmlal_n_s16(hi, vget_high_s16(iD), iCoefD);
+	hi = vmlal_n_s16(hi, vget_high_s16(iE), iCoefE);
+	return vqmovun_s16(vcombine_s16(vqmovn_s32(vshrq_n_s32(lo, 8)), vqmovn_s32(vshrq_n_s32(hi, 8))));
+}
+
+/**
+ * @brief Convert a block of pixels.
+ * @param[in] iY The 8 luma values as 16 bits integers.
+ * @param[in] iUv The 4 chroma pairs (U, V) as 16 bits integers.
+ * @param[out] oBlock The RGB values.
+ */
+inline void convertBlock(const uint16x8_t iY, const uint16x8_t iUv, Block& oBlock) {
+	const int16x8_t c = vsubq_s16(vreinterpretq_s16_u16(iY), vdupq_n_s16(16));
+	const int16x8_t uv = vsubq_s16(vreinterpretq_s16_u16(iUv), vdupq_n_s16(128));
+	// duplicate the chroma for the two pixels of each pair.
+	const int16x8x2_t split = vuzpq_s16(uv, uv);
+	const int16x8_t d = vzipq_s16(split.val[0], split.val[0]).val[0];
+	const int16x8_t e = vzipq_s16(split.val[1], split.val[1]).val[0];
+	vst1_u8(oBlock.r.data(), channelBlock(c, d, e, 0, 409));
+	vst1_u8(oBlock.g.data(), channelBlock(c, d, e, -100, -208));
+	vst1_u8(oBlock.b.data(), channelBlock(c, d, e, 516, 0));
+}
+
+inline void convertNv12Block(const uint8_t* iY, const uint8_t* iUv, Block& oBlock) {
+	convertBlock(vmovl_u8(vld1_u8(iY)), vmovl_u8(vld1_u8(iUv)), oBlock);
+}
+
+inline void convertYuYvBlock(const uint8_t* iYuYv, Block& oBlock) {
+	const uint16x8_t pixels = vreinterpretq_u16_u8(vld1q_u8(iYuYv));
+	convertBlock(vandq_u16(pixels, vdupq_n_u16(0x00ff)), vshrq_n_u16(pixels, 8), oBlock);
+}
+#endif
+
+/**
+ * @brief Write a block of pixels in a row.
+ * @param[in] iBlock The block.
+ * @param[out] oRow The RGB24 row.
+ * @param[in] iFirst Index of the first pixel of the block.
+ * @param[in] iWidth The row width.
+ * @param[in] iMirror If the row is mirrored.
+ */
+[[maybe_unused]] inline void storeBlock(const Block& iBlock, uint8_t* oRow, const uint32_t iFirst,
+										const uint32_t iWidth, const bool iMirror) {
+	if (iMirror) {
+		uint8_t* pixel = oRow + static_cast<size_t>(iWidth - 1 - iFirst) * 3;
+		for (uint32_t k = 0; k < g_blockSize; ++k, pixel -= 3) {
+			pixel[0] = iBlock.r[k];
+			pixel[1] = iBlock.g[k];
+			pixel[2] = iBlock.b[k];
+		}
+	} else {
+		uint8_t* pixel = oRow + static_cast<size_t>(iFirst) * 3;
+		for (uint32_t k = 0; k < g_blockSize; ++k, pixel += 3) {
+			pixel[0] = iBlock.r[k];
+			pixel[1] = iBlock.g[k];
+			pixel[2] = iBlock.b[k];
+		}
+	}
+}
+
+/**
+ * @brief Persistent threads converting bands of rows.
+ *
+ * The threads are created at the first parallel conversion and wait for the next ones: a conversion does not
+ * allocate nor create threads.
+ */
+class BandWorkers final {
+public:
+	/// Conversion of the rows [begin, end) of a frame.
+	using BandFunction = void (*)(const void*, uint32_t, uint32_t);
+
+	BandWorkers() = default;
+	BandWorkers(const BandWorkers&) = delete;
+	BandWorkers(BandWorkers&&) = delete;
+	auto operator=(const BandWorkers&) -> BandWorkers& = delete;
+	auto operator=(BandWorkers&&) -> BandWorkers& = delete;
+	~BandWorkers() {
+		{
+			const std::lock_guard lock(m_mutex);
+			m_stop = true;
+		}
+		m_wake.notify_all();
+	}
+
+	/**
+	 * @brief Access to the workers.
+	 * @return The workers.
+	 */
+	static auto get() -> BandWorkers& {
+		static BandWorkers workers;
+		return workers;
+	}
+
+	/**
+	 * @brief Run a conversion on all the bands, the calling thread taking part.
+	 * @param[in] iFunction The band conversion.
+	 * @param[in] iContext The conversion context.
+	 * @param[in] iBandRows The number of rows of a band.
+	 * @param[in] iRows The number of rows of the frame.
+	 * @param[in] iThreads The number of threads to use.
+	 */
+	void run(const BandFunction iFunction, const void* iContext, const uint32_t iBandRows, const uint32_t iRows,
+			 const uint32_t iThreads) {
+		const std::lock_guard runLock(m_runMutex);
+		std::unique_lock lock(m_mutex);
+		const uint32_t workerCount = std::min(iThreads, g_maxConversionThreads) - 1;
+		while (m_threads.size() < workerCount) m_threads.emplace_back([this] { work(); });
+		const Job job{.function = iFunction,
+					  .context = iContext,
+					  .bandRows = iBandRows,
+					  .rows = iRows,
+					  .bandCount = (iRows + iBandRows - 1) / iBandRows};
+		const uint64_t generation = ++m_generation;
+		m_job = job;
+		m_finishedBands = 0;
+		m_parkedWorkers = 0;
+		m_nextBand.store(generationTag(generation), std::memory_order_release);
+		lock.unlock();
+		m_wake.notify_all();
+		const uint32_t done = runBands(job, generation);
+		lock.lock();
+		m_finishedBands += done;
+		// every worker took part and parked again: none still reads this conversion when the next one starts.
+		m_done.wait(lock, [this, &job] {
+			return m_finishedBands == job.bandCount && m_parkedWorkers == m_threads.size();
+		});
+	}
+
+private:
+	/**
+	 * @brief Parameters of a conversion.
+	 */
+	struct Job {
+		/// The conversion.
+		BandFunction function = nullptr;
+		/// The conversion context.
+		const void* context = nullptr;
+		/// Number of rows of a band.
+		uint32_t bandRows = 0;
+		/// Number of rows of the frame.
+		uint32_t rows = 0;
+		/// Number of bands of the frame.
+		uint32_t bandCount = 0;
+	};
+
+	/**
+	 * @brief Get the band counter value of the first band of a conversion.
+	 * @param[in] iGeneration The conversion counter.
+	 * @return The band counter, the conversion in the high bits and the band in the low bits.
+	 */
+	static constexpr auto generationTag(const uint64_t iGeneration) -> uint64_t { return iGeneration << 32u; }
+
+	/**
+	 * @brief Loop of the worker threads.
+	 */
+	void work() {
+		std::unique_lock lock(m_mutex);
+		uint64_t generation = 0;
+		while (true) {
+			m_wake.wait(lock, [this, generation] { return m_stop || m_generation != generation; });
+			if (m_stop)
+				return;
+			// the conversion is copied under the lock: the next one may start as soon as this worker parks.
+			generation = m_generation;
+			const Job job = m_job;
+			lock.unlock();
+			const uint32_t done = runBands(job, generation);
+			lock.lock();
+			m_finishedBands += done;
+			++m_parkedWorkers;
+			m_done.notify_all();
+		}
+	}
+
+	/**
+	 * @brief Convert the bands of a conversion not yet taken.
+	 * @param[in] iJob The conversion.
+	 * @param[in] iGeneration The conversion counter.
+	 * @return The number of converted bands.
+	 */
+	auto runBands(const Job& iJob, const uint64_t iGeneration) -> uint32_t {
+		const uint64_t tag = generationTag(iGeneration);
+		uint32_t count = 0;
+		uint64_t next = m_nextBand.load(std::memory_order_acquire);
+		// only the bands of the given conversion are taken.
+		while (next >= tag && next < tag + iJob.bandCount) {
+			if (!m_nextBand.compare_exchange_weak(next, next + 1, std::memory_order_acq_rel))
+				continue;
+			const auto begin = static_cast<uint32_t>(next - tag) * iJob.bandRows;
+			iJob.function(iJob.context, begin, std::min(begin + iJob.bandRows, iJob.rows));
+			++count;
+			++next;
+		}
+		return count;
+	}
+
+	/// Serialize the conversions of several threads.
+	std::mutex m_runMutex;
+	/// Protect the state.
+	std::mutex m_mutex;
+	/// Signal a new conversion or the stop.
+	std::condition_variable m_wake;
+	/// Signal the end of a conversion.
+	std::condition_variable m_done;
+	/// The current conversion.
+	Job m_job;
+	/// Number of converted bands.
+	uint32_t m_finishedBands = 0;
+	/// Number of workers done with the current conversion.
+	size_t m_parkedWorkers = 0;
+	/// Next band to take, tagged with the conversion counter.
+	std::atomic<uint64_t> m_nextBand{0};
+	/// Counter of the conversions.
+	uint64_t m_generation = 0;
+	/// If the threads must stop.
+	bool m_stop = false;
+	/// The worker threads, joined after the stop in the destruction.
+	std::vector<std::jthread> m_threads;
+};
+
+/**
+ * @brief Run a conversion on bands of rows, in parallel for the large frames.
+ * @tparam RowFunction Type of the conversion of a band.
+ * @param[in] iSize The frame size.
+ * @param[in] iParams The conversion parameters.
+ * @param[in] iRows The conversion of the rows [begin, end).
+ */
+template<typename RowFunction>
+void forEachBand(const math::vec2ui& iSize, const ConversionParams& iParams, const RowFunction& iRows) {
+	uint32_t threads = iParams.threadCount;
+	if (threads == 0) {
+		threads = iSize.surface() >= g_parallelConversionThreshold
+						  ? std::min(g_maxConversionThreads, std::max(1u, std::thread::hardware_concurrency()))
+						  : 1;
+	}
+	// even number of rows, so that the NV12 chroma rows are not shared between bands.
+	const uint32_t bandRows = ((iSize.y() + threads - 1) / threads + 1) & ~1u;
+	if (threads <= 1 || bandRows >= iSize.y()) {
+		iRows(0, iSize.y());
+		return;
+	}
+	BandWorkers::get().run(
+			[](const void* iContext, const uint32_t iBegin, const uint32_t iEnd) {
+				(*static_cast<const RowFunction*>(iContext))(iBegin, iEnd);
+			},
+			&iRows, bandRows, iSize.y(), threads);
+}
+
+/**
+ * @brief Check if the vectorized implementation is used.
+ * @param[in] iParams The conversion parameters.
+ * @return True for the vectorized implementation.
+ */
+constexpr auto useSimd(const ConversionParams& iParams) -> bool {
+	return g_blockSize > 0 && iParams.kernel == ConversionKernel::Simd;
+}
+
+}// namespace
+
+void convertNv12ToRgb24(const uint8_t* iNv12Buffer, const math::vec2ui& iSize, uint8_t* oRgb24Buffer,
+						const ConversionParams& iParams) {
+	OWL_PROFILE_FUNCTION()
+
+	const uint32_t width = iSize.x();
+	const uint8_t* uvPlane = iNv12Buffer + static_cast<size_t>(iSize.surface());
+	const bool simd = useSimd(iParams);
+	forEachBand(iSize, iParams, [=](const uint32_t iBegin, const uint32_t iEnd) {
+		for (uint32_t row = iBegin; row < iEnd; ++row) {
+			const uint8_t* yRow = iNv12Buffer + static_cast<size_t>(row) * width;
+			const uint8_t* uvRow = uvPlane + static_cast<size_t>(row / 2) * width;
+			uint8_t* rgbRow = oRgb24Buffer + static_cast<size_t>(row) * width * 3;
+			uint32_t x = 0;
+#if defined(OWL_CONVERSION_AVX2) || defined(OWL_CONVERSION_SSE2) || defined(OWL_CONVERSION_NEON)
+			if (simd) {
+				Block block{};
+				for (; x + g_blockSize <= width; x += g_blockSize) {
+					convertNv12Block(yRow + x, uvRow + x, block);
+					storeBlock(block, rgbRow, x, width, iParams.mirror);
+				}
+			}
+#endif
+			for (; x < width; ++x) {
+				const uint32_t uv = x & ~1u;
+				yuvToRgb(yRow[x], uvRow[uv], uvRow[uv + 1],
+						 rgbRow + static_cast<size_t>(iParams.mirror ? width - 1 - x : x) * 3);
+			}
+		}
+	});
+}
+
+void convertYuYvToRgb24(const uint8_t* iYuYvBuffer, const math::vec2ui& iSize, uint8_t* oRgb24Buffer,
+						const ConversionParams& iParams) {
+	OWL_PROFILE_FUNCTION()
+
+	const uint32_t width = iSize.x();
+	const bool simd = useSimd(iParams);
+	forEachBand(iSize, iParams, [=](const uint32_t iBegin, const uint32_t iEnd) {
+		for (uint32_t row = iBegin; row < iEnd; ++row) {
+			const uint8_t* yuyvRow = iYuYvBuffer + static_cast<size_t>(row) * width * 2;
+			uint8_t* rgbRow = oRgb24Buffer + static_cast<size_t>(row) * width * 3;
+			uint32_t x = 0;
+#if defined(OWL_CONVERSION_AVX2) || defined(OWL_CONVERSION_SSE2) || defined(OWL_CONVERSION_NEON)
+			if (simd) {
+				Block block{};
+				for (; x + g_blockSize <= width; x += g_blockSize) {
+					convertYuYvBlock(yuyvRow + static_cast<size_t>(x) * 2, block);
+					storeBlock(block, rgbRow, x, width, iParams.mirror);
+				}
+			}
+#endif
+			for (; x < width; ++x) {
+				const size_t pair = static_cast<size_t>(x & ~1u) * 2;
+				// the width should be even: the last pixel of an odd row has no red chroma.
+				const uint8_t v = (x | 1u) < width ? yuyvRow[pair + 3] : 128;
+				yuvToRgb(yuyvRow[static_cast<size_t>(x) * 2], yuyvRow[pair + 1], v,
+						 rgbRow + static_cast<size_t>(iParams.mirror ? width - 1 - x : x) * 3);
+			}
+		}
+	});
+}
+
+void copyRgb24(const uint8_t* iRgb24Buffer, const math::vec2ui& iSize, uint8_t* oRgb24Buffer,
+			   const ConversionParams& iParams) {
+	OWL_PROFILE_FUNCTION()
+
+	if (!iParams.mirror) {
+		std::memcpy(oRgb24Buffer, iRgb24Buffer, static_cast<size_t>(iSize.surface()) * 3);
+		return;
+	}
+	const uint32_t width = iSize.x();
+	forEachBand(iSize, iParams, [=](const uint32_t iBegin, const uint32_t iEnd) {
+		for (uint32_t row = iBegin; row < iEnd; ++row) {
+			const uint8_t* source = iRgb24Buffer + static_cast<size_t>(row) * width * 3;
+			uint8_t* destination = oRgb24Buffer + (static_cast<size_t>(row) + 1) * width * 3;
+			for (uint32_t x = 0; x < width; ++x, source += 3) {
+				destination -= 3;
+				destination[0] = source[0];
+				destination[1] = source[1];
+				destination[2] = source[2];
+			}
+		}
+	});
+}
+
+// NOLINTEND(*-magic-numbers)
+OWL_DIAG_POP
+
+auto getSimdKernelName() -> std::string_view {
+#if defined(OWL_CONVERSION_AVX2)
+	return "AVX2";
+#elif defined(OWL_CONVERSION_SSE2)
+	return "SSE2";
+#elif defined(OWL_CONVERSION_NEON)
+	return "NEON";
+#else
+	return "None";
+#endif
+}
+
+}// namespace owl::input::video
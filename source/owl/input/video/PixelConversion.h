@@ -0,0 +1,77 @@
+/**
+ * @file PixelConversion.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+#include "math/vectors.h"
+
+namespace owl::input::video {
+
+/**
+ * @brief Implementation of the pixel conversions.
+ */
+enum struct ConversionKernel : uint8_t {
+	Scalar,///< Reference implementation, one pixel at a time.
+	Simd,///< Vectorized implementation for the target (AVX2, SSE2 or NEON), scalar if none is available.
+};
+
+/// Minimal number of pixels of a frame for splitting its conversion across threads.
+constexpr uint32_t g_parallelConversionThreshold{1280 * 720};
+/// Maximal number of threads converting a frame.
+constexpr uint32_t g_maxConversionThreads{4};
+
+/**
+ * @brief Parameters of a conversion.
+ */
+struct OWL_API ConversionParams {
+	/// If the rows are mirrored horizontally.
+	bool mirror = false;
+	/// The implementation to use.
+	ConversionKernel kernel = ConversionKernel::Simd;
+	/// Number of threads, 0 to choose from the frame size.
+	uint32_t threadCount = 0;
+};
+
+/**
+ * @brief Convert a NV12 frame to RGB24.
+ * @param[in] iNv12Buffer The NV12 frame: the Y plane followed by the interleaved UV plane.
+ * @param[in] iSize The size of the frame.
+ * @param[out] oRgb24Buffer The RGB24 frame of iSize.surface() * 3 bytes.
+ * @param[in] iParams The conversion parameters.
+ */
+OWL_API void convertNv12ToRgb24(const uint8_t* iNv12Buffer, const math::vec2ui& iSize, uint8_t* oRgb24Buffer,
+								const ConversionParams& iParams = {});
+
+/**
+ * @brief Convert a YUYV frame to RGB24.
+ * @param[in] iYuYvBuffer The YUYV frame.
+ * @param[in] iSize The size of the frame.
+ * @param[out] oRgb24Buffer The RGB24 frame of iSize.surface() * 3 bytes.
+ * @param[in] iParams The conversion parameters.
+ */
+OWL_API void convertYuYvToRgb24(const uint8_t* iYuYvBuffer, const math::vec2ui& iSize, uint8_t* oRgb24Buffer,
+								const ConversionParams& iParams = {});
+
+/**
+ * @brief Copy a RGB24 frame.
+ * @param[in] iRgb24Buffer The source frame.
+ * @param[in] iSize The size of the frame.
+ * @param[out] oRgb24Buffer The RGB24 frame of iSize.surface() * 3 bytes.
+ * @param[in] iParams The conversion parameters.
+ */
+OWL_API void copyRgb24(const uint8_t* iRgb24Buffer, const math::vec2ui& iSize, uint8_t* oRgb24Buffer,
+					   const ConversionParams& iParams = {});
+
+/**
+ * @brief Get the name of the vectorized implementation.
+ * @return The instruction set used by ConversionKernel::Simd.
+ */
+OWL_API auto getSimdKernelName() -> std::string_view;
+
+}// namespace owl::input::video
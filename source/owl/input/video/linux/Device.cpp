@@ -11,11 +11,13 @@
 
 #if defined(OWL_PLATFORM_LINUX)
 #include "../Manager.h"
+#include "core/external/stbimage.h"
 
 #include <fcntl.h>
 #include <filesystem>
 #include <linux/media.h>
 #include <linux/videodev2.h>
+#include <poll.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
 
@@ -122,10 +124,8 @@ auto getV4L2PixelFormat(const Device::PixelFormat& iPixelFormat) -> uint32_t {
 
 
 void updateList(std::vector<shared<video::Device>>& ioList) {
-	// check if all listed devices still exists
-	if (std::remove_if(ioList.begin(), ioList.end(), [](const shared<video::Device>& dev) {
-			return !std::static_pointer_cast<Device>(dev)->isValid();
-		}) != ioList.end()) {
+	// check if all listed devices still exists, the list may hold other kinds of devices.
+	if (std::erase_if(ioList, [](const shared<video::Device>& dev) { return !dev->isValid(); }) > 0) {
 		OWL_CORE_WARN("Possible problems during video input listing.")
 	}
 
@@ -138,7 +138,7 @@ void updateList(std::vector<shared<video::Device>>& ioList) {
 		}
 		// don't add a device that already exists
 		if (std::find_if(ioList.begin(), ioList.end(), [&testDev](const shared<video::Device>& dev) {
-				return testDev->getBusInfo() == static_pointer_cast<Device>(dev)->getBusInfo();
+				return testDev->getBusInfo() == dev->getBusInfo();
 			}) != ioList.end())
 			continue;
 		OWL_CORE_TRACE("Found: {} ({}) [{}] ", devCounter, testDev->getName(), testDev->getBusInfo())
@@ -188,7 +188,7 @@ Device::~Device() { close(); };
 void Device::open() {
 	OWL_CORE_INFO("Opening device ({}): {}", m_file, m_name)
 	close();
-	m_fileHandler = ::open(m_file.c_str(), O_RDWR | O_CLOEXEC);
+	m_fileHandler = ::open(m_file.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
 	if (m_fileHandler <= 0) {
 		OWL_CORE_WARN("({}) Unable to open the device.", m_file)
 		return;
@@ -227,44 +227,29 @@ void Device::open() {
 		m_pixFormat = getDevicePixelFormat(fmt.fmt.pix.pixelformat);
 		m_size = {fmt.fmt.pix.width, fmt.fmt.pix.height};
 	}
-	// request buffer from device.
+	// the frame interval schedules the uploads.
 	{
-		v4l2_requestbuffers requestBuffers{};
-		requestBuffers.count = 1;// only one buffer requested.
-		requestBuffers.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-		requestBuffers.memory = V4L2_MEMORY_MMAP;
-		if (ioctl(m_fileHandler, VIDIOC_REQBUFS, &requestBuffers) < 0) {
-			OWL_CORE_WARN("({}) Unable to request buffer.", m_file)
-			close();
-			return;
+		v4l2_streamparm parm{};
+		parm.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+		m_frameInterval = {};
+		if (ioctl(m_fileHandler, VIDIOC_G_PARM, &parm) == 0 && parm.parm.capture.timeperframe.numerator > 0 &&
+			parm.parm.capture.timeperframe.denominator > 0) {
+			m_frameInterval = std::chrono::duration<double>(
+					static_cast<double>(parm.parm.capture.timeperframe.numerator) /
+					static_cast<double>(parm.parm.capture.timeperframe.denominator));
+			OWL_CORE_INFO("({}) Using frame interval {}/{} s", m_file, parm.parm.capture.timeperframe.numerator,
+						  parm.parm.capture.timeperframe.denominator)
+		} else {
+			OWL_CORE_WARN("({}) Unable to get the frame interval.", m_file)
 		}
 	}
-	// define the bufferInfo
-	{
-		memset(&m_bufferInfo, 0, sizeof(m_bufferInfo));
-		m_bufferInfo.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-		m_bufferInfo.memory = V4L2_MEMORY_MMAP;
-		m_bufferInfo.index = 0;
-	}
-	// query buffer from device
-	{
-		if (ioctl(m_fileHandler, VIDIOC_QUERYBUF, &m_bufferInfo) < 0) {
-			OWL_CORE_WARN("({}) Unable to query buffer.", m_file)
-			close();
-			return;
-		}
-		OWL_CORE_INFO("({}) Buffer info, length {} , offset {}.", m_file, m_bufferInfo.length, m_bufferInfo.m.offset)
-		mp_buffer = mmap(nullptr, m_bufferInfo.length, PROT_READ | PROT_WRITE, MAP_SHARED, m_fileHandler,
-						 m_bufferInfo.m.offset);
-		if (mp_buffer == MAP_FAILED) {
-			OWL_CORE_ERROR("({}) Unable to map the device buffer.", m_file)
-			close();
-			return;
-		}
+	if (!mapBuffers()) {
+		close();
+		return;
 	}
 	//Activate the streaming
 	{
-		uint32_t type = m_bufferInfo.type;
+		uint32_t type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
 		if (ioctl(m_fileHandler, VIDIOC_STREAMON, &type) < 0) {
 			OWL_CORE_WARN("({}) Unable to start the streaming.", m_file)
 			close();
@@ -272,60 +257,116 @@ void Device::open() {
 		}
 		m_streaming = true;
 	}
-	// queue the buffer
-	if (ioctl(m_fileHandler, VIDIOC_QBUF, &m_bufferInfo) < 0) {
-		OWL_CORE_WARN("Device ({}) unable to queue the buffer.", m_file)
-		close();
-		return;
+	resetCapture();
+	m_captureThread = std::jthread([this](const std::stop_token& iStop) { captureLoop(iStop); });
+}
+
+auto Device::mapBuffers() -> bool {
+	// request buffers from device.
+	v4l2_requestbuffers requestBuffers{};
+	requestBuffers.count = g_captureBufferCount;
+	requestBuffers.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+	requestBuffers.memory = V4L2_MEMORY_MMAP;
+	if (ioctl(m_fileHandler, VIDIOC_REQBUFS, &requestBuffers) < 0 || requestBuffers.count == 0) {
+		OWL_CORE_WARN("({}) Unable to request buffers.", m_file)
+		return false;
+	}
+	OWL_CORE_INFO("({}) Using {} buffers.", m_file, requestBuffers.count)
+	// query, map and queue each buffer.
+	for (uint32_t index = 0; index < requestBuffers.count; ++index) {
+		v4l2_buffer bufferInfo{};
+		bufferInfo.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+		bufferInfo.memory = V4L2_MEMORY_MMAP;
+		bufferInfo.index = index;
+		if (ioctl(m_fileHandler, VIDIOC_QUERYBUF, &bufferInfo) < 0) {
+			OWL_CORE_WARN("({}) Unable to query buffer {}.", m_file, index)
+			return false;
+		}
+		void* data = mmap(nullptr, bufferInfo.length, PROT_READ | PROT_WRITE, MAP_SHARED, m_fileHandler,
+						  bufferInfo.m.offset);
+		if (data == MAP_FAILED) {
+			OWL_CORE_ERROR("({}) Unable to map the device buffer {}.", m_file, index)
+			return false;
+		}
+		m_buffers.push_back({.data = data, .length = bufferInfo.length});
+		if (ioctl(m_fileHandler, VIDIOC_QBUF, &bufferInfo) < 0) {
+			OWL_CORE_WARN("({}) Unable to queue the buffer {}.", m_file, index)
+			return false;
+		}
 	}
+	return true;
 }
 
 void Device::close() {
 	if (!isOpened())
 		return;
-	if (mp_buffer != nullptr)
-		munmap(mp_buffer, m_bufferInfo.length);
+	// the capture thread uses the buffers.
+	if (m_captureThread.joinable()) {
+		m_captureThread.request_stop();
+		m_captureThread.join();
+	}
 	if (m_streaming) {
-		if (ioctl(m_fileHandler, VIDIOC_STREAMOFF, &m_bufferInfo) < 0) {
+		uint32_t type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+		if (ioctl(m_fileHandler, VIDIOC_STREAMOFF, &type) < 0) {
 			OWL_CORE_WARN("({}) Unable to close the streaming.", m_file)
 		}
 	}
+	for (const auto& [data, length]: m_buffers) munmap(data, length);
+	m_buffers.clear();
 	::close(m_fileHandler);
 	m_fileHandler = 0;
 	m_size = {1, 1};
-	mp_buffer = nullptr;
 	m_streaming = false;
 }
 
 auto Device::isOpened() const -> bool { return m_fileHandler != 0; }
 
-void Device::fillFrame(shared<renderer::Texture>& ioFrame) {
+void Device::fillFrame(FrameTextures& ioFrame) {
 	if (!m_streaming)
 		return;// need to be open and ready!
-	// recreate the frame if not the right size.
-	if (!ioFrame || ioFrame->getSize() != m_size) {
-		ioFrame = renderer::Texture2D::create({m_size, renderer::ImageFormat::RGB8});
-	}
-	// dequeue the buffer
-	if (ioctl(m_fileHandler, VIDIOC_DQBUF, &m_bufferInfo) < 0) {
-		OWL_CORE_WARN("Device ({}) unable to dequeue the buffer.", m_file)
-		return;
-	}
+	consumeFrame(ioFrame);
+}
 
-	std::vector<uint8_t> convertedBuffer =
-			getRgbBuffer(static_cast<const uint8_t*>(mp_buffer), static_cast<int32_t>(m_bufferInfo.bytesused));
-	// frames are written after dequeue the buffer
-	if (!convertedBuffer.empty()) {
-		if (static_cast<size_t>(m_size.surface()) * 3ull != convertedBuffer.size()) {
-			OWL_CORE_WARN("Device ({}) buffer size missmatch: {}, expecting {}.", m_file, m_bufferInfo.bytesused,
-						  m_size.surface() * 3)
-		} else {
-			ioFrame->setData(convertedBuffer.data(), static_cast<uint32_t>(convertedBuffer.size()));
+void Device::captureLoop(const std::stop_token& iStop) {
+	core::external::setStbImageRecycling(true);
+	pollfd descriptor{.fd = m_fileHandler, .events = POLLIN, .revents = 0};
+	while (!iStop.stop_requested()) {
+		const int ready = poll(&descriptor, 1, g_capturePollTimeout);
+		if (ready < 0 && errno != EINTR) {
+			OWL_CORE_WARN("Device ({}) unable to wait for a frame.", m_file)
+			return;
+		}
+		if (ready <= 0)
+			continue;
+		// dequeue the buffer
+		v4l2_buffer bufferInfo{};
+		bufferInfo.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+		bufferInfo.memory = V4L2_MEMORY_MMAP;
+		if (ioctl(m_fileHandler, VIDIOC_DQBUF, &bufferInfo) < 0) {
+			if (errno == EAGAIN || errno == EINTR)
+				continue;
+			OWL_CORE_WARN("Device ({}) unable to dequeue the buffer.", m_file)
+			return;
+		}
+		{
+			OWL_PROFILE_SCOPE("video capture conversion")
+			// the mailbox frames keep their pixel buffers: no allocation once the three are sized.
+			Frame& frame = m_mailbox.acquireWrite();
+			if (captureFrame(static_cast<const uint8_t*>(m_buffers[bufferInfo.index].data),
+							 static_cast<int32_t>(bufferInfo.bytesused), frame)) {
+				frame.sequence = bufferInfo.sequence;
+				frame.timestamp = std::chrono::steady_clock::now();
+				publishFrame();
+			}
+		}
+		// recorded once the live frame is published.
+		recordFrame(static_cast<const uint8_t*>(m_buffers[bufferInfo.index].data),
+					static_cast<int32_t>(bufferInfo.bytesused), bufferInfo.sequence);
+		// queue the buffer
+		if (ioctl(m_fileHandler, VIDIOC_QBUF, &bufferInfo) < 0) {
+			OWL_CORE_WARN("Device ({}) unable to queue the buffer.", m_file)
+			return;
 		}
-	}
-	// queue the buffer
-	if (ioctl(m_fileHandler, VIDIOC_QBUF, &m_bufferInfo) < 0) {
-		OWL_CORE_WARN("Device ({}) unable to queue the buffer.", m_file)
 	}
 }
 
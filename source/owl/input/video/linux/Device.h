@@ -17,6 +17,11 @@
  */
 namespace owl::input::video::linux64 {
 
+/// Number of buffers requested to the driver.
+constexpr uint32_t g_captureBufferCount{4};
+/// Timeout of the capture thread's wait for a frame, to check for stop requests.
+constexpr int g_capturePollTimeout{100};
+
 /**
  * @brief Search for devices and them to the given list.
  * @param[in] ioList The device list to update.
@@ -66,10 +71,10 @@ public:
 	[[nodiscard]] auto getFile() const -> const std::string& { return m_file; }
 
 	/**
-	 * @brief Retrieve a frame.
+	 * @brief Upload the latest captured frame, if any.
 	 * @param[in,out] ioFrame The frame to update.
 	 */
-	void fillFrame(shared<renderer::Texture>& ioFrame) override;
+	void fillFrame(FrameTextures& ioFrame) override;
 
 	/**
 	 * @brief Check if this device is valid.
@@ -82,12 +87,33 @@ private:
 	std::string m_file;
 	/// The file handler.
 	int m_fileHandler = 0;
-	/// buffer map to the device.
-	void* mp_buffer = nullptr;
-	/// Buffer info.
-	v4l2_buffer m_bufferInfo{};
+	/**
+	 * @brief A buffer mapped to the device.
+	 */
+	struct MappedBuffer {
+		/// The mapped memory.
+		void* data = nullptr;
+		/// The mapped size.
+		size_t length = 0;
+	};
+	/// Buffers mapped to the device.
+	std::vector<MappedBuffer> m_buffers;
 	/// if the streaming is started.
 	bool m_streaming = false;
+	/// Thread dequeuing and converting the frames.
+	std::jthread m_captureThread;
+
+	/**
+	 * @brief Map the driver buffers and queue them.
+	 * @return True if successful.
+	 */
+	auto mapBuffers() -> bool;
+
+	/**
+	 * @brief Wait for the frames, convert and publish them.
+	 * @param[in] iStop The stop token of the thread.
+	 */
+	void captureLoop(const std::stop_token& iStop);
 
 	void printSupportedFormat() const;
 
@@ -181,10 +181,8 @@ OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
 void updateList(std::vector<shared<video::Device>>& ioList) {
 	if (!cc.addRef())
 		return;
-	// check if all listed devices still exists
-	if (std::remove_if(ioList.begin(), ioList.end(), [](const shared<video::Device>& iDev) {
-			return !std::static_pointer_cast<Device>(iDev)->isValid();
-		}) != ioList.end()) {
+	// check if all listed devices still exists, the list may hold other kinds of devices.
+	if (std::erase_if(ioList, [](const shared<video::Device>& iDev) { return !iDev->isValid(); }) > 0) {
 		OWL_CORE_WARN("Possible problems during video input listing.")
 	}
 
@@ -227,7 +225,7 @@ void updateList(std::vector<shared<video::Device>>& ioList) {
 		}
 		// don't add a device that already exists
 		if (std::ranges::find_if(ioList.begin(), ioList.end(), [&testDev](const shared<video::Device>& dev) {
-				return testDev->getBusInfo() == static_pointer_cast<Device>(dev)->getBusInfo();
+				return testDev->getBusInfo() == dev->getBusInfo();
 			}) != ioList.end())
 			continue;
 		OWL_CORE_TRACE("Found: {} ({}) [{}] ", devCounter, testDev->getName(), testDev->getBusInfo())
@@ -309,13 +307,24 @@ void Device::open() {
 	mediaType->GetGUID(MF_MT_SUBTYPE, &format);
 	OWL_CORE_INFO("Device ({}): Native media sub type: {}.", m_name, getPixelFormatString(format))
 	m_pixFormat = getDevicePixelFormat(format);
+	uint32_t rateNumerator = 0;
+	uint32_t rateDenominator = 0;
+	m_frameInterval = {};
+	if (SUCCEEDED(MFGetAttributeRatio(mediaType.get(), MF_MT_FRAME_RATE, &rateNumerator, &rateDenominator)) &&
+		rateNumerator > 0 && rateDenominator > 0) {
+		m_frameInterval = std::chrono::duration<double>(static_cast<double>(rateDenominator) /
+														static_cast<double>(rateNumerator));
+		OWL_CORE_INFO("Device ({}): Frame rate {}/{}.", m_name, rateNumerator, rateDenominator)
+	}
 	mediaType->SetUINT32(MF_MT_INTERLACE_MODE, MFVideoInterlace_Progressive);
 	mediaType->SetUINT32(MF_MT_ALL_SAMPLES_INDEPENDENT, TRUE);
 	hr = m_sourceReader->SetCurrentMediaType(MF_SOURCE_READER_FIRST_VIDEO_STREAM, nullptr, mediaType.get());
 	if (FAILED(hr)) {
 		OWL_CORE_WARN("Device ({}): Unable to set native media type.", m_name)
 		close();
+		return;
 	}
+	resetCapture();
 }
 
 void Device::close() {
@@ -331,18 +340,12 @@ void Device::close() {
 
 auto Device::isOpened() const -> bool { return m_size.surface() > 1; }
 
-void Device::fillFrame(shared<renderer::Texture>& iFrame) {
+void Device::fillFrame(FrameTextures& ioFrame) {
 	if (!isOpened())
 		return;
 	// Resizing the frame.
 	if (m_size.surface() == 0)
 		return;
-	if (!iFrame || iFrame->getSize() != m_size) {
-		if (iFrame)
-			iFrame.reset();
-		iFrame = renderer::Texture2D::create({m_size, renderer::ImageFormat::RGB8});
-	}
-	// For now only fill with black
 	WPointer<IMFSample> sample;
 	int64_t timestamp = 0;
 	u_long actualIndex = 0;
@@ -355,6 +358,10 @@ void Device::fillFrame(shared<renderer::Texture>& iFrame) {
 			return;
 		}
 	}
+	// the frames are read synchronously: captured when the sample is read.
+	const auto captureTime = std::chrono::steady_clock::now();
+	const uint64_t sequence = m_sequence++;
+	m_captured.fetch_add(1, std::memory_order_relaxed);
 	u_long count = 0;
 	if (FAILED(sample->GetBufferCount(&count)) || count == 0) {
 		OWL_CORE_WARN("Device ({}): No  buffer found in the sample from device.", m_name)
@@ -368,14 +375,26 @@ void Device::fillFrame(shared<renderer::Texture>& iFrame) {
 	byte* byteBuffer = nullptr;
 	u_long bCurLen = 0;
 	buffer->Lock(&byteBuffer, nullptr, &bCurLen);
-	std::vector<byte> convertedBuffer = getRgbBuffer(byteBuffer, static_cast<int32_t>(bCurLen));
-	if (m_size.surface() * 3ull != convertedBuffer.size()) {
-		OWL_CORE_WARN("Frame size missmatch {} buffer: {}.", m_size.surface() * 3ull, convertedBuffer.size())
-		buffer->Unlock();
+	math::vec2ui size;
+	const bool converted = convertToRgb(byteBuffer, static_cast<int32_t>(bCurLen), m_rgbBuffer, size);
+	recordFrame(byteBuffer, static_cast<int32_t>(bCurLen), sequence);
+	buffer->Unlock();
+	if (!converted)
 		return;
+	// the MJPEG frames may be downscaled.
+	auto& texture = ioFrame.texture;
+	if (!texture || texture->getSize() != size) {
+		if (texture)
+			texture.reset();
+		texture = renderer::Texture2D::create({size, renderer::ImageFormat::RGB8, false});
 	}
-	iFrame->setData(convertedBuffer.data(), static_cast<uint32_t>(convertedBuffer.size()));
-	buffer->Unlock();
+	texture->setData(m_rgbBuffer.data(), static_cast<uint32_t>(m_rgbBuffer.size()));
+	ioFrame.chroma.reset();
+	ioFrame.layout = renderer::YuvLayout::None;
+	ioFrame.mirror = false;
+	ioFrame.sequence = sequence;
+	ioFrame.timestamp = captureTime;
+	accountUpload(captureTime);
 }
 
 auto Device::isValid() const -> bool { return !m_name.empty() && !m_busInfo.empty(); }
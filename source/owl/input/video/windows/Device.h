@@ -63,9 +63,9 @@ public:
 
 	/**
 	 * @brief Retrieve a frame.
-	 * @param[in] iFrame The frame to update.
+	 * @param[in,out] ioFrame The frame to update.
 	 */
-	void fillFrame(shared<renderer::Texture>& iFrame) override;
+	void fillFrame(FrameTextures& ioFrame) override;
 
 	/**
 	 * @brief Check the validity of the device.
@@ -80,6 +80,10 @@ private:
 	WPointer<IMFActivate> m_devActive;
 	/// Pointer to the source reader.
 	WPointer<IMFSourceReader> m_sourceReader;
+	/// The converted frame, reused from a frame to the next.
+	std::vector<uint8_t> m_rgbBuffer;
+	/// Number of frames read.
+	uint64_t m_sequence = 0;
 };
 
 }// namespace owl::input::video::windows
@@ -22,9 +22,11 @@
 #include "core/layer/Layer.h"
 #include "core/utils/FileDialog.h"
 #include "core/utils/FileUtils.h"
+#include "core/utils/SeqLock.h"
 // -------------------------
 
 // ------ Debugging --------
+#include "debug/FrameProfiler.h"
 #include "debug/Profiler.h"
 #include "debug/Tracker.h"
 // -------------------------
@@ -34,6 +36,10 @@
 #include "input/CameraOrthoController.h"
 #include "input/Input.h"
 #include "input/Window.h"
+#include "input/serial/MspLink.h"
+#include "input/session/SessionReader.h"
+#include "input/video/FileDevice.h"
+#include "input/video/FrameRecorder.h"
 #include "input/video/Manager.h"
 #include "math/math.h"
 
@@ -65,7 +65,7 @@ void PhysicCommand::init(scene::Scene* iScene) {
 		bodyDef.rotation = b2MakeRot(transform.rotation().z());
 
 		const b2BodyId body = b2CreateBody(m_impl->worldId, &bodyDef);
-		OWL_INFO("PhysicCommand::init(), body created ({} {} {})", body.index1, body.world0, body.revision)
+		OWL_CORE_TRACE("PhysicCommand::init(), body created ({} {} {})", body.index1, body.world0, body.revision)
 		sbody.bodyId = m_impl->nextId;
 		m_impl->bodies[m_impl->nextId] = body;
 		m_impl->nextId++;
@@ -91,7 +91,7 @@ auto PhysicCommand::isInitialized() -> bool { return m_scene != nullptr; }
 
 void PhysicCommand::frame(const core::Timestep& iTimestep) {
 	if (!isInitialized()) {
-		OWL_CORE_WARN("PhysicCommand::frame(), Physic engine not initialized")
+		OWL_CORE_WARN_THROTTLED(core::gDefaultFrequency, "PhysicCommand::frame(), Physic engine not initialized")
 		return;
 	}
 	// Update the physical world
@@ -110,7 +110,7 @@ void PhysicCommand::frame(const core::Timestep& iTimestep) {
 
 void PhysicCommand::impulse(const scene::Entity& iEntity, const math::vec2f& iImpulse) {
 	if (!isInitialized()) {
-		OWL_CORE_WARN("PhysicCommand::impulse(), Physic engine not initialized.")
+		OWL_CORE_WARN_THROTTLED(core::gDefaultFrequency, "PhysicCommand::impulse(), Physic engine not initialized.")
 		return;
 	}
 	if (!iEntity) {
@@ -128,7 +128,7 @@ void PhysicCommand::impulse(const scene::Entity& iEntity, const math::vec2f& iIm
 
 auto PhysicCommand::getVelocity(const scene::Entity& iEntity) -> math::vec2f {
 	if (!isInitialized()) {
-		OWL_CORE_WARN("PhysicCommand::getVelocity(), Physic Engine not initialized.")
+		OWL_CORE_WARN_THROTTLED(core::gDefaultFrequency, "PhysicCommand::getVelocity(), Physic Engine not initialized.")
 		return {0.0f, 0.0f};
 	}
 	if (!iEntity) {
@@ -144,6 +144,23 @@ public:
 	 */
 	virtual void endFrame() {}
 
+	/**
+	 * @brief Start a scope timed on the GPU.
+	 * @param[in] iNameId Interned name of the scope (see debug::Profiler::internName).
+	 */
+	virtual void beginGpuScope([[maybe_unused]] uint32_t iNameId) {}
+
+	/**
+	 * @brief End the innermost scope timed on the GPU.
+	 */
+	virtual void endGpuScope() {}
+
+	/**
+	 * @brief Check if the API is able to time the GPU scopes.
+	 * @return True if GPU timers are supported.
+	 */
+	[[nodiscard]] virtual auto hasGpuTimers() const -> bool { return false; }
+
 protected:
 	/**
 	 * @brief Define the API State.
@@ -9,6 +9,8 @@
 
 #include "RenderCommand.h"
 
+#include "debug/FrameProfiler.h"
+
 namespace owl::renderer {
 
 uniq<RenderAPI> RenderCommand::mu_renderAPI = nullptr;
@@ -21,4 +23,15 @@ auto RenderCommand::getState() -> RenderAPI::State {
 	return RenderAPI::State::Error;
 }
 
+GpuScope::GpuScope(const uint32_t iNameId)
+	: m_active{debug::FrameProfiler::isEnabled() || debug::Profiler::get().isSessionActive()} {
+	if (m_active)
+		RenderCommand::beginGpuScope(iNameId);
+}
+
+GpuScope::~GpuScope() {
+	if (m_active)
+		RenderCommand::endGpuScope();
+}
+
 }// namespace owl::renderer
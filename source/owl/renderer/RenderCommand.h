@@ -10,6 +10,7 @@
 
 #include "RenderAPI.h"
 #include "core/Core.h"
+#include "debug/Profiler.h"
 
 namespace owl::renderer {
 /**
@@ -160,6 +161,33 @@ public:
 			mu_renderAPI->endTextureLoad();
 	}
 
+	/**
+	 * @brief Start a scope timed on the GPU.
+	 * @param[in] iNameId Interned name of the scope.
+	 */
+	static void beginGpuScope(const uint32_t iNameId) {
+		if (mu_renderAPI)
+			mu_renderAPI->beginGpuScope(iNameId);
+	}
+
+	/**
+	 * @brief End the innermost scope timed on the GPU.
+	 */
+	static void endGpuScope() {
+		if (mu_renderAPI)
+			mu_renderAPI->endGpuScope();
+	}
+
+	/**
+	 * @brief Check if the API is able to time the GPU scopes.
+	 * @return True if GPU timers are supported.
+	 */
+	static auto hasGpuTimers() -> bool {
+		if (mu_renderAPI)
+			return mu_renderAPI->hasGpuTimers();
+		return false;
+	}
+
 	/**
 	 * @brief Check if the API type require initializations.
 	 * @return True if initialization required.
@@ -174,4 +202,37 @@ private:
 	/// Pointer to the render API
 	static uniq<RenderAPI> mu_renderAPI;
 };
+
+/**
+ * @brief Scope timed on the GPU while a profiler is recording.
+ *
+ * The timestamps are read back a few frames later, the results go to the frame profiler and to the profiling session
+ * in a "GPU" track.
+ */
+class OWL_API GpuScope final {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param[in] iNameId Interned name of the scope.
+	 */
+	explicit GpuScope(uint32_t iNameId);
+	/**
+	 * @brief Destructor.
+	 */
+	~GpuScope();
+	GpuScope(const GpuScope&) = delete;
+	GpuScope(GpuScope&&) = delete;
+	auto operator=(const GpuScope&) -> GpuScope& = delete;
+	auto operator=(GpuScope&&) -> GpuScope& = delete;
+
+private:
+	/// If the scope is timed.
+	bool m_active;
+};
 }// namespace owl::renderer
+
+#define OWL_GPU_SCOPE_LINE2(name, line)                                                                                \
+	static const uint32_t gpuNameId##line = ::owl::debug::Profiler::get().internName(name);                            \
+	::owl::renderer::GpuScope gpuScope##line(gpuNameId##line);
+#define OWL_GPU_SCOPE_LINE(name, line) OWL_GPU_SCOPE_LINE2(name, line)
+#define OWL_GPU_SCOPE(name) OWL_GPU_SCOPE_LINE(name, __LINE__)
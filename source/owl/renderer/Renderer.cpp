@@ -9,6 +9,8 @@
 
 #include "Renderer.h"
 #include "Renderer2D.h"
+#include "utils/ShaderCache.h"
+#include "utils/shaderFileUtils.h"
 
 namespace owl::renderer {
 
@@ -21,8 +23,7 @@ void Renderer::init() {
 	OWL_PROFILE_FUNCTION()
 
 	m_sceneData = mkShared<SceneData>();
-	m_shaderLibrary = mkShared<ShaderLibrary>();
-	m_textureLibrary = mkShared<TextureLibrary>();
+	initLibraries();
 
 	RenderCommand::init();
 	if (RenderCommand::getState() != RenderAPI::State::Ready) {
@@ -30,13 +31,23 @@ void Renderer::init() {
 		return;
 	}
 
+	if (RenderCommand::requireInit() && utils::ShaderCache::get().getFile() != utils::getShaderCacheFile())
+		utils::ShaderCache::get().open(utils::getShaderCacheFile());
 	Renderer2D::init();
 
 	m_internalState = State::Running;
 }
 
+void Renderer::initLibraries() {
+	if (!m_shaderLibrary)
+		m_shaderLibrary = mkShared<ShaderLibrary>();
+	if (!m_textureLibrary)
+		m_textureLibrary = mkShared<TextureLibrary>();
+}
+
 void Renderer::shutdown() {
 	Renderer2D::shutdown();
+	utils::ShaderCache::get().close();
 	reset();
 	m_internalState = State::Stopped;
 }
@@ -41,6 +41,13 @@ public:
 	 */
 	static void init();
 
+	/**
+	 * @brief Create the shader and texture libraries if not already done.
+	 *
+	 * Allows asset lookups and shader precompilation before the renderer initialization.
+	 */
+	static void initLibraries();
+
 	/**
 	 * @brief Stops the renderer.
 	 */
@@ -11,6 +11,7 @@
 
 #include "DrawData.h"
 #include "RenderCommand.h"
+#include "Shader.h"
 #include "UniformBuffer.h"
 #include "core/Application.h"
 
@@ -43,6 +44,19 @@ struct QuadVertex {
 	int entityId;
 };
 
+/**
+ * @brief Structure holding video quad vertex information.
+ */
+struct VideoVertex {
+	math::vec3 position;
+	math::vec4 color;
+	math::vec2 texCoord;
+	float texIndex;
+	float chromaIndex;
+	float layout;
+	int entityId;
+};
+
 /**
  * @brief Structure holding circle vertex information.
  */
@@ -107,6 +121,9 @@ struct InternalData {
 	/// Quad Data
 	VertexData<QuadVertex> quad;
 	shared<DrawData> drawQuad;
+	/// Video quad Data
+	VertexData<VideoVertex> video;
+	shared<DrawData> drawVideo;
 	/// Circle Data
 	VertexData<CircleVertex> circle;
 	shared<DrawData> drawCircle;
@@ -127,14 +144,75 @@ struct InternalData {
 	std::vector<shared<Texture2D>> textureSlots;
 	/// next texture index
 	uint32_t textureSlotIndex = 1;// 0 = white texture
+	/// Layout of the strings drawn without layout cache.
+	fonts::TextLayout textLayout;
 };
 
 }// namespace utils
 
 namespace {
 shared<utils::InternalData> g_data;
+
+/**
+ * @brief Get the slot of a texture in the current batch, starting the next batch if no slot is left.
+ * @param[in] iTexture The texture.
+ * @return The slot index, 0 (white texture) for a null texture.
+ */
+auto textureSlot(const shared<Texture2D>& iTexture) -> float {
+	if (iTexture == nullptr)
+		return 0.0f;
+	for (uint32_t i = 1; i < g_data->textureSlotIndex; i++) {
+		if (*g_data->textureSlots[i] == *iTexture)
+			return static_cast<float>(i);
+	}
+	if (g_data->textureSlotIndex >= utils::g_MaxTextureSlots)
+		Renderer2D::nextBatch();
+	const auto textureIndex = static_cast<float>(g_data->textureSlotIndex);
+	g_data->textureSlots[g_data->textureSlotIndex] = iTexture;
+	g_data->textureSlotIndex++;
+	return textureIndex;
+}
+
+/**
+ * @brief Draw a quad textured by a raw video frame.
+ * @param[in] iQuadData Quad's properties.
+ */
+void drawVideoQuad(const Quad2DData& iQuadData) {
+	if (g_data->video.indexCount >= utils::g_maxIndices)
+		Renderer2D::nextBatch();
+	// both planes must be in the same batch.
+	if (g_data->textureSlotIndex + 2 > utils::g_MaxTextureSlots)
+		Renderer2D::nextBatch();
+	const float textureIndex = textureSlot(std::static_pointer_cast<Texture2D>(iQuadData.texture));
+	const float chromaIndex =
+			iQuadData.chromaTexture != nullptr
+					? textureSlot(std::static_pointer_cast<Texture2D>(iQuadData.chromaTexture))
+					: textureIndex;
+	for (size_t i = 0; i < utils::g_quadVertexCount; i++) {
+		g_data->video.vertexBuf.emplace_back(
+				utils::VideoVertex{.position = iQuadData.transform() * utils::g_quadVertexPositions[i],
+								   .color = iQuadData.color,
+								   .texCoord = utils::g_textureCoords[i],
+								   .texIndex = textureIndex,
+								   .chromaIndex = chromaIndex,
+								   .layout = static_cast<float>(iQuadData.yuvLayout),
+								   .entityId = iQuadData.entityId});
+	}
+	g_data->video.indexCount += 6;
+	g_data->stats.quadCount++;
+}
 }// namespace
 
+void Renderer2D::precompileShaders() {
+	OWL_PROFILE_FUNCTION()
+
+	Shader::precompile({{.shaderName = {.name = "quad", .renderer = "renderer2D"}},
+						{.shaderName = {.name = "video", .renderer = "renderer2D"}},
+						{.shaderName = {.name = "circle", .renderer = "renderer2D"}},
+						{.shaderName = {.name = "line", .renderer = "renderer2D"}},
+						{.shaderName = {.name = "text", .renderer = "renderer2D"}}});
+}
+
 void Renderer2D::init() {
 	OWL_PROFILE_FUNCTION()
 
@@ -160,6 +238,8 @@ void Renderer2D::init() {
 			offset += 4;
 		}
 	}
+	// compile the shaders concurrently, their creation then only reads the cache.
+	precompileShaders();
 	// quads
 	g_data->drawQuad = DrawData::create();
 	g_data->drawQuad->init(
@@ -172,6 +252,19 @@ void Renderer2D::init() {
 					{"i_EntityID", ShaderDataType::Int},
 			},
 			"renderer2D", quadIndices, "quad");
+	// video quads
+	g_data->drawVideo = DrawData::create();
+	g_data->drawVideo->init(
+			{
+					{"i_Position", ShaderDataType::Float3},
+					{"i_Color", ShaderDataType::Float4},
+					{"i_TexCoord", ShaderDataType::Float2},
+					{"i_TexIndex", ShaderDataType::Float},
+					{"i_ChromaIndex", ShaderDataType::Float},
+					{"i_Layout", ShaderDataType::Float},
+					{"i_EntityID", ShaderDataType::Int},
+			},
+			"renderer2D", quadIndices, "video");
 	// circles
 	g_data->drawCircle = DrawData::create();
 	g_data->drawCircle->init(
@@ -235,6 +328,7 @@ void Renderer2D::shutdown() {
 		text.reset();
 	}
 	g_data->drawQuad.reset();
+	g_data->drawVideo.reset();
 	g_data->drawCircle.reset();
 	g_data->drawLine.reset();
 	g_data.reset();
@@ -257,48 +351,60 @@ void Renderer2D::endScene() {
 void Renderer2D::flush() {
 	// bind textures
 	RenderCommand::beginBatch();
-	RenderCommand::beginTextureLoad();
-	for (uint32_t i = 0; i < g_data->textureSlotIndex; i++) g_data->textureSlots[i]->bind(i);
-	RenderCommand::endTextureLoad();
-
-	if (g_data->quad.indexCount > 0) {
-		g_data->drawQuad->setVertexData(
-				g_data->quad.vertexBuf.data(),
-				static_cast<uint32_t>(g_data->quad.vertexBuf.size() * sizeof(utils::QuadVertex)));
-
-		// draw call
-		RenderCommand::drawData(g_data->drawQuad, g_data->quad.indexCount);
-		g_data->stats.drawCalls++;
-	}
-	if (g_data->circle.indexCount > 0) {
-		g_data->drawCircle->setVertexData(
-				g_data->circle.vertexBuf.data(),
-				static_cast<uint32_t>(g_data->circle.vertexBuf.size() * sizeof(utils::CircleVertex)));
-		// draw call
-		RenderCommand::drawData(g_data->drawCircle, g_data->circle.indexCount);
-		g_data->stats.drawCalls++;
-	}
-	if (g_data->line.indexCount > 0) {
-		g_data->drawLine->setVertexData(
-				g_data->line.vertexBuf.data(),
-				static_cast<uint32_t>(g_data->line.vertexBuf.size() * sizeof(utils::LineVertex)));
-		// draw call
-		RenderCommand::drawLine(g_data->drawLine, g_data->line.indexCount);
-		g_data->stats.drawCalls++;
-	}
-	if (g_data->text.indexCount > 0) {
-		g_data->drawText->setVertexData(
-				g_data->text.vertexBuf.data(),
-				static_cast<uint32_t>(g_data->text.vertexBuf.size() * sizeof(utils::TextVertex)));
-		// draw call
-		RenderCommand::drawData(g_data->drawText, g_data->text.indexCount);
-		g_data->stats.drawCalls++;
+	{
+		OWL_GPU_SCOPE("Renderer2D::flush")
+		RenderCommand::beginTextureLoad();
+		for (uint32_t i = 0; i < g_data->textureSlotIndex; i++) g_data->textureSlots[i]->bind(i);
+		RenderCommand::endTextureLoad();
+
+		if (g_data->quad.indexCount > 0) {
+			g_data->drawQuad->setVertexData(
+					g_data->quad.vertexBuf.data(),
+					static_cast<uint32_t>(g_data->quad.vertexBuf.size() * sizeof(utils::QuadVertex)));
+
+			// draw call
+			RenderCommand::drawData(g_data->drawQuad, g_data->quad.indexCount);
+			g_data->stats.drawCalls++;
+		}
+		if (g_data->video.indexCount > 0) {
+			g_data->drawVideo->setVertexData(
+					g_data->video.vertexBuf.data(),
+					static_cast<uint32_t>(g_data->video.vertexBuf.size() * sizeof(utils::VideoVertex)));
+			// draw call
+			RenderCommand::drawData(g_data->drawVideo, g_data->video.indexCount);
+			g_data->stats.drawCalls++;
+		}
+		if (g_data->circle.indexCount > 0) {
+			g_data->drawCircle->setVertexData(
+					g_data->circle.vertexBuf.data(),
+					static_cast<uint32_t>(g_data->circle.vertexBuf.size() * sizeof(utils::CircleVertex)));
+			// draw call
+			RenderCommand::drawData(g_data->drawCircle, g_data->circle.indexCount);
+			g_data->stats.drawCalls++;
+		}
+		if (g_data->line.indexCount > 0) {
+			g_data->drawLine->setVertexData(
+					g_data->line.vertexBuf.data(),
+					static_cast<uint32_t>(g_data->line.vertexBuf.size() * sizeof(utils::LineVertex)));
+			// draw call
+			RenderCommand::drawLine(g_data->drawLine, g_data->line.indexCount);
+			g_data->stats.drawCalls++;
+		}
+		if (g_data->text.indexCount > 0) {
+			g_data->drawText->setVertexData(
+					g_data->text.vertexBuf.data(),
+					static_cast<uint32_t>(g_data->text.vertexBuf.size() * sizeof(utils::TextVertex)));
+			// draw call
+			RenderCommand::drawData(g_data->drawText, g_data->text.indexCount);
+			g_data->stats.drawCalls++;
+		}
 	}
 	RenderCommand::endBatch();
 }
 
 void Renderer2D::startBatch() {
 	utils::resetDrawData(g_data->quad);
+	utils::resetDrawData(g_data->video);
 	utils::resetDrawData(g_data->circle);
 	utils::resetDrawData(g_data->line);
 	utils::resetDrawData(g_data->text);
@@ -374,6 +480,10 @@ void Renderer2D::drawCircle(const CircleData& iCircleData) {
 
 void Renderer2D::drawQuad(const Quad2DData& iQuadData) {
 	OWL_PROFILE_FUNCTION()
+	if (iQuadData.yuvLayout != YuvLayout::None && iQuadData.texture != nullptr) {
+		drawVideoQuad(iQuadData);
+		return;
+	}
 	if (g_data->quad.indexCount >= utils::g_maxIndices)
 		nextBatch();
 	float textureIndex = 0.0f;
@@ -410,74 +520,22 @@ void Renderer2D::drawString(const StringData& iStringData) {
 		OWL_CORE_ERROR("Renderer2D::drawString: Font not set")
 		return;
 	}
+	auto& layout = iStringData.layout != nullptr ? *iStringData.layout : g_data->textLayout;
+	layout.update(iStringData.font, iStringData.text, iStringData.kerning, iStringData.lineSpacing);
 
-	// Manage texture
-	const shared<Texture2D> fontAtlas = iStringData.font->getAtlasTexture();
+	const math::mat4 transform = iStringData.transform();
+	// the glyphs may be spread on several atlas pages.
+	std::optional<uint32_t> currentPage;
 	float textureIndex = 0.0f;
-	for (uint32_t i = 1; i < g_data->textureSlotIndex; i++) {
-		if (*g_data->textureSlots[i] == *fontAtlas) {
-			textureIndex = static_cast<float>(i);
-			break;
-		}
-	}
-	if (textureIndex == 0.0f) {
-		if (g_data->textureSlotIndex >= utils::g_MaxTextureSlots)
-			nextBatch();
-		textureIndex = static_cast<float>(g_data->textureSlotIndex);
-		g_data->textureSlots[g_data->textureSlotIndex] = fontAtlas;
-		g_data->textureSlotIndex++;
-	}
-	// compute extent.
-	math::box2f extents;
-	{
-		math::vec2 cursor{0.f, 0.f};
-		for (size_t i = 0; i < iStringData.text.size(); i++) {
-			char character = iStringData.text[i];
-			if (isascii(character) == 0)
-				character = '?';
-			if (character == '\r')
-				continue;
-			if (character == '\n') {
-				cursor.x() = 0;
-				cursor.y() -= iStringData.font->getScaledLineHeight() + iStringData.lineSpacing;
-				continue;
-			}
-			auto [quad, uv] = iStringData.font->getGlyphBox(character);
-			quad.translate(cursor);
-			extents.update(quad);
-			if (i < iStringData.text.size() - 1) {
-				char next = iStringData.text[i + 1];
-				if (isascii(next) == 0)
-					next = '?';
-				cursor.x() += iStringData.font->getAdvance(character, next) + iStringData.kerning;
-			}
+	for (const auto& [quad, uv, page]: layout.getGlyphs()) {
+		if (currentPage != page) {
+			textureIndex = textureSlot(iStringData.font->getAtlasTexture(page));
+			currentPage = page;
 		}
-	}
-	// compute offset and scale to fit the 2D quad -1,1
-	math::vec2 scale = extents.diagonal();
-	scale.x() = 1.f / scale.x();
-	scale.y() = 1.f / scale.y();
-	const math::vec2 offset = -extents.min() - 0.5f * extents.diagonal();
-	math::vec2 cursor{0.f, 0.f};
-	for (size_t i = 0; i < iStringData.text.size(); i++) {
-		char character = iStringData.text[i];
-		if (isascii(character) == 0)
-			character = '?';
-		if (character == '\r')
-			continue;
-		if (character == '\n') {
-			cursor.x() = 0;
-			cursor.y() -= iStringData.font->getScaledLineHeight() + iStringData.lineSpacing;
-			continue;
-		}
-		auto [quad, uv] = iStringData.font->getGlyphBox(character);
-		quad.translate(cursor + offset);
-		quad.scale(scale);
-		// render here
-		const math::vec3 p1 = iStringData.transform() * math::vec4(quad.min().x(), quad.min().y(), 0, 1.f);
-		const math::vec3 p2 = iStringData.transform() * math::vec4(quad.min().x(), quad.max().y(), 0, 1.f);
-		const math::vec3 p3 = iStringData.transform() * math::vec4(quad.max().x(), quad.max().y(), 0, 1.f);
-		const math::vec3 p4 = iStringData.transform() * math::vec4(quad.max().x(), quad.min().y(), 0, 1.f);
+		const math::vec3 p1 = transform * math::vec4(quad.min().x(), quad.min().y(), 0, 1.f);
+		const math::vec3 p2 = transform * math::vec4(quad.min().x(), quad.max().y(), 0, 1.f);
+		const math::vec3 p3 = transform * math::vec4(quad.max().x(), quad.max().y(), 0, 1.f);
+		const math::vec3 p4 = transform * math::vec4(quad.max().x(), quad.min().y(), 0, 1.f);
 		g_data->text.vertexBuf.emplace_back(utils::TextVertex{.position = p1,
 															  .color = iStringData.color,
 															  .texCoord = uv.min(),
@@ -500,12 +558,6 @@ void Renderer2D::drawString(const StringData& iStringData) {
 															  .entityId = iStringData.entityId});
 		g_data->stats.quadCount++;
 		g_data->text.indexCount += 6;
-		if (i < iStringData.text.size() - 1) {
-			char next = iStringData.text[i + 1];
-			if (isascii(next) == 0)
-				next = '?';
-			cursor.x() += iStringData.font->getAdvance(character, next) + iStringData.kerning;
-		}
 	}
 }
 
@@ -12,7 +12,7 @@
 #include "CameraEditor.h"
 #include "CameraOrtho.h"
 #include "Texture.h"
-#include "fonts/Font.h"
+#include "fonts/TextLayout.h"
 #include "math/Transform.h"
 #include "scene/component/SpriteRenderer.h"
 
@@ -33,6 +33,10 @@ struct OWL_API Quad2DData {
 	float tilingFactor = 1.f;
 	/// unique ID for the entity.
 	int entityId = -1;
+	/// Layout of a texture holding a raw video frame, converted to RGB by the shader (tiling is ignored).
+	YuvLayout yuvLayout = YuvLayout::None;
+	/// The chroma plane of a NV12 video frame.
+	shared<Texture> chromaTexture = nullptr;
 };
 
 /**
@@ -99,8 +103,8 @@ struct OWL_API PolyLineData {
 struct OWL_API StringData {
 	/// Transformation of the render.
 	math::Transform transform;
-	/// Test to render
-	std::string text;
+	/// Text to render in UTF-8, not copied: must outlive the draw call.
+	std::string_view text;
 	/// font to use (or default one)
 	shared<fonts::Font> font = nullptr;
 	/// Color to render.
@@ -111,6 +115,8 @@ struct OWL_API StringData {
 	float lineSpacing = 0.f;
 	/// unique ID for the entity.
 	int entityId = -1;
+	/// Layout kept between the draws, nullptr to compute the layout at each draw.
+	fonts::TextLayout* layout = nullptr;
 };
 
 /**
@@ -134,6 +140,13 @@ public:
 	 */
 	static void init();
 
+	/**
+	 * @brief Compile the shaders of the renderer into the shader cache.
+	 *
+	 * Does not need the graphic context, so it can be called from a worker thread before init().
+	 */
+	static void precompileShaders();
+
 	/**
 	 * @brief Terminate the renderer.
 	 */
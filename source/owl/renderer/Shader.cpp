@@ -14,6 +14,7 @@
 #include "opengl/Shader.h"
 #include "vulkan/Shader.h"
 
+#include "core/utils/FileUtils.h"
 #include "utils/shaderFileUtils.h"
 
 #include <magic_enum/magic_enum.hpp>
@@ -96,6 +97,37 @@ auto Shader::create(const std::filesystem::path& iFile) -> shared<Shader> {
 	return shader;
 }
 
+void Shader::precompile(const std::vector<Specification>& iShaders) {
+	OWL_PROFILE_FUNCTION()
+
+	const auto api = RenderCommand::getApi();
+	if (!RenderCommand::requireInit() || api == RenderAPI::Type::Null)
+		return;
+	const std::string apiName = api == RenderAPI::Type::OpenGL ? "opengl" : "vulkan";
+	std::vector<utils::ShaderCompileJob> jobs;
+	for (const auto& [shaderName]: iShaders) {
+		const auto vertex = Renderer::getTextureLibrary().find(
+				fmt::format("shaders/{}/{}/{}.vert", shaderName.renderer, apiName, shaderName.name));
+		if (!vertex.has_value())
+			continue;
+		std::unordered_map<ShaderType, std::string> sources;
+		for (const auto& f: std::filesystem::directory_iterator(vertex.value().parent_path())) {
+			if (f.path().stem() != shaderName.name)
+				continue;
+			if (f.path().extension() == ".vert")
+				sources.emplace(ShaderType::Vertex, core::utils::fileToString(f.path()));
+			else if (f.path().extension() == ".frag")
+				sources.emplace(ShaderType::Fragment, core::utils::fileToString(f.path()));
+		}
+		auto shaderJobs = api == RenderAPI::Type::OpenGL
+								  ? opengl::Shader::getOpenGlCompileJobs(opengl::Shader::getVulkanCompileJobs(
+											shaderName.name, shaderName.renderer, sources))
+								  : vulkan::Shader::getCompileJobs(shaderName.name, shaderName.renderer, sources);
+		std::ranges::move(shaderJobs, std::back_inserter(jobs));
+	}
+	utils::ShaderCache::get().getOrCompile(jobs);
+}
+
 Shader::~Shader() = default;
 
 auto Shader::decomposeName(const std::string& iFullName) -> ShaderName {
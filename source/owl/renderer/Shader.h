@@ -89,6 +89,14 @@ public:
 	 */
 	static auto create(const std::filesystem::path& iFile) -> shared<Shader>;
 
+	/**
+	 * @brief Compile concurrently the stages of several shaders that are not in the shader cache.
+	 * @param[in] iShaders The shaders to prepare.
+	 *
+	 * The creation of these shaders then only reads the binaries from the cache.
+	 */
+	static void precompile(const std::vector<Specification>& iShaders);
+
 	/**
 	 * @brief Set shader's internal int variable.
 	 * @param[in] iName Shader's variable's name.
@@ -13,6 +13,7 @@
 #include "core/Application.h"
 #include "null/Texture.h"
 #include "opengl/Texture.h"
+#include "utils/TextureCooker.h"
 #include "vulkan/Texture.h"
 
 namespace owl::renderer {
@@ -59,6 +60,8 @@ auto Texture::Specification::getPixelSize() const -> uint8_t {
 			return 4;
 		case ImageFormat::R8:
 			return 1;
+		case ImageFormat::RG8:
+			return 2;
 		case ImageFormat::RGBA32F:
 			return 16;
 		case ImageFormat::None:
@@ -67,27 +70,49 @@ auto Texture::Specification::getPixelSize() const -> uint8_t {
 	return 0;
 }
 
+auto Texture::Specification::getMemorySize() const -> size_t {
+	size_t memory = 0;
+	uint32_t width = size.x();
+	uint32_t height = size.y();
+	while (width > 0 && height > 0) {
+		memory += static_cast<size_t>(width) * height * getPixelSize();
+		if (!generateMips || (width == 1 && height == 1))
+			break;
+		width = std::max(width >> 1u, 1u);
+		height = std::max(height >> 1u, 1u);
+	}
+	return memory;
+}
+
 Texture2D::Texture2D(std::filesystem::path iPath) : Texture{std::move(iPath)} {}
 
 Texture2D::Texture2D(const Specification& iSpecs) : Texture{iSpecs} {}
 
 auto Texture2D::create(const std::filesystem::path& iFile) -> shared<Texture2D> {
+	auto file = iFile;
+	if (file.extension() == utils::getCookedExtension()) {
+		// a source image modified after the cooking wins over the stale cooked file.
+		if (const auto source = utils::findNewerSource(file); source.has_value()) {
+			OWL_CORE_INFO("Texture: {} is older than its source, loading {}.", file.string(), source->string())
+			file = source.value();
+		}
+	}
 	switch (RenderCommand::getApi()) {
 		case RenderAPI::Type::Null:
 			{
-				if (auto texture = mkShared<null::Texture2D>(iFile); texture->isLoaded())// No data
+				if (auto texture = mkShared<null::Texture2D>(file); texture->isLoaded())// No data
 					return texture;
 				return nullptr;
 			}
 		case RenderAPI::Type::OpenGL:
 			{
-				if (auto texture = mkShared<opengl::Texture2D>(iFile); texture->isLoaded())// No data
+				if (auto texture = mkShared<opengl::Texture2D>(file); texture->isLoaded())// No data
 					return texture;
 				return nullptr;
 			}
 		case RenderAPI::Type::Vulkan:
 			{
-				if (auto texture = mkShared<vulkan::Texture2D>(iFile); texture->isLoaded())// No data
+				if (auto texture = mkShared<vulkan::Texture2D>(file); texture->isLoaded())// No data
 					return texture;
 				return nullptr;
 			}
@@ -24,6 +24,16 @@ enum struct ImageFormat : uint8_t {
 	RGB8,///< Three 8bits-channels.
 	RGBA8,///< Four 8bits-channels.
 	RGBA32F,///< Four float channels.
+	RG8,///< Two 8bits-channels.
+};
+
+/**
+ * @brief Layout of the raw video frames, converted to RGB while drawing.
+ */
+enum struct YuvLayout : uint8_t {
+	None,///< RGB pixels, no conversion.
+	Nv12,///< Luma plane in R8 and half size interleaved chroma plane in RG8.
+	YuYv,///< Luma and alternated U and V chroma in RG8.
 };
 
 class TextureLibrary;
@@ -70,6 +80,11 @@ public:
 		 * @return Pixel's data size..
 		 */
 		[[nodiscard]] auto getPixelSize() const -> uint8_t;
+		/**
+		 * @brief Compute the memory footprint of a texture with these specifications.
+		 * @return Memory size in bytes, including the mip chain.
+		 */
+		[[nodiscard]] auto getMemorySize() const -> size_t;
 	};
 	/**
 	 * @brief Constructor by specifications.
@@ -120,6 +135,16 @@ public:
 	 */
 	virtual void setData(void* iData, uint32_t iSize) = 0;
 
+	/**
+	 * @brief Define the data of a region of the texture.
+	 * @param[in] iData Raw data of the region, rows without padding.
+	 * @param[in] iOffset Position of the region in pixels.
+	 * @param[in] iSize Size of the region in pixels.
+	 *
+	 * The mip levels are not updated.
+	 */
+	virtual void setSubData(const void* iData, const math::vec2ui& iOffset, const math::vec2ui& iSize) = 0;
+
 	/**
 	 * @brief Get access to the texture's name.
 	 * @return The texture's name.
@@ -138,6 +163,12 @@ public:
 	 */
 	[[nodiscard]] auto getSpecification() const -> const Specification& { return m_specification; }
 
+	/**
+	 * @brief Get the memory footprint of the texture.
+	 * @return Memory size in bytes.
+	 */
+	[[nodiscard]] auto getMemorySize() const -> size_t { return m_specification.getMemorySize(); }
+
 protected:
 	/// Eventually the specifications.
 	Specification m_specification;
@@ -191,9 +222,11 @@ public:
 
 	/**
 	 * @brief Get the possible file extension for this dataset.
+	 *
+	 * Cooked textures come first, so they are preferred over their source image.
 	 * @return The datasets possible extension.
 	 */
-	static auto extension() -> std::vector<std::string> { return {".jpg", ".png"}; }
+	static auto extension() -> std::vector<std::string> { return {".otex", ".jpg", ".png"}; }
 };
 OWL_DIAG_POP
 
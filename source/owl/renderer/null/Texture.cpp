@@ -8,10 +8,16 @@
 #include "owlpch.h"
 
 #include "Texture.h"
+#include "renderer/utils/TextureCooker.h"
 
 namespace owl::renderer::null {
 
 Texture2D::Texture2D(std::filesystem::path iPath) : renderer::Texture2D{std::move(iPath)} {
+	if (m_path.extension() == utils::getCookedExtension()) {
+		if (const auto image = utils::readCookedImage(m_path, true); image.has_value())
+			m_specification = image->specification;
+		return;
+	}
 	if (exists(m_path))
 		m_specification.size = {1, 1};
 }
@@ -24,4 +30,6 @@ void Texture2D::bind(uint32_t) const {}
 
 void Texture2D::setData(void*, uint32_t) {}
 
+void Texture2D::setSubData(const void*, const math::vec2ui&, const math::vec2ui&) {}
+
 }// namespace owl::renderer::null
@@ -36,6 +36,13 @@ namespace {
 }
 }// namespace
 
+RenderAPI::~RenderAPI() {
+	for (auto& frame: m_gpuFrames) {
+		if (!frame.queries.empty())
+			glDeleteQueries(static_cast<int32_t>(frame.queries.size()), frame.queries.data());
+	}
+}
+
 void RenderAPI::init() {
 	OWL_PROFILE_FUNCTION()
 
@@ -62,6 +69,16 @@ void RenderAPI::init() {
 	glEnable(GL_DEPTH_TEST);
 	glEnable(GL_LINE_SMOOTH);
 
+	int32_t timestampBits = 0;
+	glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &timestampBits);
+	m_gpuTimers = timestampBits > 0;
+	if (m_gpuTimers) {
+		for (auto& frame: m_gpuFrames) {
+			frame.queries.resize(utils::g_gpuQueriesPerFrame);
+			glGenQueries(static_cast<int32_t>(frame.queries.size()), frame.queries.data());
+		}
+	}
+
 	// renderer is now ready
 	setState(State::Ready);
 }
@@ -96,4 +113,52 @@ auto RenderAPI::getMaxTextureSlots() const -> uint32_t {
 	return std::min(32u, static_cast<uint32_t>(textureUnits));
 }
 
+void RenderAPI::beginFrame() {
+	if (!m_gpuTimers)
+		return;
+	m_gpuFrameIndex = (m_gpuFrameIndex + 1) % utils::g_gpuTimingLatency;
+	collectGpuFrame(m_gpuFrames[m_gpuFrameIndex]);
+}
+
+void RenderAPI::beginGpuScope(const uint32_t iNameId) {
+	if (!m_gpuTimers)
+		return;
+	auto& frame = m_gpuFrames[m_gpuFrameIndex];
+	if (const auto query = frame.recorder.begin(iNameId, true); query.has_value())
+		glQueryCounter(frame.queries[query.value()], GL_TIMESTAMP);
+}
+
+void RenderAPI::endGpuScope() {
+	if (!m_gpuTimers)
+		return;
+	auto& frame = m_gpuFrames[m_gpuFrameIndex];
+	if (const auto query = frame.recorder.end(true); query.has_value())
+		glQueryCounter(frame.queries[query.value()], GL_TIMESTAMP);
+}
+
+void RenderAPI::collectGpuFrame(GpuFrame& ioFrame) {
+	const uint32_t scopeCount = ioFrame.recorder.getQueryCount() / 2;
+	std::optional<uint32_t> lastScope;
+	for (uint32_t i = 0; i < scopeCount; ++i) {
+		if (ioFrame.recorder.isComplete(i))
+			lastScope = i;
+	}
+	if (lastScope.has_value()) {
+		// the timestamps are written in order: the last one being available means all are.
+		int32_t available = GL_FALSE;
+		glGetQueryObjectiv(ioFrame.queries[2 * lastScope.value() + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (available == GL_TRUE) {
+			std::vector<uint64_t> timestamps(2 * scopeCount, 0);
+			for (uint32_t i = 0; i < scopeCount; ++i) {
+				if (!ioFrame.recorder.isComplete(i))
+					continue;
+				glGetQueryObjectui64v(ioFrame.queries[2 * i], GL_QUERY_RESULT, &timestamps[2 * i]);
+				glGetQueryObjectui64v(ioFrame.queries[2 * i + 1], GL_QUERY_RESULT, &timestamps[2 * i + 1]);
+			}
+			ioFrame.recorder.publish(timestamps);
+		}
+	}
+	ioFrame.recorder.reset();
+}
+
 }// namespace owl::renderer::opengl
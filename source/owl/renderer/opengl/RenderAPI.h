@@ -9,6 +9,7 @@
 #pragma once
 
 #include "../RenderAPI.h"
+#include "../utils/GpuScopeRecorder.h"
 
 /**
  * @brief Namespace for opengl specific rendering objects.
@@ -28,7 +29,7 @@ public:
 	/**
 	 * @brief Destructor.
 	 */
-	~RenderAPI() override = default;
+	~RenderAPI() override;
 
 	/**
 	 * @brief Initialize the renderer.
@@ -74,5 +75,51 @@ public:
 	 * @return Number of texture slots.
 	 */
 	[[nodiscard]] auto getMaxTextureSlots() const -> uint32_t override;
+
+	/**
+	 * @brief Reset value for the frame to render.
+	 */
+	void beginFrame() override;
+
+	/**
+	 * @brief Start a scope timed on the GPU.
+	 * @param[in] iNameId Interned name of the scope.
+	 */
+	void beginGpuScope(uint32_t iNameId) override;
+
+	/**
+	 * @brief End the innermost scope timed on the GPU.
+	 */
+	void endGpuScope() override;
+
+	/**
+	 * @brief Check if the API is able to time the GPU scopes.
+	 * @return True if GPU timers are supported.
+	 */
+	[[nodiscard]] auto hasGpuTimers() const -> bool override { return m_gpuTimers; }
+
+private:
+	/**
+	 * @brief Timestamp queries of a frame.
+	 */
+	struct GpuFrame {
+		/// The query objects.
+		std::vector<uint32_t> queries;
+		/// The scopes using the queries.
+		utils::GpuScopeRecorder recorder;
+	};
+
+	/**
+	 * @brief Read back the timestamps of a frame if the GPU wrote them, without waiting.
+	 * @param[in,out] ioFrame The frame to read, its queries are free after the call.
+	 */
+	static void collectGpuFrame(GpuFrame& ioFrame);
+
+	/// The frames waiting for their timestamps.
+	std::array<GpuFrame, utils::g_gpuTimingLatency> m_gpuFrames;
+	/// Index of the frame being recorded.
+	uint32_t m_gpuFrameIndex = 0;
+	/// If the timestamp queries are supported.
+	bool m_gpuTimers = false;
 };
 }// namespace owl::renderer::opengl
@@ -12,6 +12,7 @@
 #include "core/external/opengl46.h"
 #include "core/external/shaderc.h"
 #include "core/utils/FileUtils.h"
+#include "core/utils/HashUtils.h"
 #include "renderer/utils/shaderFileUtils.h"
 
 namespace owl::renderer::opengl {
@@ -34,6 +35,40 @@ auto shaderStageToGlShader(const ShaderType& iStage) -> uint32_t {
 	OWL_CORE_ASSERT(false, "Unsupported Shader Type")
 	return 0;
 }
+
+/// Tag of the program binaries in the cache keys.
+constexpr uint64_t g_programBinaryTag{0x70726f6772616dull};
+
+auto supportProgramBinary() -> bool {
+	static const bool support = [] {
+		GLint formats = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+		return formats > 0;
+	}();
+	return support;
+}
+
+auto getDriverHash() -> uint64_t {
+	static const uint64_t hash = [] {
+		uint64_t result = core::utils::g_hashSeed;
+		for (const GLenum name: {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+			if (const auto* str = glGetString(name); str != nullptr)
+				result = core::utils::hashString(reinterpret_cast<const char*>(str), result);
+		}
+		return result;
+	}();
+	return hash;
+}
+
+auto getProgramKey(const std::vector<renderer::utils::ShaderCompileJob>& iJobs) -> uint64_t {
+	std::vector<uint64_t> keys;
+	keys.reserve(iJobs.size());
+	for (const auto& job: iJobs) keys.push_back(job.key);
+	std::ranges::sort(keys);
+	uint64_t key = core::utils::hashCombine(getDriverHash(), g_programBinaryTag);
+	for (const uint64_t jobKey: keys) key = core::utils::hashCombine(key, jobKey);
+	return key;
+}
 }// namespace
 
 }// namespace utils
@@ -83,12 +118,14 @@ void Shader::compile(const std::unordered_map<ShaderType, std::string>& iSources
 
 	const auto start = std::chrono::steady_clock::now();
 
-	// todo: direct check for openGL binaries...
-	renderer::utils::createCacheDirectoryIfNeeded(getRenderer(), "opengl_vulkan");
-	compileOrGetVulkanBinaries(iSources);
-	renderer::utils::createCacheDirectoryIfNeeded(getRenderer(), "opengl");
-	compileOrGetOpenGlBinaries();
-	createProgram();
+	const auto vulkanJobs = getVulkanCompileJobs(getName(), getRenderer(), iSources);
+	const auto openGlJobs = getOpenGlCompileJobs(vulkanJobs);
+	const uint64_t programKey = utils::getProgramKey(openGlJobs);
+	if (!loadProgramBinary(programKey)) {
+		compileOrGetBinaries(vulkanJobs, openGlJobs);
+		createProgram();
+		saveProgramBinary(programKey);
+	}
 
 	const auto timer = std::chrono::steady_clock::now() - start;
 	double duration =
@@ -96,86 +133,71 @@ void Shader::compile(const std::unordered_map<ShaderType, std::string>& iSources
 	OWL_CORE_INFO("Compilation of shader {} in {} ms", getName(), duration)
 }
 
-void Shader::compileOrGetVulkanBinaries(const std::unordered_map<ShaderType, std::string>& iSources) {
+void Shader::compileOrGetBinaries(const std::vector<renderer::utils::ShaderCompileJob>& iVulkanJobs,
+								  const std::vector<renderer::utils::ShaderCompileJob>& iOpenGlJobs) {
 	OWL_PROFILE_FUNCTION()
 
-	shaderc::CompileOptions options;
-	options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_2);
-	options.SetOptimizationLevel(shaderc_optimization_level_performance);
-
-	auto& shaderData = m_vulkanSpirv;
-	shaderData.clear();
-	for (auto&& [stage, source]: iSources) {
-		const std::filesystem::path basePath =
-				renderer::utils::getShaderPath(getName(), getRenderer(), "opengl", stage);
-		const std::filesystem::path cachedPath =
-				renderer::utils::getShaderCachedPath(getName(), getRenderer(), "opengl_vulkan", stage);
-
-		if (exists(cachedPath) && (last_write_time(cachedPath) > last_write_time(basePath))) {
-			// Cache exists: read it
-			OWL_CORE_INFO("Using cached Vulkan Shader {}-{}", getName(), magic_enum::enum_name(stage))
-			shaderData[stage] = renderer::utils::readCachedShader(cachedPath);
-		} else {
-			if (exists(cachedPath))
-				OWL_CORE_INFO("Origin file newer than cached one, Recompiling.")
-			const shaderc::Compiler compiler;
-			const shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(
-					source, renderer::utils::shaderStageToShaderC(stage),
-					renderer::utils::getShaderPath(getName(), getRenderer(), "opengl", stage).string().c_str(),
-					options);
-			if (module.GetCompilationStatus() != shaderc_compilation_status_success) {
-				OWL_CORE_ERROR(module.GetErrorMessage())
-				OWL_CORE_ASSERT(false, "Failed Compilation")
-			}
-			shaderData[stage] = std::vector<uint32_t>(module.cbegin(), module.cend());
-			renderer::utils::writeCachedShader(cachedPath, shaderData[stage]);
+	auto& cache = renderer::utils::ShaderCache::get();
+	// The OpenGL jobs resolve the Vulkan ones on cache miss, so everything is compiled concurrently.
+	auto openGlBinaries = cache.getOrCompile(iOpenGlJobs);
+	auto vulkanBinaries = cache.getOrCompile(iVulkanJobs);
+	m_vulkanSpirv.clear();
+	m_openGlSpirv.clear();
+	for (size_t i = 0; i < iVulkanJobs.size(); ++i) {
+		if (vulkanBinaries[i].empty() || openGlBinaries[i].empty()) {
+			OWL_CORE_ASSERT(false, "Failed Compilation")
+			continue;
 		}
+		m_vulkanSpirv[iVulkanJobs[i].stage] = std::move(vulkanBinaries[i]);
+		m_openGlSpirv[iOpenGlJobs[i].stage] = std::move(openGlBinaries[i]);
 	}
-	for (auto&& [stage, data]: shaderData)
+	for (auto&& [stage, data]: m_vulkanSpirv)
 		renderer::utils::shaderReflect(getName(), getRenderer(), "opengl", stage, data);
 }
 
-void Shader::compileOrGetOpenGlBinaries() {
-	OWL_PROFILE_FUNCTION()
+auto Shader::getVulkanCompileJobs(const std::string& iShaderName, const std::string& iRenderer,
+								  const std::unordered_map<ShaderType, std::string>& iSources)
+		-> std::vector<renderer::utils::ShaderCompileJob> {
+	constexpr renderer::utils::ShaderCompileOptions options{.targetEnv = shaderc_target_env_vulkan,
+															.envVersion = shaderc_env_version_vulkan_1_2,
+															.optimize = true};
+	std::vector<renderer::utils::ShaderCompileJob> jobs;
+	for (auto&& [stage, source]: iSources) {
+		auto file = renderer::utils::getShaderPath(iShaderName, iRenderer, "opengl", stage).string();
+		jobs.push_back({.key = renderer::utils::computeShaderKey(source, stage, options),
+						.stage = stage,
+						.name = fmt::format("{}/{}-{}", iRenderer, iShaderName, magic_enum::enum_name(stage)),
+						.compile = [source, stage, file, options] {
+							return renderer::utils::compileGlslToSpirv(source, stage, file, options);
+						}});
+	}
+	return jobs;
+}
 
-	auto& shaderData = m_openGlSpirv;
-
-	shaderc::CompileOptions options;
-	options.SetTargetEnvironment(shaderc_target_env_opengl, shaderc_env_version_opengl_4_5);
-	options.SetOptimizationLevel(shaderc_optimization_level_performance);
-
-	shaderData.clear();
-	m_openGlSource.clear();
-	for (auto&& [stage, spirv]: m_vulkanSpirv) {
-		const std::filesystem::path basePath =
-				renderer::utils::getShaderCachedPath(getName(), getRenderer(), "opengl_vulkan", stage);
-		const std::filesystem::path cachedPath =
-				renderer::utils::getShaderCachedPath(getName(), getRenderer(), "opengl", stage);
-		if (exists(cachedPath) && (last_write_time(cachedPath) > last_write_time(basePath))) {
-			OWL_CORE_INFO("Using cached OpenGL Shader {}-{}", getName(), magic_enum::enum_name(stage))
-			shaderData[stage] = renderer::utils::readCachedShader(cachedPath);
-		} else {
-			if (exists(cachedPath))
-				OWL_CORE_INFO("Origin file newer than cached one, Recompiling.")
-			spirv_cross::CompilerGLSL glslCompiler(spirv);
-			m_openGlSource[stage] = glslCompiler.compile();
-			auto& source = m_openGlSource[stage];
-			const shaderc::Compiler compiler;
-			const shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(
-					source, renderer::utils::shaderStageToShaderC(stage),
-					renderer::utils::getShaderPath(getName(), getRenderer(), "opengl", stage).string().c_str());
-			if (module.GetCompilationStatus() != shaderc_compilation_status_success) {
-				OWL_CORE_ERROR(module.GetErrorMessage())
-				OWL_CORE_ASSERT(false, "Compilation error")
-			}
-			shaderData[stage] = std::vector<uint32_t>(module.cbegin(), module.cend());
-			renderer::utils::writeCachedShader(cachedPath, shaderData[stage]);
-		}
+auto Shader::getOpenGlCompileJobs(const std::vector<renderer::utils::ShaderCompileJob>& iVulkanJobs)
+		-> std::vector<renderer::utils::ShaderCompileJob> {
+	constexpr renderer::utils::ShaderCompileOptions options{};
+	std::vector<renderer::utils::ShaderCompileJob> jobs;
+	for (const auto& vulkanJob: iVulkanJobs) {
+		jobs.push_back({.key = renderer::utils::combineShaderKey(vulkanJob.key, vulkanJob.stage, options),
+						.stage = vulkanJob.stage,
+						.name = fmt::format("{} (OpenGL)", vulkanJob.name),
+						.compile = [vulkanJob, options]() -> std::optional<std::vector<uint32_t>> {
+							const auto spirv = renderer::utils::ShaderCache::get().getOrCompile(vulkanJob);
+							if (spirv.empty())
+								return std::nullopt;
+							spirv_cross::CompilerGLSL glslCompiler(spirv);
+							return renderer::utils::compileGlslToSpirv(glslCompiler.compile(), vulkanJob.stage,
+																	   vulkanJob.name, options);
+						}});
 	}
+	return jobs;
 }
 
 void Shader::createProgram() {
 	const GLuint program = glCreateProgram();
+	if (utils::supportProgramBinary())
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 
 	// list of shader's id
 	std::vector<GLuint> shaderIDs;
@@ -211,6 +233,47 @@ void Shader::createProgram() {
 	m_programId = program;
 }
 
+auto Shader::loadProgramBinary(const uint64_t iKey) -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	if (!utils::supportProgramBinary())
+		return false;
+	const auto data = renderer::utils::ShaderCache::get().find(iKey);
+	// layout: binary format, binary size in bytes, then the binary padded to 32 bits.
+	if (!data.has_value() || data->size() < 2 || (data->size() - 2) * sizeof(uint32_t) < data->at(1))
+		return false;
+	const GLuint program = glCreateProgram();
+	glProgramBinary(program, data->at(0), std::span(data.value()).subspan(2).data(), static_cast<GLsizei>(data->at(1)));
+	GLint isLinked = 0;
+	glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+	if (isLinked == GL_FALSE) {
+		// the driver may reject binaries after an update.
+		OWL_CORE_INFO("Program binary of shader {} rejected by the driver, recompiling.", getName())
+		glDeleteProgram(program);
+		return false;
+	}
+	OWL_CORE_INFO("Using cached program binary for shader {}", getName())
+	m_programId = program;
+	return true;
+}
+
+void Shader::saveProgramBinary(const uint64_t iKey) const {
+	OWL_PROFILE_FUNCTION()
+
+	if (m_programId == 0 || !utils::supportProgramBinary())
+		return;
+	GLint length = 0;
+	glGetProgramiv(m_programId, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+		return;
+	std::vector<uint32_t> data(2 + (static_cast<size_t>(length) + sizeof(uint32_t) - 1) / sizeof(uint32_t));
+	GLenum format = 0;
+	glGetProgramBinary(m_programId, length, nullptr, &format, std::span(data).subspan(2).data());
+	data[0] = format;
+	data[1] = static_cast<uint32_t>(length);
+	renderer::utils::ShaderCache::get().store(iKey, std::move(data));
+}
+
 void Shader::bind() const {
 	OWL_PROFILE_FUNCTION()
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "../Shader.h"
+#include "../utils/ShaderCache.h"
 
 namespace owl::renderer::opengl {
 /**
@@ -171,6 +172,25 @@ public:
 	 */
 	void uploadUniformFloat4(const std::string& iName, const math::vec4& iValue) const;
 
+	/**
+	 * @brief Build the jobs compiling the shader's stages to Vulkan flavored SPIR-V.
+	 * @param[in] iShaderName Shader's name.
+	 * @param[in] iRenderer Name of the shader's related renderer.
+	 * @param[in] iSources The shader's sources with type.
+	 * @return The jobs to resolve through the shader cache.
+	 */
+	static auto getVulkanCompileJobs(const std::string& iShaderName, const std::string& iRenderer,
+									 const std::unordered_map<ShaderType, std::string>& iSources)
+			-> std::vector<renderer::utils::ShaderCompileJob>;
+
+	/**
+	 * @brief Build the jobs producing the OpenGL SPIR-V from the Vulkan flavored one.
+	 * @param[in] iVulkanJobs The jobs giving the Vulkan flavored SPIR-V.
+	 * @return The jobs to resolve through the shader cache.
+	 */
+	static auto getOpenGlCompileJobs(const std::vector<renderer::utils::ShaderCompileJob>& iVulkanJobs)
+			-> std::vector<renderer::utils::ShaderCompileJob>;
+
 private:
 	/// Id of the shader in the GPU.
 	uint32_t m_programId = 0;
@@ -181,12 +201,24 @@ private:
 	 */
 	void compile(const std::unordered_map<ShaderType, std::string>& iSources);
 
-	void compileOrGetVulkanBinaries(const std::unordered_map<ShaderType, std::string>& iSources);
-	void compileOrGetOpenGlBinaries();
+	void compileOrGetBinaries(const std::vector<renderer::utils::ShaderCompileJob>& iVulkanJobs,
+							  const std::vector<renderer::utils::ShaderCompileJob>& iOpenGlJobs);
 	void createProgram();
 
+	/**
+	 * @brief Create the program from a cached program binary.
+	 * @param[in] iKey The cache key of the program.
+	 * @return True if the program has been created.
+	 */
+	auto loadProgramBinary(uint64_t iKey) -> bool;
+
+	/**
+	 * @brief Store the binary of the linked program in the cache.
+	 * @param[in] iKey The cache key of the program.
+	 */
+	void saveProgramBinary(uint64_t iKey) const;
+
 	std::unordered_map<ShaderType, std::vector<uint32_t>> m_vulkanSpirv;
 	std::unordered_map<ShaderType, std::vector<uint32_t>> m_openGlSpirv;
-	std::unordered_map<ShaderType, std::string> m_openGlSource;
 };
 }// namespace owl::renderer::opengl
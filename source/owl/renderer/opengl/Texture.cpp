@@ -9,6 +9,8 @@
 
 #include "Texture.h"
 #include "core/external/opengl46.h"
+#include "renderer/utils/TextureCooker.h"
+
 #include <stb_image.h>
 
 namespace owl::renderer::opengl {
@@ -22,6 +24,8 @@ auto glDataFormat(const ImageFormat& iFormat) -> GLenum {
 			return GL_RGB;
 		case ImageFormat::R8:
 			return GL_RED;
+		case ImageFormat::RG8:
+			return GL_RG;
 		case ImageFormat::RGBA32F:
 			return GL_RGBA32F;
 		case ImageFormat::None:
@@ -36,7 +40,9 @@ auto glInternalDataFormat(const ImageFormat& iFormat) -> GLenum {
 		case ImageFormat::RGB8:
 			return GL_RGB8;
 		case ImageFormat::R8:
-			return GL_RED_INTEGER;
+			return GL_R8;
+		case ImageFormat::RG8:
+			return GL_RG8;
 		case ImageFormat::RGBA32F:
 			return GL_RGBA32F;
 		case ImageFormat::None:
@@ -49,6 +55,26 @@ auto glInternalDataFormat(const ImageFormat& iFormat) -> GLenum {
 Texture2D::Texture2D(std::filesystem::path iPath) : renderer::Texture2D{std::move(iPath)} {
 	OWL_PROFILE_FUNCTION()
 
+	if (m_path.extension() == utils::getCookedExtension()) {
+		const auto image = utils::readCookedImage(m_path);
+		if (!image.has_value()) {
+			OWL_CORE_WARN("OpenGL Texture: Failed to load cooked image {}", m_path.string())
+			return;
+		}
+		m_specification = image->specification;
+		createStorage(static_cast<uint32_t>(image->levels.size()));
+		// rows of the small levels or of 1, 2 or 3 bytes pixels are not aligned on 4 bytes.
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		for (uint32_t level = 0; level < image->levels.size(); ++level) {
+			const auto levelSize = utils::getMipLevelSize(m_specification.size, level);
+			glTextureSubImage2D(m_textureId, static_cast<GLint>(level), 0, 0, static_cast<GLsizei>(levelSize.x()),
+								static_cast<GLsizei>(levelSize.y()), glDataFormat(m_specification.format),
+								GL_UNSIGNED_BYTE, image->levels[level].data());
+		}
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		return;
+	}
+
 	int width = 0;
 	int height = 0;
 	int channels = 0;
@@ -71,19 +97,8 @@ Texture2D::Texture2D(std::filesystem::path iPath) : renderer::Texture2D{std::mov
 	m_specification.format = channels == 4 ? ImageFormat::RGBA8 : ImageFormat::RGB8;
 	m_specification.size = {static_cast<uint32_t>(width), static_cast<uint32_t>(height)};
 
-	glCreateTextures(GL_TEXTURE_2D, 1, &m_textureId);
-	glTextureStorage2D(m_textureId, 1, glInternalDataFormat(m_specification.format),
-					   static_cast<GLsizei>(m_specification.size.x()), static_cast<GLsizei>(m_specification.size.y()));
-
-	glTextureParameteri(m_textureId, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTextureParameteri(m_textureId, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-	glTextureParameteri(m_textureId, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTextureParameteri(m_textureId, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-	glTextureSubImage2D(m_textureId, 0, 0, 0, static_cast<GLsizei>(m_specification.size.x()),
-						static_cast<GLsizei>(m_specification.size.y()), glDataFormat(m_specification.format),
-						GL_UNSIGNED_BYTE, data);
+	createStorage(m_specification.generateMips ? utils::getMipLevelCount(m_specification.size) : 1);
+	setData(data, m_specification.size.surface() * static_cast<uint32_t>(channels));
 
 	stbi_image_free(data);
 }
@@ -91,11 +106,16 @@ Texture2D::Texture2D(std::filesystem::path iPath) : renderer::Texture2D{std::mov
 Texture2D::Texture2D(const Specification& iSpecs) : renderer::Texture2D{iSpecs} {
 	OWL_PROFILE_FUNCTION()
 
+	createStorage(m_specification.generateMips ? utils::getMipLevelCount(m_specification.size) : 1);
+}
+
+void Texture2D::createStorage(const uint32_t iLevels) {
+	m_levels = std::max(iLevels, 1u);
 	glCreateTextures(GL_TEXTURE_2D, 1, &m_textureId);
-	glTextureStorage2D(m_textureId, 1, glInternalDataFormat(m_specification.format),
+	glTextureStorage2D(m_textureId, static_cast<GLsizei>(m_levels), glInternalDataFormat(m_specification.format),
 					   static_cast<GLsizei>(m_specification.size.x()), static_cast<GLsizei>(m_specification.size.y()));
 
-	glTextureParameteri(m_textureId, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTextureParameteri(m_textureId, GL_TEXTURE_MIN_FILTER, m_levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
 	glTextureParameteri(m_textureId, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
 	glTextureParameteri(m_textureId, GL_TEXTURE_WRAP_S, GL_REPEAT);
@@ -119,9 +139,28 @@ void Texture2D::setData(void* iData, [[maybe_unused]] const uint32_t iSize) {
 
 	OWL_CORE_ASSERT(iSize == m_specification.size.surface() * m_specification.getPixelSize(),
 					"Data size missmatch texture size!")
+	// rows of 1, 2 or 3 bytes pixels are not aligned on 4 bytes.
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 	glTextureSubImage2D(m_textureId, 0, 0, 0, static_cast<GLsizei>(m_specification.size.x()),
 						static_cast<GLsizei>(m_specification.size.y()), glDataFormat(m_specification.format),
 						GL_UNSIGNED_BYTE, iData);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	if (m_levels > 1)
+		glGenerateTextureMipmap(m_textureId);
+}
+
+void Texture2D::setSubData(const void* iData, const math::vec2ui& iOffset, const math::vec2ui& iSize) {
+	OWL_PROFILE_FUNCTION()
+
+	OWL_CORE_ASSERT(iOffset.x() + iSize.x() <= m_specification.size.x() &&
+							iOffset.y() + iSize.y() <= m_specification.size.y(),
+					"Region outside of the texture!")
+	// rows of 3 bytes pixels are not aligned on 4 bytes.
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTextureSubImage2D(m_textureId, 0, static_cast<GLint>(iOffset.x()), static_cast<GLint>(iOffset.y()),
+						static_cast<GLsizei>(iSize.x()), static_cast<GLsizei>(iSize.y()),
+						glDataFormat(m_specification.format), GL_UNSIGNED_BYTE, iData);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 }
 
 }// namespace owl::renderer::opengl
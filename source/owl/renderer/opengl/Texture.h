@@ -64,8 +64,23 @@ public:
 	 */
 	void setData(void* iData, uint32_t iSize) override;
 
+	/**
+	 * @brief Define the data of a region of the texture.
+	 * @param[in] iData Raw data of the region, rows without padding.
+	 * @param[in] iOffset Position of the region in pixels.
+	 * @param[in] iSize Size of the region in pixels.
+	 */
+	void setSubData(const void* iData, const math::vec2ui& iOffset, const math::vec2ui& iSize) override;
+
 private:
+	/**
+	 * @brief Create the texture object and its storage.
+	 * @param[in] iLevels Number of mip levels to allocate.
+	 */
+	void createStorage(uint32_t iLevels);
 	/// OpenGL binding.
 	uint32_t m_textureId = 0;
+	/// Number of allocated mip levels.
+	uint32_t m_levels = 1;
 };
 }// namespace owl::renderer::opengl
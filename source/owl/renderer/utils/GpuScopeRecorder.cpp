@@ -0,0 +1,80 @@
+/**
+ * @file GpuScopeRecorder.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "GpuScopeRecorder.h"
+
+#include "debug/FrameProfiler.h"
+#include "debug/Profiler.h"
+
+namespace owl::renderer::utils {
+
+void GpuScopeRecorder::reset() {
+	m_scopes.clear();
+	m_open.clear();
+}
+
+auto GpuScopeRecorder::begin(const uint32_t iNameId, const bool iWritable) -> std::optional<uint32_t> {
+	if (!iWritable || m_scopes.size() >= g_maxGpuScopes) {
+		m_open.push_back(-1);
+		return std::nullopt;
+	}
+	const auto index = static_cast<int32_t>(m_scopes.size());
+	m_scopes.push_back({.nameId = iNameId,
+						.depth = static_cast<uint32_t>(m_open.size()),
+						.cpuTicks = debug::ProfileTimer::now(),
+						.complete = false});
+	m_open.push_back(index);
+	return static_cast<uint32_t>(2 * index);
+}
+
+auto GpuScopeRecorder::end(const bool iWritable) -> std::optional<uint32_t> {
+	if (m_open.empty())
+		return std::nullopt;
+	const int32_t index = m_open.back();
+	m_open.pop_back();
+	if (index < 0 || !iWritable)
+		return std::nullopt;
+	m_scopes[static_cast<size_t>(index)].complete = true;
+	return static_cast<uint32_t>(2 * index + 1);
+}
+
+void GpuScopeRecorder::publish(const std::span<const uint64_t> iTimestamps) const {
+	const bool session = debug::Profiler::get().isSessionActive();
+	const double nanosecondsPerTick = session ? debug::Profiler::get().getNanosecondsPerTick() : 1.0;
+	std::vector<debug::ScopeTiming> timings;
+	timings.reserve(m_scopes.size());
+	// the GPU clock is not correlated to the CPU one: the first scope is placed at its recording time.
+	std::optional<std::pair<int64_t, uint64_t>> origin;
+	for (size_t i = 0; i < m_scopes.size() && 2 * i + 1 < iTimestamps.size(); ++i) {
+		const auto& scope = m_scopes[i];
+		const uint64_t start = iTimestamps[2 * i];
+		const uint64_t end = iTimestamps[2 * i + 1];
+		if (!scope.complete || end < start)
+			continue;
+		timings.push_back({.nameId = scope.nameId,
+						   .depth = scope.depth,
+						   .calls = 1,
+						   .duration = static_cast<double>(end - start) / 1e6,
+						   .budget = 0});
+		if (!session)
+			continue;
+		if (!origin.has_value())
+			origin = {scope.cpuTicks, start};
+		const auto toTicks = [&origin, nanosecondsPerTick](const uint64_t iTimestamp) {
+			return origin->first +
+				   static_cast<int64_t>(static_cast<double>(static_cast<int64_t>(iTimestamp - origin->second)) /
+										nanosecondsPerTick);
+		};
+		debug::Profiler::get().recordGpu(scope.nameId, toTicks(start), toTicks(end));
+	}
+	debug::FrameProfiler::setGpuScopes(timings);
+}
+
+}// namespace owl::renderer::utils
@@ -0,0 +1,99 @@
+/**
+ * @file GpuScopeRecorder.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+
+#include <span>
+
+namespace owl::renderer::utils {
+
+/// Number of frames between the recording of the GPU timestamps and their read back.
+constexpr uint32_t g_gpuTimingLatency{3};
+/// Maximal number of GPU scopes in a frame.
+constexpr uint32_t g_maxGpuScopes{64};
+/// Number of timestamp queries needed for a frame.
+constexpr uint32_t g_gpuQueriesPerFrame{2 * g_maxGpuScopes};
+
+/**
+ * @brief The GPU scopes recorded during a frame, API independent part of the GPU timers.
+ *
+ * Scope i uses the timestamp queries 2i (start) and 2i+1 (end) of the frame. The API writes the timestamps, reads
+ * them back a few frames later and gives them to publish().
+ */
+class OWL_API GpuScopeRecorder final {
+public:
+	/**
+	 * @brief Forget the scopes of the previous use.
+	 */
+	void reset();
+
+	/**
+	 * @brief Open a scope.
+	 * @param[in] iNameId Interned name of the scope.
+	 * @param[in] iWritable If the API is able to write the timestamp now.
+	 * @return The query receiving the start timestamp, nullopt if nothing has to be written.
+	 */
+	auto begin(uint32_t iNameId, bool iWritable) -> std::optional<uint32_t>;
+
+	/**
+	 * @brief Close the innermost scope.
+	 * @param[in] iWritable If the API is able to write the timestamp now.
+	 * @return The query receiving the end timestamp, nullopt if nothing has to be written.
+	 */
+	auto end(bool iWritable) -> std::optional<uint32_t>;
+
+	/**
+	 * @brief Check if some timestamps have been written.
+	 * @return True if there are timestamps to read back.
+	 */
+	[[nodiscard]] auto hasTimestamps() const -> bool { return !m_scopes.empty(); }
+
+	/**
+	 * @brief Get the number of queries used.
+	 * @return The number of queries to read back.
+	 */
+	[[nodiscard]] auto getQueryCount() const -> uint32_t { return static_cast<uint32_t>(m_scopes.size()) * 2; }
+
+	/**
+	 * @brief Check if both timestamps of a scope have been written.
+	 * @param[in] iScope Index of the scope (its queries are 2 * iScope and 2 * iScope + 1).
+	 * @return True if the scope can be read back.
+	 */
+	[[nodiscard]] auto isComplete(const uint32_t iScope) const -> bool {
+		return iScope < m_scopes.size() && m_scopes[iScope].complete;
+	}
+
+	/**
+	 * @brief Give the measures to the profilers.
+	 * @param[in] iTimestamps The timestamps of the queries in nanoseconds.
+	 */
+	void publish(std::span<const uint64_t> iTimestamps) const;
+
+private:
+	/**
+	 * @brief A recorded scope.
+	 */
+	struct Scope {
+		/// Interned name of the scope.
+		uint32_t nameId = 0;
+		/// Nesting level.
+		uint32_t depth = 0;
+		/// CPU time of the recording in profiler ticks.
+		int64_t cpuTicks = 0;
+		/// If both timestamps have been written.
+		bool complete = false;
+	};
+	/// The scopes in opening order.
+	std::vector<Scope> m_scopes;
+	/// The open scopes, -1 for the scopes not recorded.
+	std::vector<int32_t> m_open;
+};
+
+}// namespace owl::renderer::utils
@@ -0,0 +1,238 @@
+/**
+ * @file ShaderCache.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "ShaderCache.h"
+
+#include <future>
+
+namespace owl::renderer::utils {
+
+namespace {
+
+/// Magic number at the beginning of the cache file.
+constexpr std::array<char, 4> g_cacheMagic{'O', 'S', 'H', 'C'};
+/// Version of the cache file layout.
+constexpr uint32_t g_cacheVersion{1};
+
+/**
+ * @brief Header of the cache file.
+ */
+struct CacheHeader {
+	/// Magic number.
+	std::array<char, 4> magic = g_cacheMagic;
+	/// File layout version.
+	uint32_t version = g_cacheVersion;
+	/// Number of entries in the index.
+	uint64_t entryCount = 0;
+};
+
+/**
+ * @brief Entry of the file index.
+ */
+struct IndexEntry {
+	/// Key of the binary.
+	uint64_t key = 0;
+	/// Offset of the binary from the beginning of the file.
+	uint64_t offset = 0;
+	/// Size of the binary in bytes.
+	uint64_t size = 0;
+};
+
+}// namespace
+
+ShaderCache::ShaderCache() = default;
+
+ShaderCache::~ShaderCache() = default;
+
+auto ShaderCache::get() -> ShaderCache& {
+	static ShaderCache instance;
+	return instance;
+}
+
+void ShaderCache::open(const std::filesystem::path& iFile) {
+	OWL_PROFILE_FUNCTION()
+
+	close();
+	const std::lock_guard lock(m_mutex);
+	m_file = iFile;
+	std::ifstream in(m_file, std::ios::in | std::ios::binary);
+	if (!in.is_open())
+		return;
+	CacheHeader header;
+	in.read(reinterpret_cast<char*>(&header), sizeof(CacheHeader));
+	if (!in || header.magic != g_cacheMagic || header.version != g_cacheVersion) {
+		OWL_CORE_WARN("Shader cache: invalid file {}, starting with an empty cache.", m_file.string())
+		return;
+	}
+	std::vector<IndexEntry> index(header.entryCount);
+	in.read(reinterpret_cast<char*>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(IndexEntry)));
+	if (!in) {
+		OWL_CORE_WARN("Shader cache: truncated index in {}, starting with an empty cache.", m_file.string())
+		return;
+	}
+	for (const auto& [key, offset, size]: index)
+		m_entries[key] = Entry{.offset = offset, .size = size, .loaded = false, .data = {}};
+	OWL_CORE_TRACE("Shader cache: {} entries in {}", m_entries.size(), m_file.string())
+}
+
+void ShaderCache::close() {
+	save();
+	const std::lock_guard lock(m_mutex);
+	m_entries.clear();
+	m_file.clear();
+	m_dirty = false;
+}
+
+auto ShaderCache::save() -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	const std::lock_guard lock(m_mutex);
+	if (!m_dirty || m_file.empty())
+		return true;
+	// every binary must be in memory before the file is rewritten.
+	for (auto& entry: m_entries | std::views::values) {
+		if (!entry.loaded && !loadEntry(entry))
+			return false;
+	}
+	if (m_file.has_parent_path() && !exists(m_file.parent_path()))
+		create_directories(m_file.parent_path());
+	auto tmpFile = m_file;
+	tmpFile += ".tmp";
+	{
+		std::ofstream out(tmpFile, std::ios::out | std::ios::binary);
+		if (!out.is_open()) {
+			OWL_CORE_WARN("Shader cache: cannot open file {} for writing.", tmpFile.string())
+			return false;
+		}
+		const CacheHeader header{.entryCount = m_entries.size()};
+		std::vector<IndexEntry> index;
+		index.reserve(m_entries.size());
+		uint64_t offset = sizeof(CacheHeader) + m_entries.size() * sizeof(IndexEntry);
+		for (auto&& [key, entry]: m_entries) {
+			entry.offset = offset;
+			entry.size = entry.data.size() * sizeof(uint32_t);
+			index.push_back({.key = key, .offset = entry.offset, .size = entry.size});
+			offset += entry.size;
+		}
+		out.write(reinterpret_cast<const char*>(&header), sizeof(CacheHeader));
+		out.write(reinterpret_cast<const char*>(index.data()),
+				  static_cast<std::streamsize>(index.size() * sizeof(IndexEntry)));
+		for (const auto& entry: m_entries | std::views::values)
+			out.write(reinterpret_cast<const char*>(entry.data.data()), static_cast<std::streamsize>(entry.size));
+		if (!out) {
+			OWL_CORE_WARN("Shader cache: failed to write {}.", tmpFile.string())
+			return false;
+		}
+	}
+	std::error_code error;
+	std::filesystem::rename(tmpFile, m_file, error);
+	if (error) {
+		OWL_CORE_WARN("Shader cache: failed to replace {} ({}).", m_file.string(), error.message())
+		return false;
+	}
+	m_dirty = false;
+	return true;
+}
+
+auto ShaderCache::getFile() const -> std::filesystem::path {
+	const std::lock_guard lock(m_mutex);
+	return m_file;
+}
+
+auto ShaderCache::size() const -> size_t {
+	const std::lock_guard lock(m_mutex);
+	return m_entries.size();
+}
+
+auto ShaderCache::contains(const uint64_t iKey) const -> bool {
+	const std::lock_guard lock(m_mutex);
+	return m_entries.contains(iKey);
+}
+
+auto ShaderCache::find(const uint64_t iKey) -> std::optional<std::vector<uint32_t>> {
+	const std::lock_guard lock(m_mutex);
+	const auto it = m_entries.find(iKey);
+	if (it == m_entries.end())
+		return std::nullopt;
+	if (!it->second.loaded && !loadEntry(it->second)) {
+		m_entries.erase(it);
+		m_dirty = true;
+		return std::nullopt;
+	}
+	return it->second.data;
+}
+
+void ShaderCache::store(const uint64_t iKey, std::vector<uint32_t> iData) {
+	const std::lock_guard lock(m_mutex);
+	const uint64_t dataSize = iData.size() * sizeof(uint32_t);
+	m_entries[iKey] = Entry{.offset = 0, .size = dataSize, .loaded = true, .data = std::move(iData)};
+	m_dirty = true;
+}
+
+auto ShaderCache::getOrCompile(const ShaderCompileJob& iJob) -> std::vector<uint32_t> {
+	if (auto data = find(iJob.key); data.has_value())
+		return std::move(data.value());
+	auto data = iJob.compile();
+	if (!data.has_value()) {
+		OWL_CORE_ERROR("Shader cache: failed to compile {}.", iJob.name)
+		return {};
+	}
+	store(iJob.key, data.value());
+	return std::move(data.value());
+}
+
+auto ShaderCache::getOrCompile(const std::vector<ShaderCompileJob>& iJobs) -> std::vector<std::vector<uint32_t>> {
+	OWL_PROFILE_FUNCTION()
+
+	std::vector<std::vector<uint32_t>> results(iJobs.size());
+	std::vector<std::pair<size_t, std::future<std::optional<std::vector<uint32_t>>>>> pending;
+	for (size_t i = 0; i < iJobs.size(); ++i) {
+		if (auto data = find(iJobs[i].key); data.has_value()) {
+			OWL_CORE_TRACE("Shader cache: using cached {}", iJobs[i].name)
+			results[i] = std::move(data.value());
+		} else {
+			OWL_CORE_TRACE("Shader cache: compiling {}", iJobs[i].name)
+			pending.emplace_back(i, std::async(std::launch::async, iJobs[i].compile));
+		}
+	}
+	if (pending.empty())
+		return results;
+	for (auto&& [i, future]: pending) {
+		auto data = future.get();
+		if (!data.has_value()) {
+			OWL_CORE_ERROR("Shader cache: failed to compile {}.", iJobs[i].name)
+			continue;
+		}
+		store(iJobs[i].key, data.value());
+		results[i] = std::move(data.value());
+	}
+	OWL_CORE_INFO("Shader cache: {} cached, {} compiled.", iJobs.size() - pending.size(), pending.size())
+	save();
+	return results;
+}
+
+auto ShaderCache::loadEntry(Entry& ioEntry) const -> bool {
+	if (m_file.empty() || ioEntry.size % sizeof(uint32_t) != 0)
+		return false;
+	std::ifstream in(m_file, std::ios::in | std::ios::binary);
+	if (!in.is_open())
+		return false;
+	in.seekg(static_cast<std::streamoff>(ioEntry.offset));
+	ioEntry.data.resize(ioEntry.size / sizeof(uint32_t));
+	in.read(reinterpret_cast<char*>(ioEntry.data.data()), static_cast<std::streamsize>(ioEntry.size));
+	if (!in) {
+		ioEntry.data.clear();
+		return false;
+	}
+	ioEntry.loaded = true;
+	return true;
+}
+
+}// namespace owl::renderer::utils
@@ -0,0 +1,160 @@
+/**
+ * @file ShaderCache.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "renderer/Shader.h"
+
+#include <filesystem>
+#include <mutex>
+#include <optional>
+
+namespace owl::renderer::utils {
+
+/**
+ * @brief A compilation unit to resolve through the shader cache.
+ */
+struct OWL_API ShaderCompileJob {
+	/// Key of the result in the cache (hash of everything that can change the binary).
+	uint64_t key = 0;
+	/// Stage of the shader.
+	ShaderType stage = ShaderType::None;
+	/// Name used in the messages.
+	std::string name;
+	/// Function producing the binary on cache miss, may be called from a worker thread.
+	std::function<std::optional<std::vector<uint32_t>>()> compile;
+};
+
+/**
+ * @brief Content addressed cache of shader binaries stored in a single indexed file.
+ *
+ * The file starts with a header and an index of (key, offset, size) entries, the binaries follow. Binaries
+ * are only read when requested. All the functions are thread safe.
+ */
+class OWL_API ShaderCache final {
+public:
+	ShaderCache(const ShaderCache&) = delete;
+	ShaderCache(ShaderCache&&) = delete;
+	auto operator=(const ShaderCache&) -> ShaderCache& = delete;
+	auto operator=(ShaderCache&&) -> ShaderCache& = delete;
+
+	/**
+	 * @brief Destructor.
+	 */
+	~ShaderCache();
+
+	/**
+	 * @brief Access to the cache instance.
+	 * @return The shader cache.
+	 */
+	static auto get() -> ShaderCache&;
+
+	/**
+	 * @brief Attach the cache to a file and read its index.
+	 * @param[in] iFile The cache file.
+	 *
+	 * Any previously opened file is saved and closed first. A missing or invalid file gives an empty cache.
+	 */
+	void open(const std::filesystem::path& iFile);
+
+	/**
+	 * @brief Save the pending entries and empty the cache.
+	 */
+	void close();
+
+	/**
+	 * @brief Write the cache file if it has been modified.
+	 * @return False in case of writing error.
+	 */
+	auto save() -> bool;
+
+	/**
+	 * @brief Get the file of the cache.
+	 * @return The cache file, empty if the cache is memory only.
+	 */
+	[[nodiscard]] auto getFile() const -> std::filesystem::path;
+
+	/**
+	 * @brief Get the number of entries in the cache.
+	 * @return The number of entries.
+	 */
+	[[nodiscard]] auto size() const -> size_t;
+
+	/**
+	 * @brief Check if a key is in the cache.
+	 * @param[in] iKey The key to check.
+	 * @return True if exists.
+	 */
+	[[nodiscard]] auto contains(uint64_t iKey) const -> bool;
+
+	/**
+	 * @brief Get a binary from the cache.
+	 * @param[in] iKey The key of the binary.
+	 * @return The binary, or nullopt if not in the cache.
+	 */
+	[[nodiscard]] auto find(uint64_t iKey) -> std::optional<std::vector<uint32_t>>;
+
+	/**
+	 * @brief Add or replace a binary in the cache.
+	 * @param[in] iKey The key of the binary.
+	 * @param[in] iData The binary.
+	 */
+	void store(uint64_t iKey, std::vector<uint32_t> iData);
+
+	/**
+	 * @brief Get the result of a job, compiling it if not in the cache.
+	 * @param[in] iJob The job to resolve.
+	 * @return The binary, empty in case of failure.
+	 */
+	auto getOrCompile(const ShaderCompileJob& iJob) -> std::vector<uint32_t>;
+
+	/**
+	 * @brief Get the result of several jobs, the cache misses are compiled concurrently.
+	 * @param[in] iJobs The jobs to resolve.
+	 * @return The binaries in the order of the jobs, empty in case of failure.
+	 */
+	auto getOrCompile(const std::vector<ShaderCompileJob>& iJobs) -> std::vector<std::vector<uint32_t>>;
+
+private:
+	/**
+	 * @brief Private constructor (singleton).
+	 */
+	ShaderCache();
+
+	/**
+	 * @brief An entry of the cache.
+	 */
+	struct Entry {
+		/// Offset of the data in the file.
+		uint64_t offset = 0;
+		/// Size of the data in the file (bytes).
+		uint64_t size = 0;
+		/// If the data are in memory.
+		bool loaded = false;
+		/// The data.
+		std::vector<uint32_t> data;
+	};
+
+	/**
+	 * @brief Read the data of an entry from the file.
+	 * @param[in,out] ioEntry The entry to load.
+	 * @return True if succeeded.
+	 */
+	auto loadEntry(Entry& ioEntry) const -> bool;
+
+	/// Access protection.
+	mutable std::mutex m_mutex;
+	/// The cache file.
+	std::filesystem::path m_file;
+	/// The cache entries.
+	std::unordered_map<uint64_t, Entry> m_entries;
+	/// If the cache has not been saved since last modification.
+	bool m_dirty = false;
+};
+
+}// namespace owl::renderer::utils
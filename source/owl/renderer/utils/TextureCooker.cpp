@@ -0,0 +1,252 @@
+/**
+ * @file TextureCooker.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "TextureCooker.h"
+
+#include "core/utils/HashUtils.h"
+
+#include <stb_image.h>
+
+namespace owl::renderer::utils {
+
+namespace {
+
+/// Magic number at the beginning of cooked files.
+constexpr std::array<char, 4> g_cookedMagic{'O', 'T', 'E', 'X'};
+/// Version of the cooked file layout, part of the cook key.
+constexpr uint32_t g_cookedVersion{1};
+
+/**
+ * @brief Header of a cooked file.
+ */
+struct CookedHeader {
+	/// Magic number.
+	std::array<char, 4> magic = g_cookedMagic;
+	/// File layout version.
+	uint32_t version = g_cookedVersion;
+	/// Cook key.
+	uint64_t cookKey = 0;
+	/// Width of the base level.
+	uint32_t width = 0;
+	/// Height of the base level.
+	uint32_t height = 0;
+	/// Pixel format.
+	uint8_t format = 0;
+	/// Number of mip levels.
+	uint8_t levelCount = 0;
+	/// Reserved for later use (compression scheme).
+	uint16_t flags = 0;
+	/// Reserved, keeps the header free of padding bytes.
+	uint32_t reserved = 0;
+};
+static_assert(sizeof(CookedHeader) == 32, "The cooked header must not hold padding bytes.");
+
+/// Extensions of the source images, in order of preference.
+const std::array<std::string_view, 2> g_sourceExtensions{".png", ".jpg"};
+
+auto isCookable(const ImageFormat& iFormat) -> bool {
+	return iFormat == ImageFormat::R8 || iFormat == ImageFormat::RGB8 || iFormat == ImageFormat::RGBA8;
+}
+
+}// namespace
+
+auto getCookedExtension() -> std::string { return ".otex"; }
+
+auto getMipLevelCount(const math::vec2ui& iSize) -> uint32_t {
+	uint32_t maxDim = std::max(iSize.x(), iSize.y());
+	if (maxDim == 0)
+		return 0;
+	uint32_t levels = 1;
+	while (maxDim > 1) {
+		maxDim >>= 1u;
+		++levels;
+	}
+	return levels;
+}
+
+auto getMipLevelSize(const math::vec2ui& iSize, const uint32_t iLevel) -> math::vec2ui {
+	return {std::max(iSize.x() >> iLevel, 1u), std::max(iSize.y() >> iLevel, 1u)};
+}
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+void generateMipChain(CookedImage& ioImage) {
+	OWL_PROFILE_FUNCTION()
+
+	if (ioImage.levels.empty())
+		return;
+	ioImage.levels.resize(1);
+	const auto& baseSize = ioImage.specification.size;
+	const uint32_t levelCount = getMipLevelCount(baseSize);
+	const uint32_t pixelSize = ioImage.specification.getPixelSize();
+	for (uint32_t level = 1; level < levelCount; ++level) {
+		const auto srcSize = getMipLevelSize(baseSize, level - 1);
+		const auto dstSize = getMipLevelSize(baseSize, level);
+		const auto& src = ioImage.levels[level - 1];
+		std::vector<uint8_t> dst(dstSize.surface() * pixelSize);
+		for (uint32_t y = 0; y < dstSize.y(); ++y) {
+			const uint32_t y0 = std::min(2 * y, srcSize.y() - 1);
+			const uint32_t y1 = std::min(2 * y + 1, srcSize.y() - 1);
+			for (uint32_t x = 0; x < dstSize.x(); ++x) {
+				const uint32_t x0 = std::min(2 * x, srcSize.x() - 1);
+				const uint32_t x1 = std::min(2 * x + 1, srcSize.x() - 1);
+				for (uint32_t c = 0; c < pixelSize; ++c) {
+					const uint32_t sum = src[(y0 * srcSize.x() + x0) * pixelSize + c] +
+										 src[(y0 * srcSize.x() + x1) * pixelSize + c] +
+										 src[(y1 * srcSize.x() + x0) * pixelSize + c] +
+										 src[(y1 * srcSize.x() + x1) * pixelSize + c];
+					dst[(y * dstSize.x() + x) * pixelSize + c] = static_cast<uint8_t>((sum + 2) / 4);
+				}
+			}
+		}
+		ioImage.levels.push_back(std::move(dst));
+	}
+}
+OWL_DIAG_POP
+
+auto computeCookKey(const std::filesystem::path& iSource, const CookOptions& iOptions) -> std::optional<uint64_t> {
+	const auto sourceHash = core::utils::hashFile(iSource);
+	if (!sourceHash.has_value())
+		return std::nullopt;
+	uint64_t key = core::utils::hashCombine(sourceHash.value(), g_cookedVersion);
+	key = core::utils::hashCombine(key, static_cast<uint64_t>(iOptions.format));
+	return core::utils::hashCombine(key, iOptions.generateMips ? 1u : 0u);
+}
+
+auto cookImage(const std::filesystem::path& iSource, const CookOptions& iOptions) -> std::optional<CookedImage> {
+	OWL_PROFILE_FUNCTION()
+
+	if (!isCookable(iOptions.format)) {
+		OWL_CORE_ERROR("Texture cooker: unsupported target format {}.", magic_enum::enum_name(iOptions.format))
+		return std::nullopt;
+	}
+	const auto key = computeCookKey(iSource, iOptions);
+	if (!key.has_value()) {
+		OWL_CORE_WARN("Texture cooker: Unable to read {}.", iSource.string())
+		return std::nullopt;
+	}
+	CookedImage image;
+	image.cookKey = key.value();
+	image.specification.format = iOptions.format;
+	image.specification.generateMips = iOptions.generateMips;
+	const int channels = image.specification.getPixelSize();
+	int width = 0;
+	int height = 0;
+	int sourceChannels = 0;
+	stbi_set_flip_vertically_on_load(1);
+	// stb does the channel conversion when asking a given number of channels.
+	stbi_uc* data = stbi_load(iSource.string().c_str(), &width, &height, &sourceChannels, channels);
+	if (data == nullptr) {
+		OWL_CORE_WARN("Texture cooker: Failed to decode image {}", iSource.string())
+		return std::nullopt;
+	}
+	image.specification.size = {static_cast<uint32_t>(width), static_cast<uint32_t>(height)};
+	const size_t dataSize = image.specification.size.surface() * static_cast<size_t>(channels);
+	image.levels.emplace_back(data, data + dataSize);
+	stbi_image_free(data);
+	if (iOptions.generateMips)
+		generateMipChain(image);
+	return image;
+}
+
+auto writeCookedImage(const std::filesystem::path& iFile, const CookedImage& iImage) -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	if (iFile.has_parent_path() && !exists(iFile.parent_path()))
+		create_directories(iFile.parent_path());
+	std::ofstream out(iFile, std::ios::out | std::ios::binary);
+	if (!out.is_open()) {
+		OWL_CORE_WARN("Cannot open file {} for writting.", iFile.string())
+		return false;
+	}
+	// value initialized then assigned: the whole header is defined, cooked files are reproducible.
+	CookedHeader header{};
+	header.cookKey = iImage.cookKey;
+	header.width = iImage.specification.size.x();
+	header.height = iImage.specification.size.y();
+	header.format = static_cast<uint8_t>(iImage.specification.format);
+	header.levelCount = static_cast<uint8_t>(iImage.levels.size());
+	out.write(reinterpret_cast<const char*>(&header), sizeof(CookedHeader));
+	for (const auto& level: iImage.levels) {
+		const uint64_t size = level.size();
+		out.write(reinterpret_cast<const char*>(&size), sizeof(uint64_t));
+		out.write(reinterpret_cast<const char*>(level.data()), static_cast<std::streamsize>(size));
+	}
+	out.close();
+	return true;
+}
+
+auto readCookedImage(const std::filesystem::path& iFile, const bool iHeaderOnly) -> std::optional<CookedImage> {
+	OWL_PROFILE_FUNCTION()
+
+	std::ifstream in(iFile, std::ios::in | std::ios::binary);
+	if (!in.is_open())
+		return std::nullopt;
+	CookedHeader header;
+	in.read(reinterpret_cast<char*>(&header), sizeof(CookedHeader));
+	if (!in || header.magic != g_cookedMagic || header.version != g_cookedVersion || header.levelCount == 0)
+		return std::nullopt;
+	CookedImage image;
+	image.cookKey = header.cookKey;
+	image.specification.size = {header.width, header.height};
+	image.specification.format = static_cast<ImageFormat>(header.format);
+	image.specification.generateMips = header.levelCount > 1;
+	if (!isCookable(image.specification.format))
+		return std::nullopt;
+	if (iHeaderOnly)
+		return image;
+	const uint32_t pixelSize = image.specification.getPixelSize();
+	for (uint32_t level = 0; level < header.levelCount; ++level) {
+		uint64_t size = 0;
+		in.read(reinterpret_cast<char*>(&size), sizeof(uint64_t));
+		if (size != getMipLevelSize(image.specification.size, level).surface() * pixelSize)
+			return std::nullopt;
+		auto& data = image.levels.emplace_back(size);
+		in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(size));
+		if (!in)
+			return std::nullopt;
+	}
+	return image;
+}
+
+auto findNewerSource(const std::filesystem::path& iCooked) -> std::optional<std::filesystem::path> {
+	std::error_code error;
+	const auto cookedTime = std::filesystem::last_write_time(iCooked, error);
+	if (error)
+		return std::nullopt;
+	for (const auto& extension: g_sourceExtensions) {
+		auto source = iCooked;
+		source.replace_extension(extension);
+		const auto sourceTime = std::filesystem::last_write_time(source, error);
+		if (!error && sourceTime > cookedTime)
+			return source;
+	}
+	return std::nullopt;
+}
+
+auto cookFile(const std::filesystem::path& iSource, const std::filesystem::path& iDestination,
+			  const CookOptions& iOptions) -> CookResult {
+	OWL_PROFILE_FUNCTION()
+
+	if (!iOptions.force && exists(iDestination)) {
+		const auto existing = readCookedImage(iDestination, true);
+		if (const auto key = computeCookKey(iSource, iOptions);
+			existing.has_value() && key.has_value() && existing->cookKey == key.value())
+			return CookResult::UpToDate;
+	}
+	const auto image = cookImage(iSource, iOptions);
+	if (!image.has_value())
+		return CookResult::Failed;
+	if (!writeCookedImage(iDestination, image.value()))
+		return CookResult::Failed;
+	return CookResult::Cooked;
+}
+
+}// namespace owl::renderer::utils
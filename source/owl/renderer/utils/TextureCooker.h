@@ -0,0 +1,130 @@
+/**
+ * @file TextureCooker.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "renderer/Texture.h"
+
+namespace owl::renderer::utils {
+
+/**
+ * @brief Texture data ready to be sent to the GPU.
+ *
+ * Pixels are already flipped vertically and converted to the specification's format. Each mip level
+ * is stored contiguously, level 0 being the full-size image.
+ */
+struct OWL_API CookedImage {
+	/// The specification of the image (size & format of level 0).
+	Texture::Specification specification;
+	/// Hash of the source and cook options used to produce this image.
+	uint64_t cookKey = 0;
+	/// The pixels data for each mip level.
+	std::vector<std::vector<uint8_t>> levels;
+};
+
+/**
+ * @brief Options of the texture cooking.
+ */
+struct OWL_API CookOptions {
+	/// Target pixel format (only 8 bits formats are supported).
+	ImageFormat format = ImageFormat::RGBA8;
+	/// If the mip chain should be generated.
+	bool generateMips = true;
+	/// Cook even if the output is up-to-date.
+	bool force = false;
+};
+
+/**
+ * @brief Result of a cook operation.
+ */
+enum struct CookResult : uint8_t {
+	Cooked,///< The file has been (re)generated.
+	UpToDate,///< The existing file matches the source.
+	Failed,///< Something went wrong.
+};
+
+/**
+ * @brief Get the file extension of cooked textures.
+ * @return The extension.
+ */
+OWL_API auto getCookedExtension() -> std::string;
+
+/**
+ * @brief Compute the number of mip levels for a full mip chain.
+ * @param[in] iSize Size of the base level.
+ * @return Number of levels, including the base level.
+ */
+OWL_API auto getMipLevelCount(const math::vec2ui& iSize) -> uint32_t;
+
+/**
+ * @brief Compute the size of a given mip level.
+ * @param[in] iSize Size of the base level.
+ * @param[in] iLevel The mip level.
+ * @return The level's size.
+ */
+OWL_API auto getMipLevelSize(const math::vec2ui& iSize, uint32_t iLevel) -> math::vec2ui;
+
+/**
+ * @brief Generate the mip levels by successive 2x2 box filtering.
+ * @param[in,out] ioImage The image, only its first level is used as input.
+ */
+OWL_API void generateMipChain(CookedImage& ioImage);
+
+/**
+ * @brief Compute the key identifying a source file cooked with given options.
+ * @param[in] iSource The source image.
+ * @param[in] iOptions The cook options.
+ * @return The key, or nullopt if the source cannot be read.
+ */
+OWL_API auto computeCookKey(const std::filesystem::path& iSource, const CookOptions& iOptions)
+		-> std::optional<uint64_t>;
+
+/**
+ * @brief Decode a source image and convert it to the cooked representation.
+ * @param[in] iSource The source image.
+ * @param[in] iOptions The cook options.
+ * @return The cooked image, or nullopt in case of failure.
+ */
+OWL_API auto cookImage(const std::filesystem::path& iSource, const CookOptions& iOptions)
+		-> std::optional<CookedImage>;
+
+/**
+ * @brief Write a cooked image to a file.
+ * @param[in] iFile The destination file.
+ * @param[in] iImage The image to write.
+ * @return True if succeeded.
+ */
+OWL_API auto writeCookedImage(const std::filesystem::path& iFile, const CookedImage& iImage) -> bool;
+
+/**
+ * @brief Read a cooked image from a file.
+ * @param[in] iFile The file to read.
+ * @param[in] iHeaderOnly If true, only the specification and key are read.
+ * @return The image, or nullopt in case of invalid file.
+ */
+OWL_API auto readCookedImage(const std::filesystem::path& iFile, bool iHeaderOnly = false)
+		-> std::optional<CookedImage>;
+
+/**
+ * @brief Find the source image next to a cooked file, when it has been modified after the cooking.
+ * @param[in] iCooked The cooked file.
+ * @return The newer source image, or nullopt if the cooked file is up-to-date.
+ */
+OWL_API auto findNewerSource(const std::filesystem::path& iCooked) -> std::optional<std::filesystem::path>;
+
+/**
+ * @brief Cook a source image into a file, if the existing file is not up-to-date.
+ * @param[in] iSource The source image.
+ * @param[in] iDestination The cooked file.
+ * @param[in] iOptions The cook options.
+ * @return The result of the operation.
+ */
+OWL_API auto cookFile(const std::filesystem::path& iSource, const std::filesystem::path& iDestination,
+					  const CookOptions& iOptions) -> CookResult;
+
+}// namespace owl::renderer::utils
@@ -11,10 +11,16 @@
 #include "core/Application.h"
 #include "shaderFileUtils.h"
 
+#include "core/utils/HashUtils.h"
 #include "renderer/Renderer.h"
 
 namespace owl::renderer::utils {
 
+namespace {
+/// Version of the compilation pipeline, to increment when it changes the produced binaries.
+constexpr uint64_t g_shaderKeyVersion{1};
+}// namespace
+
 auto getCacheDirectory(const std::string& iRenderer, const std::string& iRendererApi) -> std::filesystem::path {
 	auto output = core::Application::get().getWorkingDirectory() / "cache" / "shader";
 	if (!iRenderer.empty())
@@ -33,11 +39,6 @@ void createCacheDirectoryIfNeeded(const std::string& iRenderer, const std::strin
 	}
 }
 
-auto getShaderCachedPath(const std::string& iShaderName, const std::string& iRenderer, const std::string& iRendererApi,
-						 const ShaderType& iType) -> std::filesystem::path {
-	return getCacheDirectory(iRenderer, iRendererApi) / (iShaderName + getCacheExtension(iType));
-}
-
 auto getShaderPath(const std::string& iShaderName, const std::string& iRenderer, const std::string& iRendererApi,
 				   const ShaderType& iType) -> std::filesystem::path {
 	return Renderer::getTextureLibrary()
@@ -57,44 +58,6 @@ auto getExtension(const ShaderType& iStage) -> std::string {
 	return ext;
 }
 
-auto getCacheExtension(const ShaderType& iStage) -> std::string {
-	auto ext = fmt::format(".{}.spv", magic_enum::enum_name(iStage).substr(0, 4));
-	std::ranges::transform(ext.begin(), ext.end(), ext.begin(),
-						   [](const unsigned char iChar) { return std::tolower(iChar); });
-	return ext;
-}
-
-
-auto readCachedShader(const std::filesystem::path& iFile) -> std::vector<uint32_t> {
-	OWL_PROFILE_FUNCTION()
-
-	std::vector<uint32_t> result;
-	std::ifstream in(iFile, std::ios::in | std::ios::binary);
-	in.seekg(0, std::ios::end);
-	const auto size = in.tellg();
-	in.seekg(0, std::ios::beg);
-	result.resize(static_cast<size_t>(size) / sizeof(uint32_t));
-	in.read(reinterpret_cast<char*>(result.data()), size);
-	in.close();
-	return result;
-}
-
-auto writeCachedShader(const std::filesystem::path& iFile, const std::vector<uint32_t>& iData) -> bool {
-	OWL_PROFILE_FUNCTION()
-	std::ofstream out(iFile, std::ios::out | std::ios::binary);
-	if (!exists(iFile.parent_path()))
-		OWL_CORE_WARN("Cache directory {} does not exists, creating.", iFile.parent_path().string())
-
-	if (out.is_open()) {
-		out.write(reinterpret_cast<const char*>(iData.data()), static_cast<int64_t>(iData.size() * sizeof(uint32_t)));
-		out.flush();
-		out.close();
-		return true;
-	}
-	OWL_CORE_WARN("Cannot open file {} for writting.", iFile.string())
-	return false;
-}
-
 auto shaderStageToShaderC(const ShaderType& iStage) -> shaderc_shader_kind {
 	switch (iStage) {
 		case ShaderType::Vertex:
@@ -135,4 +98,43 @@ void shaderReflect(const std::string& iShaderName, const std::string& iRenderer,
 #endif
 }
 
+auto getShaderCacheFile() -> std::filesystem::path { return getCacheDirectory("", "") / "shaders.cache"; }
+
+auto computeShaderKey(const std::string_view iSource, const ShaderType iStage, const ShaderCompileOptions& iOptions)
+		-> uint64_t {
+	return combineShaderKey(core::utils::hashString(iSource), iStage, iOptions);
+}
+
+auto combineShaderKey(const uint64_t iKey, const ShaderType iStage, const ShaderCompileOptions& iOptions)
+		-> uint64_t {
+	unsigned int spvVersion = 0;
+	unsigned int spvRevision = 0;
+	shaderc_get_spv_version(&spvVersion, &spvRevision);
+	uint64_t key = core::utils::hashCombine(iKey, g_shaderKeyVersion);
+	key = core::utils::hashCombine(key, (static_cast<uint64_t>(spvVersion) << 32u) | spvRevision);
+	key = core::utils::hashCombine(key, static_cast<uint64_t>(iStage));
+	key = core::utils::hashCombine(key, static_cast<uint64_t>(iOptions.targetEnv));
+	key = core::utils::hashCombine(key, static_cast<uint64_t>(iOptions.envVersion));
+	return core::utils::hashCombine(key, iOptions.optimize ? 1u : 0u);
+}
+
+auto compileGlslToSpirv(const std::string& iSource, const ShaderType iStage, const std::string& iFileName,
+						const ShaderCompileOptions& iOptions) -> std::optional<std::vector<uint32_t>> {
+	OWL_PROFILE_FUNCTION()
+
+	shaderc::CompileOptions options;
+	if (iOptions.envVersion != 0)
+		options.SetTargetEnvironment(iOptions.targetEnv, iOptions.envVersion);
+	if (iOptions.optimize)
+		options.SetOptimizationLevel(shaderc_optimization_level_performance);
+	// each call uses its own compiler instance, so compilations can run concurrently.
+	const shaderc::Compiler compiler;
+	const auto module = compiler.CompileGlslToSpv(iSource, shaderStageToShaderC(iStage), iFileName.c_str(), options);
+	if (module.GetCompilationStatus() != shaderc_compilation_status_success) {
+		OWL_CORE_ERROR(module.GetErrorMessage())
+		return std::nullopt;
+	}
+	return std::vector<uint32_t>(module.cbegin(), module.cend());
+}
+
 }// namespace owl::renderer::utils
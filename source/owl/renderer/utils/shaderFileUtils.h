@@ -20,9 +20,6 @@ auto getCacheDirectory(const std::string& iRenderer, const std::string& iRendere
 
 void createCacheDirectoryIfNeeded(const std::string& iRenderer, const std::string& iRendererApi);
 
-auto getShaderCachedPath(const std::string& iShaderName, const std::string& iRenderer, const std::string& iRendererApi,
-						 const ShaderType& iType) -> std::filesystem::path;
-
 auto getShaderPath(const std::string& iShaderName, const std::string& iRenderer, const std::string& iRendererApi,
 				   const ShaderType& iType) -> std::filesystem::path;
 
@@ -31,15 +28,56 @@ auto getRelativeShaderPath(const std::string& iShaderName, const std::string& iR
 
 auto getExtension(const ShaderType& iStage) -> std::string;
 
-auto getCacheExtension(const ShaderType& iStage) -> std::string;
-
 auto shaderStageToShaderC(const ShaderType& iStage) -> shaderc_shader_kind;
 
-auto readCachedShader(const std::filesystem::path& iFile) -> std::vector<uint32_t>;
-
-auto writeCachedShader(const std::filesystem::path& iFile, const std::vector<uint32_t>& iData) -> bool;
-
 void shaderReflect(const std::string& iShaderName, const std::string& iRenderer, const std::string& iRendererApi,
 				   ShaderType iStage, const std::vector<uint32_t>& iShaderData);
 
+/**
+ * @brief Options of a GLSL to SPIR-V compilation.
+ */
+struct ShaderCompileOptions {
+	/// Target environment.
+	shaderc_target_env targetEnv = shaderc_target_env_default;
+	/// Version of the target environment (0 means the compiler's default).
+	shaderc_env_version envVersion{};
+	/// If performance optimization is enabled.
+	bool optimize = false;
+};
+
+/**
+ * @brief Get the path of the shader cache file.
+ * @return The path to the cache file.
+ */
+auto getShaderCacheFile() -> std::filesystem::path;
+
+/**
+ * @brief Compute the cache key of a compilation.
+ * @param[in] iSource The complete shader's source.
+ * @param[in] iStage The shader's stage.
+ * @param[in] iOptions The compile options.
+ * @return The cache key.
+ */
+auto computeShaderKey(std::string_view iSource, ShaderType iStage, const ShaderCompileOptions& iOptions) -> uint64_t;
+
+/**
+ * @brief Compute the cache key of a compilation whose source is derived from another cached binary.
+ * @param[in] iKey The key of the input binary.
+ * @param[in] iStage The shader's stage.
+ * @param[in] iOptions The compile options.
+ * @return The cache key.
+ */
+auto combineShaderKey(uint64_t iKey, ShaderType iStage, const ShaderCompileOptions& iOptions) -> uint64_t;
+
+/**
+ * @brief Compile GLSL source to SPIR-V, thread safe.
+ * @param[in] iSource The shader's source.
+ * @param[in] iStage The shader's stage.
+ * @param[in] iFileName The source file name for the messages.
+ * @param[in] iOptions The compile options.
+ * @return The binary, or nullopt if compilation failed.
+ */
+auto compileGlslToSpirv(const std::string& iSource, ShaderType iStage, const std::string& iFileName,
+						const ShaderCompileOptions& iOptions) -> std::optional<std::vector<uint32_t>>;
+
 }// namespace owl::renderer::utils
@@ -112,4 +112,10 @@ void RenderAPI::endTextureLoad() {
 	vkd.commitTextureBind(internal::VulkanHandler::get().getCurrentFrameIndex());
 }
 
+void RenderAPI::beginGpuScope(const uint32_t iNameId) { internal::VulkanHandler::get().beginGpuScope(iNameId); }
+
+void RenderAPI::endGpuScope() { internal::VulkanHandler::get().endGpuScope(); }
+
+auto RenderAPI::hasGpuTimers() const -> bool { return internal::VulkanHandler::get().hasGpuTimers(); }
+
 }// namespace owl::renderer::vulkan
@@ -100,5 +100,22 @@ public:
 	 * @brief Ends draw call for the current frame.
 	 */
 	void endFrame() override;
+
+	/**
+	 * @brief Start a scope timed on the GPU.
+	 * @param[in] iNameId Interned name of the scope.
+	 */
+	void beginGpuScope(uint32_t iNameId) override;
+
+	/**
+	 * @brief End the innermost scope timed on the GPU.
+	 */
+	void endGpuScope() override;
+
+	/**
+	 * @brief Check if the API is able to time the GPU scopes.
+	 * @return True if GPU timers are supported.
+	 */
+	[[nodiscard]] auto hasGpuTimers() const -> bool override;
 };
 }// namespace owl::renderer::vulkan
@@ -118,7 +118,6 @@ void Shader::createShader(const std::unordered_map<ShaderType, std::string>& iSo
 	OWL_PROFILE_FUNCTION()
 	const auto start = std::chrono::steady_clock::now();
 
-	renderer::utils::createCacheDirectoryIfNeeded(getRenderer(), "vulkan");
 	compileOrGetVulkanBinaries(iSources);
 
 	const auto timer = std::chrono::steady_clock::now() - start;
@@ -130,45 +129,39 @@ void Shader::createShader(const std::unordered_map<ShaderType, std::string>& iSo
 void Shader::compileOrGetVulkanBinaries(const std::unordered_map<ShaderType, std::string>& iSources) {
 	OWL_PROFILE_FUNCTION()
 
-	shaderc::CompileOptions options;
-	options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_0);
-	options.SetOptimizationLevel(shaderc_optimization_level_performance);
-
-	auto& shaderData = m_vulkanSpirv;
-	shaderData.clear();
-	for (auto&& [stage, source]: iSources) {
-		const std::filesystem::path basePath =
-				renderer::utils::getShaderPath(getName(), getRenderer(), "vulkan", stage);
-		const std::filesystem::path cachedPath =
-				renderer::utils::getShaderCachedPath(getName(), getRenderer(), "vulkan", stage);
-		if (exists(cachedPath) && (last_write_time(cachedPath) > last_write_time(basePath))) {
-			// Cache exists: read it
-			OWL_CORE_INFO("Using cached Vulkan Shader {}-{}", getName(), magic_enum::enum_name(stage))
-			shaderData[stage] = renderer::utils::readCachedShader(cachedPath);
-		} else {
-			if (exists(cachedPath))
-				OWL_CORE_INFO("Origin file newer than cached one, Recompiling.")
-			OWL_CORE_TRACE("Compile shader file: {}",
-						   renderer::utils::getRelativeShaderPath(getName(), getRenderer(), "vulkan", stage).string())
-			const shaderc::Compiler compiler;
-			const auto module = compiler.CompileGlslToSpv(
-					source, renderer::utils::shaderStageToShaderC(stage),
-					renderer::utils::getShaderPath(getName(), getRenderer(), "vulkan", stage).string().c_str(),
-					options);
-			if (module.GetCompilationStatus() != shaderc_compilation_status_success) {
-				OWL_CORE_ERROR(module.GetErrorMessage())
-				OWL_CORE_ASSERT(false, "Failed Compilation")
-			}
-			shaderData[stage] = std::vector<uint32_t>(module.cbegin(), module.cend());
-			OWL_CORE_TRACE("Write compiled shader file, size {}", shaderData[stage].size())
-			if (!renderer::utils::writeCachedShader(cachedPath, shaderData[stage]))
-				OWL_CORE_WARN("Failed to write the compiled shader.")
+	const auto jobs = getCompileJobs(getName(), getRenderer(), iSources);
+	auto binaries = renderer::utils::ShaderCache::get().getOrCompile(jobs);
+	m_vulkanSpirv.clear();
+	for (size_t i = 0; i < jobs.size(); ++i) {
+		if (binaries[i].empty()) {
+			OWL_CORE_ASSERT(false, "Failed Compilation")
+			continue;
 		}
+		m_vulkanSpirv[jobs[i].stage] = std::move(binaries[i]);
 	}
-	for (auto&& [stage, data]: shaderData)
+	for (auto&& [stage, data]: m_vulkanSpirv)
 		renderer::utils::shaderReflect(getName(), getRenderer(), "vulkan", stage, data);
 }
 
+auto Shader::getCompileJobs(const std::string& iShaderName, const std::string& iRenderer,
+							const std::unordered_map<ShaderType, std::string>& iSources)
+		-> std::vector<renderer::utils::ShaderCompileJob> {
+	constexpr renderer::utils::ShaderCompileOptions options{.targetEnv = shaderc_target_env_vulkan,
+															.envVersion = shaderc_env_version_vulkan_1_0,
+															.optimize = true};
+	std::vector<renderer::utils::ShaderCompileJob> jobs;
+	for (auto&& [stage, source]: iSources) {
+		auto file = renderer::utils::getShaderPath(iShaderName, iRenderer, "vulkan", stage).string();
+		jobs.push_back({.key = renderer::utils::computeShaderKey(source, stage, options),
+						.stage = stage,
+						.name = fmt::format("{}/{}-{}", iRenderer, iShaderName, magic_enum::enum_name(stage)),
+						.compile = [source, stage, file, options] {
+							return renderer::utils::compileGlslToSpirv(source, stage, file, options);
+						}});
+	}
+	return jobs;
+}
+
 auto Shader::getStagesInfo() -> std::vector<VkPipelineShaderStageCreateInfo> {
 	auto& vkh = internal::VulkanHandler::get();
 	const auto& vkc = internal::VulkanCore::get();
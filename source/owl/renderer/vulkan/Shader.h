@@ -9,6 +9,7 @@
 #pragma once
 
 #include "../Shader.h"
+#include "../utils/ShaderCache.h"
 #include <vulkan/vulkan.h>
 
 namespace owl::renderer::vulkan {
@@ -121,6 +122,17 @@ public:
 	 */
 	auto getStagesInfo() -> std::vector<VkPipelineShaderStageCreateInfo>;
 
+	/**
+	 * @brief Build the compilation jobs of a shader's stages.
+	 * @param[in] iShaderName Shader's name.
+	 * @param[in] iRenderer Name of the shader's related renderer.
+	 * @param[in] iSources The shader's sources with type.
+	 * @return The jobs to resolve through the shader cache.
+	 */
+	static auto getCompileJobs(const std::string& iShaderName, const std::string& iRenderer,
+							   const std::unordered_map<ShaderType, std::string>& iSources)
+			-> std::vector<renderer::utils::ShaderCompileJob>;
+
 private:
 	void createShader(const std::unordered_map<ShaderType, std::string>& iSources);
 	void compileOrGetVulkanBinaries(const std::unordered_map<ShaderType, std::string>& iSources);
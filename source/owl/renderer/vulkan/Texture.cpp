@@ -12,6 +12,7 @@
 #include "internal/Descriptors.h"
 #include "internal/VulkanHandler.h"
 #include "internal/utils.h"
+#include "renderer/utils/TextureCooker.h"
 
 #include <stb_image.h>
 
@@ -25,11 +26,65 @@ void createImage(const uint32_t iIndex, const math::vec2ui& iDimensions) {
 	internal::Descriptors::get().bindTextureImage(iIndex);
 }
 
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+/**
+ * @brief Copy pixels to a staging memory, in the RGBA format of the vulkan images.
+ * @param[in] iData The source pixels.
+ * @param[in] iPixelCount Number of pixels.
+ * @param[in] iFormat Format of the source pixels.
+ * @param[out] oStaging The staging memory.
+ * @return False if the format is not supported.
+ */
+auto stagePixels(const void* iData, const size_t iPixelCount, const ImageFormat iFormat, void* oStaging) -> bool {
+	if (iFormat == ImageFormat::RGBA8) {
+		// input data already in the right format, just copy
+		memcpy(oStaging, iData, iPixelCount * 4);
+		return true;
+	}
+	if (iFormat == ImageFormat::RGB8) {
+		// need to insert alpha chanel.
+		const auto* dataChar = static_cast<const uint8_t*>(iData);
+		auto* dataPixelChar = static_cast<uint8_t*>(oStaging);
+		for (size_t i = 0, j = 0; j < iPixelCount * 3; i += 4, j += 3) {
+			memcpy(dataPixelChar + i, dataChar + j, 3);
+			*(dataPixelChar + i + 3) = 0xFFu;
+		}
+		return true;
+	}
+	if (iFormat == ImageFormat::R8 || iFormat == ImageFormat::RG8) {
+		// spread the channels, the missing ones are zero.
+		const size_t channels = iFormat == ImageFormat::R8 ? 1 : 2;
+		const auto* dataChar = static_cast<const uint8_t*>(iData);
+		auto* dataPixelChar = static_cast<uint8_t*>(oStaging);
+		for (size_t i = 0, j = 0; j < iPixelCount * channels; i += 4, j += channels) {
+			memcpy(dataPixelChar + i, dataChar + j, channels);
+			memset(dataPixelChar + i + channels, 0, 3 - channels);
+			*(dataPixelChar + i + 3) = 0xFFu;
+		}
+		return true;
+	}
+	OWL_CORE_ERROR("Vulkan Texture, image format {} not supported.", magic_enum::enum_name(iFormat))
+	return false;
+}
+OWL_DIAG_POP
+
 }// namespace
 
 Texture2D::Texture2D(const Specification& iSpecs) : renderer::Texture2D{iSpecs} {}
 
 Texture2D::Texture2D(std::filesystem::path iPath) : renderer::Texture2D{std::move(iPath)} {
+	if (m_path.extension() == utils::getCookedExtension()) {
+		auto image = utils::readCookedImage(m_path);
+		if (!image.has_value()) {
+			OWL_CORE_WARN("Vulkan Texture: Failed to load cooked image {}", m_path.string())
+			return;
+		}
+		// Only the base level is used: vulkan images are created with a single mip level.
+		m_specification = image->specification;
+		setData(image->levels.front().data(), static_cast<uint32_t>(image->levels.front().size()));
+		return;
+	}
 	int width = 0;
 	int height = 0;
 	int channels = 0;
@@ -84,19 +139,9 @@ void Texture2D::setData(void* iData, const uint32_t iSize) {
 						   stagingBufferMemory);
 	void* dataPixel = nullptr;
 	vkMapMemory(vkc.getLogicalDevice(), stagingBufferMemory, 0, imageSize, 0, &dataPixel);
-	if (m_specification.format == ImageFormat::RGBA8) {
-		// input data already in the right format, just copy
-		memcpy(dataPixel, iData, imageSize);
-	} else if (m_specification.format == ImageFormat::RGB8) {
-		// need to insert alpha chanel.
-		const auto* dataChar = static_cast<uint8_t*>(iData);
-		auto* dataPixelChar = static_cast<uint8_t*>(dataPixel);
-		for (uint32_t i = 0, j = 0; j < iSize; i += 4, j += 3) {
-			memcpy(dataPixelChar + i, dataChar + j, 3);
-			*(dataPixelChar + i + 3) = 0xFFu;
-		}
-	} else {
-		OWL_CORE_ERROR("Vulkan Texture, image format {} not supported.", magic_enum::enum_name(m_specification.format))
+	if (!stagePixels(iData, m_specification.size.surface(), m_specification.format, dataPixel)) {
+		vkUnmapMemory(vkc.getLogicalDevice(), stagingBufferMemory);
+		internal::freeBuffer(vkc.getLogicalDevice(), stagingBuffer, stagingBufferMemory);
 		return;
 	}
 	vkUnmapMemory(vkc.getLogicalDevice(), stagingBufferMemory);
@@ -119,6 +164,42 @@ void Texture2D::setData(void* iData, const uint32_t iSize) {
 }
 OWL_DIAG_POP
 
+void Texture2D::setSubData(const void* iData, const math::vec2ui& iOffset, const math::vec2ui& iSize) {
+	if (iOffset.x() + iSize.x() > m_specification.size.x() || iOffset.y() + iSize.y() > m_specification.size.y()) {
+		OWL_CORE_ERROR("Vulkan Texture {}: Region outside of the texture.", m_path.string())
+		return;
+	}
+	auto& vkd = internal::Descriptors::get();
+	if (!vkd.isTextureRegistered(m_textureId)) {
+		// the image is created by a full upload.
+		const size_t pixelCount = m_specification.size.surface();
+		std::vector<uint8_t> blank(pixelCount * m_specification.getPixelSize());
+		setData(blank.data(), static_cast<uint32_t>(blank.size()));
+	}
+	const auto& vkc = internal::VulkanCore::get();
+	VkBuffer stagingBuffer = nullptr;
+	VkDeviceMemory stagingBufferMemory = nullptr;
+	const VkDeviceSize regionSize = iSize.surface() * 4ull;
+	internal::createBuffer(regionSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+						   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer,
+						   stagingBufferMemory);
+	void* dataPixel = nullptr;
+	vkMapMemory(vkc.getLogicalDevice(), stagingBufferMemory, 0, regionSize, 0, &dataPixel);
+	const bool staged = stagePixels(iData, iSize.surface(), m_specification.format, dataPixel);
+	vkUnmapMemory(vkc.getLogicalDevice(), stagingBufferMemory);
+	if (staged) {
+		// the rest of the image is kept: transition from the read layout, not from undefined.
+		const auto& data = vkd.getTextureData(m_textureId);
+		internal::transitionImageLayout(data.textureImage, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+										VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		internal::copyBufferToImage(stagingBuffer, data.textureImage, iSize,
+									{static_cast<int32_t>(iOffset.x()), static_cast<int32_t>(iOffset.y())});
+		internal::transitionImageLayout(data.textureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+										VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+	}
+	internal::freeBuffer(vkc.getLogicalDevice(), stagingBuffer, stagingBufferMemory);
+}
+
 auto Texture2D::getRendererId() const -> uint64_t {
 	auto& desc = internal::Descriptors::get();
 	auto& texData = desc.getTextureData(m_textureId);
@@ -64,6 +64,14 @@ public:
 	 */
 	void setData(void* iData, uint32_t iSize) override;
 
+	/**
+	 * @brief Define the data of a region of the texture.
+	 * @param[in] iData Raw data of the region, rows without padding.
+	 * @param[in] iOffset Position of the region in pixels.
+	 * @param[in] iSize Size of the region in pixels.
+	 */
+	void setSubData(const void* iData, const math::vec2ui& iOffset, const math::vec2ui& iSize) override;
+
 private:
 	uint32_t m_textureId = 0;
 };
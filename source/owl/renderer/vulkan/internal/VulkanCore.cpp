@@ -420,6 +420,12 @@ OWL_DIAG_POP
 
 auto VulkanCore::getMaxSamplerAnisotropy() const -> float { return m_phyProps->properties.limits.maxSamplerAnisotropy; }
 
+auto VulkanCore::getGraphicTimestampBits() const -> uint32_t {
+	if (m_phyProps->graphicQueueIndex >= m_phyProps->queueFamilies.size())
+		return 0;
+	return m_phyProps->queueFamilies[m_phyProps->graphicQueueIndex].timestampValidBits;
+}
+
 auto VulkanCore::beginSingleTimeCommands() const -> VkCommandBuffer {
 	const auto& core = VulkanCore::get();
 	const VkCommandBufferAllocateInfo allocInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
@@ -123,6 +123,14 @@ public:
 	 */
 	[[nodiscard]] auto getPhysicalDevice() const -> VkPhysicalDevice { return m_physicalDevice; }
 
+	/**
+	 * @brief Access to the physical device's properties.
+	 * @return The physical device's properties.
+	 */
+	[[nodiscard]] auto getPhysicalDeviceProperties() const -> const VkPhysicalDeviceProperties& {
+		return m_phyProps->properties;
+	}
+
 	/**
 	 * @brief Access to the logical device.
 	 * @return The logical device.
@@ -221,6 +229,12 @@ public:
 
 	[[nodiscard]] auto getMaxSamplerAnisotropy() const -> float;
 
+	/**
+	 * @brief Get the number of valid bits of the timestamps written in the graphic queue.
+	 * @return The number of bits, 0 if the graphic queue does not support timestamps.
+	 */
+	[[nodiscard]] auto getGraphicTimestampBits() const -> uint32_t;
+
 	[[nodiscard]] auto beginSingleTimeCommands() const -> VkCommandBuffer;
 
 	void endSingleTimeCommands(VkCommandBuffer iCommandBuffer) const;
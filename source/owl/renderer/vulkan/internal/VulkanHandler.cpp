@@ -12,10 +12,48 @@
 #include "../GraphContext.h"
 #include "Descriptors.h"
 #include "core/Application.h"
+#include "renderer/utils/shaderFileUtils.h"
 #include "utils.h"
 
 namespace owl::renderer::vulkan::internal {
 
+namespace {
+
+/// Magic number at the beginning of the pipeline cache file.
+constexpr std::array<char, 4> g_pipelineCacheMagic{'O', 'V', 'P', 'C'};
+
+/**
+ * @brief Header of the pipeline cache file, identifying the device that produced the data.
+ */
+struct PipelineCacheHeader {
+	/// Magic number.
+	std::array<char, 4> magic = g_pipelineCacheMagic;
+	/// Vendor of the device.
+	uint32_t vendorId = 0;
+	/// Identifier of the device.
+	uint32_t deviceId = 0;
+	/// Version of the driver.
+	uint32_t driverVersion = 0;
+	/// Pipeline cache UUID of the device.
+	std::array<uint8_t, VK_UUID_SIZE> uuid{};
+	/// Size of the cache data.
+	uint64_t dataSize = 0;
+};
+
+auto makePipelineCacheHeader(const VkPhysicalDeviceProperties& iProperties) -> PipelineCacheHeader {
+	PipelineCacheHeader header{.vendorId = iProperties.vendorID,
+							   .deviceId = iProperties.deviceID,
+							   .driverVersion = iProperties.driverVersion};
+	std::ranges::copy(iProperties.pipelineCacheUUID, header.uuid.begin());
+	return header;
+}
+
+auto getPipelineCacheFile() -> std::filesystem::path {
+	return renderer::utils::getCacheDirectory("", "") / "vulkan_pipeline.cache";
+}
+
+}// namespace
+
 VulkanHandler::VulkanHandler() = default;
 
 VulkanHandler::~VulkanHandler() = default;
@@ -40,6 +78,8 @@ void VulkanHandler::initVulkan() {
 			return;
 		OWL_CORE_TRACE("Vulkan: Descriptor pool created.")
 	}
+	createPipelineCache();
+	createTimestampPool();
 	m_state = State::Running;
 }
 
@@ -55,6 +95,13 @@ void VulkanHandler::release() {
 			vkDestroyPipelineLayout(core.getLogicalDevice(), pipeLine.layout, nullptr);
 	}
 	m_pipeLines.clear();
+	releasePipelineCache();
+	if (m_timestampPool != nullptr) {
+		vkDestroyQueryPool(core.getLogicalDevice(), m_timestampPool, nullptr);
+		m_timestampPool = nullptr;
+	}
+	for (auto& scopes: m_gpuScopes)
+		scopes.reset();
 
 	if (m_ImGuiRenderPass != nullptr) {
 		vkDestroyRenderPass(core.getLogicalDevice(), m_ImGuiRenderPass, nullptr);
@@ -95,7 +142,7 @@ auto VulkanHandler::toImGuiInfo(std::vector<VkFormat>& ioFormats) -> ImGui_ImplV
 			.MinImageCount = m_swapChain->getImageCount(),
 			.ImageCount = m_swapChain->getImageCount(),
 			.MSAASamples = VK_SAMPLE_COUNT_1_BIT,
-			.PipelineCache = VK_NULL_HANDLE,
+			.PipelineCache = m_pipelineCache,
 			.Subpass = 0,
 			.UseDynamicRendering = false,
 			.PipelineRenderingCreateInfo = {.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR,
@@ -136,6 +183,141 @@ void VulkanHandler::createSwapChain() {
 	unbindFramebuffer();
 }
 
+void VulkanHandler::createPipelineCache() {
+	const auto& core = VulkanCore::get();
+	const auto expected = makePipelineCacheHeader(core.getPhysicalDeviceProperties());
+	std::vector<uint8_t> initialData;
+	if (owl::core::Application::instanced()) {
+		std::ifstream in(getPipelineCacheFile(), std::ios::in | std::ios::binary);
+		PipelineCacheHeader header;
+		if (in.is_open() && in.read(reinterpret_cast<char*>(&header), sizeof(PipelineCacheHeader))) {
+			if (header.magic == expected.magic && header.vendorId == expected.vendorId &&
+				header.deviceId == expected.deviceId && header.driverVersion == expected.driverVersion &&
+				header.uuid == expected.uuid) {
+				initialData.resize(header.dataSize);
+				const auto size = static_cast<std::streamsize>(header.dataSize);
+				if (!in.read(reinterpret_cast<char*>(initialData.data()), size))
+					initialData.clear();
+			} else {
+				OWL_CORE_INFO("Vulkan: pipeline cache built for another device or driver, discarded.")
+			}
+		}
+	}
+	const VkPipelineCacheCreateInfo cacheInfo{.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+											  .pNext = nullptr,
+											  .flags = {},
+											  .initialDataSize = initialData.size(),
+											  .pInitialData = initialData.empty() ? nullptr : initialData.data()};
+	if (const VkResult result =
+				vkCreatePipelineCache(core.getLogicalDevice(), &cacheInfo, nullptr, &m_pipelineCache);
+		result != VK_SUCCESS) {
+		OWL_CORE_WARN("Vulkan: failed to create pipeline cache ({}).", resultString(result))
+		m_pipelineCache = nullptr;
+		return;
+	}
+	OWL_CORE_TRACE("Vulkan: pipeline cache created ({} bytes loaded).", initialData.size())
+}
+
+void VulkanHandler::createTimestampPool() {
+	const auto& core = VulkanCore::get();
+	if (core.getGraphicTimestampBits() == 0) {
+		OWL_CORE_INFO("Vulkan: graphic queue without timestamps, GPU scopes are not timed.")
+		return;
+	}
+	const VkQueryPoolCreateInfo poolInfo{
+			.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+			.pNext = nullptr,
+			.flags = {},
+			.queryType = VK_QUERY_TYPE_TIMESTAMP,
+			.queryCount = renderer::utils::g_gpuTimingLatency * renderer::utils::g_gpuQueriesPerFrame,
+			.pipelineStatistics = {}};
+	if (const VkResult result = vkCreateQueryPool(core.getLogicalDevice(), &poolInfo, nullptr, &m_timestampPool);
+		result != VK_SUCCESS) {
+		OWL_CORE_WARN("Vulkan: failed to create timestamp query pool ({}).", resultString(result))
+		m_timestampPool = nullptr;
+		return;
+	}
+	m_timestampPeriod = static_cast<double>(core.getPhysicalDeviceProperties().limits.timestampPeriod);
+	m_timestampsReset = false;
+}
+
+void VulkanHandler::collectTimestamps() {
+	m_gpuFrameIndex = (m_gpuFrameIndex + 1) % renderer::utils::g_gpuTimingLatency;
+	m_timestampsReset = false;
+	auto& scopes = m_gpuScopes[m_gpuFrameIndex];
+	if (!scopes.hasTimestamps())
+		return;
+	// each query gives its value followed by its availability.
+	const uint32_t queryCount = scopes.getQueryCount();
+	std::vector<uint64_t> results(2 * static_cast<size_t>(queryCount), 0);
+	const uint32_t firstQuery = m_gpuFrameIndex * renderer::utils::g_gpuQueriesPerFrame;
+	const VkResult result = vkGetQueryPoolResults(VulkanCore::get().getLogicalDevice(), m_timestampPool, firstQuery,
+												  queryCount, results.size() * sizeof(uint64_t), results.data(),
+												  2 * sizeof(uint64_t),
+												  VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+	if (result != VK_SUCCESS && result != VK_NOT_READY) {
+		scopes.reset();
+		return;
+	}
+	std::vector<uint64_t> timestamps(queryCount, 0);
+	bool ready = true;
+	for (uint32_t i = 0; i < queryCount / 2 && ready; ++i) {
+		if (!scopes.isComplete(i))
+			continue;
+		for (const uint32_t query: {2 * i, 2 * i + 1}) {
+			ready = ready && results[2 * query + 1] != 0;
+			timestamps[query] = static_cast<uint64_t>(static_cast<double>(results[2 * query]) * m_timestampPeriod);
+		}
+	}
+	// results not ready are dropped rather than waited for.
+	if (ready)
+		scopes.publish(timestamps);
+	scopes.reset();
+}
+
+void VulkanHandler::beginGpuScope(const uint32_t iNameId) {
+	if (m_timestampPool == nullptr)
+		return;
+	if (const auto query = m_gpuScopes[m_gpuFrameIndex].begin(iNameId, inBatch && m_timestampsReset);
+		query.has_value())
+		vkCmdWriteTimestamp(getCurrentCommandBuffer(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_timestampPool,
+							m_gpuFrameIndex * renderer::utils::g_gpuQueriesPerFrame + query.value());
+}
+
+void VulkanHandler::endGpuScope() {
+	if (m_timestampPool == nullptr)
+		return;
+	if (const auto query = m_gpuScopes[m_gpuFrameIndex].end(inBatch && m_timestampsReset); query.has_value())
+		vkCmdWriteTimestamp(getCurrentCommandBuffer(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_timestampPool,
+							m_gpuFrameIndex * renderer::utils::g_gpuQueriesPerFrame + query.value());
+}
+
+void VulkanHandler::releasePipelineCache() {
+	if (m_pipelineCache == nullptr)
+		return;
+	const auto& core = VulkanCore::get();
+	size_t dataSize = 0;
+	if (owl::core::Application::instanced() &&
+		vkGetPipelineCacheData(core.getLogicalDevice(), m_pipelineCache, &dataSize, nullptr) == VK_SUCCESS &&
+		dataSize > 0) {
+		std::vector<uint8_t> data(dataSize);
+		if (vkGetPipelineCacheData(core.getLogicalDevice(), m_pipelineCache, &dataSize, data.data()) == VK_SUCCESS) {
+			auto header = makePipelineCacheHeader(core.getPhysicalDeviceProperties());
+			header.dataSize = dataSize;
+			const auto file = getPipelineCacheFile();
+			if (!exists(file.parent_path()))
+				create_directories(file.parent_path());
+			std::ofstream out(file, std::ios::out | std::ios::binary);
+			out.write(reinterpret_cast<const char*>(&header), sizeof(PipelineCacheHeader));
+			out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(dataSize));
+			if (!out)
+				OWL_CORE_WARN("Vulkan: failed to write pipeline cache {}.", file.string())
+		}
+	}
+	vkDestroyPipelineCache(core.getLogicalDevice(), m_pipelineCache, nullptr);
+	m_pipelineCache = nullptr;
+}
+
 auto VulkanHandler::getPipeline(const int32_t iId) const -> VulkanHandler::PipeLineData {
 	if (m_state == State::Running || !m_pipeLines.contains(iId))
 		return {};
@@ -288,7 +470,7 @@ auto VulkanHandler::pushPipeline(const std::string& iPipeLineName,
 													.basePipelineIndex = 0};
 
 	OWL_CORE_TRACE("Vulkan pipeline: vkCreateGraphicsPipelines")
-	if (const VkResult result = vkCreateGraphicsPipelines(core.getLogicalDevice(), VK_NULL_HANDLE, 1, &pipelineInfo,
+	if (const VkResult result = vkCreateGraphicsPipelines(core.getLogicalDevice(), m_pipelineCache, 1, &pipelineInfo,
 														  nullptr, &pData.pipeLine);
 		result != VK_SUCCESS) {
 		OWL_CORE_ERROR("Vulkan: failed to create graphics pipeline for {} ({})", iPipeLineName, resultString(result))
@@ -332,6 +514,8 @@ void VulkanHandler::beginFrame() {
 	if (m_state != State::Running)
 		return;
 	const auto& core = VulkanCore::get();
+	if (m_timestampPool != nullptr)
+		collectTimestamps();
 	unbindFramebuffer();
 	m_currentframebuffer->resetBatch();
 	vkWaitForFences(core.getLogicalDevice(), 1, m_currentframebuffer->getCurrentFence(), VK_TRUE, UINT64_MAX);
@@ -385,6 +569,13 @@ void VulkanHandler::beginBatch() {
 		m_state = State::ErrorBeginCommandBuffer;
 		return;
 	}
+	if (m_timestampPool != nullptr && !m_timestampsReset) {
+		// queries must be reset outside a render pass, before the first scope of the frame.
+		vkCmdResetQueryPool(getCurrentCommandBuffer(), m_timestampPool,
+							m_gpuFrameIndex * renderer::utils::g_gpuQueriesPerFrame,
+							renderer::utils::g_gpuQueriesPerFrame);
+		m_timestampsReset = true;
+	}
 
 	const VkRenderPassBeginInfo renderPassInfo{
 			.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
@@ -11,6 +11,7 @@
 #include "VulkanCore.h"
 
 #include <backends/imgui_impl_vulkan.h>
+#include <renderer/utils/GpuScopeRecorder.h>
 #include <renderer/vulkan/Framebuffer.h>
 
 /**
@@ -155,6 +156,23 @@ public:
 	void unbindFramebuffer();
 	[[nodiscard]] auto getCurrentFrameBufferName() const -> std::string;
 
+	/**
+	 * @brief Write the start timestamp of a GPU scope.
+	 * @param[in] iNameId Interned name of the scope.
+	 */
+	void beginGpuScope(uint32_t iNameId);
+
+	/**
+	 * @brief Write the end timestamp of the innermost GPU scope.
+	 */
+	void endGpuScope();
+
+	/**
+	 * @brief Check if the GPU scopes are timed.
+	 * @return True if the timestamp queries are available.
+	 */
+	[[nodiscard]] auto hasGpuTimers() const -> bool { return m_timestampPool != nullptr; }
+
 private:
 	/**
 	 * @brief Default Constructor.
@@ -168,6 +186,26 @@ private:
 
 	void createSwapChain();
 
+	/**
+	 * @brief Create the pipeline cache, initialized from the cache file if it matches the device.
+	 */
+	void createPipelineCache();
+
+	/**
+	 * @brief Write the pipeline cache to the cache file and destroy it.
+	 */
+	void releasePipelineCache();
+
+	/**
+	 * @brief Create the timestamp query pool if the device supports it.
+	 */
+	void createTimestampPool();
+
+	/**
+	 * @brief Read back the timestamps of the frame slot about to be reused, without waiting.
+	 */
+	void collectTimestamps();
+
 	/// The current state of the handler.
 	State m_state = State::Uninitialized;
 	/// Loaded version.
@@ -186,5 +224,18 @@ private:
 
 	/// List of piplines.
 	std::map<int32_t, PipeLineData> m_pipeLines;
+	/// The pipeline cache.
+	VkPipelineCache m_pipelineCache{nullptr};
+
+	/// The timestamp queries of all the frame slots.
+	VkQueryPool m_timestampPool{nullptr};
+	/// Duration of a timestamp tick in nanoseconds.
+	double m_timestampPeriod = 1.0;
+	/// The GPU scopes of the frame slots.
+	std::array<renderer::utils::GpuScopeRecorder, renderer::utils::g_gpuTimingLatency> m_gpuScopes;
+	/// The frame slot being recorded.
+	uint32_t m_gpuFrameIndex = 0;
+	/// If the queries of the frame slot have been reset.
+	bool m_timestampsReset = false;
 };
 }// namespace owl::renderer::vulkan::internal
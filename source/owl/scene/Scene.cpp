@@ -262,7 +262,8 @@ void Scene::render() {
 										  .color = text.color,
 										  .kerning = text.kerning,
 										  .lineSpacing = text.lineSpacing,
-										  .entityId = static_cast<int>(entity)});
+										  .entityId = static_cast<int>(entity),
+										  .layout = &text.layout});
 	}
 }
 
@@ -10,7 +10,7 @@
 
 #include "core/Application.h"
 #include "core/Core.h"
-#include "fonts/Font.h"
+#include "fonts/TextLayout.h"
 #include "math/YamlSerializers.h"
 
 namespace owl::scene::component {
@@ -29,6 +29,8 @@ struct OWL_API Text {
 	float kerning = 0.0f;
 	/// The line spacing.
 	float lineSpacing = 0.0f;
+	/// The layout of the last rendering, computed again when the text properties change.
+	fonts::TextLayout layout;
 	/**
 	 * @brief Get the class title.
 	 * @return The class title.
@@ -0,0 +1,126 @@
+/**
+ * @file main.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include <owl.h>
+
+#include <magic_enum/magic_enum.hpp>
+#include <renderer/utils/TextureCooker.h>
+
+namespace {
+
+using owl::renderer::utils::CookOptions;
+using owl::renderer::utils::CookResult;
+
+void printUsage() {
+	OWL_INFO("Usage: owl_cook [options] <input> [output]")
+	OWL_INFO("  <input>        Source image or directory (searched recursively for .png & .jpg).")
+	OWL_INFO("  [output]       Output file or directory (default: next to the sources).")
+	OWL_INFO("Options:")
+	OWL_INFO("  --format <fmt> Target pixel format: R8, RGB8 or RGBA8 (default: RGBA8).")
+	OWL_INFO("  --no-mips      Do not generate the mip chain.")
+	OWL_INFO("  --force        Cook even if the output is up-to-date.")
+}
+
+auto isSourceImage(const std::filesystem::path& iPath) -> bool {
+	const auto ext = iPath.extension();
+	return ext == ".png" || ext == ".jpg";
+}
+
+/**
+ * @brief Simple statistics of the run.
+ */
+struct CookStats {
+	/// Number of cooked files.
+	uint32_t cooked = 0;
+	/// Number of up-to-date files.
+	uint32_t upToDate = 0;
+	/// Number of failures.
+	uint32_t failed = 0;
+};
+
+void cookOne(const std::filesystem::path& iSource, const std::filesystem::path& iDestination,
+			 const CookOptions& iOptions, CookStats& ioStats) {
+	switch (cookFile(iSource, iDestination, iOptions)) {
+		case CookResult::Cooked:
+			OWL_INFO("Cooked     {}", iDestination.string())
+			++ioStats.cooked;
+			break;
+		case CookResult::UpToDate:
+			OWL_TRACE("Up-to-date {}", iDestination.string())
+			++ioStats.upToDate;
+			break;
+		case CookResult::Failed:
+			OWL_ERROR("Failed     {}", iSource.string())
+			++ioStats.failed;
+			break;
+	}
+}
+
+}// namespace
+
+auto main(const int iArgc, char* iArgv[]) -> int {
+	owl::core::Log::init(spdlog::level::info);
+	CookOptions options;
+	std::vector<std::filesystem::path> positional;
+	const std::span args(iArgv, static_cast<size_t>(iArgc));
+	for (size_t i = 1; i < args.size(); ++i) {
+		const std::string_view arg{args[i]};
+		if (arg == "--help" || arg == "-h") {
+			printUsage();
+			owl::core::Log::invalidate();
+			return 0;
+		}
+		if (arg == "--no-mips") {
+			options.generateMips = false;
+		} else if (arg == "--force") {
+			options.force = true;
+		} else if (arg == "--format" && i + 1 < args.size()) {
+			const auto format = magic_enum::enum_cast<owl::renderer::ImageFormat>(args[++i]);
+			if (!format.has_value()) {
+				OWL_ERROR("Unknown format {}", args[i])
+				owl::core::Log::invalidate();
+				return 1;
+			}
+			options.format = format.value();
+		} else {
+			positional.emplace_back(arg);
+		}
+	}
+	if (positional.empty() || positional.size() > 2) {
+		printUsage();
+		owl::core::Log::invalidate();
+		return 1;
+	}
+	const auto& input = positional.front();
+	const bool hasOutput = positional.size() == 2;
+	CookStats stats;
+	const auto ext = owl::renderer::utils::getCookedExtension();
+	if (is_directory(input)) {
+		const auto outputDir = hasOutput ? positional.back() : input;
+		for (const auto& entry: std::filesystem::recursive_directory_iterator(input)) {
+			if (!entry.is_regular_file() || !isSourceImage(entry.path()))
+				continue;
+			auto destination = outputDir / relative(entry.path(), input);
+			destination.replace_extension(ext);
+			cookOne(entry.path(), destination, options, stats);
+		}
+	} else if (exists(input)) {
+		auto destination = hasOutput ? positional.back() : input;
+		if (!hasOutput || is_directory(destination)) {
+			destination = (hasOutput ? destination : input.parent_path()) / input.filename();
+			destination.replace_extension(ext);
+		}
+		cookOne(input, destination, options, stats);
+	} else {
+		OWL_ERROR("Input {} does not exist.", input.string())
+		owl::core::Log::invalidate();
+		return 1;
+	}
+	OWL_INFO("Done: {} cooked, {} up-to-date, {} failed.", stats.cooked, stats.upToDate, stats.failed)
+	owl::core::Log::invalidate();
+	return stats.failed > 0 ? 1 : 0;
+}
@@ -46,7 +46,6 @@ private:
 	[[nodiscard]] auto isConnected() const -> bool;
 	void toggleConnect();
 
-	bool connected = false;
 	bool showStats = true;
 	bool showFakeDrone = true;
 
@@ -15,12 +15,13 @@ CameraSystem::CameraSystem() { resize({1, 1}); }
 CameraSystem::~CameraSystem() = default;
 
 void CameraSystem::onUpdate(const owl::core::Timestep& iTs) {
-	++m_frameCount;
 	auto& cameraManager = owl::input::video::Manager::get();
 	auto& settings = IO::DroneSettings::get();
 
-	// read image from camera
-	if (m_frameCount % m_frameCheck == 0) {
+	// check the devices periodically
+	m_probeElapsed += iTs.getSeconds();
+	if (m_probeElapsed >= s_probePeriod) {
+		m_probeElapsed = 0.f;
 		if (const size_t nbCam = cameraManager.getDeviceCount(); nbCam == 0) {
 			settings.useCamera = false;
 		} else {
@@ -35,35 +36,76 @@ void CameraSystem::onUpdate(const owl::core::Timestep& iTs) {
 				cameraManager.open(static_cast<size_t>(settings.cameraId));
 			}
 		}
-		if (cameraManager.isOpened()) {
-			if (!settings.useCamera) {
-				cameraManager.close();
-			}
-			// Define the frameSkip
-			if (const float frameRateTs = iTs.getStabilizedFps(); frameRateTs > 0) {
-				m_frameSkip = static_cast<int32_t>(240.f / frameRateTs);
-			}
+		if (cameraManager.isOpened() && !settings.useCamera) {
+			cameraManager.close();
 		}
 	}
 
-	if (m_frameSkip <= 0 || m_frameCount % m_frameSkip == 0) {
-		if (cameraManager.isOpened()) {
-			cameraManager.fillFrame(m_frame);
-		} else {
-			resize({1, 1});
-			uint8_t color[] = {45, 87, 96};
-			m_frame->setData(&color, 3);
-		}
+	// the recording ends with its camera.
+	if (m_recorder && (!cameraManager.isOpened() || cameraManager.getCurrentDevice() != m_recordedDevice))
+		stopRecording();
+
+	const auto device = cameraManager.isOpened() ? cameraManager.getCurrentDevice() : nullptr;
+	if (!device) {
+		m_polledDevice.reset();
+		resize({1, 1});
+		return;
+	}
+	if (device != m_polledDevice) {
+		m_polledDevice = device;
+		m_nextPoll = {};
+		m_lastTimestamp = {};
+		m_lastDropped = 0;
+		m_lostFrames = 0;
+	}
+	// no new frame before the next capture: skip the poll, that would block a synchronous device.
+	const auto now = std::chrono::steady_clock::now();
+	if (now < m_nextPoll)
+		return;
+	if (device->getSize().y() > 0) {
+		const auto& nativeSize = device->getSize();
+		const owl::math::vec2ui displaySize{m_displayHeight * nativeSize.x() / nativeSize.y(), m_displayHeight};
+		device->setDecodeScale(owl::input::video::chooseDecodeScale(nativeSize, displaySize));
+		// NV12 and YUYV frames are converted by the video shader.
+		device->setGpuConversion(true);
+	}
+	// the textures are only updated by a new frame.
+	cameraManager.fillFrame(m_frame);
+	if (m_frame.timestamp == m_lastTimestamp)
+		return;
+	// the frames replaced in the mailbox are already counted by the device statistics.
+	const uint64_t dropped = device->getStatistics().dropped;
+	if (m_lastTimestamp != std::chrono::steady_clock::time_point{} && m_frame.sequence > m_lastSequence + 1) {
+		const uint64_t gap = m_frame.sequence - m_lastSequence - 1;
+		const uint64_t replaced = dropped > m_lastDropped ? dropped - m_lastDropped : 0;
+		if (gap > replaced)
+			m_lostFrames += gap - replaced;
 	}
+	m_lastDropped = dropped;
+	m_lastTimestamp = m_frame.timestamp;
+	m_lastSequence = m_frame.sequence;
+	// a small margin absorbs the capture jitter.
+	m_nextPoll = m_frame.timestamp +
+				 std::chrono::duration_cast<std::chrono::steady_clock::duration>(device->getFrameInterval() * 0.75);
 }
 
 void CameraSystem::resize(const owl::math::vec2ui& iSize) {
-	if (iSize == m_size)
+	// the camera may have replaced the frame by its own textures.
+	if (iSize == m_size && m_frame.texture && m_frame.texture->getSize() == iSize &&
+		m_frame.layout == owl::renderer::YuvLayout::None)
 		return;
 	m_size = iSize;
-	m_frame.reset();
-	m_frame = owl::renderer::Texture2D::create(
+	m_frame = {};
+	m_frame.texture = owl::renderer::Texture2D::create(
 			{.size = m_size, .format = owl::renderer::ImageFormat::RGB8, .generateMips = false});
+	// the placeholder color, uploaded once.
+	std::vector<uint8_t> color(3ull * m_size.surface());
+	for (size_t i = 0; i < color.size(); i += 3) {
+		color[i] = 45;
+		color[i + 1] = 87;
+		color[i + 2] = 96;
+	}
+	m_frame.texture->setData(color.data(), static_cast<uint32_t>(color.size()));
 }
 
 // NOLINTBEGIN(readability-convert-member-functions-to-static)
@@ -93,6 +135,18 @@ auto CameraSystem::getCurrentCameraId() const -> int32_t {
 	return owl::input::video::Manager::get().getCurrentDeviceId();
 }
 
+auto CameraSystem::getCaptureStatistics() const -> owl::input::video::Device::Statistics {
+	if (!m_polledDevice)
+		return {};
+	return m_polledDevice->getStatistics();
+}
+
+auto CameraSystem::getFrameInterval() const -> std::chrono::duration<double> {
+	if (!m_polledDevice)
+		return {};
+	return m_polledDevice->getFrameInterval();
+}
+
 auto CameraSystem::getCurrentCameraName() const -> std::string {
 	const auto& sys = owl::input::video::Manager::get();
 	if (!sys.isOpened())
@@ -101,12 +155,41 @@ auto CameraSystem::getCurrentCameraName() const -> std::string {
 }
 // NOLINTEND(readability-convert-member-functions-to-static)
 
+auto CameraSystem::startRecording(const std::filesystem::path& iFile) -> bool {
+	stopRecording();
+	const auto& cameraManager = owl::input::video::Manager::get();
+	const auto device = cameraManager.getCurrentDevice();
+	if (!cameraManager.isOpened() || !device)
+		return false;
+	// the frames are written by the recorder thread, fed by the capture thread.
+	auto recorder = owl::mkShared<owl::input::video::FrameRecorder>();
+	if (!recorder->start(iFile, device->getPixelFormat(), device->getSize()))
+		return false;
+	device->setRecorder(recorder);
+	m_recorder = std::move(recorder);
+	m_recordedDevice = device;
+	return true;
+}
+
+void CameraSystem::stopRecording() {
+	if (!m_recorder)
+		return;
+	m_recordedDevice->setRecorder(nullptr);
+	m_recorder->stop();
+	m_recorder.reset();
+	m_recordedDevice.reset();
+}
+
 void CameraSystem::invalidate() {
+	stopRecording();
 	m_size = {0, 0};
-	m_frameSkip = 0;
-	m_frameCheck = 50;
-	m_frameCount = 0;
-	m_frame.reset();
+	m_probeElapsed = s_probePeriod;
+	m_frame = {};
+	m_polledDevice.reset();
+	m_nextPoll = {};
+	m_lastTimestamp = {};
+	m_lastSequence = 0;
+	m_lostFrames = 0;
 }
 
 }// namespace drone::IO
@@ -42,9 +42,15 @@ public:
 
 	/**
 	 * @brief Get the camera frame.
-	 * @return The camera frame.
+	 * @return The camera frame textures.
 	 */
-	[[nodiscard]] auto getFrame() const -> const owl::shared<owl::renderer::Texture>& { return m_frame; }
+	[[nodiscard]] auto getFrame() const -> const owl::input::video::FrameTextures& { return m_frame; }
+
+	/**
+	 * @brief Define the height at which the frame is displayed, to decode the compressed frames at a smaller size.
+	 * @param[in] iHeight The displayed height in pixels, zero for the native size.
+	 */
+	void setDisplayHeight(const uint32_t iHeight) { m_displayHeight = iHeight; }
 
 	/**
 	 * @brief Set the camera by its ID.
@@ -76,6 +82,50 @@ public:
 	 */
 	[[nodiscard]] auto getListOfCameraNames() const -> std::vector<std::string>;
 
+	/**
+	 * @brief Get the capture statistics of the current camera.
+	 * @return The statistics, empty without camera.
+	 */
+	[[nodiscard]] auto getCaptureStatistics() const -> owl::input::video::Device::Statistics;
+
+	/**
+	 * @brief Get the time between two frames of the current camera.
+	 * @return The frame interval, zero if unknown.
+	 */
+	[[nodiscard]] auto getFrameInterval() const -> std::chrono::duration<double>;
+
+	/**
+	 * @brief Get the number of frames missing in the sequence of the displayed frames.
+	 * @return The number of frames captured by the camera, never displayed and not replaced in the mailbox.
+	 */
+	[[nodiscard]] auto getLostFrames() const -> uint64_t { return m_lostFrames; }
+
+	/**
+	 * @brief Start recording the frames of the current camera.
+	 * @param[in] iFile The recording file, its extension is defined by the pixel format of the camera.
+	 * @return True if the recording started.
+	 */
+	auto startRecording(const std::filesystem::path& iFile) -> bool;
+
+	/**
+	 * @brief Stop the recording and complete its file.
+	 */
+	void stopRecording();
+
+	/**
+	 * @brief Check if the camera is recorded.
+	 * @return True if recording.
+	 */
+	[[nodiscard]] auto isRecording() const -> bool { return m_recorder != nullptr; }
+
+	/**
+	 * @brief Get the current recording.
+	 * @return The recorder, nullptr if not recording.
+	 */
+	[[nodiscard]] auto getRecorder() const -> const owl::shared<owl::input::video::FrameRecorder>& {
+		return m_recorder;
+	}
+
 	/**
 	 * @brief Destroy internal objects.
 	 */
@@ -91,11 +141,30 @@ private:
 
 	owl::math::vec2ui m_size;
 
-	int32_t m_frameSkip = 0;
-	int32_t m_frameCheck = 50;
-	int32_t m_frameCount = 0;
-
-	owl::shared<owl::renderer::Texture> m_frame;
+	/// Time between two checks of the devices, in seconds.
+	static constexpr float s_probePeriod{1.f};
+	/// Time since the last check of the devices, in seconds.
+	float m_probeElapsed = s_probePeriod;
+	/// Height at which the frame is displayed.
+	uint32_t m_displayHeight = 0;
+
+	owl::input::video::FrameTextures m_frame;
+	/// The recorder of the camera frames.
+	owl::shared<owl::input::video::FrameRecorder> m_recorder;
+	/// The recorded camera.
+	owl::shared<owl::input::video::Device> m_recordedDevice;
+	/// The camera providing the frame.
+	owl::shared<owl::input::video::Device> m_polledDevice;
+	/// Earliest time of the next frame.
+	std::chrono::steady_clock::time_point m_nextPoll;
+	/// Capture time of the displayed frame.
+	std::chrono::steady_clock::time_point m_lastTimestamp;
+	/// Sequence number of the displayed frame.
+	uint64_t m_lastSequence = 0;
+	/// Frames replaced in the device mailbox at the displayed frame.
+	uint64_t m_lastDropped = 0;
+	/// Number of frames missing in the sequence, not counting the replaced ones.
+	uint64_t m_lostFrames = 0;
 };
 
 }// namespace drone::IO
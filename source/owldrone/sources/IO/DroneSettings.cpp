@@ -23,6 +23,7 @@ void DroneSettings::readFromFile(const std::filesystem::path &file) {
 		if (appConfig["cameraId"]) cameraId = appConfig["cameraId"].as<int>();
 		if (appConfig["useSerialPort"]) useSerialPort = appConfig["useSerialPort"].as<bool>();
 		if (appConfig["SerialPort"]) serialPort = appConfig["SerialPort"].as<std::string>();
+		if (appConfig["SerialBaudRate"]) serialBaudRate = appConfig["SerialBaudRate"].as<uint32_t>();
 	}
 }
 
@@ -34,6 +35,7 @@ void DroneSettings::saveToFile(const std::filesystem::path &file) const {
 	out << YAML::Key << "cameraId" << YAML::Value << cameraId;
 	out << YAML::Key << "useSerialPort" << YAML::Value << useSerialPort;
 	out << YAML::Key << "SerialPort" << YAML::Value << serialPort;
+	out << YAML::Key << "SerialBaudRate" << YAML::Value << serialBaudRate;
 	out << YAML::EndMap;
 	out << YAML::EndMap;
 
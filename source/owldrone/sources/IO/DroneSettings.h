@@ -55,6 +55,8 @@ public:
 	int32_t cameraId = 1;
 	/// The serial port in use.
 	std::string serialPort;
+	/// The baud rate of the serial port.
+	uint32_t serialBaudRate = 115200;
 
 private:
 	/**
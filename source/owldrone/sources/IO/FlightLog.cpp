@@ -0,0 +1,218 @@
+/**
+ * @file FlightLog.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "FlightLog.h"
+#include "CameraSystem.h"
+#include "DroneSettings.h"
+#include "TelemetrySystem.h"
+
+namespace drone::IO {
+
+namespace {
+
+/**
+ * @brief Payload of a camera frame record.
+ */
+struct CameraFrameRecord {
+	/// The capture sequence number.
+	uint64_t sequence = 0;
+	/// The capture time from the start of the session, in nanoseconds.
+	int64_t timestamp = 0;
+};
+
+}// namespace
+
+FlightLog::FlightLog() = default;
+
+FlightLog::~FlightLog() = default;
+
+void FlightLog::onUpdate(const owl::core::Timestep& iTs) {
+	if (m_replaying)
+		replayFrame(iTs);
+	else if (isRecording())
+		recordFrame(iTs.getTimePoint());
+}
+
+void FlightLog::onEvent(const owl::event::Event& iEvent) {
+	if (!isRecording())
+		return;
+	if (owl::input::session::EventPayload payload; owl::input::session::SessionWriter::encodeEvent(iEvent, payload))
+		m_writer.pushValue(static_cast<uint16_t>(RecordType::Input), m_frameTime, payload);
+}
+
+auto FlightLog::startRecording(const std::filesystem::path& iFile) -> bool {
+	stopReplay();
+	stopRecording();
+	if (!m_writer.start(iFile))
+		return false;
+	m_frameTime = m_writer.getStart();
+	m_cameraFile.clear();
+	m_cameraTimestamp = {};
+	auto& camSys = CameraSystem::get();
+	if (!camSys.isRecording() && owl::input::video::Manager::get().isOpened())
+		m_cameraRecording = camSys.startRecording(iFile);
+	return true;
+}
+
+void FlightLog::stopRecording() {
+	if (!isRecording())
+		return;
+	m_writer.stop();
+	if (m_cameraRecording)
+		CameraSystem::get().stopRecording();
+	m_cameraRecording = false;
+}
+
+auto FlightLog::startReplay(const std::filesystem::path& iFile, const bool iMaxSpeed) -> bool {
+	stopRecording();
+	stopReplay();
+	if (!m_reader.open(iFile))
+		return false;
+	// the replay is the only source of the remote controller.
+	TelemetrySystem::get().disconnect();
+	m_replaying = true;
+	m_maxSpeed = iMaxSpeed;
+	m_replayTime = {};
+	m_statistics = {};
+	m_replayStart = std::chrono::steady_clock::now();
+	OWL_INFO("Flight log: replaying {} ({:.1f} s, {} records{}).", iFile.string(),
+			 std::chrono::duration<double>(m_reader.getDuration()).count(), m_reader.getRecords().size(),
+			 m_maxSpeed ? ", max speed" : "")
+	return true;
+}
+
+void FlightLog::stopReplay() {
+	if (!m_replaying)
+		return;
+	m_replaying = false;
+	m_reader.close();
+	m_camera.reset();
+	const double elapsed = m_statistics.elapsed.count();
+	OWL_INFO("Flight log: replayed {:.2f} s of session in {:.2f} s, {} frames ({:.1f} fps), {} records.",
+			 m_statistics.replayed.count(), elapsed, m_statistics.frames,
+			 elapsed > 0 ? static_cast<double>(m_statistics.frames) / elapsed : 0.0, m_statistics.records)
+}
+
+auto FlightLog::getReplayProgress() const -> float {
+	const auto duration = m_reader.getDuration();
+	if (!m_replaying || duration.count() <= 0)
+		return m_replaying ? 0.f : 1.f;
+	return static_cast<float>(std::chrono::duration<double>(m_replayTime) / std::chrono::duration<double>(duration));
+}
+
+void FlightLog::invalidate() {
+	stopRecording();
+	stopReplay();
+	m_remote.reset();
+	m_inputHandler = nullptr;
+}
+
+void FlightLog::recordFrame(const std::chrono::steady_clock::time_point iTime) {
+	OWL_PROFILE_FUNCTION()
+	m_frameTime = iTime;
+	if (m_remote)
+		m_writer.pushValue(static_cast<uint16_t>(RecordType::State), iTime, m_remote->getState());
+	const auto& camSys = CameraSystem::get();
+	if (camSys.isRecording() && camSys.getRecorder()->getFile() != m_cameraFile) {
+		// the camera file, with its frame interval for the replay pace.
+		m_cameraFile = camSys.getRecorder()->getFile();
+		const double interval = camSys.getFrameInterval().count();
+		const std::string file = m_cameraFile.string();
+		std::vector<uint8_t> payload(sizeof(interval));
+		std::memcpy(payload.data(), &interval, sizeof(interval));
+		payload.insert(payload.end(), file.begin(), file.end());
+		m_writer.push(static_cast<uint16_t>(RecordType::CameraFile), iTime, payload);
+	}
+	if (const auto& frame = camSys.getFrame(); frame.timestamp != m_cameraTimestamp) {
+		m_cameraTimestamp = frame.timestamp;
+		m_writer.pushValue(static_cast<uint16_t>(RecordType::CameraFrame), iTime,
+						   CameraFrameRecord{.sequence = frame.sequence,
+											 .timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+																  frame.timestamp - m_writer.getStart())
+																  .count()});
+	}
+}
+
+void FlightLog::replayFrame(const owl::core::Timestep& iTs) {
+	OWL_PROFILE_FUNCTION()
+	using owl::input::session::SessionReader;
+	if (m_maxSpeed)
+		m_replayTime = m_reader.getNextTime();
+	else
+		m_replayTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::duration<float>(iTs.getSeconds()));
+	const auto records = m_reader.advanceTo(m_replayTime);
+	bool newState = false;
+	std::optional<uint64_t> cameraSequence;
+	for (const auto& record: records) {
+		switch (static_cast<RecordType>(record.type)) {
+			case RecordType::State:
+				if (controller::Telemetry state; m_remote && SessionReader::readValue(record, state)) {
+					m_remote->publishTelemetry(state);
+					newState = true;
+				}
+				break;
+			case RecordType::CameraFrame:
+				if (CameraFrameRecord frame; SessionReader::readValue(record, frame)) {
+					cameraSequence = frame.sequence;
+					++m_statistics.cameraFrames;
+				}
+				break;
+			case RecordType::Input:
+				if (const auto event = SessionReader::decodeEvent(record); event && m_inputHandler) {
+					m_inputHandler(*event);
+					++m_statistics.inputs;
+				}
+				break;
+			case RecordType::CameraFile:
+				openCamera(record);
+				break;
+		}
+	}
+	if (newState)
+		m_remote->applyTelemetry();
+	// the camera shows the frame displayed with the replayed state, the previous references are outdated.
+	if (cameraSequence.has_value() && m_camera && !m_camera->showFrame(cameraSequence.value()))
+		++m_statistics.missingCameraFrames;
+	++m_statistics.frames;
+	m_statistics.records += records.size();
+	m_statistics.replayed = std::min(m_replayTime, m_reader.getDuration());
+	m_statistics.elapsed = std::chrono::steady_clock::now() - m_replayStart;
+	if (m_reader.isFinished())
+		stopReplay();
+}
+
+void FlightLog::openCamera(const owl::input::session::SessionReader::Record& iRecord) {
+	using owl::input::video::Device;
+	using owl::input::video::FileDevice;
+	// the recorded frame interval is not used: the frames are shown by the frame records.
+	if (iRecord.payload.size() <= sizeof(double))
+		return;
+	const auto name = iRecord.payload.subspan(sizeof(double));
+	const std::filesystem::path file{std::string{name.begin(), name.end()}};
+	if (!exists(file)) {
+		OWL_WARN("Flight log: camera recording {} not found.", file.string())
+		return;
+	}
+	const bool mjpeg = file.extension() == owl::input::video::FrameRecorder::getExtension(Device::PixelFormat::MJpeg);
+	// the camera follows the replay clock, at the recorded pace or at max speed.
+	const auto device = owl::mkShared<FileDevice>(
+			file, FileDevice::Specification{.format = mjpeg ? Device::PixelFormat::MJpeg : Device::PixelFormat::Nv12,
+											.size = {},
+											.frameRate = 0.f,
+											.loop = false,
+											.stepped = true});
+	auto& cameraManager = owl::input::video::Manager::get();
+	cameraManager.close();
+	if (const int8_t id = cameraManager.addDevice(device); id >= 0) {
+		DroneSettings::get().useCamera = true;
+		CameraSystem::get().setCamera(id);
+		m_camera = device;
+	}
+}
+
+}// namespace drone::IO
@@ -0,0 +1,215 @@
+/**
+ * @file FlightLog.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "controller/RemoteController.h"
+
+namespace drone::IO {
+
+/**
+ * @brief Class FlightLog, recording and replaying the flight sessions.
+ *
+ * A session log holds, for each frame, the state of the remote controller, the reference of the displayed camera
+ * frame and the input events. The replay feeds them back through the remote controller, the camera system and the
+ * event handler, at the recorded pace or as fast as possible to measure the throughput. The camera recording is
+ * replayed by a stepped device, showing the frame referenced by the replayed records.
+ */
+class FlightLog final {
+public:
+	/**
+	 * @brief Types of the records.
+	 */
+	enum struct RecordType : uint16_t {
+		/// State of the remote controller.
+		State = 1,
+		/// Sequence number and capture time of the displayed camera frame.
+		CameraFrame,
+		/// Input event.
+		Input,
+		/// Frame interval and file of the camera recording.
+		CameraFile,
+	};
+
+	/**
+	 * @brief Replay statistics.
+	 */
+	struct ReplayStatistics {
+		/// Number of frames displayed.
+		uint64_t frames = 0;
+		/// Number of records replayed.
+		uint64_t records = 0;
+		/// Number of camera frames referenced.
+		uint64_t cameraFrames = 0;
+		/// Number of referenced camera frames missing in the camera recording.
+		uint64_t missingCameraFrames = 0;
+		/// Number of input events replayed.
+		uint64_t inputs = 0;
+		/// Replayed time of the session.
+		std::chrono::duration<double> replayed{0};
+		/// Time spent replaying.
+		std::chrono::duration<double> elapsed{0};
+	};
+
+	/**
+	 * @brief Destructor.
+	 */
+	~FlightLog();
+
+	FlightLog(const FlightLog&) = delete;
+	FlightLog(FlightLog&&) = delete;
+	auto operator=(const FlightLog&) -> FlightLog& = delete;
+	auto operator=(FlightLog&&) -> FlightLog& = delete;
+
+	/**
+	 * @brief Singleton get.
+	 * @return Instance of the Flight Log.
+	 */
+	static auto get() -> FlightLog& {
+		static FlightLog instance;
+		return instance;
+	}
+
+	/**
+	 * @brief Define the remote controller to record or to feed.
+	 * @param[in] iRemote The remote controller.
+	 */
+	void setRemoteController(const owl::shared<controller::RemoteController>& iRemote) { m_remote = iRemote; }
+
+	/**
+	 * @brief Define the function receiving the replayed input events.
+	 * @param[in] iHandler The event handler.
+	 */
+	void setInputHandler(std::function<void(owl::event::Event&)> iHandler) { m_inputHandler = std::move(iHandler); }
+
+	/**
+	 * @brief Frame update: record the current state, or replay the next records.
+	 * @param[in] iTs The frame time step.
+	 */
+	void onUpdate(const owl::core::Timestep& iTs);
+
+	/**
+	 * @brief Record an input event, with the time of the last frame so it is replayed with it.
+	 * @param[in] iEvent The event.
+	 */
+	void onEvent(const owl::event::Event& iEvent);
+
+	/**
+	 * @brief Start recording a session, with the camera frames if a camera is open.
+	 * @param[in] iFile The base name of the log and camera files.
+	 * @return True if the recording started.
+	 */
+	auto startRecording(const std::filesystem::path& iFile) -> bool;
+
+	/**
+	 * @brief Stop the recording.
+	 */
+	void stopRecording();
+
+	/**
+	 * @brief Check if a session is recorded.
+	 * @return True if recording.
+	 */
+	[[nodiscard]] auto isRecording() const -> bool { return m_writer.isRecording(); }
+
+	/**
+	 * @brief Get the session log writer.
+	 * @return The writer.
+	 */
+	[[nodiscard]] auto getWriter() const -> const owl::input::session::SessionWriter& { return m_writer; }
+
+	/**
+	 * @brief Start replaying a session.
+	 * @param[in] iFile The session log.
+	 * @param[in] iMaxSpeed If the records are replayed as fast as possible, one recorded frame per frame.
+	 * @return True if the replay started.
+	 */
+	auto startReplay(const std::filesystem::path& iFile, bool iMaxSpeed) -> bool;
+
+	/**
+	 * @brief Stop the replay.
+	 */
+	void stopReplay();
+
+	/**
+	 * @brief Check if a session is replayed.
+	 * @return True if replaying.
+	 */
+	[[nodiscard]] auto isReplaying() const -> bool { return m_replaying; }
+
+	/**
+	 * @brief Get the replay progression.
+	 * @return The replayed fraction of the session.
+	 */
+	[[nodiscard]] auto getReplayProgress() const -> float;
+
+	/**
+	 * @brief Get the statistics of the running or last replay.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getReplayStatistics() const -> const ReplayStatistics& { return m_statistics; }
+
+	/**
+	 * @brief Destroy internal objects.
+	 */
+	void invalidate();
+
+private:
+	/**
+	 * @brief Constructor.
+	 */
+	FlightLog();
+
+	/**
+	 * @brief Record the state of the frame.
+	 * @param[in] iTime The frame time.
+	 */
+	void recordFrame(std::chrono::steady_clock::time_point iTime);
+
+	/**
+	 * @brief Replay the records due at this frame.
+	 * @param[in] iTs The frame time step.
+	 */
+	void replayFrame(const owl::core::Timestep& iTs);
+
+	/**
+	 * @brief Open the replay of a camera recording.
+	 * @param[in] iRecord The camera file record.
+	 */
+	void openCamera(const owl::input::session::SessionReader::Record& iRecord);
+
+	/// The remote controller.
+	owl::shared<controller::RemoteController> m_remote;
+	/// The handler of the replayed events.
+	std::function<void(owl::event::Event&)> m_inputHandler;
+	/// The session log writer.
+	owl::input::session::SessionWriter m_writer;
+	/// Time of the last recorded frame, the time of the following events.
+	std::chrono::steady_clock::time_point m_frameTime;
+	/// If the camera recording was started with the session.
+	bool m_cameraRecording = false;
+	/// The recorded camera file.
+	std::filesystem::path m_cameraFile;
+	/// Capture time of the last recorded camera frame.
+	std::chrono::steady_clock::time_point m_cameraTimestamp;
+	/// The session log reader.
+	owl::input::session::SessionReader m_reader;
+	/// The device replaying the camera recording.
+	owl::shared<owl::input::video::FileDevice> m_camera;
+	/// If a session is replayed.
+	bool m_replaying = false;
+	/// If the replay runs as fast as possible.
+	bool m_maxSpeed = false;
+	/// The replay clock.
+	std::chrono::nanoseconds m_replayTime{0};
+	/// Start of the replay.
+	std::chrono::steady_clock::time_point m_replayStart;
+	/// The replay statistics.
+	ReplayStatistics m_statistics;
+};
+
+}// namespace drone::IO
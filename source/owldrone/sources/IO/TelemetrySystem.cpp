@@ -0,0 +1,134 @@
+/**
+ * @file TelemetrySystem.cpp
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "TelemetrySystem.h"
+#include "DeviceManager.h"
+#include "DroneSettings.h"
+
+namespace drone::IO {
+
+namespace {
+
+// NOLINTBEGIN(*-magic-numbers)
+/// MSP commands of the telemetry.
+enum struct Command : uint16_t {
+	/// Motor outputs, 8 × uint16 in µs.
+	Motor = 104,
+	/// GPS data, ground speed as uint16 in cm/s at offset 12.
+	RawGps = 106,
+	/// Attitude, roll and pitch as int16 in tenths of degree, heading as int16 in degrees.
+	Attitude = 108,
+	/// Altitude, int32 in cm and vertical speed as int16 in cm/s.
+	Altitude = 109,
+};
+
+/// Rate of the telemetry requests in Hz.
+constexpr float g_requestRate{100.f};
+/// Motor output giving a zero rate, in µs.
+constexpr float g_motorIdle{1000.f};
+/// Motor output range, in µs.
+constexpr float g_motorRange{1000.f};
+/// Motor rate at full output.
+constexpr float g_motorFullRate{6000.f};
+
+/**
+ * @brief Read a little endian value in a payload.
+ * @tparam T The value type.
+ * @param[in] iPayload The payload.
+ * @param[in] iOffset Position of the value.
+ * @return The value.
+ */
+template<typename T>
+auto readValue(const std::span<const uint8_t> iPayload, const size_t iOffset) -> T {
+	T value{};
+	std::memcpy(&value, iPayload.subspan(iOffset, sizeof(T)).data(), sizeof(T));
+	return value;
+}
+// NOLINTEND(*-magic-numbers)
+
+}// namespace
+
+TelemetrySystem::TelemetrySystem()
+	: m_link{[this](const owl::input::serial::MspFrame& iFrame) { onMessage(iFrame); }} {}
+
+TelemetrySystem::~TelemetrySystem() { disconnect(); }
+
+void TelemetrySystem::setRemoteController(const owl::shared<controller::RemoteController>& iRemote) {
+	// the link thread publishes to the remote controller.
+	disconnect();
+	m_remote = iRemote;
+}
+
+void TelemetrySystem::onUpdate() {
+	if (m_link.isOpened() && m_link.isLost())
+		disconnect();
+	if (m_remote)
+		m_remote->applyTelemetry();
+}
+
+auto TelemetrySystem::connect() -> bool {
+	disconnect();
+	const auto& settings = DroneSettings::get();
+	const auto& device = DeviceManager::get().getCurrentDevice();
+	if (!m_remote || !settings.useSerialPort || !device)
+		return false;
+	m_state = {};
+	return m_link.open({.port = device->port,
+						.baudRate = settings.serialBaudRate,
+						.requests = {static_cast<uint16_t>(Command::Attitude), static_cast<uint16_t>(Command::Altitude),
+									 static_cast<uint16_t>(Command::RawGps), static_cast<uint16_t>(Command::Motor)},
+						.requestRate = g_requestRate});
+}
+
+void TelemetrySystem::disconnect() { m_link.close(); }
+
+void TelemetrySystem::invalidate() {
+	disconnect();
+	m_remote.reset();
+	m_state = {};
+}
+
+// NOLINTBEGIN(*-magic-numbers)
+void TelemetrySystem::onMessage(const owl::input::serial::MspFrame& iFrame) {
+	if (iFrame.direction != owl::input::serial::MspDirection::Response)
+		return;
+	const auto& payload = iFrame.payload;
+	switch (static_cast<Command>(iFrame.command)) {
+		case Command::Attitude:
+			if (payload.size() < 6)
+				return;
+			m_state.rotations = {static_cast<float>(readValue<int16_t>(payload, 0)) / 10.f,
+								 static_cast<float>(readValue<int16_t>(payload, 2)) / 10.f,
+								 static_cast<float>(readValue<int16_t>(payload, 4))};
+			break;
+		case Command::Altitude:
+			if (payload.size() < 6)
+				return;
+			m_state.altitude = static_cast<float>(readValue<int32_t>(payload, 0)) / 100.f;
+			m_state.verticalVelocity = static_cast<float>(readValue<int16_t>(payload, 4)) / 100.f;
+			break;
+		case Command::RawGps:
+			if (payload.size() < 14)
+				return;
+			m_state.horizontalVelocity = static_cast<float>(readValue<uint16_t>(payload, 12)) / 100.f;
+			break;
+		case Command::Motor:
+			m_state.motorCount = static_cast<uint32_t>(
+					std::min(payload.size() / sizeof(uint16_t), controller::Telemetry::s_maxMotors));
+			for (size_t i = 0; i < m_state.motorCount; ++i) {
+				const float output = static_cast<float>(readValue<uint16_t>(payload, i * sizeof(uint16_t)));
+				m_state.motors.at(i) = std::clamp((output - g_motorIdle) / g_motorRange, 0.f, 1.f) * g_motorFullRate;
+			}
+			break;
+		default:
+			return;
+	}
+	m_remote->publishTelemetry(m_state);
+}
+// NOLINTEND(*-magic-numbers)
+
+}// namespace drone::IO
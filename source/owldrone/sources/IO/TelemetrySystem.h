@@ -0,0 +1,102 @@
+/**
+ * @file TelemetrySystem.h
+ * @author Silmaen
+ * @date 19/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "controller/RemoteController.h"
+
+namespace drone::IO {
+
+/**
+ * @brief Class TelemetrySystem, reading the telemetry of the flight controller on the serial port.
+ *
+ * The messages are read and decoded by the thread of the link, which publishes the state to the remote controller.
+ * The UI thread only applies the latest state.
+ */
+class TelemetrySystem final {
+public:
+	/**
+	 * @brief Destructor.
+	 */
+	~TelemetrySystem();
+
+	TelemetrySystem(const TelemetrySystem&) = delete;
+	TelemetrySystem(TelemetrySystem&&) = delete;
+	auto operator=(const TelemetrySystem&) -> TelemetrySystem& = delete;
+	auto operator=(TelemetrySystem&&) -> TelemetrySystem& = delete;
+
+	/**
+	 * @brief Singleton get.
+	 * @return Instance of the Telemetry System.
+	 */
+	static auto get() -> TelemetrySystem& {
+		static TelemetrySystem instance;
+		return instance;
+	}
+
+	/**
+	 * @brief Define the remote controller receiving the telemetry, closing the link.
+	 * @param[in] iRemote The remote controller.
+	 */
+	void setRemoteController(const owl::shared<controller::RemoteController>& iRemote);
+
+	/**
+	 * @brief Frame update: close a lost link and apply the latest telemetry to the remote controller.
+	 */
+	void onUpdate();
+
+	/**
+	 * @brief Open the link on the current serial device.
+	 * @return True if the link is opened.
+	 */
+	auto connect() -> bool;
+
+	/**
+	 * @brief Close the link.
+	 */
+	void disconnect();
+
+	/**
+	 * @brief Check if the link is opened.
+	 * @return True if connected.
+	 */
+	[[nodiscard]] auto isConnected() const -> bool { return m_link.isOpened(); }
+
+	/**
+	 * @brief Get the statistics of the link.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStatistics() const -> owl::input::serial::MspLink::Statistics {
+		return m_link.getStatistics();
+	}
+
+	/**
+	 * @brief Destroy internal objects.
+	 */
+	void invalidate();
+
+private:
+	/**
+	 * @brief Constructor.
+	 */
+	TelemetrySystem();
+
+	/**
+	 * @brief Decode a message and publish the new state, called by the link thread.
+	 * @param[in] iFrame The message.
+	 */
+	void onMessage(const owl::input::serial::MspFrame& iFrame);
+
+	/// The remote controller receiving the telemetry.
+	owl::shared<controller::RemoteController> m_remote;
+	/// The state decoded by the link thread.
+	controller::Telemetry m_state;
+	/// The link to the flight controller.
+	owl::input::serial::MspLink m_link;
+};
+
+}// namespace drone::IO
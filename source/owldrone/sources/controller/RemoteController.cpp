@@ -17,6 +17,31 @@ void RemoteController::setMotorRates(const std::vector<float>& mot) {
 	}
 }
 
+auto RemoteController::applyTelemetry() -> bool {
+	if (m_telemetry.getVersion() == m_telemetryVersion)
+		return false;
+	Telemetry telemetry;
+	m_telemetryVersion = m_telemetry.load(telemetry);
+	m_horizontalVelocity = telemetry.horizontalVelocity;
+	m_verticalVelocity = telemetry.verticalVelocity;
+	m_altitude = telemetry.altitude;
+	m_rotations = {telemetry.rotations[0], telemetry.rotations[1], telemetry.rotations[2]};
+	const size_t count = std::min({m_motors.size(), static_cast<size_t>(telemetry.motorCount), Telemetry::s_maxMotors});
+	std::copy_n(telemetry.motors.begin(), count, m_motors.begin());
+	return true;
+}
+
+auto RemoteController::getState() const -> Telemetry {
+	Telemetry state{.horizontalVelocity = m_horizontalVelocity,
+					.verticalVelocity = m_verticalVelocity,
+					.altitude = m_altitude,
+					.rotations = {m_rotations.x(), m_rotations.y(), m_rotations.z()},
+					.motors = {},
+					.motorCount = static_cast<uint32_t>(std::min(m_motors.size(), Telemetry::s_maxMotors))};
+	std::copy_n(m_motors.begin(), state.motorCount, state.motors.begin());
+	return state;
+}
+
 RemoteController::~RemoteController() = default;
 
 }// namespace drone::controller
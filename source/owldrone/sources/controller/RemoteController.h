@@ -11,6 +11,26 @@
 
 namespace drone::controller {
 
+/**
+ * @brief State of the drone decoded from the telemetry.
+ */
+struct Telemetry {
+	/// Largest number of motors.
+	static constexpr size_t s_maxMotors{8};
+	/// The horizontal velocity.
+	float horizontalVelocity = 0;
+	/// The vertical velocity.
+	float verticalVelocity = 0;
+	/// The altitude.
+	float altitude = 0;
+	/// The rotations roll pitch yaw.
+	std::array<float, 3> rotations{};
+	/// The motor rates.
+	std::array<float, s_maxMotors> motors{};
+	/// Number of motor rates.
+	uint32_t motorCount = 0;
+};
+
 /**
  * @brief Class RemoteController
  */
@@ -27,26 +47,10 @@ public:
 	 */
 	~RemoteController();
 
-	/**
-	 * @brief Copy constructor.
-	 */
-	RemoteController(const RemoteController&) = default;
-
-	/**
-	 * @brief Move constructor.
-	 */
-	RemoteController(RemoteController&&) = default;
-
-	/**
-	 * @brief Copy affectation operator.
-	 */
-	auto operator=(const RemoteController&) -> RemoteController& = default;
-
-	/**
-	 * @brief Move affectation operator.
-	 */
-	auto operator=(RemoteController&&) -> RemoteController& = default;
-
+	RemoteController(const RemoteController&) = delete;
+	RemoteController(RemoteController&&) = delete;
+	auto operator=(const RemoteController&) -> RemoteController& = delete;
+	auto operator=(RemoteController&&) -> RemoteController& = delete;
 
 	/**
 	 * @brief Reads the horizontal velocity.
@@ -108,6 +112,30 @@ public:
 	 */
 	void setMotorRates(const std::vector<float>& mot);
 
+	/**
+	 * @brief Publish a new telemetry state, from any thread.
+	 * @param[in] iTelemetry The telemetry state.
+	 */
+	void publishTelemetry(const Telemetry& iTelemetry) { m_telemetry.store(iTelemetry); }
+
+	/**
+	 * @brief Get the latest telemetry state, from any thread.
+	 * @return The telemetry state.
+	 */
+	[[nodiscard]] auto getTelemetry() const -> Telemetry { return m_telemetry.load(); }
+
+	/**
+	 * @brief Get the current values as a telemetry state.
+	 * @return The state of the values.
+	 */
+	[[nodiscard]] auto getState() const -> Telemetry;
+
+	/**
+	 * @brief Copy the latest telemetry state in the values, from the thread reading them.
+	 * @return True if a new state was published since the last call.
+	 */
+	auto applyTelemetry() -> bool;
+
 private:
 	/// The horizontal velocity.
 	float m_horizontalVelocity = 0;
@@ -119,6 +147,10 @@ private:
 	owl::math::vec3 m_rotations = {0.f, 0.f, 0.f};
 	/// The vertical velocity.
 	std::vector<float> m_motors;
+	/// The published telemetry.
+	owl::core::utils::SeqLock<Telemetry> m_telemetry;
+	/// Version of the applied telemetry.
+	uint64_t m_telemetryVersion = 0;
 };
 
 }// namespace drone::controller
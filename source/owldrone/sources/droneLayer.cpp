@@ -11,6 +11,8 @@
 #include "IO/CameraSystem.h"
 #include "IO/DeviceManager.h"
 #include "IO/DroneSettings.h"
+#include "IO/FlightLog.h"
+#include "IO/TelemetrySystem.h"
 #include "panels/Gauges.h"
 #include "panels/Information.h"
 #include "panels/Settings.h"
@@ -59,12 +61,17 @@ void DroneLayer::onAttach() {
 	gauges->setRemoteController(rc);
 	information->setRemoteController(rc);
 	viewport->setRemoteController(rc);
+	IO::TelemetrySystem::get().setRemoteController(rc);
+	IO::FlightLog::get().setRemoteController(rc);
+	IO::FlightLog::get().setInputHandler([this](event::Event& ioEvent) { onEvent(ioEvent); });
 }
 
 void DroneLayer::onDetach() {
 	OWL_PROFILE_FUNCTION()
 
+	IO::FlightLog::get().invalidate();
 	IO::CameraSystem::get().invalidate();
+	IO::TelemetrySystem::get().invalidate();
 	rc.reset();
 	settings.reset();
 	gauges.reset();
@@ -79,6 +86,8 @@ void DroneLayer::onUpdate(const core::Timestep& iTimeStep) {
 	OWL_PROFILE_FUNCTION()
 
 	renderer::Renderer2D::resetStats();
+	IO::TelemetrySystem::get().onUpdate();
+	IO::FlightLog::get().onUpdate(iTimeStep);
 
 	switch (mode) {
 		case DisplayMode::Settings:
@@ -93,6 +102,7 @@ void DroneLayer::onUpdate(const core::Timestep& iTimeStep) {
 }
 
 void DroneLayer::onEvent(event::Event& ioEvent) {
+	IO::FlightLog::get().onEvent(ioEvent);
 
 	event::EventDispatcher dispatcher(ioEvent);
 	dispatcher.dispatch<event::KeyPressedEvent>(
@@ -296,7 +306,13 @@ void DroneLayer::renderToolbar() {
 }
 OWL_DIAG_POP
 
-auto DroneLayer::isConnected() const -> bool { return connected; }
-void DroneLayer::toggleConnect() { connected = !connected; }
+auto DroneLayer::isConnected() const -> bool { return IO::TelemetrySystem::get().isConnected(); }
+void DroneLayer::toggleConnect() {
+	auto& telemetry = IO::TelemetrySystem::get();
+	if (telemetry.isConnected())
+		telemetry.disconnect();
+	else if (!telemetry.connect())
+		OWL_WARN("Unable to connect the telemetry.")
+}
 
 }// namespace drone
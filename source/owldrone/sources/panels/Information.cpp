@@ -6,6 +6,9 @@
  * All modification must get authorization from the author.
  */
 #include "Information.h"
+#include "IO/CameraSystem.h"
+#include "IO/FlightLog.h"
+#include "IO/TelemetrySystem.h"
 
 namespace drone::panels {
 
@@ -19,6 +22,46 @@ void Information::onUpdate(const owl::core::Timestep &) {
 void Information::onRender() {
 	ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2{0, 0});
 	ImGui::Begin("Drone Misc");
+	if (ImGui::CollapsingHeader("Camera", ImGuiTreeNodeFlags_DefaultOpen)) {
+		const auto& camSys = IO::CameraSystem::get();
+		const auto statistics = camSys.getCaptureStatistics();
+		if (const double interval = camSys.getFrameInterval().count(); interval > 0)
+			ImGui::Text("%s", fmt::format("Capture rate: {:.1f} fps", 1.0 / interval).c_str());
+		else
+			ImGui::Text("Capture rate: unknown");
+		ImGui::Text("%s", fmt::format("Frames captured: {}, displayed: {}", statistics.captured, statistics.uploaded)
+								  .c_str());
+		ImGui::Text("%s", fmt::format("Dropped frames: {} replaced, {} lost", statistics.dropped,
+									  camSys.getLostFrames())
+								  .c_str());
+		ImGui::Text("%s", fmt::format("Latency: {:.1f} ms (mean {:.1f} ms)", statistics.lastLatency.count(),
+									  statistics.meanLatency.count())
+								  .c_str());
+	}
+	if (ImGui::CollapsingHeader("Telemetry", ImGuiTreeNodeFlags_DefaultOpen)) {
+		const auto& telemetry = IO::TelemetrySystem::get();
+		if (telemetry.isConnected()) {
+			const auto statistics = telemetry.getStatistics();
+			ImGui::Text("%s", fmt::format("Received: {} bytes, {} messages", statistics.bytes, statistics.frames)
+									  .c_str());
+			ImGui::Text("%s", fmt::format("Errors: {}, requests: {}", statistics.errors, statistics.requests).c_str());
+		} else {
+			ImGui::Text("Not connected");
+		}
+	}
+	if (const auto& flightLog = IO::FlightLog::get(); flightLog.isReplaying()) {
+		if (ImGui::CollapsingHeader("Replay", ImGuiTreeNodeFlags_DefaultOpen)) {
+			const auto& statistics = flightLog.getReplayStatistics();
+			ImGui::ProgressBar(flightLog.getReplayProgress());
+			ImGui::Text("%s", fmt::format("Replayed: {:.1f} s in {:.1f} s", statistics.replayed.count(),
+										  statistics.elapsed.count())
+									  .c_str());
+			ImGui::Text("%s", fmt::format("Frames: {}, records: {}, camera frames: {} ({} missing), inputs: {}",
+										  statistics.frames, statistics.records, statistics.cameraFrames,
+										  statistics.missingCameraFrames, statistics.inputs)
+									  .c_str());
+		}
+	}
 
 	ImGui::End();
 	ImGui::PopStyleVar();
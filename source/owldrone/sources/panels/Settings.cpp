@@ -9,6 +9,7 @@
 #include "IO/CameraSystem.h"
 #include "IO/DeviceManager.h"
 #include "IO/DroneSettings.h"
+#include "IO/FlightLog.h"
 
 namespace drone::panels {
 
@@ -56,6 +57,26 @@ void Settings::onRender() {
 			if (ImGui::Button("Refresh List")) {
 				camSys.actualiseList();
 			}
+			if (camSys.isRecording()) {
+				if (ImGui::Button("Stop Recording")) {
+					camSys.stopRecording();
+				} else {
+					const auto& recorder = camSys.getRecorder();
+					const auto statistics = recorder->getStatistics();
+					ImGui::SameLine();
+					ImGui::Text("%s", fmt::format("{}: {} frames, {:.1f} MB", recorder->getFile().filename().string(),
+												  statistics.written, static_cast<double>(statistics.bytes) / 1048576.0)
+											  .c_str());
+					ImGui::Text("%s", fmt::format("Dropped frames: {}, queue peak: {}", statistics.dropped,
+												  statistics.maxQueued)
+											  .c_str());
+				}
+			} else if (ImGui::Button("Start Recording")) {
+				const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(
+						std::chrono::system_clock::now().time_since_epoch());
+				camSys.startRecording(owl::core::Application::get().getWorkingDirectory() / "recordings" /
+									  fmt::format("flight_{}", seconds.count()));
+			}
 		}
 	}
 	static bool comOpen = true;
@@ -98,6 +119,44 @@ void Settings::onRender() {
 			}
 		}
 	}
+	static bool logOpen = true;
+	if (ImGui::CollapsingHeader("Flight Log", static_cast<ImGuiTreeNodeFlags>(logOpen))) {
+		auto& flightLog = IO::FlightLog::get();
+		if (flightLog.isRecording()) {
+			if (ImGui::Button("Stop Session Recording")) {
+				flightLog.stopRecording();
+			} else {
+				const auto& writer = flightLog.getWriter();
+				const auto statistics = writer.getStatistics();
+				ImGui::SameLine();
+				ImGui::Text("%s", fmt::format("{}: {} records, {:.1f} kB, {} dropped",
+											  writer.getFile().filename().string(), statistics.records,
+											  static_cast<double>(statistics.bytes) / 1024.0, statistics.dropped)
+										  .c_str());
+			}
+		} else if (flightLog.isReplaying()) {
+			if (ImGui::Button("Stop Replay"))
+				flightLog.stopReplay();
+			ImGui::SameLine();
+			ImGui::ProgressBar(flightLog.getReplayProgress());
+		} else {
+			if (ImGui::Button("Start Session Recording")) {
+				const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(
+						std::chrono::system_clock::now().time_since_epoch());
+				flightLog.startRecording(owl::core::Application::get().getWorkingDirectory() / "recordings" /
+										 fmt::format("flight_{}", seconds.count()));
+			}
+			static bool maxSpeed = false;
+			ImGui::SameLine();
+			if (ImGui::Button("Replay Session")) {
+				if (const auto file = owl::core::utils::FileDialog::openFile("Owl Session (*.owls)|owls\n");
+					!file.empty())
+					flightLog.startReplay(file, maxSpeed);
+			}
+			ImGui::SameLine();
+			ImGui::Checkbox("Max speed", &maxSpeed);
+		}
+	}
 	ImGui::End();
 	ImGui::PopStyleVar();
 }
@@ -47,6 +47,8 @@ void Viewport::onUpdate(const core::Timestep& iTimeStep) {
 
 	const float aspectRatio = m_viewportSize.ratio();
 	const float scaling = std::min(aspectRatio, 2.f);
+	// the frame height is scaling and the viewport height 2.
+	cam.setDisplayHeight(static_cast<uint32_t>(static_cast<float>(m_viewportSize.y()) * scaling / 2.f));
 
 	if (m_viewportSize.surface() > 0 && m_viewportSize != spec.size) {
 		mp_framebuffer->resize(m_viewportSize);
@@ -63,9 +65,12 @@ void Viewport::onUpdate(const core::Timestep& iTimeStep) {
 	// Do the drawings!
 	// ===============================================================
 	renderer::Renderer2D::beginScene(*m_camera);
-	const float ratio = cam.getFrame()->getSize().ratio();
-	const math::Transform tran{{0, 0, 0}, {0, 0, 180}, {ratio * scaling, 1 * scaling, 0}};
-	renderer::Renderer2D::drawQuad({.transform = tran, .texture = cam.getFrame()});
+	const auto& frame = cam.getFrame();
+	const float ratio = frame.texture->getSize().ratio();
+	const float mirror = frame.mirror ? -1.f : 1.f;
+	const math::Transform tran{{0, 0, 0}, {0, 0, 180}, {mirror * ratio * scaling, 1 * scaling, 0}};
+	renderer::Renderer2D::drawQuad(
+			{.transform = tran, .texture = frame.texture, .yuvLayout = frame.layout, .chromaTexture = frame.chroma});
 	renderer::Renderer2D::endScene();
 	// ===============================================================
 	// free the frame buffer.
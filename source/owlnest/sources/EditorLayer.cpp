@@ -206,6 +206,8 @@ void EditorLayer::renderMenu() {
 			if (ImGui::MenuItem("Show Stats", nullptr, m_showStats)) {
 				m_showStats = !m_showStats;
 			}
+			if (ImGui::MenuItem("Frame Profiler", "F3", debug::FrameProfiler::isEnabled()))
+				debug::FrameProfiler::setEnabled(!debug::FrameProfiler::isEnabled());
 			ImGui::EndMenu();
 		}
 		ImGui::EndMenuBar();
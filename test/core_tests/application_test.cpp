@@ -18,6 +18,9 @@ TEST(Core, ApplicationDummy) {
 	params.useDebugging = true;
 	auto app = owl::mkShared<Application>(params);
 	EXPECT_EQ(app->getState(), Application::State::Running);
+	EXPECT_TRUE(app->getAssetIndex().isReady());
+	EXPECT_FALSE(app->getStartupTrace().empty());
+	EXPECT_TRUE(std::ranges::all_of(app->getStartupTrace(), [](const auto& iTiming) { return iTiming.success; }));
 	Application::invalidate();
 	app.reset();
 	Log::invalidate();
@@ -2,6 +2,7 @@
 #include "testHelper.h"
 
 #include <core/Application.h>
+#include <fstream>
 #include <renderer/Renderer.h>
 
 using namespace owl::core;
@@ -20,3 +21,131 @@ TEST(AssetLibrary, DummyTexture) {
 	app.reset();
 	Log::invalidate();
 }
+
+TEST(AssetLibrary, MemoryBudget) {
+	Log::init(spdlog::level::off);
+	RenderCommand::create(RenderAPI::Type::Null);
+	const AppParams params{.name = "super boby", .renderer = RenderAPI::Type::Null, .hasGui = false, .isDummy = true};
+	auto app = owl::mkShared<Application>(params);
+	{
+		auto lib = Renderer::TextureLibrary();
+		lib.load("CheckerBoard");
+		EXPECT_TRUE(lib.isResident("CheckerBoard"));
+		EXPECT_EQ(lib.getMemoryUsage(), 4);
+		lib.setMemoryBudget(1);
+		EXPECT_TRUE(lib.exists("CheckerBoard"));
+		EXPECT_FALSE(lib.isResident("CheckerBoard"));
+		EXPECT_EQ(lib.getMemoryUsage(), 0);
+		{
+			const auto tex = lib.get("CheckerBoard");
+			EXPECT_NE(tex, nullptr);
+			EXPECT_TRUE(lib.isResident("CheckerBoard"));
+			EXPECT_EQ(lib.trim(), 0);
+		}
+		EXPECT_EQ(lib.trim(), 4);
+		EXPECT_FALSE(lib.isResident("CheckerBoard"));
+		// non reloadable assets are never evicted.
+		auto bob = Texture2D::create(Texture2D::Specification{{1, 1}, ImageFormat::RGB8});
+		lib.add("superbob", bob);
+		bob.reset();
+		EXPECT_EQ(lib.trim(), 0);
+		EXPECT_TRUE(lib.isResident("superbob"));
+	}
+	Application::invalidate();
+	app.reset();
+	RenderCommand::invalidate();
+	Log::invalidate();
+}
+
+TEST(AssetLibrary, LookupWithoutTrim) {
+	Log::init(spdlog::level::off);
+	RenderCommand::create(RenderAPI::Type::Null);
+	const AppParams params{.name = "super boby", .renderer = RenderAPI::Type::Null, .hasGui = false, .isDummy = true};
+	auto app = owl::mkShared<Application>(params);
+	{
+		auto lib = Renderer::TextureLibrary();
+		lib.setMemoryBudget(4);
+		{
+			// the referenced assets are kept over the budget.
+			const auto checker = lib.load("CheckerBoard");
+			const auto mario = lib.load("mario");
+			EXPECT_GT(lib.getMemoryUsage(), lib.getMemoryBudget());
+		}
+		// the lookup of a resident asset leaves the trimming to the frame end.
+		EXPECT_NE(lib.get("CheckerBoard"), nullptr);
+		EXPECT_TRUE(lib.isResident("mario"));
+		EXPECT_GT(lib.trim(), 0);
+		EXPECT_TRUE(lib.isResident("CheckerBoard"));
+		EXPECT_FALSE(lib.isResident("mario"));
+	}
+	Application::invalidate();
+	app.reset();
+	RenderCommand::invalidate();
+	Log::invalidate();
+}
+
+TEST(AssetLibrary, Index) {
+	Log::init(spdlog::level::off);
+	const auto root = std::filesystem::temp_directory_path() / "owl_asset_index";
+	const auto second = std::filesystem::temp_directory_path() / "owl_asset_index2";
+	std::filesystem::remove_all(root);
+	std::filesystem::remove_all(second);
+	create_directories(root / "textures" / "sub");
+	create_directories(second);
+	for (const auto& file: {root / "logo.png", root / "textures" / "sub" / "wood.png", second / "wood.jpg"}) {
+		std::ofstream out(file);
+		out << "x";
+	}
+	assets::AssetIndex index;
+	EXPECT_FALSE(index.isReady());
+	index.build({root, second});
+	EXPECT_TRUE(index.isReady());
+	EXPECT_EQ(index.size(), 3);
+	const std::vector<std::string> ext{".png", ".jpg"};
+	EXPECT_EQ(index.find("logo", ext).value_or(""), root / "logo.png");
+	EXPECT_EQ(index.find("wood", ext).value_or(""), root / "textures" / "sub" / "wood.png");
+	EXPECT_EQ(index.find("sub/wood.png", ext).value_or(""), root / "textures" / "sub" / "wood.png");
+	EXPECT_EQ(index.find("wood.jpg", ext).value_or(""), second / "wood.jpg");
+	EXPECT_FALSE(index.find("ood", ext).has_value());
+	EXPECT_EQ(index.list({".jpg"}).size(), 1);
+	// a file created after the build.
+	{
+		std::ofstream out(root / "textures" / "stone.png");
+		out << "x";
+	}
+	EXPECT_FALSE(index.find("stone", ext).has_value());
+	index.insert(root / "textures" / "stone.png");
+	index.insert(root / "textures" / "stone.png");
+	index.insert(std::filesystem::temp_directory_path() / "stone.png");
+	EXPECT_EQ(index.size(), 4);
+	EXPECT_EQ(index.find("stone", ext).value_or(""), root / "textures" / "stone.png");
+	index.clear();
+	EXPECT_FALSE(index.isReady());
+	std::filesystem::remove_all(root);
+	std::filesystem::remove_all(second);
+	Log::invalidate();
+}
+
+TEST(AssetLibrary, CreatedAfterIndex) {
+	Log::init(spdlog::level::off);
+	RenderCommand::create(RenderAPI::Type::Null);
+	const AppParams params{.name = "super boby", .renderer = RenderAPI::Type::Null, .hasGui = false, .isDummy = true};
+	auto app = owl::mkShared<Application>(params);
+	ASSERT_TRUE(app->getAssetIndex().isReady());
+	const auto file = app->getAssetDirectories().front().assetsPath / "textures" / "owl_created.png";
+	{
+		std::ofstream out(file);
+		out << "x";
+	}
+	{
+		const auto lib = Renderer::TextureLibrary();
+		EXPECT_EQ(lib.find("owl_created").value_or(""), file);
+		// the file is now indexed.
+		EXPECT_EQ(app->getAssetIndex().find("owl_created", {".png"}).value_or(""), file);
+	}
+	std::filesystem::remove(file);
+	Application::invalidate();
+	app.reset();
+	RenderCommand::invalidate();
+	Log::invalidate();
+}
@@ -2,6 +2,7 @@
 #include "testHelper.h"
 
 #include <core/task/Scheduler.h>
+#include <core/task/TaskGraph.h>
 
 using namespace owl::core;
 using namespace owl::core::task;
@@ -122,3 +123,77 @@ TEST(core_task, SchedulerTimers) {
 	std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
 	EXPECT_EQ(counter, 8);
 }
+
+TEST(core_task, TaskGraphOrder) {
+	Log::init(spdlog::level::off);
+	TaskGraph graph;
+	std::mutex mutex;
+	std::vector<std::string> order;
+	auto record = [&](const std::string& iName) {
+		return [&, iName] {
+			const std::lock_guard lock(mutex);
+			order.push_back(iName);
+			return true;
+		};
+	};
+	graph.add("final", record("final"), {"main", "worker2"}, TaskGraph::Affinity::Main);
+	graph.add("worker1", record("worker1"));
+	graph.add("worker2", record("worker2"), {"worker1"});
+	graph.add("main", record("main"), {}, TaskGraph::Affinity::Main);
+	EXPECT_TRUE(graph.run());
+	ASSERT_EQ(order.size(), 4);
+	EXPECT_EQ(order.back(), "final");
+	EXPECT_LT(std::ranges::find(order, "worker1"), std::ranges::find(order, "worker2"));
+	ASSERT_EQ(graph.getTimings().size(), 4);
+	EXPECT_EQ(graph.getTimings().back().name, "final");
+	EXPECT_EQ(graph.getTimings().back().affinity, TaskGraph::Affinity::Main);
+	EXPECT_GE(graph.getDuration(), 0.0);
+	Log::invalidate();
+}
+
+TEST(core_task, TaskGraphSerial) {
+	Log::init(spdlog::level::off);
+	TaskGraph graph;
+	graph.setConcurrent(false);
+	EXPECT_FALSE(graph.isConcurrent());
+	const auto caller = std::this_thread::get_id();
+	std::vector<std::string> order;
+	auto record = [&](const std::string& iName) {
+		return [&, iName] {
+			order.push_back(iName);
+			return std::this_thread::get_id() == caller;
+		};
+	};
+	graph.add("worker1", record("worker1"));
+	graph.add("worker2", record("worker2"), {"worker1"});
+	graph.add("main", record("main"), {"worker1"}, TaskGraph::Affinity::Main);
+	EXPECT_TRUE(graph.run());
+	ASSERT_EQ(order.size(), 3);
+	EXPECT_EQ(order.front(), "worker1");
+	Log::invalidate();
+}
+
+TEST(core_task, TaskGraphFailures) {
+	Log::init(spdlog::level::off);
+	{
+		TaskGraph graph;
+		bool dependentRun = false;
+		graph.add("fail", [] { return false; });
+		graph.add("dependent", [&] { return dependentRun = true; }, {"fail"});
+		EXPECT_FALSE(graph.run());
+		EXPECT_FALSE(dependentRun);
+	}
+	{
+		TaskGraph graph;
+		graph.add("a", [] { return true; }, {"b"});
+		graph.add("b", [] { return true; }, {"a"});
+		EXPECT_FALSE(graph.run());
+		EXPECT_TRUE(graph.getTimings().empty());
+	}
+	{
+		TaskGraph graph;
+		graph.add("a", [] { return true; }, {"unknown"});
+		EXPECT_FALSE(graph.run());
+	}
+	Log::invalidate();
+}
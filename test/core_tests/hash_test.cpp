@@ -0,0 +1,27 @@
+#include "testHelper.h"
+
+#include <core/utils/HashUtils.h>
+
+using namespace owl::core::utils;
+
+TEST(Hash, bytes) {
+	EXPECT_EQ(hashString(""), g_hashSeed);
+	EXPECT_EQ(hashString("a"), 0xaf63dc4c8601ec8cull);
+	EXPECT_NE(hashString("ab"), hashString("ba"));
+	EXPECT_EQ(hashString("b", hashString("a")), hashString("ab"));
+}
+
+TEST(Hash, file) {
+	const auto file = std::filesystem::temp_directory_path() / "owl_hash_test.txt";
+	EXPECT_FALSE(hashFile(file).has_value());
+	{
+		std::ofstream out(file);
+		out << "owl";
+	}
+	const auto hash = hashFile(file);
+	ASSERT_TRUE(hash.has_value());
+	EXPECT_EQ(hash.value(), hashString("owl"));
+	std::filesystem::remove(file);
+}
+
+TEST(Hash, combine) { EXPECT_NE(hashCombine(1, 2), hashCombine(2, 1)); }
@@ -2,6 +2,7 @@
 #include "testHelper.h"
 
 #include <core/Log.h>
+#include <spdlog/sinks/base_sink.h>
 
 using namespace owl::core;
 
@@ -20,3 +21,75 @@ TEST(Log, basic) {
 	Log::newFrame();
 	Log::invalidate();
 }
+
+namespace {
+/**
+ * @brief Sink keeping the payloads, blocked until released.
+ */
+class CaptureSink final : public spdlog::sinks::base_sink<std::mutex> {
+public:
+	void release() {
+		m_released = true;
+		m_released.notify_all();
+	}
+	[[nodiscard]] auto getPayloads() -> std::vector<std::string> {
+		const std::lock_guard lock(mutex_);
+		return m_payloads;
+	}
+
+protected:
+	void sink_it_(const spdlog::details::log_msg& iMsg) override {
+		m_released.wait(false);
+		m_payloads.emplace_back(iMsg.payload.begin(), iMsg.payload.end());
+	}
+	void flush_() override {}
+
+private:
+	std::atomic<bool> m_released{false};
+	std::vector<std::string> m_payloads;
+};
+}// namespace
+
+TEST(Log, asynchronous) {
+	constexpr size_t queueSize = 16;
+	constexpr size_t messageCount = 200;
+	const auto sink = std::make_shared<CaptureSink>();
+	Log::setSinks({sink});
+	Log::init(spdlog::level::trace, gDefaultFrequency, Log::Mode::Asynchronous, queueSize);
+	EXPECT_EQ(Log::getMode(), Log::Mode::Asynchronous);
+	Log::newFrame();
+	// the blocked sink fills the queue: the oldest records are overwritten.
+	for (size_t i = 0; i < messageCount; ++i) { OWL_CORE_TRACE("message {}", i) }
+	EXPECT_GT(Log::getDroppedRecords(), 0);
+	sink->release();
+	Log::invalidate();
+	Log::setSinks({});
+	EXPECT_EQ(Log::getMode(), Log::Mode::Synchronous);
+	const auto payloads = sink->getPayloads();
+	ASSERT_FALSE(payloads.empty());
+	EXPECT_LT(payloads.size(), messageCount);
+	EXPECT_EQ(payloads.back(), fmt::format("#1 message {}", messageCount - 1));
+	EXPECT_TRUE(std::ranges::all_of(payloads, [](const std::string& iPayload) { return iPayload.starts_with("#1 "); }));
+}
+
+TEST(Log, limiter) {
+	Log::init(spdlog::level::off);
+	LogLimiter once{0};
+	LogLimiter throttled{3};
+	size_t onceCount = 0;
+	size_t throttledCount = 0;
+	for (size_t i = 0; i < 10; ++i) {
+		if (once.allow())
+			++onceCount;
+		if (throttled.allow())
+			++throttledCount;
+		OWL_CORE_WARN_ONCE("once")
+		OWL_CORE_WARN_THROTTLED(3, "throttled")
+		Log::newFrame();
+	}
+	EXPECT_EQ(onceCount, 1);
+	EXPECT_EQ(once.getSuppressed(), 9);
+	EXPECT_EQ(throttledCount, 4);
+	EXPECT_EQ(throttled.getSuppressed(), 6);
+	Log::invalidate();
+}
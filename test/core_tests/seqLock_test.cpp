@@ -0,0 +1,56 @@
+#include "testHelper.h"
+
+#include <core/utils/SeqLock.h>
+
+using namespace owl::core::utils;
+
+namespace {
+
+struct Sample {
+	uint64_t counter = 0;
+	std::array<uint32_t, 5> copies{};
+	float value = 0;
+};
+
+}// namespace
+
+TEST(SeqLock, storeLoad) {
+	SeqLock<Sample> lock;
+	EXPECT_EQ(lock.getVersion(), 0);
+	EXPECT_EQ(lock.load().counter, 0);
+	lock.store({.counter = 4, .copies = {1, 2, 3, 4, 5}, .value = 2.5f});
+	EXPECT_EQ(lock.getVersion(), 1);
+	Sample sample;
+	EXPECT_EQ(lock.load(sample), 1);
+	EXPECT_EQ(sample.counter, 4);
+	EXPECT_EQ(sample.copies[4], 5);
+	EXPECT_FLOAT_EQ(sample.value, 2.5f);
+	lock.store({});
+	EXPECT_EQ(lock.getVersion(), 2);
+	EXPECT_EQ(lock.load().copies[0], 0);
+}
+
+TEST(SeqLock, concurrent) {
+	SeqLock<Sample> lock;
+	constexpr uint64_t count{50000};
+	std::jthread writer([&lock] {
+		for (uint64_t i = 1; i <= count; ++i) {
+			Sample sample{.counter = i, .copies = {}, .value = static_cast<float>(i)};
+			sample.copies.fill(static_cast<uint32_t>(i));
+			lock.store(sample);
+		}
+	});
+	uint64_t last = 0;
+	uint64_t lastVersion = 0;
+	while (last < count) {
+		Sample sample;
+		const uint64_t version = lock.load(sample);
+		// never a torn value.
+		for (const uint32_t copy: sample.copies) ASSERT_EQ(copy, static_cast<uint32_t>(sample.counter));
+		ASSERT_EQ(version, sample.counter);
+		ASSERT_GE(sample.counter, last);
+		ASSERT_GE(version, lastVersion);
+		last = sample.counter;
+		lastVersion = version;
+	}
+}
@@ -0,0 +1,33 @@
+#include "testHelper.h"
+
+#include <core/utils/StringUtils.h>
+
+using namespace owl::core::utils;
+
+namespace {
+auto decodeAll(const std::string_view iText) -> std::vector<uint32_t> {
+	std::vector<uint32_t> result;
+	size_t position = 0;
+	while (position < iText.size()) result.push_back(decodeUtf8(iText, position));
+	return result;
+}
+}// namespace
+
+TEST(String, utf8) {
+	EXPECT_EQ(decodeAll("ab"), (std::vector<uint32_t>{'a', 'b'}));
+	// é, Ж, 中, 😀
+	EXPECT_EQ(decodeAll("\xc3\xa9\xd0\x96\xe4\xb8\xad\xf0\x9f\x98\x80"),
+			  (std::vector<uint32_t>{0xe9, 0x416, 0x4e2d, 0x1f600}));
+	size_t position = 0;
+	EXPECT_EQ(decodeUtf8("", position), g_replacementCodepoint);
+	EXPECT_EQ(position, 0);
+}
+
+TEST(String, utf8Invalid) {
+	// lone continuation byte, truncated sequence, overlong encoding, surrogate.
+	EXPECT_EQ(decodeAll("\x80" "a"), (std::vector<uint32_t>{g_replacementCodepoint, 'a'}));
+	EXPECT_EQ(decodeAll("\xe4\xb8"), (std::vector<uint32_t>{g_replacementCodepoint, g_replacementCodepoint}));
+	EXPECT_EQ(decodeAll("\xc0\xaf"), (std::vector<uint32_t>{g_replacementCodepoint, g_replacementCodepoint}));
+	EXPECT_EQ(decodeAll("\xed\xa0\x80" "b"),
+			  (std::vector<uint32_t>{g_replacementCodepoint, g_replacementCodepoint, g_replacementCodepoint, 'b'}));
+}
@@ -0,0 +1,145 @@
+#include "testHelper.h"
+
+#include <debug/FrameProfiler.h>
+#include <debug/Profiler.h>
+
+using namespace owl::debug;
+
+namespace {
+void busyWait(const std::chrono::microseconds iDuration) {
+	const auto end = std::chrono::steady_clock::now() + iDuration;
+	while (std::chrono::steady_clock::now() < end) {}
+}
+}// namespace
+
+TEST(FrameProfiler, disabled) {
+	owl::core::Log::init(spdlog::level::off);
+	FrameProfiler::setEnabled(false);
+	FrameProfiler::reset();
+	for (size_t i = 0; i < 3; ++i) {
+		{ OWL_PROFILE_SCOPE("disabled") }
+		FrameProfiler::frame();
+	}
+	EXPECT_FALSE(FrameProfiler::isRecordingThread());
+	EXPECT_EQ(FrameProfiler::getStatistics().frameCount, 0);
+	EXPECT_TRUE(FrameProfiler::getLastFrame().scopes.empty());
+	owl::core::Log::invalidate();
+}
+
+TEST(FrameProfiler, scopes) {
+	owl::core::Log::init(spdlog::level::off);
+	FrameProfiler::reset();
+	FrameProfiler::setEnabled(true);
+	// the first frame only starts the recording.
+	FrameProfiler::frame();
+	EXPECT_TRUE(FrameProfiler::isRecordingThread());
+	{
+		OWL_PROFILE_SCOPE("outer")
+		for (size_t i = 0; i < 3; ++i) {
+			OWL_PROFILE_SCOPE("inner")
+			busyWait(std::chrono::microseconds(200));
+		}
+		OWL_PROFILE_SCOPE("second")
+	}
+	std::thread([] { OWL_PROFILE_SCOPE("other thread") }).join();
+	FrameProfiler::frame();
+	const auto frame = FrameProfiler::getLastFrame();
+	ASSERT_EQ(frame.scopes.size(), 3);
+	EXPECT_EQ(FrameProfiler::getName(frame.scopes[0].nameId), "outer");
+	EXPECT_EQ(frame.scopes[0].depth, 0);
+	EXPECT_EQ(frame.scopes[0].calls, 1);
+	EXPECT_EQ(FrameProfiler::getName(frame.scopes[1].nameId), "inner");
+	EXPECT_EQ(frame.scopes[1].depth, 1);
+	EXPECT_EQ(frame.scopes[1].calls, 3);
+	EXPECT_GE(frame.scopes[1].duration, 0.5);
+	EXPECT_GE(frame.scopes[0].duration, frame.scopes[1].duration);
+	EXPECT_EQ(FrameProfiler::getName(frame.scopes[2].nameId), "second");
+	EXPECT_EQ(frame.scopes[2].depth, 1);
+	EXPECT_GE(frame.duration, frame.scopes[0].duration);
+	EXPECT_EQ(FrameProfiler::getStatistics().frameCount, 1);
+	FrameProfiler::setEnabled(false);
+	FrameProfiler::frame();
+	owl::core::Log::invalidate();
+}
+
+TEST(FrameProfiler, openScopes) {
+	owl::core::Log::init(spdlog::level::off);
+	FrameProfiler::reset();
+	FrameProfiler::setEnabled(true);
+	FrameProfiler::frame();
+	{
+		// like the main loop, a scope containing the frame boundary.
+		OWL_PROFILE_SCOPE("loop")
+		busyWait(std::chrono::microseconds(200));
+		FrameProfiler::frame();
+		busyWait(std::chrono::microseconds(200));
+	}
+	FrameProfiler::frame();
+	const auto frame = FrameProfiler::getLastFrame();
+	ASSERT_EQ(frame.scopes.size(), 1);
+	EXPECT_EQ(FrameProfiler::getName(frame.scopes[0].nameId), "loop");
+	EXPECT_GE(frame.scopes[0].duration, 0.1);
+	EXPECT_EQ(FrameProfiler::getStatistics().frameCount, 2);
+	FrameProfiler::setEnabled(false);
+	FrameProfiler::frame();
+	owl::core::Log::invalidate();
+}
+
+TEST(FrameProfiler, allocations) {
+	owl::core::Log::init(spdlog::level::off);
+	FrameProfiler::reset();
+	FrameProfiler::setEnabled(true);
+	FrameProfiler::frame();
+	{
+		std::vector<owl::shared<int>> values;
+		for (int i = 0; i < 10; ++i) values.push_back(owl::mkShared<int>(i));
+	}
+	FrameProfiler::frame();
+	const auto frame = FrameProfiler::getLastFrame();
+#ifndef OWL_SANITIZER_CUSTOM_ALLOCATOR
+	EXPECT_GE(frame.allocations.allocationCalls, 10);
+	EXPECT_GE(frame.allocations.allocatedMemory.size, 10 * sizeof(int));
+#endif
+	FrameProfiler::setEnabled(false);
+	FrameProfiler::frame();
+	owl::core::Log::invalidate();
+}
+
+TEST(FrameProfiler, statistics) {
+	owl::core::Log::init(spdlog::level::off);
+	FrameProfiler::reset();
+	FrameProfiler::setBudget(g_frameBudgetName, 1.5);
+	FrameProfiler::setBudget("budget", 0.1);
+	const auto budgets = FrameProfiler::getBudgets();
+	EXPECT_EQ(budgets.size(), 2);
+	EXPECT_DOUBLE_EQ(budgets.at("budget"), 0.1);
+	FrameProfiler::setEnabled(true);
+	FrameProfiler::frame();
+	for (size_t i = 0; i < 10; ++i) {
+		if (i == 7) {
+			OWL_PROFILE_SCOPE("budget")
+			busyWait(std::chrono::microseconds(2000));
+		}
+		FrameProfiler::frame();
+	}
+	const auto stats = FrameProfiler::getStatistics();
+	EXPECT_EQ(stats.frameCount, 10);
+	EXPECT_EQ(FrameProfiler::getHistory().size(), 10);
+	EXPECT_GE(stats.overBudgetFrames, 1);
+	EXPECT_LE(stats.p50, stats.p95);
+	EXPECT_LE(stats.p95, stats.p99);
+	EXPECT_LE(stats.p99, stats.max);
+	EXPECT_GE(stats.max, 2.0);
+	const auto worst = FrameProfiler::getWorstFrame();
+	EXPECT_NEAR(worst.duration, stats.max, 1e-3);
+	ASSERT_EQ(worst.scopes.size(), 1);
+	EXPECT_TRUE(worst.scopes.front().isOverBudget());
+	FrameProfiler::setBudget(g_frameBudgetName, 0);
+	FrameProfiler::setBudget("budget", 0);
+	EXPECT_TRUE(FrameProfiler::getBudgets().empty());
+	FrameProfiler::reset();
+	EXPECT_EQ(FrameProfiler::getStatistics().frameCount, 0);
+	FrameProfiler::setEnabled(false);
+	FrameProfiler::frame();
+	owl::core::Log::invalidate();
+}
@@ -0,0 +1,49 @@
+#include "testHelper.h"
+
+#include <debug/HeapProfiler.h>
+
+using namespace owl::debug;
+
+TEST(HeapProfiler, sampling) {
+	owl::core::Log::init(spdlog::level::off);
+	HeapProfiler::reset();
+	EXPECT_FALSE(HeapProfiler::isRunning());
+	HeapProfiler::start(64);
+	EXPECT_TRUE(HeapProfiler::isRunning());
+	{
+		std::vector<owl::shared<std::array<uint8_t, 256>>> values;
+		for (size_t i = 0; i < 100; ++i) values.push_back(owl::mkShared<std::array<uint8_t, 256>>());
+	}
+	HeapProfiler::stop();
+	EXPECT_FALSE(HeapProfiler::isRunning());
+	const auto callSites = HeapProfiler::getCallSites();
+#ifndef OWL_SANITIZER_CUSTOM_ALLOCATOR
+	ASSERT_FALSE(callSites.empty());
+	EXPECT_GT(callSites.front().sampleCount, 0);
+	EXPECT_GE(callSites.front().estimatedBytes, callSites.back().estimatedBytes);
+	const auto file = std::filesystem::temp_directory_path() / "owl_heap_profile.folded";
+	EXPECT_TRUE(HeapProfiler::exportFoldedStacks(file));
+	EXPECT_GT(std::filesystem::file_size(file), 0);
+	std::filesystem::remove(file);
+#endif
+	HeapProfiler::reset();
+	EXPECT_TRUE(HeapProfiler::getCallSites().empty());
+	owl::core::Log::invalidate();
+}
+
+TEST(HeapProfiler, frame) {
+	owl::core::Log::init(spdlog::level::off);
+	HeapProfiler::start();
+	HeapProfiler::frame();
+	{
+		std::vector<owl::shared<int>> values;
+		for (int i = 0; i < 10; ++i) values.push_back(owl::mkShared<int>(i));
+	}
+	HeapProfiler::frame();
+#ifndef OWL_SANITIZER_CUSTOM_ALLOCATOR
+	EXPECT_GE(HeapProfiler::getLastFrame().allocationCalls, 10);
+	EXPECT_GE(HeapProfiler::getLastFrame().allocatedMemory.size, 10 * sizeof(int));
+#endif
+	HeapProfiler::stop();
+	owl::core::Log::invalidate();
+}
@@ -33,3 +33,53 @@ TEST(profiler, timer) {
 	}
 	owl::core::Log::invalidate();
 }
+
+TEST(profiler, calibration) {
+	owl::core::Log::init(spdlog::level::off);
+	auto& prof = Profiler::get();
+	EXPECT_DOUBLE_EQ(prof.getNanosecondsPerTick(), 1.0);
+	const std::filesystem::path file("test_calibration.owlprof");
+	prof.beginSession("calibration", file.string());
+	const auto startTicks = ProfileTimer::now();
+	const auto startTime = std::chrono::steady_clock::now();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	const double nanosecondsPerTick = prof.getNanosecondsPerTick();
+	const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime);
+	const auto ticks = static_cast<double>(ProfileTimer::now() - startTicks);
+	EXPECT_NEAR(ticks * nanosecondsPerTick, elapsed.count(), 0.05 * elapsed.count());
+	prof.endSession();
+	remove(file);
+	owl::core::Log::invalidate();
+}
+
+TEST(profiler, binary) {
+	owl::core::Log::init(spdlog::level::off);
+	auto& prof = Profiler::get();
+	const std::filesystem::path file("test_profile.owlprof");
+	const std::filesystem::path jsonFile("test_profile_converted.json");
+	prof.beginSession("binary", file.string());
+	EXPECT_TRUE(prof.isSessionActive());
+	{
+		std::vector<std::thread> threads;
+		for (size_t t = 0; t < 4; ++t) {
+			threads.emplace_back([] {
+				for (size_t i = 0; i < 100; ++i) { const ProfileTimer timer("threaded"); }
+			});
+		}
+		for (auto& thread: threads) thread.join();
+		const ProfileTimer timer("main");
+	}
+	prof.endSession();
+	EXPECT_FALSE(prof.isSessionActive());
+	ASSERT_TRUE(exists(file));
+	EXPECT_TRUE(Profiler::convertToChromeTrace(file, jsonFile));
+	ASSERT_TRUE(exists(jsonFile));
+	std::ifstream in(jsonFile);
+	const std::string content((std::istreambuf_iterator(in)), std::istreambuf_iterator<char>());
+	EXPECT_TRUE(content.contains("\"name\":\"threaded\""));
+	EXPECT_TRUE(content.contains("\"name\":\"main\""));
+	in.close();
+	remove(file);
+	remove(jsonFile);
+	owl::core::Log::invalidate();
+}
@@ -44,6 +44,25 @@ TEST(Tracker, stacktrace) {
 	}
 }
 
+TEST(Tracker, deepScopes) {
+	// more nested scopes than the tracker stores.
+	constexpr size_t depth = 40;
+	{
+		std::vector<owl::uniq<ScopeUntrack>> scopes;
+		scopes.reserve(depth);
+		for (size_t i = 0; i < depth; ++i) scopes.push_back(owl::mkUniq<ScopeUntrack>());
+		const auto before = TrackerAPI::globals().allocationCalls;
+		const auto value = owl::mkShared<int>(1);
+		EXPECT_EQ(TrackerAPI::globals().allocationCalls, before);
+		while (!scopes.empty()) scopes.pop_back();
+	}
+	const auto before = TrackerAPI::globals().allocationCalls;
+	const auto value = owl::mkShared<int>(2);
+#ifndef OWL_SANITIZER_CUSTOM_ALLOCATOR
+	EXPECT_GT(TrackerAPI::globals().allocationCalls, before);
+#endif
+}
+
 TEST(MemorySize, formating) {
 	MemorySize st{.size = 488};
 	EXPECT_STREQ(st.str().c_str(), "488 bytes");
@@ -58,3 +77,28 @@ TEST(MemorySize, formating) {
 	st.size += 1024ull * 1024ull * 1024ull * 1024ull;
 	EXPECT_STREQ(st.str().c_str(), "1.08 TB");
 }
+
+TEST(Tracker, multiThread) {
+	const auto before = TrackerAPI::globals();
+	constexpr size_t threadCount = 8;
+	constexpr size_t allocCount = 1000;
+	{
+		std::vector<std::thread> threads;
+		threads.reserve(threadCount);
+		for (size_t t = 0; t < threadCount; ++t) {
+			threads.emplace_back([] {
+				std::vector<owl::shared<int>> values;
+				values.reserve(allocCount);
+				for (size_t i = 0; i < allocCount; ++i) values.push_back(owl::mkShared<int>(static_cast<int>(i)));
+				values.clear();
+			});
+		}
+		for (auto& thread: threads) thread.join();
+	}
+	const auto& after = TrackerAPI::globals();
+#ifndef OWL_SANITIZER_CUSTOM_ALLOCATOR
+	EXPECT_GE(after.allocationCalls - before.allocationCalls, threadCount * allocCount);
+	EXPECT_GE(after.deallocationCalls - before.deallocationCalls, threadCount * allocCount);
+#endif
+	EXPECT_EQ(after.allocationCalls - after.deallocationCalls, after.allocs.size());
+}
@@ -0,0 +1,113 @@
+#include "testHelper.h"
+
+#include <fonts/FontAtlasCache.h>
+
+using namespace owl::fonts;
+
+namespace {
+auto makeAtlas() -> FontAtlasData {
+	FontAtlasData data{.ascenderY = 1.0,
+					   .descenderY = -0.25,
+					   .lineHeight = 1.3,
+					   .atlasSize = {4, 2},
+					   .glyphs = {{.codepoint = 'b',
+								   .advance = 0.6,
+								   .planeBounds = {0, 0, 0.5, 0.7},
+								   .atlasBounds = {2, 0, 4, 2}},
+								  {.codepoint = 'a',
+								   .advance = 0.5,
+								   .planeBounds = {0, 0, 0.4, 0.5},
+								   .atlasBounds = {0, 0, 2, 2}}},
+					   .kerning = {{.first = 'a', .second = 'b', .advance = -0.1}},
+					   .pixels = std::vector<uint8_t>(4 * 2 * 3, 128)};
+	data.sort();
+	return data;
+}
+}// namespace
+
+TEST(FontAtlasCache, lookups) {
+	const auto data = makeAtlas();
+	ASSERT_NE(data.findGlyph('a'), nullptr);
+	EXPECT_DOUBLE_EQ(data.findGlyph('a')->advance, 0.5);
+	EXPECT_DOUBLE_EQ(data.findGlyph('b')->advance, 0.6);
+	EXPECT_EQ(data.findGlyph('c'), nullptr);
+	EXPECT_DOUBLE_EQ(data.getKerning('a', 'b'), -0.1);
+	EXPECT_DOUBLE_EQ(data.getKerning('b', 'a'), 0);
+}
+
+TEST(FontAtlasCache, readWrite) {
+	owl::core::Log::init(spdlog::level::off);
+	const auto file = std::filesystem::temp_directory_path() / "owl_test_atlas.ofnt";
+	const auto data = makeAtlas();
+	EXPECT_TRUE(getAtlasCacheFile("font", 42).empty());
+	EXPECT_TRUE(writeAtlasCache(file, 42, data));
+	const auto read = readAtlasCache(file, 42);
+	ASSERT_TRUE(read.has_value());
+	EXPECT_DOUBLE_EQ(read->descenderY, data.descenderY);
+	EXPECT_DOUBLE_EQ(read->lineHeight, data.lineHeight);
+	EXPECT_EQ(read->atlasSize, data.atlasSize);
+	ASSERT_EQ(read->glyphs.size(), 2);
+	EXPECT_EQ(read->glyphs[1].codepoint, 'b');
+	EXPECT_DOUBLE_EQ(read->glyphs[1].atlasBounds[2], 4);
+	EXPECT_DOUBLE_EQ(read->getKerning('a', 'b'), -0.1);
+	EXPECT_EQ(read->pixels, data.pixels);
+	// another key: the atlas has to be generated again.
+	EXPECT_FALSE(readAtlasCache(file, 43).has_value());
+	// truncated file.
+	std::filesystem::resize_file(file, std::filesystem::file_size(file) - 1);
+	EXPECT_FALSE(readAtlasCache(file, 42).has_value());
+	std::filesystem::remove(file);
+	EXPECT_FALSE(readAtlasCache(file, 42).has_value());
+	owl::core::Log::invalidate();
+}
+
+TEST(FontAtlasCache, reproducible) {
+	owl::core::Log::init(spdlog::level::off);
+	const auto file = std::filesystem::temp_directory_path() / "owl_test_atlas_repro.ofnt";
+	auto data = makeAtlas();
+	// garbage in the padding of the glyphs.
+	for (auto& glyph: data.glyphs) {
+		const auto copy = glyph;
+		std::memset(static_cast<void*>(&glyph), 0xFF, sizeof(glyph));
+		glyph.codepoint = copy.codepoint;
+		glyph.advance = copy.advance;
+		glyph.planeBounds = copy.planeBounds;
+		glyph.atlasBounds = copy.atlasBounds;
+	}
+	ASSERT_TRUE(writeAtlasCache(file, 42, data));
+	std::vector<uint8_t> written;
+	{
+		std::ifstream in(file, std::ios::in | std::ios::binary);
+		written.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	}
+	ASSERT_TRUE(writeAtlasCache(file, 42, makeAtlas()));
+	{
+		std::ifstream in(file, std::ios::in | std::ios::binary);
+		EXPECT_EQ(std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()),
+				  written);
+	}
+	const auto read = readAtlasCache(file, 42);
+	ASSERT_TRUE(read.has_value());
+	ASSERT_EQ(read->glyphs.size(), 2);
+	EXPECT_EQ(read->glyphs[0].codepoint, 'a');
+	EXPECT_DOUBLE_EQ(read->glyphs[0].planeBounds[3], 0.5);
+	std::filesystem::remove(file);
+	owl::core::Log::invalidate();
+}
+
+TEST(FontAtlasCache, key) {
+	const auto file = std::filesystem::temp_directory_path() / "owl_test_font.ttf";
+	{
+		std::ofstream out(file, std::ios::binary);
+		out << "not really a font";
+	}
+	constexpr std::array<CharsetRange, 1> latin{{{.begin = 0x20, .end = 0xFF}}};
+	constexpr std::array<CharsetRange, 1> ascii{{{.begin = 0x20, .end = 0x7F}}};
+	const auto key = computeAtlasKey(file, latin, 40.0);
+	ASSERT_TRUE(key.has_value());
+	EXPECT_EQ(computeAtlasKey(file, latin, 40.0), key);
+	EXPECT_NE(computeAtlasKey(file, ascii, 40.0), key);
+	EXPECT_NE(computeAtlasKey(file, latin, 32.0), key);
+	std::filesystem::remove(file);
+	EXPECT_FALSE(computeAtlasKey(file, latin, 40.0).has_value());
+}
@@ -42,7 +42,8 @@ TEST(FontLibrary, basic_with_app) {
 	EXPECT_NE(myFont->getAtlasTexture(), nullptr);
 
 	EXPECT_NEAR(myFont->getScaledLineHeight(), 1, 0.001);
-	auto [quad, uv] = myFont->getGlyphBox('a');
+	auto [quad, uv, page] = myFont->getGlyphBox('a');
+	EXPECT_EQ(page, 0);
 	EXPECT_NEAR(quad.min().x(), 0.00735, 0.001);
 	EXPECT_NEAR(quad.min().y(), -0.0333, 0.001);
 	EXPECT_NEAR(quad.max().x(), 0.3745, 0.001);
@@ -52,6 +53,20 @@ TEST(FontLibrary, basic_with_app) {
 	EXPECT_NEAR(uv.max().x(), 0.4033, 0.001);
 	EXPECT_NEAR(uv.max().y(), 0.5732, 0.001);
 	EXPECT_NEAR(myFont->getAdvance('a', 'b'), 0.408, 0.001);
+	EXPECT_FLOAT_EQ(myFont->getAdvance('\t', '\n'), myFont->getAdvance(' ', '\n'));
+	EXPECT_FLOAT_EQ(myFont->getAdvance('\r', 'a'), 0.f);
+	EXPECT_EQ(myFont->getGlyphBox('\n').quad.diagonal().x(), 0.f);
+
+	// cyrillic glyphs are rasterized on demand, '?' is used meanwhile.
+	constexpr uint32_t zhe{0x0416};
+	EXPECT_EQ(myFont->getGlyphBox(zhe).page, 0);
+	myFont->update();
+	app->getTaskScheduler().waitEmptyQueue();
+	myFont->update();
+	EXPECT_EQ(myFont->getGlyphBox(zhe).page, 1);
+	EXPECT_NE(myFont->getAtlasTexture(1), nullptr);
+	EXPECT_EQ(myFont->getAtlasTexture(2), nullptr);
+	EXPECT_GT(myFont->getAdvance(zhe, 'a'), 0.f);
 
 	Application::invalidate();
 	app.reset();
@@ -0,0 +1,88 @@
+#include "testHelper.h"
+
+#include <core/Application.h>
+#include <fonts/GlyphAtlas.h>
+
+using namespace owl::fonts;
+using namespace owl;
+
+TEST(ShelfPacker, insert) {
+	ShelfPacker packer({16, 16});
+	EXPECT_EQ(packer.insert({8, 4}), (math::vec2ui{0, 0}));
+	EXPECT_EQ(packer.insert({8, 4}), (math::vec2ui{8, 0}));
+	// no room left on the first shelf.
+	EXPECT_EQ(packer.insert({4, 4}), (math::vec2ui{0, 4}));
+	// a small rectangle goes on an existing shelf.
+	EXPECT_EQ(packer.insert({4, 3}), (math::vec2ui{4, 4}));
+	EXPECT_EQ(packer.getUsedHeight(), 8);
+	EXPECT_FALSE(packer.insert({17, 1}).has_value());
+	EXPECT_FALSE(packer.insert({4, 9}).has_value());
+	packer.clear();
+	EXPECT_EQ(packer.getUsedHeight(), 0);
+	EXPECT_EQ(packer.insert({16, 16}), (math::vec2ui{0, 0}));
+	EXPECT_FALSE(packer.insert({1, 1}).has_value());
+}
+
+TEST(GlyphAtlas, missingFont) {
+	core::Log::init(spdlog::level::off);
+	GlyphAtlas atlas("/nonexistent/font.ttf", 40.0, false);
+	EXPECT_EQ(atlas.find(0x416), nullptr);
+	EXPECT_TRUE(atlas.hasPendingGlyphs());
+	// without application, the rasterization is synchronous.
+	atlas.update(0);
+	EXPECT_FALSE(atlas.hasPendingGlyphs());
+	EXPECT_TRUE(atlas.isMissing(0x416));
+	EXPECT_EQ(atlas.find(0x416), nullptr);
+	EXPECT_FALSE(atlas.hasPendingGlyphs());
+	EXPECT_EQ(atlas.getPageCount(), 0);
+	EXPECT_EQ(atlas.getPageTexture(0), nullptr);
+	core::Log::invalidate();
+}
+
+TEST(GlyphAtlas, touchedPageKept) {
+	core::Log::init(spdlog::level::off);
+	std::filesystem::path fontFile;
+	{
+		// the application only gives the engine assets.
+		auto app = mkShared<core::Application>(core::AppParams{.args = nullptr,
+															   .frameLogFrequency = 0,
+															   .name = "test",
+															   .assetsPattern = "",
+															   .icon = "",
+															   .width = 0,
+															   .height = 0,
+															   .argCount = 0,
+															   .renderer = renderer::RenderAPI::Type::Null,
+															   .hasGui = false,
+															   .useDebugging = false,
+															   .isDummy = true});
+		fontFile = app->getAssetDirectories().front().assetsPath / "fonts" / "OpenSans-Regular.ttf";
+		core::Application::invalidate();
+	}
+	ASSERT_TRUE(exists(fontFile));
+	// a single page of large glyphs, filled in a few frames.
+	GlyphAtlas atlas(fontFile, 128.0, false, 1);
+	constexpr uint32_t cached = 0x416;
+	EXPECT_EQ(atlas.find(cached), nullptr);
+	atlas.update(1);
+	ASSERT_NE(atlas.find(cached), nullptr);
+	// each frame, the cached string only touches its page, and a new string adds a glyph.
+	uint64_t frame = 2;
+	for (uint32_t codepoint = 0x417; codepoint < 0x450; ++codepoint, ++frame) {
+		atlas.update(frame);
+		atlas.touch(0);
+		EXPECT_EQ(atlas.find(codepoint), nullptr);
+		atlas.update(frame);
+		if (atlas.hasPendingGlyphs())
+			break;
+	}
+	// the page is full: the new glyph waits, the page sampled by the cached string is kept.
+	ASSERT_TRUE(atlas.hasPendingGlyphs());
+	EXPECT_EQ(atlas.getPageCount(), 1);
+	EXPECT_NE(atlas.find(cached), nullptr);
+	// in the next frame, the page is not used yet and can be evicted.
+	atlas.update(frame + 1);
+	EXPECT_FALSE(atlas.hasPendingGlyphs());
+	EXPECT_EQ(atlas.find(cached), nullptr);
+	core::Log::invalidate();
+}
@@ -0,0 +1,54 @@
+#include "testHelper.h"
+
+#include <core/Application.h>
+#include <fonts/TextLayout.h>
+
+using namespace owl::fonts;
+using namespace owl;
+using namespace owl::core;
+
+TEST(TextLayout, cache) {
+	Log::init(spdlog::level::off);
+	auto app = owl::mkShared<Application>(AppParams{.args = nullptr,
+													.frameLogFrequency = 0,
+													.name = "test",
+													.assetsPattern = "",
+													.icon = "",
+													.width = 0,
+													.height = 0,
+													.argCount = 0,
+													.renderer = owl::renderer::RenderAPI::Type::Null,
+													.hasGui = false,
+													.useDebugging = false,
+													.isDummy = true});
+	const auto font = app->getFontLibrary().getDefaultFont();
+	ASSERT_NE(font, nullptr);
+
+	TextLayout layout;
+	EXPECT_FALSE(layout.update(nullptr, "ab", 0, 0));
+	EXPECT_TRUE(layout.getGlyphs().empty());
+	EXPECT_TRUE(layout.update(font, "ab\r\nc", 0, 0));
+	ASSERT_EQ(layout.getGlyphs().size(), 3);
+	for (const auto& glyph: layout.getGlyphs()) {
+		EXPECT_GE(glyph.quad.min().x(), -0.501f);
+		EXPECT_LE(glyph.quad.max().x(), 0.501f);
+		EXPECT_GE(glyph.quad.min().y(), -0.501f);
+		EXPECT_LE(glyph.quad.max().y(), 0.501f);
+		EXPECT_EQ(glyph.page, 0);
+	}
+	// 'c' is on the second line.
+	EXPECT_LT(layout.getGlyphs()[2].quad.max().y(), layout.getGlyphs()[0].quad.min().y());
+
+	// nothing changed.
+	EXPECT_FALSE(layout.update(font, "ab\r\nc", 0, 0));
+	EXPECT_TRUE(layout.update(font, "ab\r\nd", 0, 0));
+	EXPECT_TRUE(layout.update(font, "ab\r\nd", 0.1f, 0));
+	EXPECT_TRUE(layout.update(font, "ab\r\nd", 0.1f, 0.1f));
+	EXPECT_FALSE(layout.update(font, "ab\r\nd", 0.1f, 0.1f));
+	layout.invalidate();
+	EXPECT_TRUE(layout.update(font, "ab\r\nd", 0.1f, 0.1f));
+
+	Application::invalidate();
+	app.reset();
+	Log::invalidate();
+}
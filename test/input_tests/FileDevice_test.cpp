@@ -0,0 +1,189 @@
+#include "testHelper.h"
+
+#include <input/video/FileDevice.h>
+#include <input/video/Manager.h>
+#include <renderer/RenderCommand.h>
+
+using namespace owl::input::video;
+using namespace owl::renderer;
+
+namespace {
+
+void writeFile(const std::filesystem::path& iFile, const size_t iSize, const uint8_t iValue) {
+	const std::vector<char> data(iSize, static_cast<char>(iValue));
+	std::ofstream out(iFile, std::ios::out | std::ios::binary);
+	out.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+}// namespace
+
+TEST(FileDevice, rawFile) {
+	owl::core::Log::init(spdlog::level::off);
+	RenderCommand::create(RenderAPI::Type::Null);
+	const auto file = std::filesystem::temp_directory_path() / "owl_replay.nv12";
+	const owl::math::vec2ui size{8, 4};
+	// three frames and a truncated one.
+	writeFile(file, Device::getRawFrameSize(Device::PixelFormat::Nv12, size) * 3 + 5, 128);
+	FileDevice device(file, {.format = Device::PixelFormat::Nv12, .size = size, .frameRate = 0, .loop = false});
+	EXPECT_TRUE(device.isValid());
+	EXPECT_EQ(device.getBusInfo(), fmt::format("file:{}", file.string()));
+	device.open();
+	ASSERT_TRUE(device.isOpened());
+	EXPECT_EQ(device.getFrameCount(), 3);
+	while (!device.isFinished()) std::this_thread::yield();
+	FrameTextures frame;
+	device.fillFrame(frame);
+	ASSERT_NE(frame.texture, nullptr);
+	EXPECT_EQ(frame.texture->getSize(), size);
+	EXPECT_EQ(frame.texture->getSpecification().format, ImageFormat::RGB8);
+	EXPECT_EQ(frame.layout, YuvLayout::None);
+	EXPECT_EQ(frame.sequence, 3);
+	EXPECT_EQ(device.getFrameInterval().count(), 0);
+	const auto statistics = device.getStatistics();
+	EXPECT_EQ(statistics.captured, 3);
+	EXPECT_EQ(statistics.uploaded, 1);
+	EXPECT_EQ(statistics.dropped, 2);
+	EXPECT_EQ(statistics.lastLatency, statistics.meanLatency);
+	// no upload without a new frame.
+	const auto timestamp = frame.timestamp;
+	device.fillFrame(frame);
+	EXPECT_EQ(frame.timestamp, timestamp);
+	EXPECT_EQ(device.getStatistics().uploaded, 1);
+	device.close();
+	EXPECT_FALSE(device.isOpened());
+	std::filesystem::remove(file);
+	RenderCommand::invalidate();
+	owl::core::Log::invalidate();
+}
+
+TEST(FileDevice, directory) {
+	owl::core::Log::init(spdlog::level::off);
+	RenderCommand::create(RenderAPI::Type::Null);
+	const auto dir = std::filesystem::temp_directory_path() / "owl_replay";
+	std::filesystem::create_directories(dir);
+	const owl::math::vec2ui size{6, 2};
+	const size_t frameSize = Device::getRawFrameSize(Device::PixelFormat::YuYv, size);
+	writeFile(dir / "frame_0.yuyv", frameSize, 16);
+	writeFile(dir / "frame_1.yuyv", frameSize, 235);
+	writeFile(dir / "frame_2.yuyv", frameSize - 1, 0);
+	const auto device = owl::mkShared<FileDevice>(
+			dir, FileDevice::Specification{.format = Device::PixelFormat::YuYv, .size = size, .frameRate = 1000});
+	auto& manager = Manager::get();
+	const size_t count = manager.getDeviceCount();
+	EXPECT_EQ(manager.addDevice(device), static_cast<int8_t>(count));
+	EXPECT_EQ(manager.addDevice(device), static_cast<int8_t>(count));
+	EXPECT_EQ(manager.addDevice(nullptr), -1);
+	ASSERT_EQ(manager.getDeviceCount(), count + 1);
+	EXPECT_EQ(manager.getDevicesNames().back(), "Replay owl_replay");
+	device->setGpuConversion(true);
+	manager.open(count);
+	ASSERT_TRUE(manager.isOpened());
+	EXPECT_EQ(device->getFrameCount(), 2);
+	EXPECT_NEAR(device->getFrameInterval().count(), 0.001, 1e-9);
+	FrameTextures frame;
+	while (frame.texture == nullptr) manager.fillFrame(frame);
+	EXPECT_EQ(frame.texture->getSize(), size);
+	EXPECT_EQ(frame.texture->getSpecification().format, ImageFormat::RG8);
+	EXPECT_EQ(frame.layout, YuvLayout::YuYv);
+	manager.close();
+	manager.updateDeviceList(true);
+	std::filesystem::remove_all(dir);
+	RenderCommand::invalidate();
+	owl::core::Log::invalidate();
+}
+
+TEST(FileDevice, removedSource) {
+	owl::core::Log::init(spdlog::level::off);
+	RenderCommand::create(RenderAPI::Type::Null);
+	const auto first = std::filesystem::temp_directory_path() / "owl_replay_first.yuyv";
+	const auto second = std::filesystem::temp_directory_path() / "owl_replay_second.yuyv";
+	const owl::math::vec2ui size{6, 2};
+	writeFile(first, Device::getRawFrameSize(Device::PixelFormat::YuYv, size), 16);
+	writeFile(second, Device::getRawFrameSize(Device::PixelFormat::YuYv, size), 16);
+	const FileDevice::Specification specification{.format = Device::PixelFormat::YuYv, .size = size, .frameRate = 0};
+	auto& manager = Manager::get();
+	const size_t count = manager.getDeviceCount();
+	ASSERT_EQ(manager.addDevice(owl::mkShared<FileDevice>(first, specification)), static_cast<int8_t>(count));
+	const auto device = owl::mkShared<FileDevice>(second, specification);
+	ASSERT_EQ(manager.addDevice(device), static_cast<int8_t>(count + 1));
+	manager.open(count + 1);
+	ASSERT_TRUE(manager.isOpened());
+	// a device listed before the current one disappears.
+	std::filesystem::remove(first);
+	manager.updateDeviceList();
+	ASSERT_EQ(manager.getDeviceCount(), count + 1);
+	EXPECT_EQ(manager.getCurrentDevice(), device);
+	EXPECT_EQ(manager.getCurrentDeviceId(), static_cast<int8_t>(count));
+	// the current device disappears.
+	std::filesystem::remove(second);
+	manager.updateDeviceList();
+	EXPECT_EQ(manager.getDeviceCount(), count);
+	EXPECT_FALSE(manager.isOpened());
+	EXPECT_EQ(manager.getCurrentDevice(), nullptr);
+	EXPECT_FALSE(device->isOpened());
+	manager.updateDeviceList(true);
+	RenderCommand::invalidate();
+	owl::core::Log::invalidate();
+}
+
+TEST(FileDevice, stepped) {
+	owl::core::Log::init(spdlog::level::off);
+	RenderCommand::create(RenderAPI::Type::Null);
+	const auto file = std::filesystem::temp_directory_path() / "owl_replay_stepped.nv12";
+	const owl::math::vec2ui size{8, 4};
+	writeFile(file, Device::getRawFrameSize(Device::PixelFormat::Nv12, size) * 3, 128);
+	FileDevice device(file, {.format = Device::PixelFormat::Nv12, .size = size, .loop = false, .stepped = true});
+	EXPECT_FALSE(device.showFrame(1));
+	device.open();
+	ASSERT_TRUE(device.isOpened());
+	EXPECT_EQ(device.getFrameCount(), 3);
+	EXPECT_EQ(device.getFrameInterval().count(), 0);
+	// nothing is published without a request.
+	FrameTextures frame;
+	device.fillFrame(frame);
+	EXPECT_EQ(frame.texture, nullptr);
+	EXPECT_TRUE(device.showFrame(2));
+	device.fillFrame(frame);
+	ASSERT_NE(frame.texture, nullptr);
+	EXPECT_EQ(frame.sequence, 2);
+	EXPECT_FALSE(device.showFrame(7));
+	EXPECT_EQ(device.getStatistics().captured, 1);
+	device.close();
+	EXPECT_FALSE(device.isOpened());
+	EXPECT_FALSE(device.showFrame(2));
+	std::filesystem::remove(file);
+	RenderCommand::invalidate();
+	owl::core::Log::invalidate();
+}
+
+// Replay throughput and latency, reported as test properties (--gtest_output=xml).
+TEST(FileDevice, replayBenchmark) {
+	owl::core::Log::init(spdlog::level::off);
+	RenderCommand::create(RenderAPI::Type::Null);
+	const auto file = std::filesystem::temp_directory_path() / "owl_replay_bench.nv12";
+	const owl::math::vec2ui size{640, 480};
+	constexpr size_t frames{8};
+	writeFile(file, Device::getRawFrameSize(Device::PixelFormat::Nv12, size) * frames, 90);
+	for (const bool gpuConversion: {false, true}) {
+		FileDevice device(file, {.format = Device::PixelFormat::Nv12, .size = size, .frameRate = 0});
+		device.setGpuConversion(gpuConversion);
+		device.open();
+		ASSERT_TRUE(device.isOpened());
+		FrameTextures frame;
+		const auto start = std::chrono::steady_clock::now();
+		while (device.getStatistics().uploaded < 4 * frames) device.fillFrame(frame);
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		device.close();
+		const auto statistics = device.getStatistics();
+		EXPECT_GE(statistics.captured, statistics.uploaded + statistics.dropped);
+		const std::string name = gpuConversion ? "raw" : "rgb";
+		RecordProperty(name + "_captured_fps",
+					   fmt::format("{:.0f}", static_cast<double>(statistics.captured) / elapsed.count()));
+		RecordProperty(name + "_uploaded_fps",
+					   fmt::format("{:.0f}", static_cast<double>(statistics.uploaded) / elapsed.count()));
+		RecordProperty(name + "_latency_ms", fmt::format("{:.3f}", statistics.meanLatency.count()));
+	}
+	std::filesystem::remove(file);
+	RenderCommand::invalidate();
+	owl::core::Log::invalidate();
+}
@@ -0,0 +1,53 @@
+#include "testHelper.h"
+
+#include <input/video/FrameMailbox.h>
+
+using namespace owl::input::video;
+
+TEST(FrameMailbox, latestFrame) {
+	FrameMailbox mailbox;
+	EXPECT_EQ(mailbox.consume(), nullptr);
+	mailbox.acquireWrite().sequence = 1;
+	mailbox.publish();
+	mailbox.acquireWrite().sequence = 2;
+	mailbox.publish();
+	const auto* frame = mailbox.consume();
+	ASSERT_NE(frame, nullptr);
+	EXPECT_EQ(frame->sequence, 2);
+	EXPECT_EQ(mailbox.getDroppedCount(), 1);
+	EXPECT_EQ(mailbox.consume(), nullptr);
+	mailbox.acquireWrite().sequence = 3;
+	mailbox.publish();
+	mailbox.reset();
+	EXPECT_EQ(mailbox.consume(), nullptr);
+}
+
+TEST(FrameMailbox, concurrentExchange) {
+	FrameMailbox mailbox;
+	constexpr uint64_t frames{20000};
+	std::jthread producer([&mailbox] {
+		for (uint64_t sequence = 1; sequence <= frames; ++sequence) {
+			auto& frame = mailbox.acquireWrite();
+			frame.sequence = sequence;
+			frame.pixels.assign(16, static_cast<uint8_t>(sequence));
+			mailbox.publish();
+		}
+	});
+	uint64_t last = 0;
+	uint64_t received = 0;
+	while (last < frames) {
+		const auto* frame = mailbox.consume();
+		if (frame == nullptr) {
+			std::this_thread::yield();
+			continue;
+		}
+		// frames are received in order and never torn.
+		ASSERT_GT(frame->sequence, last);
+		const auto value = static_cast<uint8_t>(frame->sequence);
+		ASSERT_TRUE(std::ranges::all_of(frame->pixels, [value](const uint8_t iP) { return iP == value; }));
+		last = frame->sequence;
+		++received;
+	}
+	producer.join();
+	EXPECT_EQ(received + mailbox.getDroppedCount(), frames);
+}
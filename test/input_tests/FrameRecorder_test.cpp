@@ -0,0 +1,156 @@
+#include "testHelper.h"
+
+#include <input/video/FileDevice.h>
+#include <input/video/FrameRecorder.h>
+
+using namespace owl::input::video;
+
+namespace {
+
+auto readFile(const std::filesystem::path& iFile) -> std::vector<uint8_t> {
+	std::ifstream in(iFile, std::ios::in | std::ios::binary);
+	return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+}// namespace
+
+TEST(FrameRecorder, container) {
+	owl::core::Log::init(spdlog::level::off);
+	const auto file = std::filesystem::temp_directory_path() / "owl_record.tmp";
+	const owl::math::vec2ui size{8, 4};
+	const size_t frameSize = Device::getRawFrameSize(Device::PixelFormat::Nv12, size);
+	FrameRecorder recorder({.queueSize = 4, .chunkSize = 100});
+	std::vector<uint8_t> frame(frameSize);
+	EXPECT_FALSE(recorder.push(frame.data(), frame.size(), 0, std::chrono::steady_clock::now()));
+	ASSERT_TRUE(recorder.start(file, Device::PixelFormat::Nv12, size));
+	EXPECT_TRUE(recorder.isRecording());
+	EXPECT_EQ(recorder.getFile().extension(), ".owlv");
+	const auto start = std::chrono::steady_clock::now();
+	for (uint8_t i = 0; i < 3; ++i) {
+		std::ranges::fill(frame, i);
+		EXPECT_TRUE(recorder.push(frame.data(), frame.size(), 10u + i, start + std::chrono::milliseconds(i)));
+	}
+	recorder.stop();
+	EXPECT_FALSE(recorder.isRecording());
+	const auto statistics = recorder.getStatistics();
+	EXPECT_EQ(statistics.pushed, 3);
+	EXPECT_EQ(statistics.written, 3);
+	EXPECT_EQ(statistics.dropped, 0);
+	EXPECT_GE(statistics.maxQueued, 1);
+	EXPECT_EQ(statistics.bytes, std::filesystem::file_size(recorder.getFile()));
+
+	FrameRecorder::ContainerInfo info;
+	std::vector<std::vector<uint8_t>> frames;
+	ASSERT_TRUE(FrameRecorder::readContainer(recorder.getFile(), info, frames));
+	EXPECT_EQ(info.format, Device::PixelFormat::Nv12);
+	EXPECT_EQ(info.size, size);
+	ASSERT_EQ(frames.size(), 3);
+	for (uint8_t i = 0; i < 3; ++i) {
+		EXPECT_EQ(frames[i], std::vector<uint8_t>(frameSize, i));
+		EXPECT_EQ(info.sequences[i], 10u + i);
+	}
+	EXPECT_GT(info.timestamps[2], info.timestamps[1]);
+
+	// the recording is replayed with its own format and size.
+	FileDevice device(recorder.getFile(), {.format = Device::PixelFormat::Rgb24, .frameRate = 0, .loop = false});
+	device.open();
+	ASSERT_TRUE(device.isOpened());
+	EXPECT_EQ(device.getFrameCount(), 3);
+	EXPECT_EQ(device.getPixelFormat(), Device::PixelFormat::Nv12);
+	EXPECT_EQ(device.getSize(), size);
+	device.close();
+	// the stepped replay shows the frames by their recorded sequence number.
+	FileDevice stepped(recorder.getFile(), {.frameRate = 0, .loop = false, .stepped = true});
+	stepped.open();
+	ASSERT_TRUE(stepped.isOpened());
+	EXPECT_TRUE(stepped.showFrame(11));
+	EXPECT_FALSE(stepped.showFrame(2));
+	stepped.close();
+
+	// an interrupted recording has no index.
+	std::filesystem::resize_file(recorder.getFile(), std::filesystem::file_size(recorder.getFile()) - 1);
+	ASSERT_TRUE(FrameRecorder::readContainer(recorder.getFile(), info, frames));
+	EXPECT_EQ(frames.size(), 3);
+	std::filesystem::resize_file(recorder.getFile(), std::filesystem::file_size(recorder.getFile()) / 2);
+	ASSERT_TRUE(FrameRecorder::readContainer(recorder.getFile(), info, frames));
+	EXPECT_LT(frames.size(), 3);
+	std::filesystem::remove(recorder.getFile());
+	owl::core::Log::invalidate();
+}
+
+TEST(FrameRecorder, mjpegPassthrough) {
+	owl::core::Log::init(spdlog::level::off);
+	const auto file = std::filesystem::temp_directory_path() / "owl_record";
+	FrameRecorder recorder;
+	ASSERT_TRUE(recorder.start(file, Device::PixelFormat::MJpeg, {640, 480}));
+	EXPECT_EQ(recorder.getFile().extension(), ".mjpeg");
+	const std::vector<uint8_t> first{0xFF, 0xD8, 1, 2, 3, 0xFF, 0xD9};
+	const std::vector<uint8_t> second{0xFF, 0xD8, 4, 5, 0xFF, 0xD9};
+	EXPECT_TRUE(recorder.push(first.data(), first.size(), 0, std::chrono::steady_clock::now()));
+	EXPECT_TRUE(recorder.push(second.data(), second.size(), 1, std::chrono::steady_clock::now()));
+	recorder.stop();
+	auto expected = first;
+	expected.insert(expected.end(), second.begin(), second.end());
+	EXPECT_EQ(readFile(recorder.getFile()), expected);
+	FrameRecorder::ContainerInfo info;
+	std::vector<std::vector<uint8_t>> frames;
+	EXPECT_FALSE(FrameRecorder::readContainer(recorder.getFile(), info, frames));
+	std::filesystem::remove(recorder.getFile());
+	owl::core::Log::invalidate();
+}
+
+TEST(FrameRecorder, dropPolicy) {
+	owl::core::Log::init(spdlog::level::off);
+	const auto file = std::filesystem::temp_directory_path() / "owl_record_drop";
+	const owl::math::vec2ui size{640, 480};
+	const std::vector<uint8_t> frame(Device::getRawFrameSize(Device::PixelFormat::YuYv, size), 128);
+	FrameRecorder recorder({.queueSize = 2});
+	ASSERT_TRUE(recorder.start(file, Device::PixelFormat::YuYv, size));
+	constexpr uint64_t frames{64};
+	uint64_t accepted = 0;
+	for (uint64_t i = 0; i < frames; ++i)
+		if (recorder.push(frame.data(), frame.size(), i, std::chrono::steady_clock::now()))
+			++accepted;
+	recorder.stop();
+	const auto statistics = recorder.getStatistics();
+	EXPECT_EQ(statistics.pushed, accepted);
+	EXPECT_EQ(statistics.written, accepted);
+	EXPECT_EQ(statistics.pushed + statistics.dropped, frames);
+	EXPECT_LE(statistics.maxQueued, 2);
+	FrameRecorder::ContainerInfo info;
+	std::vector<std::vector<uint8_t>> recorded;
+	ASSERT_TRUE(FrameRecorder::readContainer(recorder.getFile(), info, recorded));
+	EXPECT_EQ(recorded.size(), accepted);
+	std::filesystem::remove(recorder.getFile());
+	owl::core::Log::invalidate();
+}
+
+TEST(FrameRecorder, stopWhilePushing) {
+	owl::core::Log::init(spdlog::level::off);
+	const auto file = std::filesystem::temp_directory_path() / "owl_record_stop";
+	const owl::math::vec2ui size{64, 32};
+	const std::vector<uint8_t> frame(Device::getRawFrameSize(Device::PixelFormat::YuYv, size), 128);
+	FrameRecorder recorder({.queueSize = 4});
+	for (uint32_t run = 0; run < 20; ++run) {
+		ASSERT_TRUE(recorder.start(file, Device::PixelFormat::YuYv, size));
+		std::atomic<bool> capturing{true};
+		std::thread capture([&] {
+			for (uint64_t sequence = 0; capturing.load(); ++sequence)
+				recorder.push(frame.data(), frame.size(), sequence, std::chrono::steady_clock::now());
+		});
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		recorder.stop();
+		capturing.store(false);
+		capture.join();
+		// every accepted frame is written before the index.
+		const auto statistics = recorder.getStatistics();
+		EXPECT_EQ(statistics.written, statistics.pushed);
+		FrameRecorder::ContainerInfo info;
+		std::vector<std::vector<uint8_t>> recorded;
+		ASSERT_TRUE(FrameRecorder::readContainer(recorder.getFile(), info, recorded));
+		EXPECT_EQ(recorded.size(), statistics.pushed);
+		EXPECT_EQ(statistics.bytes, std::filesystem::file_size(recorder.getFile()));
+	}
+	std::filesystem::remove(recorder.getFile());
+	owl::core::Log::invalidate();
+}
@@ -0,0 +1,124 @@
+#include "testHelper.h"
+
+#include <input/video/MJpegDecoder.h>
+
+using namespace owl::input::video;
+
+namespace {
+
+// 32x16 frame: red on the left half, green on the top half.
+constexpr std::array<uint8_t, 691> g_jpeg{
+		0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+		0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+		0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07,
+		0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d,
+		0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f,
+		0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03, 0x04,
+		0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14,
+		0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+		0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+		0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0,
+		0x00, 0x11, 0x08, 0x00, 0x10, 0x00, 0x20, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+		0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+		0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+		0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+		0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+		0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+		0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+		0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+		0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+		0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+		0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+		0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+		0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+		0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+		0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+		0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+		0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+		0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+		0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+		0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+		0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+		0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+		0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+		0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+		0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+		0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfa,
+		0xce, 0x8a, 0xf8, 0x12, 0x8a, 0xfc, 0xe3, 0xfd, 0x4f, 0xff, 0x00, 0xa8, 0x8f, 0xfc, 0x97, 0xff,
+		0x00, 0xb6, 0x3f, 0xa2, 0x7f, 0xd4, 0x2f, 0xfa, 0x89, 0xff, 0x00, 0xc9, 0x3f, 0xfb, 0x63, 0xd6,
+		0xe8, 0xaf, 0x81, 0x28, 0xaf, 0xd6, 0x3f, 0xd4, 0xff, 0x00, 0xfa, 0x88, 0xff, 0x00, 0xc9, 0x7f,
+		0xfb, 0x63, 0xfc, 0xf5, 0xff, 0x00, 0x50, 0xbf, 0xea, 0x27, 0xff, 0x00, 0x24, 0xff, 0x00, 0xed,
+		0x8f, 0xff, 0xd9};
+
+auto pixel(const std::vector<uint8_t>& iFrame, const owl::math::vec2ui& iSize, const uint32_t iX, const uint32_t iY)
+		-> owl::math::vec3ui {
+	const size_t index = (static_cast<size_t>(iY) * iSize.x() + iX) * 3;
+	return {iFrame[index], iFrame[index + 1], iFrame[index + 2]};
+}
+
+auto near(const owl::math::vec3ui& iColor, const owl::math::vec3ui& iExpected) -> bool {
+	constexpr uint32_t tolerance{16};
+	for (size_t channel = 0; channel < 3; ++channel) {
+		if (std::max(iColor[channel], iExpected[channel]) - std::min(iColor[channel], iExpected[channel]) > tolerance)
+			return false;
+	}
+	return true;
+}
+
+}// namespace
+
+TEST(MJpegDecoder, scales) {
+	EXPECT_EQ(getScaledSize({1920, 1080}, DecodeScale::Half), (owl::math::vec2ui{960, 540}));
+	EXPECT_EQ(getScaledSize({1920, 1080}, DecodeScale::Eighth), (owl::math::vec2ui{240, 135}));
+	EXPECT_EQ(getScaledSize({33, 17}, DecodeScale::Quarter), (owl::math::vec2ui{9, 5}));
+	EXPECT_EQ(chooseDecodeScale({1920, 1080}, {0, 0}), DecodeScale::Full);
+	EXPECT_EQ(chooseDecodeScale({1920, 1080}, {1280, 720}), DecodeScale::Full);
+	EXPECT_EQ(chooseDecodeScale({1920, 1080}, {900, 500}), DecodeScale::Half);
+	EXPECT_EQ(chooseDecodeScale({1920, 1080}, {480, 270}), DecodeScale::Quarter);
+	EXPECT_EQ(chooseDecodeScale({1920, 1080}, {100, 100}), DecodeScale::Eighth);
+}
+
+TEST(MJpegDecoder, decode) {
+	MJpegDecoder decoder;
+	std::vector<uint8_t> frame;
+	owl::math::vec2ui size;
+	ASSERT_TRUE(decoder.decode(g_jpeg.data(), g_jpeg.size(), DecodeScale::Full, false, frame, size));
+	EXPECT_EQ(size, (owl::math::vec2ui{32, 16}));
+	EXPECT_EQ(frame.size(), 32 * 16 * 3);
+	EXPECT_TRUE(near(pixel(frame, size, 2, 2), {220, 200, 100}));
+	EXPECT_TRUE(near(pixel(frame, size, 29, 13), {20, 40, 100}));
+	std::vector<uint8_t> mirrored;
+	ASSERT_TRUE(decoder.decode(g_jpeg.data(), g_jpeg.size(), DecodeScale::Full, true, mirrored, size));
+	EXPECT_EQ(pixel(mirrored, size, 0, 3), pixel(frame, size, 31, 3));
+	EXPECT_EQ(pixel(mirrored, size, 17, 9), pixel(frame, size, 14, 9));
+}
+
+TEST(MJpegDecoder, decodeScaled) {
+	MJpegDecoder decoder;
+	std::vector<uint8_t> frame;
+	owl::math::vec2ui size;
+	for (const auto scale: {DecodeScale::Half, DecodeScale::Quarter, DecodeScale::Eighth}) {
+		ASSERT_TRUE(decoder.decode(g_jpeg.data(), g_jpeg.size(), scale, true, frame, size));
+		EXPECT_EQ(size, getScaledSize({32, 16}, scale));
+		EXPECT_EQ(frame.size(), size.surface() * 3ull);
+		// mirrored: the red half is on the right.
+		EXPECT_TRUE(near(pixel(frame, size, size.x() - 1, 0), {220, 200, 100}));
+		EXPECT_TRUE(near(pixel(frame, size, 0, size.y() - 1), {20, 40, 100}));
+	}
+}
+
+TEST(MJpegDecoder, invalid) {
+	owl::core::Log::init(spdlog::level::off);
+	MJpegDecoder decoder;
+	std::vector<uint8_t> frame;
+	owl::math::vec2ui size;
+	const std::array<uint8_t, 4> garbage{0x12, 0x34, 0x56, 0x78};
+	EXPECT_FALSE(decoder.decode(garbage.data(), garbage.size(), DecodeScale::Full, false, frame, size));
+	EXPECT_FALSE(decoder.decode(g_jpeg.data(), g_jpeg.size() / 4, DecodeScale::Full, false, frame, size));
+	// the decoder is still usable.
+	EXPECT_TRUE(decoder.decode(g_jpeg.data(), g_jpeg.size(), DecodeScale::Half, false, frame, size));
+	owl::core::Log::invalidate();
+}
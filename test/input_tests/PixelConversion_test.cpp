@@ -0,0 +1,132 @@
+#include "testHelper.h"
+
+#include <debug/TrackerClient.h>
+#include <input/video/PixelConversion.h>
+#include <random>
+
+using namespace owl::input::video;
+
+namespace {
+
+auto randomFrame(const size_t iSize) -> std::vector<uint8_t> {
+	std::mt19937 generator{42};
+	std::uniform_int_distribution<uint32_t> distribution{0, 255};
+	std::vector<uint8_t> frame(iSize);
+	for (auto& byte: frame) byte = static_cast<uint8_t>(distribution(generator));
+	return frame;
+}
+
+auto convert(const std::vector<uint8_t>& iFrame, const owl::math::vec2ui& iSize, const bool iNv12,
+			 const ConversionParams& iParams) -> std::vector<uint8_t> {
+	std::vector<uint8_t> rgb(3ull * iSize.surface(), 0);
+	if (iNv12)
+		convertNv12ToRgb24(iFrame.data(), iSize, rgb.data(), iParams);
+	else
+		convertYuYvToRgb24(iFrame.data(), iSize, rgb.data(), iParams);
+	return rgb;
+}
+
+}// namespace
+
+TEST(PixelConversion, knownValues) {
+	const owl::math::vec2ui size{2, 2};
+	// black, white and saturated pixels.
+	std::vector<uint8_t> nv12{16, 235, 16, 235, 128, 128};
+	auto rgb = convert(nv12, size, true, {});
+	EXPECT_EQ(rgb[0], 0);
+	EXPECT_EQ(rgb[3], 255);
+	EXPECT_EQ(rgb[4], 255);
+	EXPECT_EQ(rgb[5], 255);
+	rgb = convert(nv12, size, true, {.mirror = true});
+	EXPECT_EQ(rgb[0], 255);
+	EXPECT_EQ(rgb[3], 0);
+	std::vector<uint8_t> yuyv{16, 128, 235, 128, 235, 0, 235, 255};
+	rgb = convert(yuyv, size, false, {});
+	EXPECT_EQ(rgb[0], 0);
+	EXPECT_EQ(rgb[3], 255);
+	EXPECT_EQ(rgb[6], 255);
+	EXPECT_EQ(rgb[8], 0);
+}
+
+TEST(PixelConversion, simdMatchesScalar) {
+	for (const owl::math::vec2ui size: {owl::math::vec2ui{2, 2}, owl::math::vec2ui{38, 6}, owl::math::vec2ui{64, 4},
+										owl::math::vec2ui{37, 5}}) {
+		const auto nv12 = randomFrame(size.surface() + 2ull * ((size.x() + 1) / 2) * ((size.y() + 1) / 2));
+		const auto yuyv = randomFrame(2ull * size.surface());
+		for (const bool mirror: {false, true}) {
+			EXPECT_EQ(convert(nv12, size, true, {.mirror = mirror, .kernel = ConversionKernel::Scalar}),
+					  convert(nv12, size, true, {.mirror = mirror, .kernel = ConversionKernel::Simd}));
+			if (size.x() % 2 == 1)
+				continue;
+			EXPECT_EQ(convert(yuyv, size, false, {.mirror = mirror, .kernel = ConversionKernel::Scalar}),
+					  convert(yuyv, size, false, {.mirror = mirror, .kernel = ConversionKernel::Simd}));
+		}
+	}
+}
+
+TEST(PixelConversion, threadsMatchSingleThread) {
+	const owl::math::vec2ui size{1920, 1080};
+	const auto nv12 = randomFrame(size.surface() * 3ull / 2);
+	const auto yuyv = randomFrame(2ull * size.surface());
+	const auto reference = convert(nv12, size, true, {.mirror = true, .threadCount = 1});
+	EXPECT_EQ(reference, convert(nv12, size, true, {.mirror = true, .threadCount = 3}));
+	EXPECT_EQ(reference, convert(nv12, size, true, {.mirror = true}));
+	EXPECT_EQ(convert(yuyv, size, false, {.threadCount = 1}), convert(yuyv, size, false, {.threadCount = 4}));
+	std::vector<uint8_t> mirrored(reference.size());
+	std::vector<uint8_t> back(reference.size());
+	copyRgb24(reference.data(), size, mirrored.data(), {.mirror = true, .threadCount = 4});
+	copyRgb24(mirrored.data(), size, back.data(), {.mirror = true, .threadCount = 1});
+	EXPECT_EQ(reference, back);
+	EXPECT_EQ(reference, convert(nv12, size, true, {.mirror = true, .kernel = ConversionKernel::Scalar}));
+}
+
+TEST(PixelConversion, consecutiveConversions) {
+	// small frames with changing band counts, so that the workers wake after the conversion is done.
+	const owl::math::vec2ui small{64, 8};
+	const owl::math::vec2ui large{64, 64};
+	const auto smallFrame = randomFrame(2ull * small.surface());
+	const auto largeFrame = randomFrame(2ull * large.surface());
+	const auto smallReference = convert(smallFrame, small, false, {.threadCount = 1});
+	const auto largeReference = convert(largeFrame, large, false, {.threadCount = 1});
+	for (uint32_t i = 0; i < 500; ++i) {
+		ASSERT_EQ(smallReference, convert(smallFrame, small, false, {.threadCount = 4}));
+		ASSERT_EQ(largeReference, convert(largeFrame, large, false, {.threadCount = 8}));
+	}
+}
+
+TEST(PixelConversion, noAllocation) {
+	const owl::math::vec2ui size{1920, 1080};
+	const auto yuyv = randomFrame(2ull * size.surface());
+	std::vector<uint8_t> rgb(3ull * size.surface());
+	std::vector<uint8_t> mirrored(rgb.size());
+	// the first parallel conversion starts the worker threads.
+	convertYuYvToRgb24(yuyv.data(), size, rgb.data(), {.threadCount = 4});
+	const size_t before = owl::debug::TrackerAPI::globals().allocationCalls;
+	for (uint32_t frame = 0; frame < 4; ++frame) {
+		convertNv12ToRgb24(yuyv.data(), size, rgb.data(), {.mirror = true, .threadCount = 4});
+		convertYuYvToRgb24(yuyv.data(), size, rgb.data(), {.threadCount = 4});
+		copyRgb24(rgb.data(), size, mirrored.data(), {.mirror = true, .threadCount = 4});
+	}
+	const size_t after = owl::debug::TrackerAPI::globals().allocationCalls;
+#ifndef OWL_SANITIZER_CUSTOM_ALLOCATOR
+	EXPECT_EQ(after, before);
+#endif
+}
+
+// Throughput measurement, the times are reported as test properties (--gtest_output=xml).
+TEST(PixelConversion, benchmark) {
+	const owl::math::vec2ui size{1920, 1080};
+	const auto nv12 = randomFrame(size.surface() * 3ull / 2);
+	std::vector<uint8_t> rgb(3ull * size.surface());
+	constexpr uint32_t frames{8};
+	RecordProperty("kernel", std::string{getSimdKernelName()});
+	for (const auto& [name, params]: {std::pair{"scalar", ConversionParams{.kernel = ConversionKernel::Scalar,
+																			 .threadCount = 1}},
+									  std::pair{"simd", ConversionParams{.threadCount = 1}},
+									  std::pair{"simd+threads", ConversionParams{}}}) {
+		const auto start = std::chrono::steady_clock::now();
+		for (uint32_t frame = 0; frame < frames; ++frame) convertNv12ToRgb24(nv12.data(), size, rgb.data(), params);
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		RecordProperty(fmt::format("nv12_1080p_{}_ms", name), fmt::format("{:.3f}", elapsed.count() / frames));
+	}
+}
@@ -0,0 +1,194 @@
+#include "testHelper.h"
+
+#include <input/serial/MspLink.h>
+
+#ifdef OWL_PLATFORM_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace owl::input::serial;
+
+namespace {
+
+struct Received {
+	uint16_t command = 0;
+	MspDirection direction = MspDirection::Request;
+	uint8_t version = 0;
+	std::vector<uint8_t> payload;
+};
+
+auto makeParser(std::vector<Received>& oReceived) -> MspParser {
+	return MspParser([&oReceived](const MspFrame& iFrame) {
+		oReceived.push_back({.command = iFrame.command,
+							 .direction = iFrame.direction,
+							 .version = iFrame.version,
+							 .payload = {iFrame.payload.begin(), iFrame.payload.end()}});
+	});
+}
+
+}// namespace
+
+TEST(Serial, ringBuffer) {
+	RingBuffer ring(5);
+	EXPECT_EQ(ring.getCapacity(), 8);
+	EXPECT_EQ(ring.getSize(), 0);
+	auto writable = ring.getWritable();
+	EXPECT_EQ(writable[0].size(), 8);
+	EXPECT_TRUE(writable[1].empty());
+	std::ranges::fill(writable[0].first(6), 1);
+	ring.commit(6);
+	EXPECT_EQ(ring.getSize(), 6);
+	ring.consume(6);
+	// the free space wraps.
+	writable = ring.getWritable();
+	EXPECT_EQ(writable[0].size(), 2);
+	EXPECT_EQ(writable[1].size(), 6);
+	writable[0][0] = 10;
+	writable[0][1] = 11;
+	writable[1][0] = 12;
+	ring.commit(3);
+	const auto readable = ring.getReadable();
+	ASSERT_EQ(readable[0].size(), 2);
+	ASSERT_EQ(readable[1].size(), 1);
+	EXPECT_EQ(readable[0][0], 10);
+	EXPECT_EQ(readable[0][1], 11);
+	EXPECT_EQ(readable[1][0], 12);
+	ring.consume(3);
+	EXPECT_EQ(ring.getSize(), 0);
+	ring.resize(20);
+	EXPECT_EQ(ring.getCapacity(), 32);
+	EXPECT_EQ(ring.getWritable()[0].size(), 32);
+}
+
+TEST(Serial, mspRoundTrip) {
+	std::vector<Received> received;
+	auto parser = makeParser(received);
+	std::vector<uint8_t> stream;
+	const std::vector<uint8_t> small{1, 2, 3};
+	std::vector<uint8_t> large(300);
+	std::iota(large.begin(), large.end(), uint8_t{0});
+	MspParser::encode(108, small, MspDirection::Response, stream);
+	EXPECT_EQ(stream.size(), 9);
+	EXPECT_EQ(stream[1], 'M');
+	MspParser::encode(0x1001, {}, MspDirection::Request, stream);
+	MspParser::encode(5, large, MspDirection::Error, stream);
+	// garbage between messages is skipped.
+	stream.insert(stream.begin() + 9, {'x', '$', '$'});
+	// byte by byte, then in a single call.
+	for (const uint8_t byte: stream) parser.parse({&byte, 1});
+	parser.parse(stream);
+	ASSERT_EQ(received.size(), 6);
+	EXPECT_EQ(parser.getFrameCount(), 6);
+	EXPECT_EQ(parser.getErrorCount(), 0);
+	for (size_t i = 0; i < 6; i += 3) {
+		EXPECT_EQ(received[i].command, 108);
+		EXPECT_EQ(received[i].version, 1);
+		EXPECT_EQ(received[i].direction, MspDirection::Response);
+		EXPECT_EQ(received[i].payload, small);
+		EXPECT_EQ(received[i + 1].command, 0x1001);
+		EXPECT_EQ(received[i + 1].version, 2);
+		EXPECT_EQ(received[i + 1].direction, MspDirection::Request);
+		EXPECT_TRUE(received[i + 1].payload.empty());
+		EXPECT_EQ(received[i + 2].command, 5);
+		EXPECT_EQ(received[i + 2].version, 2);
+		EXPECT_EQ(received[i + 2].direction, MspDirection::Error);
+		EXPECT_EQ(received[i + 2].payload, large);
+	}
+}
+
+TEST(Serial, mspErrors) {
+	std::vector<Received> received;
+	auto parser = makeParser(received);
+	std::vector<uint8_t> stream;
+	MspParser::encode(109, std::vector<uint8_t>{1, 2, 3, 4}, MspDirection::Response, stream);
+	stream.back() ^= 0xFFu;
+	MspParser::encode(1000, std::vector<uint8_t>{1, 2}, MspDirection::Response, stream);
+	stream.back() ^= 0xFFu;
+	// oversized payload.
+	stream.insert(stream.end(), {'$', 'X', '>', 0, 1, 0, 0xFF, 0xFF});
+	MspParser::encode(110, {}, MspDirection::Response, stream);
+	parser.parse(stream);
+	EXPECT_EQ(parser.getErrorCount(), 3);
+	ASSERT_EQ(received.size(), 1);
+	EXPECT_EQ(received[0].command, 110);
+	parser.reset();
+	parser.parse(std::span(stream).first(3));
+	parser.reset();
+	parser.parse(std::span(stream).last(6));
+	EXPECT_EQ(received.size(), 2);
+}
+
+#ifdef OWL_PLATFORM_LINUX
+TEST(Serial, ptyLink) {
+	owl::core::Log::init(spdlog::level::off);
+	// the flight controller simulator writes on the master side of a pseudo terminal.
+	const int master = posix_openpt(O_RDWR | O_NOCTTY);
+	ASSERT_GE(master, 0);
+	ASSERT_EQ(grantpt(master), 0);
+	ASSERT_EQ(unlockpt(master), 0);
+	const std::string slave = ptsname(master);
+
+	std::atomic<uint64_t> attitudes{0};
+	std::atomic<uint64_t> lastValue{0};
+	MspLink link([&](const MspFrame& iFrame) {
+		if (iFrame.command != 108 || iFrame.payload.size() != sizeof(uint64_t))
+			return;
+		uint64_t value = 0;
+		std::memcpy(&value, iFrame.payload.data(), sizeof(uint64_t));
+		lastValue.store(value, std::memory_order_relaxed);
+		attitudes.fetch_add(1, std::memory_order_relaxed);
+	});
+	EXPECT_FALSE(link.open({.port = "/dev/owl_no_port", .baudRate = 115200, .requests = {}, .requestRate = 0.f,
+							.bufferSize = 64}));
+	ASSERT_TRUE(link.open({.port = slave, .baudRate = 115200, .requests = {108}, .requestRate = 200.f,
+						   .bufferSize = 64}));
+	EXPECT_TRUE(link.isOpened());
+
+	// a burst larger than the ring buffer, at a 1 kHz telemetry rate.
+	constexpr uint64_t count{1000};
+	std::vector<uint8_t> stream;
+	for (uint64_t i = 1; i <= count; ++i) {
+		std::array<uint8_t, sizeof(uint64_t)> payload{};
+		std::memcpy(payload.data(), &i, sizeof(uint64_t));
+		MspParser::encode(108, payload, MspDirection::Response, stream);
+	}
+	const size_t messageSize = stream.size() / count;
+	const auto start = std::chrono::steady_clock::now();
+	for (size_t offset = 0; offset < stream.size(); offset += 10 * messageSize) {
+		const size_t size = std::min(10 * messageSize, stream.size() - offset);
+		ASSERT_EQ(write(master, std::span(stream).subspan(offset, size).data(), size), static_cast<ssize_t>(size));
+		std::this_thread::sleep_until(start + std::chrono::milliseconds(offset / messageSize));
+	}
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (attitudes.load() < count && std::chrono::steady_clock::now() < deadline)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	EXPECT_EQ(attitudes.load(), count);
+	EXPECT_EQ(lastValue.load(), count);
+
+	// the requests of the link reach the simulator.
+	std::array<uint8_t, 64> request{};
+	const ssize_t requestSize = read(master, request.data(), request.size());
+	ASSERT_GE(requestSize, 6);
+	EXPECT_EQ(request[0], '$');
+	EXPECT_EQ(request[1], 'M');
+	EXPECT_EQ(request[2], '<');
+	EXPECT_EQ(request[4], 108);
+
+	const auto statistics = link.getStatistics();
+	EXPECT_EQ(statistics.bytes, stream.size());
+	EXPECT_EQ(statistics.frames, count);
+	EXPECT_EQ(statistics.errors, 0);
+	EXPECT_GT(statistics.requests, 0);
+
+	// closing the simulator side loses the link.
+	close(master);
+	const auto lostDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+	while (!link.isLost() && std::chrono::steady_clock::now() < lostDeadline)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	EXPECT_TRUE(link.isLost());
+	link.close();
+	EXPECT_FALSE(link.isOpened());
+	owl::core::Log::invalidate();
+}
+#endif
@@ -0,0 +1,161 @@
+#include "testHelper.h"
+
+#include <event/AppEvent.h>
+#include <event/KeyEvent.h>
+#include <event/MouseEvent.h>
+#include <input/session/SessionReader.h>
+
+using namespace owl::input::session;
+
+namespace {
+
+struct State {
+	float altitude = 0;
+	uint32_t frame = 0;
+};
+
+}// namespace
+
+TEST(Session, roundTrip) {
+	owl::core::Log::init(spdlog::level::off);
+	const auto file = std::filesystem::temp_directory_path() / "owl_session.tmp";
+	SessionWriter writer;
+	EXPECT_FALSE(writer.pushValue(1, std::chrono::steady_clock::now(), State{}));
+	ASSERT_TRUE(writer.start(file));
+	EXPECT_TRUE(writer.isRecording());
+	EXPECT_EQ(writer.getFile().extension(), g_sessionExtension);
+	const auto start = writer.getStart();
+	for (uint32_t i = 0; i < 10; ++i) {
+		const auto time = start + std::chrono::milliseconds(10 * i);
+		EXPECT_TRUE(writer.pushValue(1, time, State{.altitude = static_cast<float>(i) * 0.5f, .frame = i}));
+		if (i % 3 == 0) {
+			EventPayload payload;
+			ASSERT_TRUE(SessionWriter::encodeEvent(owl::event::MouseMovedEvent(static_cast<float>(i), 2.f), payload));
+			EXPECT_TRUE(writer.pushValue(2, time, payload));
+		}
+	}
+	EventPayload payload;
+	ASSERT_TRUE(SessionWriter::encodeEvent(owl::event::KeyPressedEvent(owl::input::key::A, 3), payload));
+	// pushed late, but timed before the end.
+	EXPECT_TRUE(writer.pushValue(2, start + std::chrono::milliseconds(45), payload));
+	EXPECT_TRUE(writer.push(3, start + std::chrono::milliseconds(90), {}));
+	writer.stop();
+	EXPECT_FALSE(writer.isRecording());
+	const auto statistics = writer.getStatistics();
+	EXPECT_EQ(statistics.records, 16);
+	EXPECT_EQ(statistics.dropped, 0);
+	EXPECT_EQ(statistics.bytes, std::filesystem::file_size(writer.getFile()));
+
+	SessionReader reader;
+	ASSERT_TRUE(reader.open(writer.getFile()));
+	ASSERT_EQ(reader.getRecords().size(), 16);
+	EXPECT_EQ(reader.getDuration(), std::chrono::milliseconds(90));
+	EXPECT_LE(reader.getStartTime(), std::chrono::system_clock::now());
+	// replay with a clock.
+	auto records = reader.advanceTo(std::chrono::milliseconds(25));
+	ASSERT_EQ(records.size(), 4);
+	State state;
+	EXPECT_TRUE(SessionReader::readValue(records[0], state));
+	EXPECT_EQ(state.frame, 0);
+	EXPECT_FALSE(SessionReader::readValue(records[0], payload));
+	EXPECT_EQ(records[1].type, 2);
+	const auto moved = SessionReader::decodeEvent(records[1]);
+	ASSERT_NE(moved, nullptr);
+	ASSERT_EQ(moved->getType(), owl::event::Type::MouseMoved);
+	EXPECT_FLOAT_EQ(static_cast<const owl::event::MouseMovedEvent&>(*moved).getY(), 2.f);
+	// replay as fast as possible, one time after the other.
+	records = reader.advance();
+	ASSERT_EQ(records.size(), 2);
+	EXPECT_EQ(records[0].timestamp, std::chrono::milliseconds(30));
+	records = reader.advance();
+	ASSERT_EQ(records.size(), 1);
+	EXPECT_TRUE(SessionReader::readValue(records[0], state));
+	EXPECT_EQ(state.frame, 4);
+	records = reader.advance();
+	ASSERT_EQ(records.size(), 1);
+	const auto key = SessionReader::decodeEvent(records[0]);
+	ASSERT_NE(key, nullptr);
+	ASSERT_EQ(key->getType(), owl::event::Type::KeyPressed);
+	EXPECT_EQ(static_cast<const owl::event::KeyPressedEvent&>(*key).getKeyCode(), owl::input::key::A);
+	EXPECT_EQ(static_cast<const owl::event::KeyPressedEvent&>(*key).getRepeatCount(), 3);
+	records = reader.advanceTo(std::chrono::seconds(1));
+	EXPECT_EQ(records.size(), 8);
+	EXPECT_EQ(records.back().type, 3);
+	EXPECT_TRUE(records.back().payload.empty());
+	EXPECT_TRUE(reader.isFinished());
+	reader.rewind();
+	EXPECT_FALSE(reader.isFinished());
+	EXPECT_EQ(reader.getNextTime(), std::chrono::milliseconds(0));
+
+	// an interrupted session is read up to its last complete record.
+	std::filesystem::resize_file(writer.getFile(), std::filesystem::file_size(writer.getFile()) - 1);
+	ASSERT_TRUE(reader.open(writer.getFile()));
+	EXPECT_EQ(reader.getRecords().size(), 15);
+	std::filesystem::resize_file(writer.getFile(), 4);
+	EXPECT_FALSE(reader.open(writer.getFile()));
+	std::filesystem::remove(writer.getFile());
+	owl::core::Log::invalidate();
+}
+
+TEST(Session, events) {
+	EventPayload payload;
+	EXPECT_FALSE(SessionWriter::encodeEvent(owl::event::WindowCloseEvent(), payload));
+	const owl::event::MouseButtonReleasedEvent released(owl::input::mouse::ButtonLeft);
+	ASSERT_TRUE(SessionWriter::encodeEvent(released, payload));
+	std::vector<uint8_t> bytes(sizeof(payload));
+	std::memcpy(bytes.data(), &payload, sizeof(payload));
+	const auto event = SessionReader::decodeEvent({.type = 0, .timestamp = {}, .payload = bytes});
+	ASSERT_NE(event, nullptr);
+	ASSERT_EQ(event->getType(), owl::event::Type::MouseButtonReleased);
+	EXPECT_EQ(static_cast<const owl::event::MouseButtonEvent&>(*event).getMouseButton(), owl::input::mouse::ButtonLeft);
+	EXPECT_EQ(SessionReader::decodeEvent({.type = 0, .timestamp = {}, .payload = {}}), nullptr);
+}
+
+TEST(Session, dropPolicy) {
+	owl::core::Log::init(spdlog::level::off);
+	const auto file = std::filesystem::temp_directory_path() / "owl_session_drop.tmp";
+	// the writer is only woken periodically: the small buffer fills up.
+	SessionWriter writer({.chunkSize = 256, .maxPending = 256, .flushPeriod = std::chrono::seconds(10)});
+	ASSERT_TRUE(writer.start(file));
+	const std::array<uint8_t, 100> data{};
+	uint64_t accepted = 0;
+	for (uint32_t i = 0; i < 1000; ++i)
+		accepted += writer.push(1, std::chrono::steady_clock::now(), data) ? 1 : 0;
+	writer.stop();
+	const auto statistics = writer.getStatistics();
+	EXPECT_EQ(statistics.records, accepted);
+	EXPECT_EQ(statistics.records + statistics.dropped, 1000);
+	SessionReader reader;
+	ASSERT_TRUE(reader.open(writer.getFile()));
+	EXPECT_EQ(reader.getRecords().size(), accepted);
+	std::filesystem::remove(writer.getFile());
+	owl::core::Log::invalidate();
+}
+
+TEST(Session, concurrentWriters) {
+	owl::core::Log::init(spdlog::level::off);
+	const auto file = std::filesystem::temp_directory_path() / "owl_session_threads.tmp";
+	SessionWriter writer({.chunkSize = 4096, .maxPending = 16ull << 20u, .flushPeriod = std::chrono::milliseconds(5)});
+	ASSERT_TRUE(writer.start(file));
+	constexpr uint32_t count{5000};
+	{
+		std::jthread other([&writer] {
+			for (uint32_t i = 0; i < count; ++i) writer.pushValue(2, std::chrono::steady_clock::now(), i);
+		});
+		for (uint32_t i = 0; i < count; ++i) writer.pushValue(1, std::chrono::steady_clock::now(), i);
+	}
+	writer.stop();
+	EXPECT_EQ(writer.getStatistics().dropped, 0);
+	SessionReader reader;
+	ASSERT_TRUE(reader.open(writer.getFile()));
+	ASSERT_EQ(reader.getRecords().size(), 2 * count);
+	std::array<uint32_t, 2> next{};
+	for (const auto& record: reader.getRecords()) {
+		uint32_t value = 0;
+		ASSERT_TRUE(SessionReader::readValue(record, value));
+		// each thread keeps its order.
+		ASSERT_EQ(value, next.at(record.type - 1u)++);
+	}
+	std::filesystem::remove(writer.getFile());
+	owl::core::Log::invalidate();
+}
@@ -0,0 +1,80 @@
+#include "testHelper.h"
+
+#include <debug/FrameProfiler.h>
+#include <renderer/utils/GpuScopeRecorder.h>
+
+using namespace owl::renderer::utils;
+using namespace owl::debug;
+
+TEST(GpuScopeRecorder, nesting) {
+	GpuScopeRecorder recorder;
+	EXPECT_FALSE(recorder.hasTimestamps());
+	EXPECT_EQ(recorder.begin(1, true), 0);
+	EXPECT_EQ(recorder.begin(2, true), 2);
+	EXPECT_FALSE(recorder.isComplete(1));
+	EXPECT_EQ(recorder.end(true), 3);
+	EXPECT_TRUE(recorder.isComplete(1));
+	EXPECT_FALSE(recorder.isComplete(0));
+	EXPECT_EQ(recorder.end(true), 1);
+	EXPECT_TRUE(recorder.isComplete(0));
+	EXPECT_FALSE(recorder.end(true).has_value());
+	EXPECT_TRUE(recorder.hasTimestamps());
+	EXPECT_EQ(recorder.getQueryCount(), 4);
+	recorder.reset();
+	EXPECT_FALSE(recorder.hasTimestamps());
+}
+
+TEST(GpuScopeRecorder, notWritable) {
+	GpuScopeRecorder recorder;
+	// a scope opened outside of a command buffer is not recorded, its inner scopes are.
+	EXPECT_FALSE(recorder.begin(1, false).has_value());
+	EXPECT_EQ(recorder.begin(2, true), 0);
+	EXPECT_EQ(recorder.end(true), 1);
+	EXPECT_FALSE(recorder.end(true).has_value());
+	// a scope closed outside of a command buffer is incomplete.
+	EXPECT_EQ(recorder.begin(3, true), 2);
+	EXPECT_FALSE(recorder.end(false).has_value());
+	EXPECT_TRUE(recorder.isComplete(0));
+	EXPECT_FALSE(recorder.isComplete(1));
+}
+
+TEST(GpuScopeRecorder, full) {
+	GpuScopeRecorder recorder;
+	for (uint32_t i = 0; i < g_maxGpuScopes; ++i) {
+		EXPECT_TRUE(recorder.begin(i, true).has_value());
+		EXPECT_TRUE(recorder.end(true).has_value());
+	}
+	EXPECT_FALSE(recorder.begin(0, true).has_value());
+	EXPECT_FALSE(recorder.end(true).has_value());
+	EXPECT_EQ(recorder.getQueryCount(), g_gpuQueriesPerFrame);
+}
+
+TEST(GpuScopeRecorder, publish) {
+	owl::core::Log::init(spdlog::level::off);
+	FrameProfiler::reset();
+	FrameProfiler::setEnabled(true);
+	FrameProfiler::frame();
+	const uint32_t outer = Profiler::get().internName("gpu outer");
+	const uint32_t inner = Profiler::get().internName("gpu inner");
+	GpuScopeRecorder recorder;
+	std::ignore = recorder.begin(outer, true);
+	std::ignore = recorder.begin(inner, true);
+	std::ignore = recorder.end(true);
+	std::ignore = recorder.begin(inner, true);
+	std::ignore = recorder.end(false);
+	std::ignore = recorder.end(true);
+	const std::vector<uint64_t> timestamps{1'000'000, 4'000'000, 1'500'000, 2'000'000, 2'500'000, 0};
+	recorder.publish(timestamps);
+	FrameProfiler::frame();
+	const auto frame = FrameProfiler::getLastFrame();
+	ASSERT_EQ(frame.gpuScopes.size(), 2);
+	EXPECT_EQ(frame.gpuScopes[0].nameId, outer);
+	EXPECT_EQ(frame.gpuScopes[0].depth, 0);
+	EXPECT_NEAR(frame.gpuScopes[0].duration, 3.0, 1e-9);
+	EXPECT_EQ(frame.gpuScopes[1].nameId, inner);
+	EXPECT_EQ(frame.gpuScopes[1].depth, 1);
+	EXPECT_NEAR(frame.gpuScopes[1].duration, 0.5, 1e-9);
+	FrameProfiler::setEnabled(false);
+	FrameProfiler::frame();
+	owl::core::Log::invalidate();
+}
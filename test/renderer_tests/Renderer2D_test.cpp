@@ -109,6 +109,30 @@ TEST(Renderer2D, fakeQuadSpriteScene) {
 	Log::invalidate();
 }
 
+TEST(Renderer2D, fakeVideoScene) {
+	Log::init(spdlog::level::off);
+	RenderCommand::create(RenderAPI::Type::Null);
+	Renderer::init();
+	const CameraEditor cam;
+	Renderer2D::resetStats();
+	Renderer2D::beginScene(cam);
+	const Transform tr{{0.f, 0.f, 0.f}, {0, 0, 180.f}, {-1.f, 1.f, 0}};
+	const auto luma = Texture2D::create(Texture2D::Specification{.size = {4, 2}, .format = ImageFormat::R8});
+	const auto chroma = Texture2D::create(Texture2D::Specification{.size = {2, 1}, .format = ImageFormat::RG8});
+	const auto packed = Texture2D::create(Texture2D::Specification{.size = {4, 2}, .format = ImageFormat::RG8});
+	Renderer2D::drawQuad({.transform = tr, .texture = luma, .yuvLayout = YuvLayout::Nv12, .chromaTexture = chroma});
+	Renderer2D::drawQuad({.transform = tr, .texture = packed, .yuvLayout = YuvLayout::YuYv});
+	Renderer2D::drawQuad({.transform = tr, .texture = packed});
+	Renderer2D::endScene();
+	const auto st = Renderer2D::getStats();
+	// quads and video quads are drawn separately.
+	EXPECT_EQ(st.drawCalls, 2);
+	EXPECT_EQ(st.quadCount, 3);
+
+	RenderCommand::invalidate();
+	Log::invalidate();
+}
+
 TEST(Renderer2D, fakeTextScene) {
 	Log::init(spdlog::level::off);
 	auto app = owl::mkShared<Application>(
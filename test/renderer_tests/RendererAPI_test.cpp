@@ -27,6 +27,8 @@ TEST(RenderAPI, RenderComamand) {
 	RenderCommand::endTextureLoad();
 	RenderCommand::beginFrame();
 	RenderCommand::beginBatch();
+	EXPECT_FALSE(RenderCommand::hasGpuTimers());
+	{ OWL_GPU_SCOPE("null") }
 	RenderCommand::endBatch();
 	RenderCommand::endFrame();
 	RenderCommand::invalidate();
@@ -0,0 +1,102 @@
+#include "testHelper.h"
+
+#include <renderer/utils/ShaderCache.h>
+
+using namespace owl::renderer;
+using namespace owl::renderer::utils;
+
+TEST(ShaderCache, memoryOnly) {
+	owl::core::Log::init(spdlog::level::off);
+	auto& cache = ShaderCache::get();
+	cache.close();
+	EXPECT_TRUE(cache.getFile().empty());
+	EXPECT_EQ(cache.size(), 0);
+	EXPECT_FALSE(cache.find(42).has_value());
+	cache.store(42, {1, 2, 3});
+	EXPECT_TRUE(cache.contains(42));
+	const auto data = cache.find(42);
+	ASSERT_TRUE(data.has_value());
+	EXPECT_EQ(data->size(), 3);
+	EXPECT_EQ(data->back(), 3);
+	EXPECT_TRUE(cache.save());
+	cache.close();
+	EXPECT_EQ(cache.size(), 0);
+	owl::core::Log::invalidate();
+}
+
+TEST(ShaderCache, compileMisses) {
+	owl::core::Log::init(spdlog::level::off);
+	auto& cache = ShaderCache::get();
+	cache.close();
+	cache.store(1, {10});
+	std::atomic<uint32_t> compiled{0};
+	std::vector<ShaderCompileJob> jobs;
+	for (uint32_t i = 1; i < 5; ++i) {
+		jobs.push_back({.key = i,
+						.stage = ShaderType::Vertex,
+						.name = fmt::format("job{}", i),
+						.compile = [i, &compiled]() -> std::optional<std::vector<uint32_t>> {
+							++compiled;
+							if (i == 4)
+								return std::nullopt;
+							return std::vector{i * 100};
+						}});
+	}
+	const auto results = cache.getOrCompile(jobs);
+	ASSERT_EQ(results.size(), 4);
+	EXPECT_EQ(compiled, 3);
+	EXPECT_EQ(results[0].front(), 10);
+	EXPECT_EQ(results[1].front(), 200);
+	EXPECT_EQ(results[2].front(), 300);
+	EXPECT_TRUE(results[3].empty());
+	EXPECT_FALSE(cache.contains(4));
+	// second pass only hits the cache.
+	compiled = 0;
+	EXPECT_EQ(cache.getOrCompile(jobs[2]).front(), 300);
+	EXPECT_EQ(compiled, 0);
+	cache.close();
+	owl::core::Log::invalidate();
+}
+
+TEST(ShaderCache, saveLoad) {
+	owl::core::Log::init(spdlog::level::off);
+	const auto file = std::filesystem::temp_directory_path() / "owl_shader_test.cache";
+	if (exists(file))
+		std::filesystem::remove(file);
+	auto& cache = ShaderCache::get();
+	cache.open(file);
+	EXPECT_EQ(cache.getFile(), file);
+	EXPECT_EQ(cache.size(), 0);
+	cache.store(7, {7, 7});
+	cache.store(8, {8, 8, 8});
+	cache.close();
+	ASSERT_TRUE(exists(file));
+	cache.open(file);
+	EXPECT_EQ(cache.size(), 2);
+	{
+		const auto data = cache.find(8);
+		ASSERT_TRUE(data.has_value());
+		EXPECT_EQ(data->size(), 3);
+		EXPECT_EQ(data->front(), 8);
+	}
+	// rewriting the file keeps the entries not read yet.
+	cache.store(9, {9});
+	EXPECT_TRUE(cache.save());
+	cache.open(file);
+	EXPECT_EQ(cache.size(), 3);
+	{
+		const auto data = cache.find(7);
+		ASSERT_TRUE(data.has_value());
+		EXPECT_EQ(data->size(), 2);
+	}
+	cache.close();
+	{
+		std::ofstream out(file, std::ios::out | std::ios::binary);
+		out << "garbage";
+	}
+	cache.open(file);
+	EXPECT_EQ(cache.size(), 0);
+	cache.close();
+	std::filesystem::remove(file);
+	owl::core::Log::invalidate();
+}
@@ -0,0 +1,104 @@
+#include "testHelper.h"
+
+#include <renderer/RenderCommand.h>
+#include <renderer/null/Texture.h>
+#include <renderer/utils/TextureCooker.h>
+
+using namespace owl::renderer;
+using namespace owl::renderer::utils;
+
+TEST(TextureCooker, mipLevels) {
+	EXPECT_EQ(getMipLevelCount({0, 0}), 0);
+	EXPECT_EQ(getMipLevelCount({1, 1}), 1);
+	EXPECT_EQ(getMipLevelCount({256, 256}), 9);
+	EXPECT_EQ(getMipLevelCount({300, 20}), 9);
+	const auto size = getMipLevelSize({300, 20}, 5);
+	EXPECT_EQ(size.x(), 9);
+	EXPECT_EQ(size.y(), 1);
+}
+
+TEST(TextureCooker, mipChain) {
+	CookedImage image;
+	image.specification.size = {4, 2};
+	image.specification.format = ImageFormat::R8;
+	image.levels.push_back({0, 4, 8, 12, 4, 8, 12, 16});
+	generateMipChain(image);
+	ASSERT_EQ(image.levels.size(), 3);
+	ASSERT_EQ(image.levels[1].size(), 2);
+	EXPECT_EQ(image.levels[1][0], 4);
+	EXPECT_EQ(image.levels[1][1], 12);
+	ASSERT_EQ(image.levels[2].size(), 1);
+	EXPECT_EQ(image.levels[2][0], 8);
+}
+
+TEST(TextureCooker, writeRead) {
+	owl::core::Log::init(spdlog::level::off);
+	const auto file = std::filesystem::temp_directory_path() / "owl_cook_test.otex";
+	CookedImage image;
+	image.cookKey = 0x1234;
+	image.specification.size = {2, 2};
+	image.specification.format = ImageFormat::RGBA8;
+	image.levels.emplace_back(16, 0x7f);
+	generateMipChain(image);
+	ASSERT_TRUE(writeCookedImage(file, image));
+	{
+		const auto header = readCookedImage(file, true);
+		ASSERT_TRUE(header.has_value());
+		EXPECT_EQ(header->cookKey, 0x1234);
+		EXPECT_TRUE(header->levels.empty());
+	}
+	{
+		const auto loaded = readCookedImage(file);
+		ASSERT_TRUE(loaded.has_value());
+		EXPECT_EQ(loaded->specification.format, ImageFormat::RGBA8);
+		EXPECT_EQ(loaded->specification.size.x(), 2);
+		ASSERT_EQ(loaded->levels.size(), 2);
+		EXPECT_EQ(loaded->levels[1].size(), 4);
+		EXPECT_EQ(loaded->levels[1][0], 0x7f);
+	}
+	{
+		const null::Texture2D tex(file);
+		EXPECT_TRUE(tex.isLoaded());
+		EXPECT_EQ(tex.getSpecification().size.y(), 2);
+	}
+	std::filesystem::remove(file);
+	EXPECT_FALSE(readCookedImage(file).has_value());
+	owl::core::Log::invalidate();
+}
+
+TEST(TextureCooker, reproducible) {
+	owl::core::Log::init(spdlog::level::off);
+	const auto file = std::filesystem::temp_directory_path() / "owl_cook_reproducible.otex";
+	CookedImage image;
+	image.cookKey = 0x5678;
+	image.specification.size = {1, 1};
+	image.specification.format = ImageFormat::R8;
+	image.levels.emplace_back(1, 0x42);
+	const auto readBytes = [&file] {
+		std::ifstream in(file, std::ios::in | std::ios::binary);
+		return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	};
+	ASSERT_TRUE(writeCookedImage(file, image));
+	const auto first = readBytes();
+	ASSERT_TRUE(writeCookedImage(file, image));
+	EXPECT_EQ(readBytes(), first);
+	std::filesystem::remove(file);
+	owl::core::Log::invalidate();
+}
+
+TEST(TextureCooker, newerSource) {
+	const auto cooked = std::filesystem::temp_directory_path() / "owl_cook_stale.otex";
+	const auto source = std::filesystem::temp_directory_path() / "owl_cook_stale.png";
+	std::ofstream(cooked) << "cooked";
+	std::ofstream(source) << "source";
+	const auto now = std::filesystem::last_write_time(cooked);
+	std::filesystem::last_write_time(source, now - std::chrono::hours(1));
+	EXPECT_FALSE(findNewerSource(cooked).has_value());
+	std::filesystem::last_write_time(source, now + std::chrono::hours(1));
+	const auto newer = findNewerSource(cooked);
+	ASSERT_TRUE(newer.has_value());
+	EXPECT_EQ(newer.value(), source);
+	std::filesystem::remove(cooked);
+	std::filesystem::remove(source);
+	EXPECT_FALSE(findNewerSource(cooked).has_value());
+}
@@ -31,6 +31,8 @@ TEST(TextureSpecifications, PixelSize) {
 	EXPECT_EQ(spec.getPixelSize(), 4);
 	spec.format = ImageFormat::RGBA32F;
 	EXPECT_EQ(spec.getPixelSize(), 16);
+	spec.format = ImageFormat::RG8;
+	EXPECT_EQ(spec.getPixelSize(), 2);
 }
 
 TEST(Texture, CreateFromString) {